@@ -0,0 +1,141 @@
+#include "unicpp/batch.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace unicpp {
+namespace {
+
+template <class Offset, class String>
+std::vector<Offset> MakeBatch(const std::vector<String>& strings,
+                              String* data) {
+  std::vector<Offset> offsets = {0};
+  for (const String& string : strings) {
+    *data += string;
+    offsets.push_back(static_cast<Offset>(data->size()));
+  }
+  return offsets;
+}
+
+template <class String, class Offset>
+std::vector<String> SplitBatch(const String& data,
+                               const std::vector<Offset>& offsets) {
+  std::vector<String> strings;
+  for (size_t i = 0; i + 1 < offsets.size(); i++) {
+    strings.push_back(data.substr(offsets[i], offsets[i + 1] - offsets[i]));
+  }
+  return strings;
+}
+
+const std::vector<std::string> kValidUtf8 = {
+    "", "tag", "caf\xC3\xA9", "\xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80", "",
+    std::string(100, 'a') + "\xE2\x82\xAC"};
+
+TEST(Batch, ValidStrings) {
+  std::string data;
+  auto offsets = MakeBatch<int32_t>(kValidUtf8, &data);
+  std::vector<int32_t> utf16_offsets(offsets.size());
+  std::u16string utf16;
+  BatchSummary summary = Utf16BatchFromUtf8(
+      offsets.data(), kValidUtf8.size(),
+      reinterpret_cast<const uint8_t*>(data.data()), utf16_offsets.data(),
+      utf16);
+  EXPECT_EQ(summary.num_invalid_strings, 0);
+  EXPECT_EQ(summary.first_invalid_string, kValidUtf8.size());
+  EXPECT_FALSE(summary.overflow);
+  EXPECT_EQ(utf16, Utf16StringFromUtf8<std::u16string>(data));
+  auto utf16_strings = SplitBatch(utf16, utf16_offsets);
+  for (size_t i = 0; i < kValidUtf8.size(); i++) {
+    EXPECT_EQ(utf16_strings[i],
+              Utf16StringFromUtf8<std::u16string>(kValidUtf8[i]));
+  }
+
+  std::vector<int64_t> utf8_offsets(offsets.size());
+  std::vector<int64_t> wide_utf16_offsets(utf16_offsets.begin(),
+                                          utf16_offsets.end());
+  std::string utf8;
+  summary = Utf8BatchFromUtf16(wide_utf16_offsets.data(), kValidUtf8.size(),
+                               utf16.data(), utf8_offsets.data(), utf8);
+  EXPECT_EQ(summary.num_invalid_strings, 0);
+  EXPECT_EQ(utf8, data);
+  EXPECT_EQ(utf8_offsets,
+            std::vector<int64_t>(offsets.begin(), offsets.end()));
+}
+
+TEST(Batch, InvalidStrings) {
+  // the second string starts inside the character of the first one, the
+  // whole data is valid
+  std::vector<std::string> strings = {"ab\xC3", "\xA9", "ok", "\xFF!", "x"};
+  std::string data;
+  auto offsets = MakeBatch<int32_t>(strings, &data);
+  std::vector<int32_t> utf16_offsets(offsets.size());
+  std::u16string utf16;
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    BatchSummary summary = Utf16BatchFromUtf8(
+        offsets.data(), strings.size(),
+        reinterpret_cast<const uint8_t*>(data.data()), utf16_offsets.data(),
+        utf16, policy);
+    EXPECT_EQ(summary.num_invalid_strings, 3);
+    EXPECT_EQ(summary.first_invalid_string, 0);
+    auto utf16_strings = SplitBatch(utf16, utf16_offsets);
+    ASSERT_EQ(utf16_strings.size(), strings.size());
+    for (size_t i = 0; i < strings.size(); i++) {
+      EXPECT_EQ(utf16_strings[i],
+                Utf16StringFromUtf8<std::u16string>(strings[i], policy));
+    }
+  }
+
+  std::vector<std::u16string> utf16_strings = {u"a\xD83D", u"\xDE00",
+                                               u"\xD83D\xDE00", u"b"};
+  std::u16string utf16_data;
+  auto utf16_batch = MakeBatch<int64_t>(utf16_strings, &utf16_data);
+  std::vector<int64_t> utf8_offsets(utf16_batch.size());
+  std::string utf8;
+  BatchSummary summary =
+      Utf8BatchFromUtf16(utf16_batch.data(), utf16_strings.size(),
+                         utf16_data.data(), utf8_offsets.data(), utf8);
+  EXPECT_EQ(summary.num_invalid_strings, 2);
+  EXPECT_EQ(summary.first_invalid_string, 0);
+  EXPECT_EQ(SplitBatch(utf8, utf8_offsets),
+            (std::vector<std::string>{"a\xEF\xBF\xBD", "\xEF\xBF\xBD",
+                                      "\xF0\x9F\x98\x80", "b"}));
+}
+
+TEST(Batch, SlicedAndEmpty) {
+  // offsets of a slice don't start at 0
+  std::string data = "skipped" "caf\xC3\xA9" "ok";
+  std::vector<int32_t> offsets = {7, 12, 14};
+  std::vector<int32_t> utf16_offsets(3);
+  std::u16string utf16 = u"old";
+  Utf16BatchFromUtf8(offsets.data(), 2,
+                     reinterpret_cast<const uint8_t*>(data.data()),
+                     utf16_offsets.data(), utf16);
+  EXPECT_EQ(utf16, u"caf\xE9ok");
+  EXPECT_EQ(utf16_offsets, (std::vector<int32_t>{0, 4, 6}));
+
+  BatchSummary summary = Utf16BatchFromUtf8(
+      offsets.data(), 0, reinterpret_cast<const uint8_t*>(data.data()),
+      utf16_offsets.data(), utf16);
+  EXPECT_EQ(summary.first_invalid_string, 0);
+  EXPECT_TRUE(utf16.empty());
+  EXPECT_EQ(utf16_offsets[0], 0);
+}
+
+TEST(Batch, Overflow) {
+  // 100 unpaired surrogates become 300 bytes of replacement characters
+  std::u16string utf16(100, u'\xDC00');
+  std::vector<int8_t> offsets = {0, 100, 100, 100};
+  std::vector<int8_t> utf8_offsets(offsets.size());
+  std::string utf8 = "old";
+  BatchSummary summary = Utf8BatchFromUtf16(offsets.data(), 3, utf16.data(),
+                                            utf8_offsets.data(), utf8);
+  EXPECT_TRUE(summary.overflow);
+  EXPECT_TRUE(utf8.empty());
+}
+
+}  // namespace
+}  // namespace unicpp
@@ -5,6 +5,44 @@
 namespace unicpp {
 namespace {
 
+static_assert(isalpha(U'a') && isalpha(0x416) && !isalpha(U'1'));
+static_assert(isdigit(U'7') && isdigit(0x663) && !isdigit(U'x'));
+static_assert(isspace(U' ') && isspace(U'\n') && isspace(0x3000));
+static_assert(toupper(U'z') == U'Z' && toupper(0x436) == 0x416);
+static_assert(tolower(U'Z') == U'z' && tolower(U'1') == U'1');
+static_assert(!isalpha(0x110000) && !isspace(0xFFFFFFFF));
+
+template <class Entry, size_t N>
+constexpr bool IsSorted(const Entry (&table)[N]) {
+  for (size_t i = 1; i < N; i++) {
+    if (table[i - 1].first >= table[i].first) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(IsSorted(kUpperTable) && IsSorted(kLowerTable));
+static_assert(IsSorted(kGeneralCategoryRanges) && IsSorted(kBidiClassRanges));
+static_assert(IsSorted(kNumericTypeTable));
+
+TEST(CharType, SameAsMaps) {
+  for (char32_t code = 0; code < 0x110000; code++) {
+    auto upper = kUpperMap.find(code);
+    ASSERT_EQ(toupper(code), upper != kUpperMap.end() ? upper->second : code);
+    auto lower = kLowerMap.find(code);
+    ASSERT_EQ(tolower(code), lower != kLowerMap.end() ? lower->second : code);
+    auto category = kGeneralCategoryRangeMap.upper_bound(code);
+    ASSERT_EQ(isalpha(code),
+              (static_cast<uint64_t>(category->second) &
+               static_cast<uint64_t>(GeneralCategory::L)) != 0);
+    auto numeric = kNumericTypeMap.find(code);
+    ASSERT_EQ(isdigit(code), numeric != kNumericTypeMap.end() &&
+                                 (numeric->second == NumericType::Decimal ||
+                                  numeric->second == NumericType::Digit));
+  }
+}
+
 TEST(Decomposition, Basic) {
   const Decomposition* decomp = decomposition(0x1D400);
   ASSERT_NE(decomp, nullptr);
@@ -0,0 +1,198 @@
+#include "unicpp/detect.h"
+
+#include "unicpp/simd_level.h"
+
+#include "tests/simd_levels.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace unicpp {
+namespace {
+
+std::string Utf16LeText(std::u16string_view text) {
+  std::string bytes;
+  for (char16_t unit : text) {
+    bytes += static_cast<char>(unit & 0xFF);
+    bytes += static_cast<char>(unit >> 8);
+  }
+  return bytes;
+}
+
+std::string Utf16BeText(std::u16string_view text) {
+  std::string bytes;
+  for (char16_t unit : text) {
+    bytes += static_cast<char>(unit >> 8);
+    bytes += static_cast<char>(unit & 0xFF);
+  }
+  return bytes;
+}
+
+TEST(DetectEncoding, ByteOrderMark) {
+  DetectedEncoding detected = DetectEncoding("\xEF\xBB\xBF" "abc");
+  EXPECT_EQ(detected.encoding, Encoding::kUtf8);
+  EXPECT_EQ(detected.confidence, 100);
+  EXPECT_EQ(detected.bom_length, 3);
+
+  detected = DetectEncoding("\xFF\xFE" "a\xE9");
+  EXPECT_EQ(detected.encoding, Encoding::kUtf16Le);
+  EXPECT_EQ(detected.confidence, 100);
+  EXPECT_EQ(detected.bom_length, 2);
+
+  detected = DetectEncoding("\xFE\xFF");
+  EXPECT_EQ(detected.encoding, Encoding::kUtf16Be);
+  EXPECT_EQ(detected.confidence, 100);
+  EXPECT_EQ(detected.bom_length, 2);
+
+  detected = DetectEncoding("\xEF\xBB");
+  EXPECT_NE(detected.confidence, 100);
+  EXPECT_EQ(detected.bom_length, 0);
+}
+
+TEST(DetectEncoding, Empty) {
+  DetectedEncoding detected = DetectEncoding(std::string_view());
+  EXPECT_EQ(detected.encoding, Encoding::kUtf8);
+  EXPECT_EQ(detected.confidence, 0);
+  EXPECT_EQ(detected.bom_length, 0);
+}
+
+TEST(DetectEncoding, Utf16) {
+  DetectedEncoding detected =
+      DetectEncoding(Utf16LeText(u"Hello, world! \x4E16\x754C"));
+  EXPECT_EQ(detected.encoding, Encoding::kUtf16Le);
+  EXPECT_GE(detected.confidence, 80);
+  EXPECT_EQ(detected.bom_length, 0);
+
+  detected = DetectEncoding(Utf16BeText(u"Hello, world! \x4E16\x754C"));
+  EXPECT_EQ(detected.encoding, Encoding::kUtf16Be);
+  EXPECT_GE(detected.confidence, 80);
+
+  detected = DetectEncoding(Utf16BeText(u"\x4E16\x754C, world"));
+  EXPECT_EQ(detected.encoding, Encoding::kUtf16Be);
+}
+
+TEST(DetectEncoding, Utf8) {
+  DetectedEncoding detected =
+      DetectEncoding("caf\xC3\xA9 na\xC3\xAFve \xE4\xB8\x96\xF0\x9F\x98\x80");
+  EXPECT_EQ(detected.encoding, Encoding::kUtf8);
+  EXPECT_GE(detected.confidence, 80);
+  EXPECT_EQ(detected.bom_length, 0);
+
+  DetectedEncoding ascii = DetectEncoding("plain text");
+  EXPECT_EQ(ascii.encoding, Encoding::kUtf8);
+  EXPECT_LT(ascii.confidence, detected.confidence);
+}
+
+TEST(DetectEncoding, Latin1) {
+  DetectedEncoding detected = DetectEncoding("caf\xE9 na\xEFve");
+  EXPECT_EQ(detected.encoding, Encoding::kLatin1);
+  EXPECT_GE(detected.confidence, 50);
+
+  DetectedEncoding controls = DetectEncoding("caf\x81 na\x8Fve");
+  EXPECT_EQ(controls.encoding, Encoding::kLatin1);
+  EXPECT_LT(controls.confidence, detected.confidence);
+}
+
+TEST(DetectEncoding, Sample) {
+  // the sample ends in the middle of a character
+  std::string text(kDetectionSampleSize - 1, 'a');
+  text += "\xE4\xB8\x96";
+  EXPECT_EQ(DetectEncoding(text).encoding, Encoding::kUtf8);
+
+  // only the sample is looked at
+  text += "\xE9";
+  EXPECT_EQ(DetectEncoding(text).encoding, Encoding::kUtf8);
+  EXPECT_EQ(DetectEncoding(text.substr(3)).encoding, Encoding::kLatin1);
+}
+
+TEST(DetectEncoding, SimdLevels) {
+  std::vector<std::string> inputs;
+  std::string text;
+  for (int i = 0; i < 300; i++) {
+    text += "Lorem ipsum \xC3\xA9";
+    text.append(i % 7, '.');
+    inputs.push_back(text);
+  }
+  std::string latin1 = text;
+  for (size_t i = 0; i < latin1.size(); i += 37) {
+    latin1[i] = static_cast<char>(0x80 + i % 0x80);
+  }
+  for (size_t size = 0; size <= latin1.size(); size += 53) {
+    inputs.push_back(latin1.substr(0, size));
+  }
+  std::string utf16 = Utf16LeText(u"Lorem ipsum \xE9 dolor sit amet");
+  for (size_t size = 0; size <= 3 * utf16.size(); size += 7) {
+    std::string prefix = (utf16 + "\x01" + utf16 + utf16).substr(0, size);
+    inputs.push_back(prefix);
+    inputs.push_back("\x01" + prefix);
+  }
+
+  std::vector<DetectedEncoding> expected;
+  {
+    ScopedSimdLevel scalar(SimdLevel::kScalar);
+    for (const std::string& input : inputs) {
+      expected.push_back(DetectEncoding(input));
+    }
+  }
+  for (SimdLevel level : SupportedLevels()) {
+    ScopedSimdLevel scoped(level);
+    for (size_t i = 0; i < inputs.size(); i++) {
+      DetectedEncoding detected = DetectEncoding(inputs[i]);
+      EXPECT_EQ(detected.encoding, expected[i].encoding) << i;
+      EXPECT_EQ(detected.confidence, expected[i].confidence) << i;
+    }
+  }
+}
+
+TEST(DecodeAuto, Encodings) {
+  DetectedEncoding detected;
+  size_t decoded = 0;
+  EXPECT_EQ(DecodeAuto<std::u32string>(std::string("\xEF\xBB\xBF"
+                                                   "a\xC3\xA9"),
+                                       ErrorPolicy::kReplace, &detected,
+                                       &decoded),
+            U"a\xE9");
+  EXPECT_EQ(detected.encoding, Encoding::kUtf8);
+  EXPECT_EQ(decoded, 6);
+
+  EXPECT_EQ(DecodeAuto<std::u16string>(
+                "\xFF\xFE" + Utf16LeText(u"a\xE9\x4E16"),
+                ErrorPolicy::kReplace, &detected, &decoded),
+            u"a\xE9\x4E16");
+  EXPECT_EQ(detected.encoding, Encoding::kUtf16Le);
+  EXPECT_EQ(decoded, 8);
+
+  EXPECT_EQ(DecodeAuto<std::u32string>(Utf16BeText(u"Hello, \x4E16\x754C"),
+                                       ErrorPolicy::kReplace, &detected,
+                                       &decoded),
+            U"Hello, \x4E16\x754C");
+  EXPECT_EQ(detected.encoding, Encoding::kUtf16Be);
+  EXPECT_EQ(decoded, 18);
+
+  std::vector<uint8_t> latin1 = {'c', 'a', 'f', 0xE9};
+  EXPECT_EQ(DecodeAuto<std::wstring>(latin1, ErrorPolicy::kReplace, &detected,
+                                     &decoded),
+            L"caf\xE9");
+  EXPECT_EQ(detected.encoding, Encoding::kLatin1);
+  EXPECT_EQ(decoded, 4);
+
+  EXPECT_EQ(DecodeAuto<std::u32string>(std::string()), U"");
+}
+
+TEST(DecodeAuto, Errors) {
+  size_t decoded = 0;
+  std::string bytes = "\xFE\xFF" + Utf16BeText(u"ab\xD800");
+  EXPECT_EQ(DecodeAuto<std::u32string>(bytes, ErrorPolicy::kReplace, nullptr,
+                                       &decoded),
+            U"ab\xFFFD");
+  EXPECT_EQ(decoded, 8);
+  EXPECT_EQ(DecodeAuto<std::u32string>(bytes, ErrorPolicy::kStop, nullptr,
+                                       &decoded),
+            U"ab");
+  EXPECT_EQ(decoded, 6);
+}
+
+}  // namespace
+}  // namespace unicpp
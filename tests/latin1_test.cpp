@@ -0,0 +1,177 @@
+#include "unicpp/latin1.h"
+
+#include "unicpp/simd_level.h"
+
+#include "tests/simd_levels.h"
+
+#include "gtest/gtest.h"
+
+#include <list>
+#include <string>
+
+namespace unicpp {
+namespace {
+
+// Long enough for the vectorized code, with all the Latin-1 characters.
+std::string Latin1Text() {
+  std::string text;
+  for (int i = 0; i < 5; i++) {
+    text += "Lorem ipsum dolor sit amet, consectetur adipiscing elit. ";
+    for (int byte = 0; byte < 256; byte += 1 + i) {
+      text += static_cast<char>(byte);
+    }
+  }
+  return text;
+}
+
+TEST(Latin1, Characters) {
+  std::string latin1 = "caf\xE9 \xFF";
+  EXPECT_EQ(Utf8BytesFromLatin1<std::string>(latin1), "caf\xC3\xA9 \xC3\xBF");
+  EXPECT_EQ(Utf16LeBytesFromLatin1<std::string>(latin1),
+            std::string("c\0a\0f\0\xE9\0 \0\xFF\0", 12));
+  EXPECT_EQ(Utf16BeBytesFromLatin1<std::string>(latin1),
+            std::string("\0c\0a\0f\0\xE9\0 \0\xFF", 12));
+  EXPECT_EQ(Utf16StringFromLatin1<std::u16string>(latin1), u"caf\xE9 \xFF");
+
+  EXPECT_EQ(Latin1BytesFromUtf8<std::string>(
+                std::string("caf\xC3\xA9 \xC3\xBF")),
+            latin1);
+  // a character above U+00FF is a single error, invalid UTF-8 one per byte
+  EXPECT_EQ(Latin1BytesFromUtf8<std::string>(
+                std::string("a\xD0\x96\xF0\x9F\x98\x80!")),
+            "a?" "?!");
+  EXPECT_EQ(Latin1BytesFromUtf8<std::string>(std::string("a\xE4\xB8\xC0!")),
+            "a?" "?" "?!");
+  EXPECT_EQ(Latin1BytesFromUtf16<std::string>(
+                std::u16string(u"\xE9\x416\U0001F600")),
+            "\xE9??");
+  EXPECT_EQ(Latin1BytesFromUtf16Le<std::string>(
+                std::string("\x37\xDC\xE9\x00\x41", 5), ErrorPolicy::kSkip),
+            "\xE9");
+
+  size_t transcoded = 0;
+  EXPECT_EQ(Latin1BytesFromUtf8<std::string>(std::string("ab\xC4\x80"),
+                                             ErrorPolicy::kStop, &transcoded),
+            "ab");
+  EXPECT_EQ(transcoded, 2);
+}
+
+TEST(Latin1, RoundTrip) {
+  std::string latin1 = Latin1Text();
+  std::list<char> list(latin1.begin(), latin1.end());
+
+  std::string expected_utf8;
+  EXPECT_EQ(Latin1ToUtf8(list.begin(), list.end(),
+                         std::back_inserter(expected_utf8)),
+            Utf8LengthFromLatin1(latin1));
+  std::string expected_le;
+  Latin1ToUtf16Le(list.begin(), list.end(), std::back_inserter(expected_le));
+  std::string expected_be;
+  Latin1ToUtf16Be(list.begin(), list.end(), std::back_inserter(expected_be));
+
+  for (SimdLevel level : SupportedLevels()) {
+    ScopedSimdLevel scoped(level);
+    std::string utf8 = Utf8BytesFromLatin1<std::string>(latin1);
+    EXPECT_EQ(utf8, expected_utf8) << SimdLevelName(level);
+    EXPECT_EQ(Utf16LeBytesFromLatin1<std::string>(latin1), expected_le)
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf16BeBytesFromLatin1<std::string>(latin1), expected_be)
+        << SimdLevelName(level);
+    std::u16string units = Utf16StringFromLatin1<std::u16string>(latin1);
+    EXPECT_EQ(units.size(), latin1.size()) << SimdLevelName(level);
+
+    EXPECT_TRUE(Utf8IsLatin1(utf8)) << SimdLevelName(level);
+    EXPECT_EQ(Latin1BytesFromUtf8<std::string>(utf8), latin1)
+        << SimdLevelName(level);
+    EXPECT_EQ(Latin1BytesFromUtf16Le<std::string>(expected_le), latin1)
+        << SimdLevelName(level);
+    EXPECT_EQ(Latin1BytesFromUtf16Be<std::string>(expected_be), latin1)
+        << SimdLevelName(level);
+    EXPECT_EQ(Latin1BytesFromUtf16<std::string>(units), latin1)
+        << SimdLevelName(level);
+  }
+}
+
+TEST(Latin1, Utf8WithErrors) {
+  std::string valid = Utf8BytesFromLatin1<std::string>(Latin1Text());
+  std::string text = valid;
+  for (size_t pos : {700, 500, 130, 129, 128, 64, 3}) {
+    text.insert(pos, "\xD0\x96\xC3\xE4\xB8\x80\xC0\xED\xA0\x80");
+  }
+  text += '\xC3';
+  std::list<char> list(text.begin(), text.end());
+
+  for (SimdLevel level : SupportedLevels()) {
+    ScopedSimdLevel scoped(level);
+    EXPECT_FALSE(Utf8IsLatin1(text)) << SimdLevelName(level);
+    EXPECT_FALSE(Utf8IsLatin1(valid + "\xC4\x80")) << SimdLevelName(level);
+    EXPECT_FALSE(Utf8IsLatin1(valid.substr(0, 100) + "\xC3"))
+        << SimdLevelName(level);
+    EXPECT_TRUE(Utf8IsLatin1(valid)) << SimdLevelName(level);
+
+    for (ErrorPolicy policy :
+         {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+      std::string expected;
+      size_t expected_transcoded = Utf8ToLatin1(
+          list.begin(), list.end(), std::back_inserter(expected), policy);
+
+      size_t transcoded = 0;
+      EXPECT_EQ(Latin1BytesFromUtf8<std::string>(text, policy, &transcoded),
+                expected)
+          << SimdLevelName(level);
+      EXPECT_EQ(transcoded, expected_transcoded) << SimdLevelName(level);
+    }
+  }
+}
+
+TEST(Latin1, Utf16WithErrors) {
+  std::string le = Utf16LeBytesFromLatin1<std::string>(Latin1Text());
+  for (size_t pos : {700, 500, 130, 128, 64, 2}) {
+    // character above U+00FF, surrogate pair, lone surrogates
+    le.insert(pos, std::string("\x16\x04\x01\xD8\x37\xDC\x37\xDC\x01\xD8", 10));
+  }
+  le += '\x41';  // odd trailing byte
+
+  std::string be = le;
+  for (size_t i = 0; i + 1 < be.size(); i += 2) {
+    std::swap(be[i], be[i + 1]);
+  }
+  std::u16string units(le.size() / 2, u'\0');
+  for (size_t i = 0; i < units.size(); i++) {
+    units[i] = static_cast<char16_t>(static_cast<uint8_t>(le[2 * i]) |
+                                     (static_cast<uint8_t>(le[2 * i + 1]) << 8));
+  }
+  std::list<char> le_list(le.begin(), le.end());
+  std::list<char16_t> units_list(units.begin(), units.end());
+
+  for (SimdLevel level : SupportedLevels()) {
+    ScopedSimdLevel scoped(level);
+    for (ErrorPolicy policy :
+         {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+      std::string expected;
+      size_t expected_transcoded = Utf16LeToLatin1(
+          le_list.begin(), le_list.end(), std::back_inserter(expected), policy);
+      std::string expected_from_units;
+      size_t expected_units_transcoded =
+          Utf16ToLatin1(units_list.begin(), units_list.end(),
+                        std::back_inserter(expected_from_units), policy);
+
+      size_t transcoded = 0;
+      EXPECT_EQ(Latin1BytesFromUtf16Le<std::string>(le, policy, &transcoded),
+                expected)
+          << SimdLevelName(level);
+      EXPECT_EQ(transcoded, expected_transcoded) << SimdLevelName(level);
+      EXPECT_EQ(Latin1BytesFromUtf16Be<std::string>(be, policy, &transcoded),
+                expected)
+          << SimdLevelName(level);
+      EXPECT_EQ(transcoded, expected_transcoded) << SimdLevelName(level);
+      EXPECT_EQ(Latin1BytesFromUtf16<std::string>(units, policy, &transcoded),
+                expected_from_units)
+          << SimdLevelName(level);
+      EXPECT_EQ(transcoded, expected_units_transcoded) << SimdLevelName(level);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace unicpp
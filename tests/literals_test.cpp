@@ -0,0 +1,74 @@
+#include "unicpp/literals.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <string>
+
+namespace unicpp {
+namespace {
+
+constexpr auto kUtf16 =
+    Utf16Literal("Z\xC3\xBCrich \xE4\xB8\xAD\xF0\x9F\x98\x80");
+static_assert(kUtf16.view() == u"Z\xFCrich \x4E2D\xD83D\xDE00");
+static_assert(kUtf16.data()[kUtf16.size()] == 0);
+
+constexpr auto kUtf32 =
+    Utf32Literal("Z\xC3\xBCrich \xE4\xB8\xAD\xF0\x9F\x98\x80");
+static_assert(kUtf32.view() == U"Z\xFCrich \x4E2D\U0001F600");
+
+static_assert(Utf32Literal("a\xFF" "b").view() == U"a\xFFFD" "b");
+static_assert(Utf32Literal("a\xFF" "b", ErrorPolicy::kSkip).view() == U"ab");
+static_assert(Utf16Literal("a\xED\xA0\x80" "b", ErrorPolicy::kStop).view() ==
+              u"a");
+static_assert(Utf16Literal("").size() == 0);
+#if defined(__cpp_char8_t)
+static_assert(Utf32Literal(u8"\u00FC\U0001F600").view() == U"\xFC\U0001F600");
+#endif
+
+// contiguous input, which needs telling compile time from runtime
+#if defined(UNICPP_HAS_CONSTANT_EVALUATED)
+constexpr std::array<char32_t, 3> DecodeAtCompileTime() {
+  std::array<char32_t, 3> chars = {};
+  const char bytes[] = "\xD0\x96z";
+  Utf8Decode(bytes, bytes + 3, chars.begin(), chars.end());
+  return chars;
+}
+static_assert(DecodeAtCompileTime()[0] == 0x416);
+static_assert(DecodeAtCompileTime()[1] == U'z');
+
+constexpr std::array<uint8_t, 10> EncodeAtCompileTime() {
+  std::array<uint8_t, 10> bytes = {};
+  const char32_t chars[] = {0x4E2D, 0xD800, 0x1F600};
+  Utf8Encode(chars, chars + 3, bytes.begin(), ErrorPolicy::kReplace);
+  return bytes;
+}
+static_assert(EncodeAtCompileTime()[0] == 0xE4);
+static_assert(EncodeAtCompileTime()[3] == 0xEF);
+static_assert(EncodeAtCompileTime()[6] == 0xF0);
+#endif
+
+TEST(Literals, SameAsRuntime) {
+  EXPECT_EQ(std::u16string(kUtf16.begin(), kUtf16.end()),
+            u"Z\xFCrich \x4E2D\xD83D\xDE00");
+  EXPECT_EQ(kUtf32.size(), 9);
+  EXPECT_EQ(kUtf32[8], 0x1F600);
+
+  // long enough for the vectorized code when not constant evaluated
+  auto runtime = [](const char* bytes, size_t size) {
+    std::u32string chars;
+    Utf8Decode(bytes, bytes + size, std::back_inserter(chars),
+               ErrorPolicy::kReplace);
+    return chars;
+  };
+  constexpr auto kLong = Utf32Literal(
+      "Lorem ipsum dolor sit amet, consectetur adipiscing elit, \xD0\x96 sed "
+      "do eiusmod tempor incididunt ut labore et dolore magna aliqua.\xC0");
+  const char kLongBytes[] =
+      "Lorem ipsum dolor sit amet, consectetur adipiscing elit, \xD0\x96 sed "
+      "do eiusmod tempor incididunt ut labore et dolore magna aliqua.\xC0";
+  EXPECT_EQ(kLong.view(), runtime(kLongBytes, sizeof(kLongBytes) - 1));
+}
+
+}  // namespace
+}  // namespace unicpp
@@ -0,0 +1,120 @@
+#include "unicpp/parallel.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace unicpp {
+namespace {
+
+constexpr size_t kNumThreads = 7;
+
+// Long enough to be split into kNumThreads chunks, with characters of all
+// lengths and invalid sequences.
+std::string DirtyUtf8() {
+  std::string text;
+  for (int i = 0; text.size() < kNumThreads * kParallelMinChunkSize + 1000;
+       i++) {
+    text += "Lorem ipsum \xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80 ";
+    text += i % 3 == 0 ? "\xED\xA0\x80" : i % 3 == 1 ? "\xF0\x9F" : "\xBF\xBF";
+  }
+  return text;
+}
+
+TEST(Parallel, SameAsSequential) {
+  std::string utf8 = DirtyUtf8();
+  std::string utf16le = Utf16LeBytesFromUtf8<std::string>(utf8);
+  utf16le.insert(100000, std::string("\x00\xD8\x41\x00\x37\xDC", 6));
+  utf16le += '\x41';
+  std::string utf16be = Utf16BeBytesFromUtf8<std::string>(utf8);
+  std::u16string utf16 = Utf16StringFromUtf8<std::u16string>(utf8);
+  utf16.insert(utf16.begin() + 200000, u'\xDC00');
+  std::u32string utf32 = Utf8Wstring<std::u32string>(utf8);
+  utf32[300000] = 0x110000;
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    for (size_t num_threads : {size_t{1}, kNumThreads, size_t{0}}) {
+      size_t expected_transcoded = 0;
+      size_t transcoded = 0;
+
+      EXPECT_EQ(Utf8WstringParallel<std::u32string>(utf8, policy, &transcoded,
+                                                     num_threads),
+                Utf8Wstring<std::u32string>(utf8, policy,
+                                            &expected_transcoded));
+      EXPECT_EQ(transcoded, expected_transcoded);
+      EXPECT_EQ(Utf8BytesParallel<std::string>(utf32, policy, &transcoded,
+                                               num_threads),
+                Utf8Bytes<std::string>(utf32, policy, &expected_transcoded));
+      EXPECT_EQ(transcoded, expected_transcoded);
+      EXPECT_EQ(Utf16LeBytesParallel<std::string>(utf32, policy, &transcoded,
+                                                  num_threads),
+                Utf16LeBytes<std::string>(utf32, policy,
+                                          &expected_transcoded));
+      EXPECT_EQ(transcoded, expected_transcoded);
+      EXPECT_EQ(Utf16BeBytesParallel<std::vector<uint8_t>>(utf32, policy),
+                Utf16BeBytes<std::vector<uint8_t>>(utf32, policy));
+
+      EXPECT_EQ(Utf16LeBytesFromUtf8Parallel<std::string>(
+                    utf8, policy, &transcoded, num_threads),
+                Utf16LeBytesFromUtf8<std::string>(utf8, policy,
+                                                  &expected_transcoded));
+      EXPECT_EQ(transcoded, expected_transcoded);
+      EXPECT_EQ(Utf16BeBytesFromUtf8Parallel<std::string>(utf8, policy,
+                                                          nullptr, num_threads),
+                Utf16BeBytesFromUtf8<std::string>(utf8, policy));
+      EXPECT_EQ(Utf16StringFromUtf8Parallel<std::u16string>(
+                    utf8, policy, nullptr, num_threads),
+                Utf16StringFromUtf8<std::u16string>(utf8, policy));
+
+      EXPECT_EQ(Utf8BytesFromUtf16LeParallel<std::string>(
+                    utf16le, policy, &transcoded, num_threads),
+                Utf8BytesFromUtf16Le<std::string>(utf16le, policy,
+                                                  &expected_transcoded));
+      EXPECT_EQ(transcoded, expected_transcoded);
+      EXPECT_EQ(Utf8BytesFromUtf16BeParallel<std::string>(
+                    utf16be, policy, nullptr, num_threads),
+                Utf8BytesFromUtf16Be<std::string>(utf16be, policy));
+      EXPECT_EQ(Utf8BytesFromUtf16Parallel<std::string>(
+                    utf16, policy, &transcoded, num_threads),
+                Utf8BytesFromUtf16<std::string>(utf16, policy,
+                                                &expected_transcoded));
+      EXPECT_EQ(transcoded, expected_transcoded);
+    }
+  }
+}
+
+TEST(Parallel, CharactersAtSeams) {
+  // the input is split in halves, put a character across the middle
+  std::string utf8(2 * kParallelMinChunkSize, 'a');
+  std::string utf16le(2 * kParallelMinChunkSize, '\0');
+  for (size_t shift = 0; shift < 4; shift++) {
+    std::string sequence = "\xF0\x9F\x98\x80";
+    utf8.replace(kParallelMinChunkSize - shift, 4, sequence);
+    EXPECT_EQ(Utf16LeBytesFromUtf8Parallel<std::string>(
+                  utf8, ErrorPolicy::kReplace, nullptr, 2),
+              Utf16LeBytesFromUtf8<std::string>(utf8));
+
+    // truncated sequences followed by the next chunk
+    sequence.resize(shift);
+    utf8.replace(kParallelMinChunkSize - shift, shift, sequence);
+    EXPECT_EQ(Utf16LeBytesFromUtf8Parallel<std::string>(
+                  utf8, ErrorPolicy::kReplace, nullptr, 2),
+              Utf16LeBytesFromUtf8<std::string>(utf8));
+  }
+
+  utf16le.replace(kParallelMinChunkSize - 2, 4,
+                  std::string("\x3D\xD8\x00\xDE", 4));
+  EXPECT_EQ(Utf8BytesFromUtf16LeParallel<std::string>(
+                utf16le, ErrorPolicy::kReplace, nullptr, 2),
+            Utf8BytesFromUtf16Le<std::string>(utf16le));
+  EXPECT_EQ(Utf8BytesFromUtf16LeParallel<std::string>(
+                utf16le, ErrorPolicy::kStop, nullptr, 2),
+            Utf8BytesFromUtf16Le<std::string>(utf16le, ErrorPolicy::kStop));
+
+  EXPECT_TRUE(Utf8WstringParallel<std::u32string>(std::string()).empty());
+}
+
+}  // namespace
+}  // namespace unicpp
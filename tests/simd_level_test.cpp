@@ -0,0 +1,120 @@
+#include "unicpp/simd_level.h"
+#include "unicpp/utf8.h"
+#include "unicpp/utf8_utf16.h"
+
+#include "tests/simd_levels.h"
+
+#include "gtest/gtest.h"
+
+#include <list>
+#include <string>
+
+namespace unicpp {
+namespace {
+
+TEST(SimdLevel, Selection) {
+  EXPECT_EQ(ActiveSimdLevel(), SupportedSimdLevel());
+  EXPECT_TRUE(SetSimdLevel(SimdLevel::kScalar));
+  EXPECT_EQ(ActiveSimdLevel(), SimdLevel::kScalar);
+  EXPECT_TRUE(SetSimdLevel(SupportedSimdLevel()));
+  if (SupportedSimdLevel() != SimdLevel::kAvx2) {
+    EXPECT_FALSE(SetSimdLevel(SimdLevel::kAvx2));
+    EXPECT_EQ(ActiveSimdLevel(), SupportedSimdLevel());
+  }
+
+  EXPECT_STREQ(SimdLevelName(SimdLevel::kScalar), "scalar");
+  EXPECT_STREQ(SimdLevelName(SimdLevel::kSse42), "sse4.2");
+  EXPECT_STREQ(SimdLevelName(SimdLevel::kAvx2), "avx2");
+}
+
+TEST(SimdLevel, SameResults) {
+  std::string text;
+  for (int i = 0; i < 50; i++) {
+    text += "Lorem ipsum dolor sit amet, \xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80 ";
+    if (i % 7 == 0) {
+      text += "\xE4\xB8\xC0";
+    }
+  }
+
+  std::u32string expected_utf32;
+  std::u32string expected_utf32_skip;
+  size_t expected_valid = 0;
+  std::string expected_utf16;
+  std::string expected_utf8;
+  size_t expected_utf16_length = 0;
+  size_t expected_utf8_length = 0;
+  {
+    ScopedSimdLevel scalar(SimdLevel::kScalar);
+    expected_utf32 = Utf8Wstring<std::u32string>(text);
+    expected_utf32_skip =
+        Utf8Wstring<std::u32string>(text, ErrorPolicy::kSkip);
+    expected_valid = Utf8ValidPrefixLength(text);
+    expected_utf16 = Utf16LeBytesFromUtf8<std::string>(text);
+    expected_utf8 = Utf8BytesFromUtf16Le<std::string>(expected_utf16);
+    expected_utf16_length = Utf16LengthFromUtf8(text);
+    expected_utf8_length = Utf8LengthFromUtf16Le(expected_utf16);
+  }
+
+  for (SimdLevel level : SupportedLevels()) {
+    ScopedSimdLevel scoped(level);
+    EXPECT_EQ(Utf8Wstring<std::u32string>(text), expected_utf32)
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf8Wstring<std::u32string>(text, ErrorPolicy::kSkip),
+              expected_utf32_skip)
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf8ValidPrefixLength(text), expected_valid)
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf8NumCharsWithReplacement(text), expected_utf32.size())
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf16LeBytesFromUtf8<std::string>(text), expected_utf16)
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf8BytesFromUtf16Le<std::string>(expected_utf16), expected_utf8)
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf16LengthFromUtf8(text), expected_utf16_length)
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf8LengthFromUtf16Le(expected_utf16), expected_utf8_length)
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf8LengthFromUtf32(expected_utf32), expected_utf8.size())
+        << SimdLevelName(level);
+  }
+}
+
+TEST(SimdLevel, EncodeUtf32) {
+  // runs of every length and invalid characters at every offset of a block
+  std::u32string text;
+  for (int i = 0; i < 40; i++) {
+    text += U"Lorem ipsum dolor sit amet, ";
+    text += U"\x416\x4E2D\U0001F600\x7FF\x800\xFFFF\U00010000\U0010FFFF";
+    if (i % 5 == 0) {
+      text.insert(text.size() - i % 13, 1, 0xD800 + i);
+    } else if (i % 5 == 1) {
+      text.insert(text.size() - i % 11, 1, i % 2 == 0 ? 0x110000 : 0xFFFFFFFF);
+    }
+  }
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::list<char32_t> list(text.begin(), text.end());
+    std::string expected;
+    size_t expected_encoded = Utf8Encode(list.begin(), list.end(),
+                                         std::back_inserter(expected), policy);
+
+    for (SimdLevel level : SupportedLevels()) {
+      ScopedSimdLevel scoped(level);
+      size_t encoded = 0;
+      EXPECT_EQ(Utf8Bytes<std::string>(text, policy, &encoded), expected)
+          << SimdLevelName(level);
+      EXPECT_EQ(encoded, expected_encoded) << SimdLevelName(level);
+
+      std::string iterated;
+      EXPECT_EQ(Utf8Encode(text.begin(), text.end(),
+                           std::back_inserter(iterated), policy),
+                expected_encoded)
+          << SimdLevelName(level);
+      EXPECT_EQ(iterated, expected) << SimdLevelName(level);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace unicpp
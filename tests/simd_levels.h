@@ -0,0 +1,43 @@
+#pragma once
+
+#include "unicpp/simd_level.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace unicpp {
+
+// The levels the tests can switch to on this machine, scalar first.
+inline std::vector<SimdLevel> SupportedLevels() {
+  std::vector<SimdLevel> levels;
+  for (SimdLevel level :
+       {SimdLevel::kScalar, SimdLevel::kSse42, SimdLevel::kAvx2}) {
+    if (level <= SupportedSimdLevel()) {
+      levels.push_back(level);
+    }
+  }
+  return levels;
+}
+
+// Switches to `level` for its lifetime, so that the level is restored even
+// if a test returns early on a failed assertion.
+class ScopedSimdLevel {
+public:
+  explicit ScopedSimdLevel(SimdLevel level)
+      : previous_(ActiveSimdLevel()) {
+    EXPECT_TRUE(SetSimdLevel(level));
+    EXPECT_EQ(ActiveSimdLevel(), level);
+  }
+  ~ScopedSimdLevel() {
+    SetSimdLevel(previous_);
+  }
+
+  ScopedSimdLevel(const ScopedSimdLevel&) = delete;
+  ScopedSimdLevel& operator=(const ScopedSimdLevel&) = delete;
+
+private:
+  SimdLevel previous_;
+};
+
+}  // namespace unicpp
@@ -0,0 +1,162 @@
+#include "unicpp/transcode_file.h"
+
+#include "unicpp/latin1.h"
+#include "unicpp/parallel.h"
+#include "unicpp/utf8_utf16.h"
+
+#include "gtest/gtest.h"
+
+#include <cerrno>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace unicpp {
+namespace {
+
+constexpr Encoding kEncodings[] = {Encoding::kUtf8, Encoding::kUtf16Le,
+                                   Encoding::kUtf16Be, Encoding::kLatin1};
+
+std::string TempPath(const std::string& name) {
+  return ::testing::TempDir() + "/transcode_file_test_" + name;
+}
+
+void WriteFile(const std::string& path, const std::string& content) {
+  std::ofstream(path, std::ios::binary) << content;
+}
+
+std::string ReadFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+}
+
+// The in-memory conversion, through UTF-32 unless the output is Latin-1.
+std::string Transcode(const std::string& input, Encoding from, Encoding to,
+                      ErrorPolicy policy, size_t* transcoded) {
+  if (to == Encoding::kLatin1) {
+    switch (from) {
+      case Encoding::kUtf8:
+        return Latin1BytesFromUtf8<std::string>(input, policy, transcoded);
+      case Encoding::kUtf16Le:
+        return Latin1BytesFromUtf16Le<std::string>(input, policy, transcoded);
+      case Encoding::kUtf16Be:
+        return Latin1BytesFromUtf16Be<std::string>(input, policy, transcoded);
+      case Encoding::kLatin1:
+        break;
+    }
+    *transcoded = input.size();
+    return input;
+  }
+
+  std::u32string chars;
+  switch (from) {
+    case Encoding::kUtf8:
+      chars = Utf8Wstring<std::u32string>(input, policy, transcoded);
+      break;
+    case Encoding::kUtf16Le:
+      chars = Utf16LeWstring<std::u32string>(input, policy, transcoded);
+      break;
+    case Encoding::kUtf16Be:
+      chars = Utf16BeWstring<std::u32string>(input, policy, transcoded);
+      break;
+    case Encoding::kLatin1:
+      for (char byte : input) {
+        chars += static_cast<uint8_t>(byte);
+      }
+      *transcoded = input.size();
+      break;
+  }
+  if (to == Encoding::kUtf8) {
+    return Utf8Bytes<std::string>(chars);
+  } else if (to == Encoding::kUtf16Le) {
+    return Utf16LeBytes<std::string>(chars);
+  }
+  return Utf16BeBytes<std::string>(chars);
+}
+
+TEST(TranscodeFile, SameAsInMemory) {
+  std::string text;
+  for (int i = 0; text.size() < 3 * kParallelMinChunkSize; i++) {
+    text += "Lorem ipsum caf\xC3\xA9 \xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80 ";
+    text += i % 2 == 0 ? "\xED\xA0\x80" : "\xF0\x9F";
+  }
+  std::string inputs[] = {
+      text,
+      Utf16LeBytesFromUtf8<std::string>(text) + std::string("\x00\xD8", 2),
+      Utf16BeBytesFromUtf8<std::string>(text) + '\x41',
+      Latin1BytesFromUtf8<std::string>(text),
+  };
+
+  std::string input_path = TempPath("input");
+  std::string output_path = TempPath("output");
+  for (size_t from = 0; from < std::size(kEncodings); from++) {
+    WriteFile(input_path, inputs[from]);
+    for (Encoding to : kEncodings) {
+      for (ErrorPolicy policy :
+           {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+        size_t expected_transcoded = 0;
+        std::string expected = Transcode(inputs[from], kEncodings[from], to,
+                                         policy, &expected_transcoded);
+        for (size_t num_threads : {size_t{1}, size_t{3}}) {
+          TranscodeFileStats stats;
+          ASSERT_TRUE(TranscodeFile(input_path, output_path, kEncodings[from],
+                                    to, policy, num_threads, &stats));
+          EXPECT_EQ(ReadFile(output_path), expected);
+          EXPECT_EQ(stats.bytes_read, expected_transcoded);
+          EXPECT_EQ(stats.bytes_written, expected.size());
+        }
+      }
+    }
+  }
+}
+
+TEST(TranscodeFile, Stats) {
+  std::string input_path = TempPath("input");
+  std::string output_path = TempPath("output");
+  // 2 invalid bytes, 1 character above U+00FF
+  WriteFile(input_path, "caf\xC3\xA9 \xC3 \xD0\x96 \xFF");
+
+  TranscodeFileStats stats;
+  ASSERT_TRUE(TranscodeFile(input_path, output_path, Encoding::kUtf8,
+                            Encoding::kUtf16Le, ErrorPolicy::kReplace, 1,
+                            &stats, true));
+  EXPECT_EQ(stats.bytes_read, 12);
+  EXPECT_EQ(stats.bytes_written, 20);
+  EXPECT_EQ(stats.errors, 2);
+
+  ASSERT_TRUE(TranscodeFile(input_path, output_path, Encoding::kUtf8,
+                            Encoding::kLatin1, ErrorPolicy::kSkip, 1, &stats,
+                            true));
+  EXPECT_EQ(ReadFile(output_path), "caf\xE9   ");
+  EXPECT_EQ(stats.errors, 3);
+
+  ASSERT_TRUE(TranscodeFile(input_path, output_path, Encoding::kUtf8,
+                            Encoding::kUtf8, ErrorPolicy::kStop, 1, &stats,
+                            true));
+  EXPECT_EQ(ReadFile(output_path), "caf\xC3\xA9 ");
+  EXPECT_EQ(stats.bytes_read, 6);
+  EXPECT_EQ(stats.errors, 2);
+}
+
+TEST(TranscodeFile, EmptyAndMissingFiles) {
+  std::string input_path = TempPath("input");
+  std::string output_path = TempPath("output");
+  WriteFile(input_path, "");
+  WriteFile(output_path, "old content");
+  TranscodeFileStats stats;
+  ASSERT_TRUE(TranscodeFile(input_path, output_path, Encoding::kUtf8,
+                            Encoding::kUtf16Be, ErrorPolicy::kReplace, 1,
+                            &stats, true));
+  EXPECT_EQ(ReadFile(output_path), "");
+  EXPECT_EQ(stats.bytes_read, 0);
+  EXPECT_EQ(stats.bytes_written, 0);
+  EXPECT_EQ(stats.errors, 0);
+
+  EXPECT_FALSE(TranscodeFile(TempPath("missing"), output_path,
+                             Encoding::kUtf8, Encoding::kLatin1));
+  EXPECT_EQ(errno, ENOENT);
+}
+
+}  // namespace
+}  // namespace unicpp
@@ -0,0 +1,236 @@
+#include "unicpp/transcode.h"
+
+#include "unicpp/latin1.h"
+#include "unicpp/utf8_utf16.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace unicpp {
+namespace {
+
+constexpr Encoding kEncodings[] = {Encoding::kUtf8, Encoding::kUtf16Le,
+                                   Encoding::kUtf16Be, Encoding::kLatin1};
+
+const uint8_t* Bytes(const std::string& string) {
+  return reinterpret_cast<const uint8_t*>(string.data());
+}
+
+std::u32string Decode(const std::string& input, Encoding from,
+                      ErrorPolicy policy) {
+  switch (from) {
+    case Encoding::kUtf8:
+      return Utf8Wstring<std::u32string>(input, policy);
+    case Encoding::kUtf16Le:
+      return Utf16LeWstring<std::u32string>(input, policy);
+    case Encoding::kUtf16Be:
+      return Utf16BeWstring<std::u32string>(input, policy);
+    case Encoding::kLatin1:
+      break;
+  }
+  std::u32string chars;
+  for (char byte : input) {
+    chars += static_cast<uint8_t>(byte);
+  }
+  return chars;
+}
+
+std::string Encode(const std::u32string& chars, Encoding to,
+                   ErrorPolicy policy) {
+  switch (to) {
+    case Encoding::kUtf8:
+      return Utf8Bytes<std::string>(chars);
+    case Encoding::kUtf16Le:
+      return Utf16LeBytes<std::string>(chars);
+    case Encoding::kUtf16Be:
+      return Utf16BeBytes<std::string>(chars);
+    case Encoding::kLatin1:
+      break;
+  }
+  std::string latin1;
+  for (char32_t ch : chars) {
+    if (ch <= 0xFF) {
+      latin1 += static_cast<char>(ch);
+    } else if (policy == ErrorPolicy::kReplace) {
+      latin1 += kLatin1ReplacementCharacter;
+    } else if (policy == ErrorPolicy::kStop) {
+      break;
+    }
+  }
+  return latin1;
+}
+
+// Long enough for the vectorized code, with invalid sequences.
+std::string Input(Encoding encoding) {
+  std::string utf8;
+  for (int i = 0; i < 20; i++) {
+    utf8 += "Lorem ipsum dolor sit amet, consectetur adipiscing elit. ";
+    utf8 += "caf\xC3\xA9 \xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80 ";
+  }
+  switch (encoding) {
+    case Encoding::kUtf8:
+      return utf8 + "\xE4\xB8" + utf8 + "\xFF";
+    case Encoding::kUtf16Le:
+      return Utf16LeBytesFromUtf8<std::string>(utf8) +
+             std::string("\x3D\xD8\x41\x00", 4) +
+             Utf16LeBytesFromUtf8<std::string>(utf8) + "\x41";
+    case Encoding::kUtf16Be:
+      return Utf16BeBytesFromUtf8<std::string>(utf8) +
+             std::string("\xDE\x00\x00\x41", 4) +
+             Utf16BeBytesFromUtf8<std::string>(utf8);
+    case Encoding::kLatin1:
+      break;
+  }
+  return Latin1BytesFromUtf8<std::string>(utf8);
+}
+
+// Transcodes `input` passing at most `input_step` values and an output buffer
+// of `output_step` values at a time.
+std::string TranscodeInSteps(Encoding from, Encoding to,
+                             const std::string& input, ErrorPolicy policy,
+                             size_t input_step, size_t output_step) {
+  std::string output;
+  std::vector<uint8_t> buffer(output_step);
+  size_t pos = 0;
+  size_t available = 0;
+  while (true) {
+    available = std::min(input.size(), std::max(available, pos + input_step));
+    bool end = available == input.size();
+    TranscodeResult result =
+        Transcode(from, to, Bytes(input) + pos, available - pos,
+                  buffer.data(), buffer.size(), policy, end);
+    pos += result.consumed;
+    output.append(buffer.begin(), buffer.begin() + result.produced);
+    if (result.status == TranscodeStatus::kDone && end) {
+      break;
+    } else if (result.status == TranscodeStatus::kNeedMoreInput) {
+      EXPECT_FALSE(end);
+      available += input_step;
+    } else if (result.status == TranscodeStatus::kError) {
+      EXPECT_EQ(policy, ErrorPolicy::kStop);
+      break;
+    }
+  }
+  return output;
+}
+
+TEST(Transcode, SameAsWholeInput) {
+  for (Encoding from : kEncodings) {
+    std::string input = Input(from);
+    for (Encoding to : kEncodings) {
+      for (ErrorPolicy policy :
+           {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+        std::string expected = Encode(Decode(input, from, policy), to, policy);
+        std::string output(4 * input.size() + 4, '\0');
+        TranscodeResult result =
+            Transcode(from, to, Bytes(input), input.size(),
+                      reinterpret_cast<uint8_t*>(&output[0]), output.size(),
+                      policy);
+        if (policy != ErrorPolicy::kStop) {
+          EXPECT_EQ(result.status, TranscodeStatus::kDone);
+          EXPECT_EQ(result.consumed, input.size());
+        }
+        output.resize(result.produced);
+        EXPECT_EQ(output, expected);
+
+        for (size_t input_step : {1, 3, 1000}) {
+          for (size_t output_step : {4, 7, 500}) {
+            EXPECT_EQ(TranscodeInSteps(from, to, input, policy, input_step,
+                                       output_step),
+                      expected);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(Transcode, Status) {
+  uint8_t output[8];
+  std::string input = "ab\xE2\x82\xAC" "c";
+
+  // a character is either written whole or not at all
+  TranscodeResult result = Transcode(Encoding::kUtf8, Encoding::kUtf16Le,
+                                     Bytes(input), input.size(), output, 5);
+  EXPECT_EQ(result.status, TranscodeStatus::kOutputFull);
+  EXPECT_EQ(result.consumed, 2);
+  EXPECT_EQ(result.produced, 4);
+  result = Transcode(Encoding::kUtf8, Encoding::kUtf8, Bytes(input),
+                     input.size(), output, 4);
+  EXPECT_EQ(result.status, TranscodeStatus::kOutputFull);
+  EXPECT_EQ(result.consumed, 2);
+  EXPECT_EQ(result.produced, 2);
+
+  // a truncated character is kept for the following input
+  result = Transcode(Encoding::kUtf8, Encoding::kUtf16Be, Bytes(input), 4,
+                     output, sizeof(output), ErrorPolicy::kStop,
+                     /*end_of_input = */ false);
+  EXPECT_EQ(result.status, TranscodeStatus::kNeedMoreInput);
+  EXPECT_EQ(result.consumed, 2);
+  result = Transcode(Encoding::kUtf8, Encoding::kUtf16Be, Bytes(input), 4,
+                     output, sizeof(output), ErrorPolicy::kStop);
+  EXPECT_EQ(result.status, TranscodeStatus::kError);
+  EXPECT_EQ(result.consumed, 2);
+  result = Transcode(Encoding::kUtf16Le, Encoding::kUtf8, Bytes(input), 3,
+                     output, sizeof(output), ErrorPolicy::kReplace, false);
+  EXPECT_EQ(result.status, TranscodeStatus::kNeedMoreInput);
+  EXPECT_EQ(result.consumed, 2);
+
+  // unrepresentable characters are errors in Latin-1
+  result = Transcode(Encoding::kUtf8, Encoding::kLatin1, Bytes(input),
+                     input.size(), output, sizeof(output), ErrorPolicy::kStop);
+  EXPECT_EQ(result.status, TranscodeStatus::kError);
+  EXPECT_EQ(result.consumed, 2);
+  EXPECT_EQ(result.produced, 2);
+  result = Transcode(Encoding::kUtf8, Encoding::kLatin1, Bytes(input),
+                     input.size(), output, sizeof(output));
+  EXPECT_EQ(result.status, TranscodeStatus::kDone);
+  EXPECT_EQ(std::string(output, output + result.produced), "ab?c");
+#if defined(__cpp_lib_span)
+  result = Transcode(Encoding::kUtf8, Encoding::kLatin1,
+                     std::span<const uint8_t>(Bytes(input), input.size()),
+                     std::span<uint8_t>(output));
+  EXPECT_EQ(result.produced, 4);
+#endif
+
+  result = Transcode(Encoding::kUtf8, Encoding::kUtf16Le, nullptr, 0, nullptr,
+                     0);
+  EXPECT_EQ(result.status, TranscodeStatus::kDone);
+  EXPECT_EQ(result.produced, 0);
+}
+
+TEST(Transcode, Utf32) {
+  std::u32string chars = U"a\xE9\x20AC\U0001F600";
+  chars += char32_t{0xD800};
+  uint8_t output[16];
+  TranscodeResult result = TranscodeFromUtf32(
+      chars.data(), chars.size(), Encoding::kUtf8, output, sizeof(output));
+  EXPECT_EQ(result.status, TranscodeStatus::kDone);
+  EXPECT_EQ(std::string(output, output + result.produced),
+            "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xEF\xBF\xBD");
+  result = TranscodeFromUtf32(chars.data(), chars.size(), Encoding::kUtf16Le,
+                              output, 9, ErrorPolicy::kSkip);
+  EXPECT_EQ(result.status, TranscodeStatus::kOutputFull);
+  EXPECT_EQ(result.consumed, 3);
+  EXPECT_EQ(result.produced, 6);
+
+  std::string utf8 = "a\xF0\x9F\x98\x80\xF0\x9F";
+  char32_t decoded[4];
+  result = TranscodeToUtf32(Encoding::kUtf8, Bytes(utf8), utf8.size(),
+                            decoded, 4, ErrorPolicy::kReplace, false);
+  EXPECT_EQ(result.status, TranscodeStatus::kNeedMoreInput);
+  EXPECT_EQ(result.consumed, 5);
+  EXPECT_EQ(std::u32string(decoded, decoded + result.produced),
+            U"a\U0001F600");
+  result = TranscodeToUtf32(Encoding::kUtf8, Bytes(utf8), utf8.size(),
+                            decoded, 4);
+  EXPECT_EQ(result.status, TranscodeStatus::kDone);
+  EXPECT_EQ(std::u32string(decoded, decoded + result.produced),
+            U"a\U0001F600\xFFFD\xFFFD");
+}
+
+}  // namespace
+}  // namespace unicpp
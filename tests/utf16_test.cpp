@@ -1,7 +1,15 @@
 #include "unicpp/utf16.h"
 
+#include "unicpp/simd_level.h"
+
+#include "tests/simd_levels.h"
+
 #include "gtest/gtest.h"
 
+#include <forward_list>
+#include <list>
+#include <sstream>
+
 namespace unicpp {
 namespace {
 
@@ -52,5 +60,258 @@ TEST(Utf16, NotBigEnoughChar) {
   }
 }
 
+TEST(Utf16, DecodeSurrogates) {
+  EXPECT_EQ(
+      Utf16LeWstring<std::u32string>(std::string_view("\x01\xD8\x37\xDC", 4)),
+      U"\x10437");
+  EXPECT_EQ(
+      Utf16BeWstring<std::u32string>(std::string_view("\xD8\x01\xDC\x37", 4)),
+      U"\x10437");
+
+  // low surrogate followed by a high one is not a pair
+  std::string_view reversed("\x37\xDC\x01\xD8", 4);
+  EXPECT_EQ(Utf16LeWstring<std::u32string>(reversed), U"\xFFFD\xFFFD");
+  EXPECT_EQ(Utf16LeWstring<std::u32string>(reversed, ErrorPolicy::kSkip),
+            U"");
+
+  // an error skips a whole code unit, or a trailing odd byte
+  std::string_view unpaired("\x01\xD8\x41\x00\x42", 5);
+  EXPECT_EQ(Utf16LeWstring<std::u32string>(unpaired), U"\xFFFD" U"A\xFFFD");
+  size_t decoded = 0;
+  EXPECT_EQ(
+      Utf16LeWstring<std::u32string>(unpaired, ErrorPolicy::kStop, &decoded),
+      U"");
+  EXPECT_EQ(decoded, 0);
+}
+
+TEST(Utf16, DecodeUnits) {
+  std::u16string units = u"A\U00010437\xDC37" u"B";
+  std::u32string decoded;
+  EXPECT_EQ(Utf16Decode(units.begin(), units.end(), std::back_inserter(decoded),
+                        ErrorPolicy::kReplace),
+            units.size());
+  EXPECT_EQ(decoded, U"A\x10437\xFFFD" U"B");
+
+  char32_t buffer[4] = {};
+  EXPECT_EQ(Utf16Decode(units.data(), units.data() + units.size(), buffer,
+                        ErrorPolicy::kReplace),
+            units.size());
+  EXPECT_EQ(std::u32string_view(buffer, 4), decoded);
+}
+
+TEST(Utf16, PrevCodePoint) {
+  const std::u16string units = u"\xDC37" u"A\U00010437\xD801\xD801\xDC37" u"B\xD801";
+  const char16_t* iter = units.data() + units.size();
+  std::u32string backward;
+  while (iter != units.data()) {
+    backward.push_back(Utf16PrevCodePoint(units.data(), iter));
+  }
+  EXPECT_EQ(backward, std::u32string({kInvalidCharacter, U'B', 0x10437,
+                                      kInvalidCharacter, 0x10437, U'A',
+                                      kInvalidCharacter}));
+
+  std::string bytes("\x01\xD8\x37\xDC\x00\xDC", 6);
+  auto bytes_iter = bytes.end();
+  EXPECT_EQ(Utf16PrevCodePoint(bytes.begin(), bytes_iter), kInvalidCharacter);
+  EXPECT_EQ(Utf16PrevCodePoint(bytes.begin(), bytes_iter), U'\x10437');
+  EXPECT_TRUE(bytes_iter == bytes.begin());
+
+  bytes_iter = bytes.end();
+  EXPECT_EQ((Utf16PrevCodePoint<std::string::iterator, Endian::kBig>(
+                bytes.begin(), bytes_iter)),
+            U'\xDC');
+}
+
+TEST(Utf16, DecodeForwardAndInputIterators) {
+  std::string text;
+  for (int i = 0; i < 1000; i++) {
+    text += std::string("A\x00\x01\xD8\x37\xDC", 6);
+    // unpaired surrogates
+    text += i % 2 == 0 ? std::string("\x01\xD8\x41\x00", 4)
+                       : std::string("\x37\xDC", 2);
+  }
+  text += 'B';  // trailing odd byte
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::u32string expected;
+    size_t expected_decoded = Utf16LeDecode(
+        text.begin(), text.end(), std::back_inserter(expected), policy);
+
+    std::forward_list<char> list(text.begin(), text.end());
+    std::u32string from_list;
+    EXPECT_EQ(Utf16LeDecode(list.begin(), list.end(),
+                            std::back_inserter(from_list), policy),
+              expected_decoded);
+    EXPECT_EQ(from_list, expected);
+
+    std::istringstream stream(text);
+    std::u32string from_stream;
+    EXPECT_EQ(Utf16LeDecode(std::istreambuf_iterator<char>(stream),
+                            std::istreambuf_iterator<char>(),
+                            std::back_inserter(from_stream), policy),
+              expected_decoded);
+    EXPECT_EQ(from_stream, expected);
+  }
+}
+
+TEST(Utf16, DecodeContiguous) {
+  // long enough for the vectorized code and for several buffered pieces,
+  // with surrogate pairs and unpaired surrogates at all the positions
+  std::u16string units;
+  for (int i = 0; i < 400; i++) {
+    units += u"Lorem ipsum \x416\x4E2D\U0001F600";
+    units.append(i % 9, u'.');
+    units += i % 4 == 0 ? u'\xD800' : i % 4 == 1 ? u'\xDFFF' : u'\xFFFF';
+    units.append(i % 7, u'x');
+  }
+  std::string le;
+  std::string be;
+  for (char16_t unit : units) {
+    le += static_cast<char>(unit & 0xFF);
+    le += static_cast<char>(unit >> 8);
+    be += static_cast<char>(unit >> 8);
+    be += static_cast<char>(unit & 0xFF);
+  }
+
+  for (SimdLevel level : SupportedLevels()) {
+    ScopedSimdLevel scoped(level);
+    for (const std::string& text : {le, le + 'B', le + "\x01\xD8"}) {
+      std::forward_list<char> list(text.begin(), text.end());
+      for (ErrorPolicy policy :
+           {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+        std::u32string expected;
+        size_t expected_decoded = Utf16LeDecode(
+            list.begin(), list.end(), std::back_inserter(expected), policy);
+
+        std::u32string chars;
+        EXPECT_EQ(Utf16LeDecode(text.begin(), text.end(),
+                                std::back_inserter(chars), policy),
+                  expected_decoded)
+            << SimdLevelName(level);
+        EXPECT_EQ(chars, expected) << SimdLevelName(level);
+        size_t decoded = 0;
+        EXPECT_EQ(Utf16LeWstring<std::u32string>(text, policy, &decoded),
+                  expected)
+            << SimdLevelName(level);
+        EXPECT_EQ(decoded, expected_decoded) << SimdLevelName(level);
+      }
+    }
+    EXPECT_EQ(Utf16BeWstring<std::u32string>(be),
+              Utf16LeWstring<std::u32string>(le))
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf16BeWstring<std::u32string>(be, ErrorPolicy::kStop).size(),
+              15)
+        << SimdLevelName(level);
+  }
+}
+
+TEST(Utf16, ValidationAndStats) {
+  std::u16string units = u"a\x4E2D\U0001F600";
+  EXPECT_EQ(Utf16ValidPrefixLength(units), 4);
+  EXPECT_EQ(Utf16NumValidChars(units), 3);
+  EXPECT_EQ(Utf16NumCharsWithReplacement(units), 3);
+
+  units += u"\xDE00\xD800" u"b";
+  EXPECT_EQ(Utf16ValidPrefixLength(units), 4);
+  EXPECT_EQ(Utf16NumValidChars(units), 3);
+  EXPECT_EQ(Utf16NumCharsWithReplacement(units), 6);
+
+  EXPECT_EQ(Utf16LeValidPrefixLength(std::string("a\0\x3D\xD8\0\xDE", 6)), 6);
+  EXPECT_EQ(Utf16BeValidPrefixLength(std::string("\0a\xD8\x3D\xDE", 5)), 2);
+  EXPECT_EQ(Utf16BeNumValidChars(std::string("\0a\xD8\x3D\xDE\0", 6)), 2);
+  EXPECT_EQ(Utf16LeNumCharsWithReplacement(std::string("a\0\x3D", 3)), 2);
+  EXPECT_EQ(Utf16LeNumCharsWithReplacement(std::string()), 0);
+}
+
+TEST(Utf16, ValidationAndStatsContiguous) {
+  // surrogate pairs and unpaired surrogates at all the positions of the blocks
+  std::u16string units;
+  for (int i = 0; i < 300; i++) {
+    units += u"Lorem ipsum \x416\x4E2D\U0001F600";
+    units.append(i % 9, u'.');
+    units += i % 5 == 0 ? u'\xD800' : i % 5 == 1 ? u'\xDFFF' : u'\xFFFF';
+    units.append(i % 7, u'x');
+  }
+  std::string le;
+  std::string be;
+  for (char16_t unit : units) {
+    le += static_cast<char>(unit & 0xFF);
+    le += static_cast<char>(unit >> 8);
+    be += static_cast<char>(unit >> 8);
+    be += static_cast<char>(unit & 0xFF);
+  }
+
+  for (SimdLevel level : SupportedLevels()) {
+    ScopedSimdLevel scoped(level);
+    for (size_t size = 0; size <= le.size(); size += 1 + size / 8) {
+      std::forward_list<char> list(le.begin(), le.begin() + size);
+      std::u32string valid;
+      size_t valid_size = Utf16LeDecode(list.begin(), list.end(),
+                                        std::back_inserter(valid),
+                                        ErrorPolicy::kStop);
+      std::u32string replaced;
+      Utf16LeDecode(list.begin(), list.end(), std::back_inserter(replaced),
+                    ErrorPolicy::kReplace);
+
+      std::string_view le_bytes = std::string_view(le).substr(0, size);
+      std::string_view be_bytes = std::string_view(be).substr(0, size);
+      std::u16string_view native =
+          std::u16string_view(units).substr(0, size / 2);
+      EXPECT_EQ(Utf16LeValidPrefixLength(le_bytes), valid_size) << size;
+      EXPECT_EQ(Utf16BeValidPrefixLength(be_bytes), valid_size) << size;
+      EXPECT_EQ(Utf16ValidPrefixLength(native), valid_size / 2) << size;
+      EXPECT_EQ(Utf16LeNumValidChars(le_bytes), valid.size()) << size;
+      EXPECT_EQ(Utf16BeNumValidChars(be_bytes), valid.size()) << size;
+      EXPECT_EQ(Utf16NumValidChars(native), valid.size()) << size;
+      EXPECT_EQ(Utf16LeNumCharsWithReplacement(le_bytes), replaced.size())
+          << size;
+      EXPECT_EQ(Utf16BeNumCharsWithReplacement(be_bytes), replaced.size())
+          << size;
+      if (size % 2 == 0) {
+        EXPECT_EQ(Utf16NumCharsWithReplacement(native), replaced.size())
+            << size;
+      }
+    }
+  }
+}
+
+TEST(Utf16, EncodeContiguous) {
+  std::u32string text;
+  for (int i = 0; i < 100; i++) {
+    text += U"Lorem ipsum \x416\x4E2D\U0001F600 ";
+    text += static_cast<char32_t>(i % 2 == 0 ? 0xD800 : 0x110000);
+  }
+  EXPECT_EQ(Utf16LengthFromUtf32(U""), 0);
+  EXPECT_EQ(Utf16LengthFromUtf32(U"a\x416\x4E2D\U0001F600"), 5);
+  EXPECT_EQ(Utf16LengthFromUtf32(text), 100 * 18);
+
+  std::list<char32_t> list(text.begin(), text.end());
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::string expected_le;
+    size_t expected_encoded = Utf16LeEncode(
+        list.begin(), list.end(), std::back_inserter(expected_le), policy);
+    std::string expected_be;
+    Utf16BeEncode(list.begin(), list.end(), std::back_inserter(expected_be),
+                  policy);
+
+    size_t encoded = 0;
+    EXPECT_EQ(Utf16LeBytes<std::string>(text, policy, &encoded), expected_le);
+    EXPECT_EQ(encoded, expected_encoded);
+    EXPECT_EQ(Utf16BeBytes<std::string>(text, policy, &encoded), expected_be);
+    EXPECT_EQ(encoded, expected_encoded);
+  }
+}
+
+TEST(Utf16, EncodeSkip) {
+  std::u32string text = U"A";
+  text += kInvalidCharacter;
+  text += U'Z';
+
+  EXPECT_EQ(Utf16LeBytes<std::string>(text, ErrorPolicy::kSkip),
+            std::string("A\x00Z\x00", 4));
+}
+
 }  // namespace
 }  // namespace unicpp
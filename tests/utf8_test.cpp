@@ -4,7 +4,11 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <forward_list>
 #include <fstream>
+#include <list>
+#include <sstream>
 #include <vector>
 
 namespace unicpp {
@@ -50,6 +54,343 @@ TEST(Utf8, DecodeAndEncode) {
   EXPECT_EQ(view, encoded);
 }
 
+TEST(Utf8, DecodeWithErrors) {
+  std::vector<char> data = LoadDataFile("unicpp/tests/data/utf8_text.txt");
+  std::string text(data.begin(), data.end());
+  for (size_t pos : {1000, 700, 500, 130, 129, 128, 64, 3}) {
+    text.insert(pos, "\xE4\xB8\x80\xC0");
+  }
+  std::list<char> list(text.begin(), text.end());
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::u32string expected;
+    size_t expected_decoded = Utf8Decode(
+        list.begin(), list.end(), std::back_inserter(expected), policy);
+
+    size_t decoded = 0;
+    EXPECT_EQ(Utf8Wstring<std::u32string>(text, policy, &decoded), expected);
+    EXPECT_EQ(decoded, expected_decoded);
+
+    std::u32string buffer(text.size(), U'\0');
+    EXPECT_EQ(Utf8Decode(text.begin(), text.end(), buffer.begin(), policy),
+              expected_decoded);
+    EXPECT_EQ(buffer.substr(0, expected.size()), expected);
+  }
+}
+
+TEST(Utf8, DecodeDirtyText) {
+  // invalid sequences of every kind spread densely enough to hit most chunks
+  // of the vectorized decoder, including ones crossing chunk boundaries
+  const char* const kPieces[] = {
+      "Lorem ipsum ",
+      "\xD0\x96\xE4\xB8\xAD",
+      "\xF0\x9F\x98\x80",
+      "\xC0\xAF",
+      "\xE0\x80\xAF",
+      "\xED\xA0\x80",
+      "\xF4\x90\x80\x80",
+      "\xF8",
+      "\x80\xBF",
+      "\xE4\xB8",
+      "\xF0\x9F\x98",
+      "dolor sit amet, ",
+  };
+  std::string text;
+  for (size_t i = 0; text.size() < 5000; i++) {
+    text += kPieces[(i * 7 + i / 5) % std::size(kPieces)];
+    if (i % 16 == 0) {
+      text += std::string(i % 150, 'a');
+    }
+  }
+  std::list<char> list(text.begin(), text.end());
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::u32string expected;
+    size_t expected_decoded = Utf8Decode(
+        list.begin(), list.end(), std::back_inserter(expected), policy);
+    if (policy != ErrorPolicy::kStop) {
+      EXPECT_EQ(expected_decoded, text.size());
+    }
+
+    size_t decoded = 0;
+    EXPECT_EQ(Utf8Wstring<std::u32string>(text, policy, &decoded), expected);
+    EXPECT_EQ(decoded, expected_decoded);
+
+    std::u32string from_string;
+    EXPECT_EQ(Utf8Decode(text.begin(), text.end(),
+                         std::back_inserter(from_string), policy),
+              expected_decoded);
+    EXPECT_EQ(from_string, expected);
+  }
+}
+
+TEST(Utf8, StreamDecoder) {
+  std::string text;
+  for (int i = 0; i < 20; i++) {
+    text += "Lorem ipsum \xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80 dolor sit amet";
+    if (i % 5 == 4) {
+      text += "\xF0\x9F\x98!\xED\xA0\x80\xE4\xB8";
+    }
+  }
+  text += "\xF0\x9F\x98";
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::u32string expected;
+    size_t expected_decoded = Utf8Decode(
+        text.begin(), text.end(), std::back_inserter(expected), policy);
+
+    for (size_t chunk_size : {1, 2, 3, 5, 64, 100, 1000}) {
+      Utf8StreamDecoder decoder(policy);
+      std::u32string decoded;
+      for (size_t pos = 0; pos < text.size(); pos += chunk_size) {
+        std::string_view chunk = std::string_view(text).substr(pos, chunk_size);
+        size_t offset = decoded.size();
+        decoded.resize(offset + decoder.pending_size() + chunk.size());
+        TranscodeResult result = decoder.Feed(chunk, &decoded[offset],
+                                              decoded.size() - offset);
+        EXPECT_NE(result.status, TranscodeStatus::kOutputFull);
+        if (!decoder.failed()) {
+          EXPECT_EQ(result.consumed, chunk.size());
+        }
+        decoded.resize(offset + result.produced);
+        EXPECT_LE(decoder.pending_size(), Utf8StreamDecoder::kMaxPendingBytes);
+      }
+      size_t offset = decoded.size();
+      decoded.resize(offset + Utf8StreamDecoder::kMaxPendingBytes);
+      TranscodeResult result = decoder.Finish(
+          &decoded[offset], Utf8StreamDecoder::kMaxPendingBytes);
+      EXPECT_NE(result.status, TranscodeStatus::kOutputFull);
+      decoded.resize(offset + result.produced);
+
+      EXPECT_EQ(decoded, expected) << chunk_size;
+      EXPECT_EQ(decoder.bytes_decoded(), expected_decoded) << chunk_size;
+      EXPECT_EQ(decoder.failed(), policy == ErrorPolicy::kStop) << chunk_size;
+      EXPECT_EQ(decoder.pending_size(), 0);
+    }
+  }
+
+  Utf8StreamDecoder decoder;
+  char32_t output[4];
+  EXPECT_EQ(decoder.Feed("\xF0\x9F", output, 4).produced, 0);
+  EXPECT_EQ(decoder.Feed("\x98", output, 4).consumed, 1);
+  EXPECT_EQ(decoder.pending_size(), 3);
+  EXPECT_EQ(decoder.Feed("\x80z", output, 4).produced, 2);
+  EXPECT_EQ(std::u32string(output, 2), U"\U0001F600z");
+  decoder.Reset();
+  EXPECT_EQ(decoder.Feed("\xE4", output, 4).produced, 0);
+  EXPECT_EQ(decoder.Finish(output, 4).produced, 1);
+  EXPECT_EQ(output[0], kReplacementCharacter);
+  EXPECT_EQ(decoder.bytes_decoded(), 1);
+}
+
+TEST(Utf8, StreamDecoderOutputFull) {
+  std::string text;
+  for (int i = 0; i < 40; i++) {
+    text += "abc\xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80\xEF\xBF\xBD";
+    text += i % 3 == 0 ? "\xF0\x9F\xE4\x80\x80" : "\xC0\xAF";
+    text.append(i, 'x');
+  }
+  text += "\xF0\x9F\x98";
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::u32string expected;
+    Utf8Decode(text.begin(), text.end(), std::back_inserter(expected), policy);
+
+    for (size_t chunk_size : {1, 2, 7, 100, 1000}) {
+      for (size_t output_size : {1, 2, 3, 70, 200}) {
+        Utf8StreamDecoder decoder(policy);
+        std::u32string decoded;
+        std::vector<char32_t> output(output_size);
+        for (size_t pos = 0; pos < text.size() && !decoder.failed();
+             pos += chunk_size) {
+          std::string_view chunk =
+              std::string_view(text).substr(pos, chunk_size);
+          TranscodeResult result;
+          do {
+            result = decoder.Feed(chunk, output.data(), output.size());
+            decoded.append(output.data(), result.produced);
+            chunk.remove_prefix(result.consumed);
+          } while (result.status == TranscodeStatus::kOutputFull);
+        }
+        TranscodeResult result;
+        do {
+          result = decoder.Finish(output.data(), output.size());
+          decoded.append(output.data(), result.produced);
+        } while (result.status == TranscodeStatus::kOutputFull);
+
+        EXPECT_EQ(decoded, expected) << chunk_size << " " << output_size;
+        EXPECT_EQ(decoder.pending_size(), 0);
+      }
+    }
+  }
+
+  // the pending bytes of an invalid sequence take several calls
+  Utf8StreamDecoder decoder;
+  char32_t output[2];
+  EXPECT_EQ(decoder.Feed("\xF0\x9F\x98", output, 2).consumed, 3);
+  TranscodeResult result = decoder.Feed("z", output, 2);
+  EXPECT_EQ(result.status, TranscodeStatus::kOutputFull);
+  EXPECT_EQ(result.consumed, 0);
+  EXPECT_EQ(result.produced, 2);
+  result = decoder.Feed("z", output, 2);
+  EXPECT_EQ(result.status, TranscodeStatus::kDone);
+  EXPECT_EQ(result.consumed, 1);
+  EXPECT_EQ(std::u32string(output, result.produced), U"\xFFFDz");
+  EXPECT_EQ(decoder.Feed("\xE4\xB8", output, 0).consumed, 2);
+  result = decoder.Finish(output, 1);
+  EXPECT_EQ(result.status, TranscodeStatus::kOutputFull);
+  EXPECT_EQ(result.produced, 1);
+  EXPECT_EQ(decoder.Finish(output, 1).status, TranscodeStatus::kDone);
+  EXPECT_EQ(decoder.Finish(output, 1).produced, 0);
+  EXPECT_EQ(decoder.bytes_decoded(), 6);
+
+#if defined(__cpp_lib_span)
+  decoder.Reset();
+  std::span<char32_t> span(output);
+  EXPECT_EQ(decoder.Feed("\xD0", span).produced, 0);
+  EXPECT_EQ(decoder.Feed("\x96", span.first(0)).status,
+            TranscodeStatus::kOutputFull);
+  EXPECT_EQ(decoder.Feed("\x96", span).produced, 1);
+  EXPECT_EQ(output[0], U'\x416');
+  EXPECT_EQ(decoder.Finish(span).status, TranscodeStatus::kDone);
+#endif
+}
+
+TEST(Utf8, PrevCodePoint) {
+  const std::string text =
+      "\x80\xBF" "a\xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80" "b\xC2\x80\x80\x80\x80"
+      "\xE0\x80\xAF\xED\xA0\x80\xF4\x90\x80\x80\xE4\xB8" "c\xF0\x9F\x98";
+  std::u32string forward;
+  Utf8Decode(text.begin(), text.end(), std::back_inserter(forward),
+             ErrorPolicy::kReplace);
+
+  std::u32string backward;
+  const char* iter = text.data() + text.size();
+  while (iter != text.data()) {
+    char32_t ch = Utf8PrevCodePoint(text.data(), iter);
+    backward.push_back(ch == kInvalidCharacter ? kReplacementCharacter : ch);
+  }
+  std::reverse(backward.begin(), backward.end());
+  EXPECT_EQ(backward, forward);
+
+  std::list<char> list(text.begin(), text.end());
+  auto list_iter = list.end();
+  EXPECT_EQ(Utf8PrevCodePoint(list.begin(), list_iter), kInvalidCharacter);
+  EXPECT_EQ(std::distance(list_iter, list.end()), 1);
+  EXPECT_EQ(Utf8PrevCodePoint(list.begin(), list_iter), kInvalidCharacter);
+  EXPECT_EQ(Utf8PrevCodePoint(list.begin(), list_iter), kInvalidCharacter);
+  EXPECT_EQ(Utf8PrevCodePoint(list.begin(), list_iter), U'c');
+}
+
+TEST(Utf8, CodePointIndex) {
+  const char* const kPieces[] = {
+      "\xD0\x96\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "\xE4\xB8",
+      "\x80\xBF",             "\xED\xA0\x80",     "Lorem ipsum ",
+  };
+  std::string text;
+  for (size_t i = 0; text.size() < 20000; i++) {
+    text += kPieces[(i * 7 + i / 5) % std::size(kPieces)];
+    if (i % 16 == 0) {
+      text += std::string(i % 700, 'a');
+    }
+  }
+
+  std::vector<size_t> offsets;
+  for (auto iter = text.begin(); iter != text.end();) {
+    offsets.push_back(iter - text.begin());
+    detail::Utf8DecodeCharacter(iter, text.end());
+  }
+  offsets.push_back(text.size());
+
+  Utf8CodePointIndex index(text);
+  ASSERT_EQ(index.size(), offsets.size() - 1);
+  for (size_t i = 0; i < offsets.size(); i++) {
+    EXPECT_EQ(index.ByteOffset(i), offsets[i]) << " i = " << i;
+    for (size_t pos = offsets[i]; pos < offsets[i] + 4 && pos <= text.size();
+         pos++) {
+      if (i + 1 == offsets.size() || pos < offsets[i + 1]) {
+        EXPECT_EQ(index.CharIndex(pos), i) << " pos = " << pos;
+      }
+    }
+  }
+  EXPECT_EQ(index.ByteOffset(offsets.size() + 10), text.size());
+
+  EXPECT_EQ(index.Substr(300, 1000),
+            std::string_view(text).substr(offsets[300],
+                                          offsets[1300] - offsets[300]));
+  EXPECT_EQ(index.Substr(1000), std::string_view(text).substr(offsets[1000]));
+  EXPECT_EQ(index.Substr(index.size() + 1), "");
+
+  EXPECT_EQ(Utf8CodePointIndex("").size(), 0);
+  EXPECT_EQ(Utf8CodePointIndex("").Substr(0), "");
+}
+
+TEST(Utf8, DecodeForwardAndInputIterators) {
+  std::string text;
+  for (int i = 0; i < 1000; i++) {
+    text += "a\xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80";
+    text += i % 2 == 0 ? "\xE4\xB8!" : "\xF0\x9F\x98";
+  }
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::u32string expected;
+    size_t expected_decoded =
+        Utf8Decode(text.begin(), text.end(), std::back_inserter(expected),
+                   policy);
+
+    std::forward_list<char> list(text.begin(), text.end());
+    std::u32string from_list;
+    EXPECT_EQ(Utf8Decode(list.begin(), list.end(),
+                         std::back_inserter(from_list), policy),
+              expected_decoded);
+    EXPECT_EQ(from_list, expected);
+
+    std::istringstream stream(text);
+    std::u32string from_stream;
+    EXPECT_EQ(Utf8Decode(std::istreambuf_iterator<char>(stream),
+                         std::istreambuf_iterator<char>(),
+                         std::back_inserter(from_stream), policy),
+              expected_decoded);
+    EXPECT_EQ(from_stream, expected);
+  }
+
+  std::istringstream stream("\xD0\x96z\xD0");
+  std::u32string bounded(2, U'\0');
+  EXPECT_EQ(Utf8Decode(std::istreambuf_iterator<char>(stream),
+                       std::istreambuf_iterator<char>(), bounded.begin(),
+                       bounded.end()),
+            3);
+  EXPECT_EQ(bounded, U"\x416z");
+}
+
+TEST(Utf8, DecodeMostlyAscii) {
+  std::string text;
+  for (int i = 0; i < 10; i++) {
+    text += "Lorem ipsum dolor sit amet, \xD0\x96 consectetur";
+  }
+  std::list<char> list(text.begin(), text.end());
+
+  std::u32string expected;
+  Utf8Decode(list.begin(), list.end(), std::back_inserter(expected));
+  ASSERT_EQ(expected.size(), text.size() - 10);
+
+  std::vector<uint8_t> bytes(text.begin(), text.end());
+  EXPECT_EQ(Utf8Wstring<std::u32string>(bytes), expected);
+  EXPECT_EQ(Utf8Wstring<std::u32string>(text), expected);
+
+  std::u32string bounded(expected.size(), U'\0');
+  EXPECT_EQ(Utf8Decode(text.data(), text.data() + text.size(), bounded.begin(),
+                       bounded.begin() + 13),
+            13);
+  EXPECT_EQ(bounded.substr(0, 13), expected.substr(0, 13));
+  EXPECT_EQ(bounded[13], U'\0');
+}
+
 TEST(Utf8, DecodeExotic) {
   std::string_view encoded = "\xe0\xa0\x80";
 
@@ -114,6 +455,134 @@ TEST(Utf8, Validation) {
   EXPECT_EQ(Utf8NumValidChars(valid_ascii_text), valid_ascii_text.length());
 }
 
+TEST(Utf8, FindErrors) {
+  struct Case {
+    std::string_view bytes;
+    size_t length;
+    Utf8ErrorKind kind;
+  };
+  const Case kCases[] = {
+      {"\x80\xBF\x80", 3, Utf8ErrorKind::kUnexpectedContinuation},
+      {"\xC0\xAF", 2, Utf8ErrorKind::kOverlong},
+      {"\xC1", 1, Utf8ErrorKind::kOverlong},
+      {"\xE0\x9F\xBF", 3, Utf8ErrorKind::kOverlong},
+      {"\xF0\x8F\xBF\xBF", 4, Utf8ErrorKind::kOverlong},
+      {"\xED\xA0\x80", 3, Utf8ErrorKind::kSurrogate},
+      {"\xF4\x90\x80\x80", 4, Utf8ErrorKind::kOutOfRange},
+      {"\xF5\x80\x80\x80", 4, Utf8ErrorKind::kOutOfRange},
+      {"\xFF", 1, Utf8ErrorKind::kOutOfRange},
+      {"\xE4\xB8", 2, Utf8ErrorKind::kTruncated},
+      {"\xF0\x9F\x98", 3, Utf8ErrorKind::kTruncated},
+      {"\xE0", 1, Utf8ErrorKind::kTruncated},
+  };
+
+  std::string text;
+  std::vector<Utf8Error> expected;
+  for (size_t i = 0; i < 200; i++) {
+    const Case& error = kCases[i % std::size(kCases)];
+    text += std::string(i * 3, 'a') + "\xD0\x96";
+    expected.push_back({text.size(), error.length, error.kind});
+    text += error.bytes;
+  }
+  // the last one is truncated by the end
+  expected.push_back({text.size(), 3, Utf8ErrorKind::kTruncated});
+  text += "\xF0\x9F\x98";
+
+  std::vector<Utf8Error> errors = Utf8FindErrors(text);
+  ASSERT_EQ(errors.size(), expected.size());
+  for (size_t i = 0; i < errors.size(); i++) {
+    EXPECT_EQ(errors[i].offset, expected[i].offset) << " i = " << i;
+    EXPECT_EQ(errors[i].length, expected[i].length) << " i = " << i;
+    EXPECT_EQ(errors[i].kind, expected[i].kind) << " i = " << i;
+  }
+
+  EXPECT_TRUE(Utf8FindErrors("Hello, \xE4\xB8\xAD").empty());
+}
+
+TEST(Utf8, ValidationLongText) {
+  std::string text;
+  std::vector<size_t> boundaries;
+  while (text.size() < 300) {
+    for (std::string_view ch : {"a", "\xD0\x96", "\xE4\xB8\xAD", "z",
+                                "\xF0\x9F\x98\x80", "\xEF\xBF\xBD", "0"}) {
+      boundaries.push_back(text.size());
+      text += ch;
+    }
+  }
+  boundaries.push_back(text.size());
+
+  EXPECT_EQ(Utf8ValidPrefixLength(text), text.size());
+  EXPECT_EQ(Utf8NumValidChars(text), boundaries.size() - 1);
+  EXPECT_EQ(Utf8NumCharsWithReplacement(text), boundaries.size() - 1);
+
+  for (size_t chars = 0; chars < boundaries.size(); chars++) {
+    size_t boundary = boundaries[chars];
+    for (std::string_view error :
+         {"\x80", "\xC1\x80", "\xE0\x9F\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80",
+          "\xF8", "\xE4\xB8!", "\xF0\x9F\x98"}) {
+      std::string broken = text.substr(0, boundary);
+      broken += error;
+      broken += text.substr(boundary);
+      EXPECT_EQ(Utf8ValidPrefixLength(broken), boundary)
+          << " boundary = " << boundary;
+
+      EXPECT_EQ(Utf8NumValidChars(broken), chars) << " boundary = " << boundary;
+      std::u32string replaced;
+      Utf8Decode(broken.begin(), broken.end(), std::back_inserter(replaced),
+                 ErrorPolicy::kReplace);
+      EXPECT_EQ(Utf8NumCharsWithReplacement(broken), replaced.size())
+          << " boundary = " << boundary;
+    }
+  }
+
+  for (size_t length = 0; length <= text.size(); length++) {
+    size_t expected = *(std::upper_bound(boundaries.begin(), boundaries.end(),
+                                         length) -
+                        1);
+    EXPECT_EQ(Utf8ValidPrefixLength(std::string_view(text).substr(0, length)),
+              expected)
+        << " length = " << length;
+  }
+}
+
+TEST(Utf8, EncodeContiguous) {
+  std::u32string text;
+  for (int i = 0; i < 100; i++) {
+    text += U"Lorem ipsum \x416\x4E2D\U0001F600 ";
+    text += static_cast<char32_t>(i % 2 == 0 ? 0xD800 : 0x110000);
+  }
+  EXPECT_EQ(Utf8LengthFromUtf32(U""), 0);
+  EXPECT_EQ(Utf8LengthFromUtf32(U"a\x416\x4E2D\U0001F600"), 10);
+  EXPECT_EQ(Utf8LengthFromUtf32(text), 100 * 25);
+
+  std::list<char32_t> list(text.begin(), text.end());
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::string expected;
+    size_t expected_encoded =
+        Utf8Encode(list.begin(), list.end(), std::back_inserter(expected),
+                   policy);
+
+    size_t encoded = 0;
+    EXPECT_EQ(Utf8Bytes<std::string>(text, policy, &encoded), expected);
+    EXPECT_EQ(encoded, expected_encoded);
+    EXPECT_EQ(Utf8Bytes<std::vector<uint8_t>>(text, policy),
+              std::vector<uint8_t>(expected.begin(), expected.end()));
+  }
+}
+
+TEST(Utf8, EncodeSkip) {
+  std::u32string text = U"A";
+  text += kInvalidCharacter;
+  text += U'Z';
+
+  std::string encoded;
+  EXPECT_EQ(Utf8Encode(text.begin(), text.end(), std::back_inserter(encoded),
+                       ErrorPolicy::kSkip),
+            3);
+  EXPECT_EQ(encoded, "AZ");
+}
+
 TEST(Utf8, DecodeIterator) {
   std::string_view one_char_valid = "A\x80Z";
 
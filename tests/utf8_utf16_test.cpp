@@ -0,0 +1,212 @@
+#include "unicpp/utf8_utf16.h"
+
+#include "tools/cpp/runfiles/runfiles.h"
+
+#include "gtest/gtest.h"
+
+#include <fstream>
+#include <list>
+#include <vector>
+
+namespace unicpp {
+namespace {
+
+using bazel::tools::cpp::runfiles::Runfiles;
+
+std::string LoadDataFile(const std::string& filepath) {
+  std::string error;
+  std::unique_ptr<Runfiles> runfiles(Runfiles::CreateForTest(&error));
+  if (runfiles == nullptr) {
+    throw std::runtime_error("Couldn't load file: " + filepath);
+  }
+
+  std::string text_path = runfiles->Rlocation(filepath);
+  std::ifstream fin(text_path, std::ios_base::binary);
+
+  return std::string(std::istreambuf_iterator<char>(fin),
+                     std::istreambuf_iterator<char>());
+}
+
+// Long enough for the vectorized code, with characters of all lengths.
+std::string MixedText() {
+  std::string text;
+  for (int i = 0; i < 20; i++) {
+    text += "Lorem ipsum dolor sit amet, \xD0\x96\xD0\xB8\xE4\xB8\xAD "
+            "\xF0\x9F\x98\x80 consectetur \xEF\xBF\xBD!";
+  }
+  return text;
+}
+
+TEST(Utf8Utf16, SurrogatePairs) {
+  std::string_view utf8 = "\xF0\x90\x90\xB7";
+
+  EXPECT_EQ(Utf16LeBytesFromUtf8<std::string>(utf8), "\x01\xD8\x37\xDC");
+  EXPECT_EQ(Utf16BeBytesFromUtf8<std::string>(utf8), "\xD8\x01\xDC\x37");
+  EXPECT_EQ(Utf16StringFromUtf8<std::u16string>(utf8), u"\U00010437");
+
+  EXPECT_EQ(Utf8BytesFromUtf16Le<std::string>(std::string("\x01\xD8\x37\xDC")),
+            utf8);
+  EXPECT_EQ(Utf8BytesFromUtf16Be<std::string>(std::string("\xD8\x01\xDC\x37")),
+            utf8);
+  EXPECT_EQ(Utf8BytesFromUtf16<std::string>(std::u16string(u"\U00010437")),
+            utf8);
+}
+
+TEST(Utf8Utf16, RoundTrip) {
+  for (const std::string& utf8 :
+       {MixedText(), LoadDataFile("unicpp/tests/data/utf8_text.txt")}) {
+    std::u32string decoded = Utf8Wstring<std::u32string>(utf8);
+    std::string expected_le = Utf16LeBytes<std::string>(decoded);
+    std::string expected_be = Utf16BeBytes<std::string>(decoded);
+
+    std::string le = Utf16LeBytesFromUtf8<std::string>(utf8);
+    EXPECT_EQ(le, expected_le);
+    std::string be = Utf16BeBytesFromUtf8<std::string>(utf8);
+    EXPECT_EQ(be, expected_be);
+    std::u16string units = Utf16StringFromUtf8<std::u16string>(utf8);
+    EXPECT_EQ(units.size() * 2, expected_le.size());
+
+    EXPECT_EQ(Utf8BytesFromUtf16Le<std::string>(le), utf8);
+    EXPECT_EQ(Utf8BytesFromUtf16Be<std::string>(be), utf8);
+    EXPECT_EQ(Utf8BytesFromUtf16<std::string>(units), utf8);
+  }
+}
+
+TEST(Utf8Utf16, Utf8WithErrors) {
+  std::string text = MixedText();
+  for (size_t pos : {700, 500, 130, 129, 128, 64, 3}) {
+    text.insert(pos, "\xE4\xB8\x80\xC0\xED\xA0\x80");
+  }
+  std::list<char> list(text.begin(), text.end());
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::string expected_le;
+    size_t expected_transcoded = Utf8ToUtf16Le(
+        list.begin(), list.end(), std::back_inserter(expected_le), policy);
+    std::string expected_be;
+    Utf8ToUtf16Be(list.begin(), list.end(), std::back_inserter(expected_be),
+                  policy);
+    std::u16string expected_units;
+    Utf8ToUtf16(list.begin(), list.end(), std::back_inserter(expected_units),
+                policy);
+
+    size_t transcoded = 0;
+    EXPECT_EQ(Utf16LeBytesFromUtf8<std::string>(text, policy, &transcoded),
+              expected_le);
+    EXPECT_EQ(transcoded, expected_transcoded);
+    EXPECT_EQ(Utf16BeBytesFromUtf8<std::vector<char>>(text, policy),
+              std::vector<char>(expected_be.begin(), expected_be.end()));
+    EXPECT_EQ(Utf16StringFromUtf8<std::u16string>(text, policy, &transcoded),
+              expected_units);
+    EXPECT_EQ(transcoded, expected_transcoded);
+  }
+}
+
+TEST(Utf8Utf16, Utf8DirtyText) {
+  std::string text;
+  for (int i = 0; i < 300; i++) {
+    text += "Lorem \xD0\x96\xF0\x9F\x98\x80";
+    text += i % 3 == 0 ? "\xED\xA0\x80" : i % 3 == 1 ? "\xF0\x9F" : "\xBF";
+    if (i % 10 == 0) {
+      text += std::string(i % 130, 'a');
+    }
+  }
+  std::list<char> list(text.begin(), text.end());
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::string expected_be;
+    size_t expected_transcoded = Utf8ToUtf16Be(
+        list.begin(), list.end(), std::back_inserter(expected_be), policy);
+    std::u16string expected_units;
+    Utf8ToUtf16(list.begin(), list.end(), std::back_inserter(expected_units),
+                policy);
+
+    size_t transcoded = 0;
+    EXPECT_EQ(Utf16BeBytesFromUtf8<std::string>(text, policy, &transcoded),
+              expected_be);
+    EXPECT_EQ(transcoded, expected_transcoded);
+    EXPECT_EQ(Utf16StringFromUtf8<std::u16string>(text, policy),
+              expected_units);
+  }
+}
+
+TEST(Utf8Utf16, Utf16WithErrors) {
+  std::string le = Utf16LeBytesFromUtf8<std::string>(MixedText());
+  for (size_t pos : {700, 500, 130, 128, 64, 2}) {
+    // lone low surrogate, high surrogate followed by a BMP character
+    le.insert(pos, std::string("\x37\xDC\x01\xD8\x41\x00", 6));
+  }
+  le += '\x41';  // odd trailing byte
+
+  std::string be = le;
+  for (size_t i = 0; i + 1 < be.size(); i += 2) {
+    std::swap(be[i], be[i + 1]);
+  }
+  std::u16string units(le.size() / 2, u'\0');
+  for (size_t i = 0; i < units.size(); i++) {
+    units[i] = static_cast<char16_t>(static_cast<uint8_t>(le[2 * i]) |
+                                     (static_cast<uint8_t>(le[2 * i + 1]) << 8));
+  }
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::list<char> le_list(le.begin(), le.end());
+    std::string expected;
+    size_t expected_transcoded = Utf16LeToUtf8(
+        le_list.begin(), le_list.end(), std::back_inserter(expected), policy);
+    std::list<char16_t> units_list(units.begin(), units.end());
+    std::string expected_from_units;
+    size_t expected_units_transcoded =
+        Utf16ToUtf8(units_list.begin(), units_list.end(),
+                    std::back_inserter(expected_from_units), policy);
+
+    size_t transcoded = 0;
+    EXPECT_EQ(Utf8BytesFromUtf16Le<std::string>(le, policy, &transcoded),
+              expected);
+    EXPECT_EQ(transcoded, expected_transcoded);
+    EXPECT_EQ(Utf8BytesFromUtf16Be<std::string>(be, policy, &transcoded),
+              expected);
+    EXPECT_EQ(transcoded, expected_transcoded);
+    EXPECT_EQ(Utf8BytesFromUtf16<std::string>(units, policy, &transcoded),
+              expected_from_units);
+    EXPECT_EQ(transcoded, expected_units_transcoded);
+  }
+
+  EXPECT_EQ(Utf8BytesFromUtf16Le<std::string>(std::string("\x37\xDC\x41", 3),
+                                               ErrorPolicy::kReplace),
+            "\xEF\xBF\xBD\xEF\xBF\xBD");
+  EXPECT_EQ(Utf8BytesFromUtf16Le<std::string>(
+                std::string("\x01\xD8\x41\x00", 4), ErrorPolicy::kSkip),
+            "A");
+}
+
+TEST(Utf8Utf16, Lengths) {
+  EXPECT_EQ(Utf16LengthFromUtf8(""), 0);
+  EXPECT_EQ(
+      Utf16LengthFromUtf8("a\xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80"), 5);
+  // replaced errors, one per byte
+  EXPECT_EQ(Utf16LengthFromUtf8("\xE4\xB8!\xC0\xF0"), 5);
+
+  EXPECT_EQ(Utf8LengthFromUtf16(u"a\x416\x4E2D\U0001F600"), 10);
+  EXPECT_EQ(Utf8LengthFromUtf16(std::u16string(1, u'\xD800')), 3);
+  EXPECT_EQ(Utf8LengthFromUtf16Le(std::string("\x00\xD8\x41", 3)), 6);
+  EXPECT_EQ(Utf8LengthFromUtf16Be(std::string("\xD8\x01\xDC\x37", 4)), 4);
+
+  std::string text = MixedText();
+  for (size_t pos : {700, 500, 130, 129, 128, 64, 3}) {
+    text.insert(pos, "\xE4\xB8\x80\xC0\xED\xA0\x80");
+  }
+  std::string le = Utf16LeBytesFromUtf8<std::string>(text);
+  EXPECT_EQ(Utf16LengthFromUtf8(text), le.size() / 2);
+  for (size_t pos : {700, 500, 130, 128, 64, 2}) {
+    le.insert(pos, std::string("\x37\xDC\x01\xD8\x41\x00", 6));
+  }
+  le += '\x41';
+  EXPECT_EQ(Utf8LengthFromUtf16Le(le),
+            Utf8BytesFromUtf16Le<std::string>(le).size());
+}
+
+}  // namespace
+}  // namespace unicpp
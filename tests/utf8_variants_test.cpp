@@ -0,0 +1,258 @@
+#include "unicpp/utf8_variants.h"
+
+#include "unicpp/simd_level.h"
+
+#include "tests/simd_levels.h"
+
+#include "gtest/gtest.h"
+
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace unicpp {
+namespace {
+
+// Long enough for the vectorized code, with unpaired surrogates, surrogate
+// pairs and zeros at all the positions in the blocks.
+std::u16string Utf16Text() {
+  std::u16string text;
+  for (int i = 0; i < 40; i++) {
+    text += u"Lorem ipsum dolor sit amet, \xE9\x416\x4E2D ";
+    text.append(i % 7, u'.');
+    text += i % 3 == 0 ? u'\xD800' : i % 3 == 1 ? u'\xDFFF' : u'\0';
+    text.append(i % 5, u'x');
+    text += u"\U0001F600\xD83D";
+  }
+  return text;
+}
+
+TEST(Utf8Variants, Characters) {
+  std::u16string utf16(u"a\0\0\xE9\xD800\U0001F600\xDC00", 8);
+
+  std::string wtf8("a\0\0\xC3\xA9\xED\xA0\x80\xF0\x9F\x98\x80\xED\xB0\x80",
+                   15);
+  EXPECT_EQ(Wtf8BytesFromUtf16<std::string>(utf16), wtf8);
+  EXPECT_EQ(Utf16StringFromWtf8<std::u16string>(wtf8), utf16);
+
+  std::string modified =
+      "a\xC0\x80\xC0\x80\xC3\xA9\xED\xA0\x80\xED\xA0\xBD\xED\xB8\x80"
+      "\xED\xB0\x80";
+  EXPECT_EQ(ModifiedUtf8BytesFromUtf16<std::string>(utf16), modified);
+  EXPECT_EQ(Utf16StringFromModifiedUtf8<std::u16string>(modified), utf16);
+
+  std::string cesu8 = "\xC3\xA9\xED\xA0\xBD\xED\xB8\x80";
+  EXPECT_EQ(Cesu8BytesFromUtf16<std::string>(std::u16string(u"\xE9\U0001F600")),
+            cesu8);
+  EXPECT_EQ(Utf16StringFromCesu8<std::u16string>(cesu8), u"\xE9\U0001F600");
+
+  EXPECT_EQ((Utf8VariantWstring<Utf8Variant::kCesu8, std::u32string>(cesu8)),
+            U"\xE9\U0001F600");
+  EXPECT_EQ((Utf8VariantWstring<Utf8Variant::kWtf8, std::u32string>(wtf8)),
+            std::u32string(U"a\0\0\xE9\xD800\U0001F600\xDC00", 7));
+  EXPECT_EQ((Utf8VariantBytes<Utf8Variant::kWtf8, std::string>(
+                std::u32string(U"\xD83D\xDE00\xDE00"))),
+            "\xF0\x9F\x98\x80\xED\xB8\x80");
+  EXPECT_EQ((Utf8VariantBytes<Utf8Variant::kModifiedUtf8, std::string>(
+                std::u32string(U"\U0001F600\0", 2))),
+            "\xED\xA0\xBD\xED\xB8\x80\xC0\x80");
+}
+
+TEST(Utf8Variants, Errors) {
+  // a WTF-8 surrogate pair, 4-byte sequences in CESU-8, unpaired surrogates in
+  // CESU-8 and zero bytes in Modified UTF-8 are invalid byte by byte
+  EXPECT_EQ(Utf16StringFromWtf8<std::u16string>(
+                std::string("\xED\xA0\xBD\xED\xB8\x80")),
+            u"\xFFFD\xFFFD\xFFFD\xDE00");
+  EXPECT_EQ(Utf16StringFromCesu8<std::u16string>(
+                std::string("a\xF0\x9F\x98\x80" "b")),
+            u"a\xFFFD\xFFFD\xFFFD\xFFFD" "b");
+  EXPECT_EQ(Utf16StringFromCesu8<std::u16string>(
+                std::string("a\xED\xA0\xBD" "b"), ErrorPolicy::kSkip),
+            u"ab");
+  EXPECT_EQ(Utf16StringFromModifiedUtf8<std::u16string>(
+                std::string("a\0b\xC0\x81", 5)),
+            u"a\xFFFD" "b\xFFFD\xFFFD");
+  EXPECT_EQ(Utf16StringFromWtf8<std::u16string>(std::string("a\xC0\x80")),
+            u"a\xFFFD\xFFFD");
+
+  size_t transcoded = 0;
+  EXPECT_EQ(Cesu8BytesFromUtf16<std::string>(std::u16string(u"ab\xDC00" "c"),
+                                             ErrorPolicy::kStop, &transcoded),
+            "ab");
+  EXPECT_EQ(transcoded, 2);
+  EXPECT_EQ(Cesu8BytesFromUtf16<std::string>(std::u16string(u"ab\xD800"),
+                                             ErrorPolicy::kReplace),
+            "ab\xEF\xBF\xBD");
+  EXPECT_EQ((Utf8VariantBytes<Utf8Variant::kCesu8, std::string>(
+                std::u32string(U"a\xDC00\x110000" "b"), ErrorPolicy::kSkip)),
+            "ab");
+  EXPECT_EQ(Utf16StringFromModifiedUtf8<std::u16string>(
+                std::string("ab\xED\xA0", 4), ErrorPolicy::kStop, &transcoded),
+            u"ab");
+  EXPECT_EQ(transcoded, 2);
+}
+
+TEST(Utf8Variants, SameAsIterators) {
+  std::u16string utf16 = Utf16Text();
+  std::list<char16_t> utf16_list(utf16.begin(), utf16.end());
+  for (SimdLevel level : SupportedLevels()) {
+    ScopedSimdLevel scoped(level);
+
+    std::string wtf8 = Wtf8BytesFromUtf16<std::string>(utf16);
+    EXPECT_EQ(wtf8, Wtf8BytesFromUtf16<std::string>(utf16_list))
+        << SimdLevelName(level);
+    EXPECT_EQ(Utf16StringFromWtf8<std::u16string>(wtf8), utf16)
+        << SimdLevelName(level);
+
+    std::string modified = ModifiedUtf8BytesFromUtf16<std::string>(utf16);
+    EXPECT_EQ(modified, ModifiedUtf8BytesFromUtf16<std::string>(utf16_list))
+        << SimdLevelName(level);
+    EXPECT_EQ(modified.find('\0'), std::string::npos) << SimdLevelName(level);
+    EXPECT_EQ(Utf16StringFromModifiedUtf8<std::u16string>(modified), utf16)
+        << SimdLevelName(level);
+
+    // unpaired surrogates are replaced in CESU-8
+    std::string cesu8 = Cesu8BytesFromUtf16<std::string>(utf16);
+    EXPECT_EQ(cesu8, Cesu8BytesFromUtf16<std::string>(utf16_list))
+        << SimdLevelName(level);
+    std::u16string replaced = Utf16StringFromCesu8<std::u16string>(cesu8);
+    EXPECT_EQ(replaced.size(), utf16.size()) << SimdLevelName(level);
+    EXPECT_EQ(Cesu8BytesFromUtf16<std::string>(replaced), cesu8)
+        << SimdLevelName(level);
+
+    for (const std::string* bytes : {&wtf8, &modified, &cesu8}) {
+      std::list<char> bytes_list(bytes->begin(), bytes->end());
+      for (std::string_view corrupted : {std::string_view("\0", 1),
+                                         std::string_view("\xED"),
+                                         std::string_view("\xF0\x9F")}) {
+        std::string text = *bytes;
+        text.insert(text.size() / 3, corrupted);
+        std::list<char> text_list(text.begin(), text.end());
+        EXPECT_EQ(Utf16StringFromWtf8<std::u16string>(text),
+                  Utf16StringFromWtf8<std::u16string>(text_list))
+            << SimdLevelName(level);
+        EXPECT_EQ(Utf16StringFromCesu8<std::u16string>(text),
+                  Utf16StringFromCesu8<std::u16string>(text_list))
+            << SimdLevelName(level);
+        EXPECT_EQ(Utf16StringFromModifiedUtf8<std::u16string>(text),
+                  Utf16StringFromModifiedUtf8<std::u16string>(text_list))
+            << SimdLevelName(level);
+        EXPECT_EQ((Utf8VariantWstring<Utf8Variant::kWtf8, std::u32string>(
+                      text)),
+                  (Utf8VariantWstring<Utf8Variant::kWtf8, std::u32string>(
+                      text_list)))
+            << SimdLevelName(level);
+        EXPECT_EQ((Utf8VariantWstring<Utf8Variant::kCesu8, std::u32string>(
+                      text)),
+                  (Utf8VariantWstring<Utf8Variant::kCesu8, std::u32string>(
+                      text_list)))
+            << SimdLevelName(level);
+      }
+    }
+
+    // the vectorized decoding doesn't stop between the surrogates of a pair
+    for (size_t offset = 0; offset < 16; offset++) {
+      std::string text = std::string(offset, 'a') +
+                         "\xED\xA0\xBD\xED\xB8\x80\xED\xED" +
+                         std::string(100, 'b');
+      EXPECT_EQ(Utf16StringFromCesu8<std::u16string>(text),
+                std::u16string(offset, u'a') + u"\U0001F600\xFFFD\xFFFD" +
+                    std::u16string(100, u'b'))
+          << SimdLevelName(level);
+    }
+
+    std::u32string chars =
+        Utf8VariantWstring<Utf8Variant::kWtf8, std::u32string>(wtf8);
+    std::list<char32_t> chars_list(chars.begin(), chars.end());
+    EXPECT_EQ((Utf8VariantBytes<Utf8Variant::kWtf8, std::string>(chars)), wtf8)
+        << SimdLevelName(level);
+    EXPECT_EQ((Utf8VariantBytes<Utf8Variant::kModifiedUtf8, std::string>(
+                  chars)),
+              (Utf8VariantBytes<Utf8Variant::kModifiedUtf8, std::string>(
+                  chars_list)))
+        << SimdLevelName(level);
+  }
+}
+
+// Inputs longer than a vectorized chunk with unpaired surrogates next to
+// invalid bytes, so that the vectorized decoding never writes a character the
+// scalar code writes again.
+TEST(Utf8Variants, UnpairedSurrogatesNearErrors) {
+  std::vector<std::string> texts;
+  // a lead surrogate decoded by the scalar code, then another one and an
+  // invalid sequence at all the positions of a chunk
+  for (size_t offset = 0; offset < 64; offset++) {
+    texts.push_back(std::string(offset, 'a') +
+                    "\xED\xA6\xBE\xED\xA0\xBD\xED\x9F" +
+                    std::string(80, 'a'));
+  }
+  const std::string_view kPieces[] = {
+      "a",
+      "\xED\xA6\xBE",
+      "\xED\xB0\x80",
+      "\xED\xA0\xBD\xED\xB8\x80",
+      "\xF0\x9F\x98\x80",
+      "\xFF",
+      std::string_view("\0", 1),
+      "\xC0\x80",
+      "\xE4\xB8"};
+  uint32_t random = 1;
+  for (int i = 0; i < 200; i++) {
+    std::string text(i % 64, 'a');
+    while (text.size() < 144) {
+      random = random * 1103515245 + 12345;
+      text += kPieces[(random >> 16) % std::size(kPieces)];
+    }
+    texts.push_back(text);
+  }
+
+  for (size_t i = 0; i < texts.size(); i++) {
+    const std::string& text = texts[i];
+    std::list<char> text_list(text.begin(), text.end());
+
+    for (SimdLevel level : SupportedLevels()) {
+      ScopedSimdLevel scoped(level);
+      for (ErrorPolicy policy :
+           {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+        size_t transcoded = 0;
+        size_t expected_transcoded = 0;
+        EXPECT_EQ(Utf16StringFromWtf8<std::u16string>(text, policy,
+                                                      &transcoded),
+                  Utf16StringFromWtf8<std::u16string>(text_list, policy,
+                                                      &expected_transcoded))
+            << SimdLevelName(level) << " " << i;
+        EXPECT_EQ(transcoded, expected_transcoded);
+        EXPECT_EQ(Utf16StringFromCesu8<std::u16string>(text, policy,
+                                                       &transcoded),
+                  Utf16StringFromCesu8<std::u16string>(text_list, policy,
+                                                       &expected_transcoded))
+            << SimdLevelName(level) << " " << i;
+        EXPECT_EQ(transcoded, expected_transcoded);
+        EXPECT_EQ(Utf16StringFromModifiedUtf8<std::u16string>(text, policy,
+                                                              &transcoded),
+                  Utf16StringFromModifiedUtf8<std::u16string>(
+                      text_list, policy, &expected_transcoded))
+            << SimdLevelName(level) << " " << i;
+        EXPECT_EQ(transcoded, expected_transcoded);
+        EXPECT_EQ((Utf8VariantWstring<Utf8Variant::kWtf8, std::u32string>(
+                      text, policy, &transcoded)),
+                  (Utf8VariantWstring<Utf8Variant::kWtf8, std::u32string>(
+                      text_list, policy, &expected_transcoded)))
+            << SimdLevelName(level) << " " << i;
+        EXPECT_EQ(transcoded, expected_transcoded);
+        EXPECT_EQ(
+            (Utf8VariantWstring<Utf8Variant::kModifiedUtf8, std::u32string>(
+                text, policy, &transcoded)),
+            (Utf8VariantWstring<Utf8Variant::kModifiedUtf8, std::u32string>(
+                text_list, policy, &expected_transcoded)))
+            << SimdLevelName(level) << " " << i;
+        EXPECT_EQ(transcoded, expected_transcoded);
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace unicpp
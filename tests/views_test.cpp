@@ -0,0 +1,125 @@
+#include "unicpp/views.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <forward_list>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__cpp_lib_ranges)
+
+namespace unicpp {
+namespace {
+
+template <class Range>
+auto Collect(Range&& range) {
+  using Value = std::ranges::range_value_t<Range>;
+  std::basic_string<Value> result;
+  for (Value value : range) {
+    result.push_back(value);
+  }
+  return result;
+}
+
+const std::string kUtf8 = "a\xD0\x96\xE4\xB8\xAD\xF0\x9F\x98\x80z";
+const std::u32string kUtf32 = U"a\x416\x4E2D\U0001F600z";
+const std::u16string kUtf16 = u"a\x416\x4E2D\xD83D\xDE00z";
+
+TEST(Views, Iterators) {
+  using Utf8DecodeView = decltype(kUtf8 | views::utf8_decode);
+  static_assert(std::ranges::forward_range<Utf8DecodeView>);
+  static_assert(std::ranges::common_range<Utf8DecodeView>);
+  static_assert(std::ranges::view<decltype(kUtf32 | views::utf16_encode)>);
+
+  auto decoded = std::string_view(kUtf8) | views::utf8_decode;
+  auto iter = decoded.begin();
+  auto copy = iter;
+  EXPECT_EQ(*++iter, U'\x416');
+  EXPECT_EQ(*copy, U'a');
+  EXPECT_EQ(std::ranges::distance(decoded), 5);
+  EXPECT_EQ(iter.base() - kUtf8.data(), 1);
+}
+
+TEST(Views, DecodeAndEncode) {
+  EXPECT_EQ(Collect(kUtf8 | views::utf8_decode), kUtf32);
+  EXPECT_EQ(Collect(views::utf16_decode(kUtf16)), kUtf32);
+
+  std::basic_string<uint8_t> utf8_bytes(kUtf8.begin(), kUtf8.end());
+  EXPECT_EQ(Collect(kUtf32 | views::utf8_encode), utf8_bytes);
+  EXPECT_EQ(Collect(kUtf32 | views::utf16_encode), kUtf16);
+
+  // round trips through pipelines of views
+  EXPECT_EQ(Collect(kUtf8 | views::utf8_decode | views::utf16_encode |
+                    views::utf16_decode | views::utf8_encode),
+            utf8_bytes);
+
+  std::forward_list<char> list(kUtf8.begin(), kUtf8.end());
+  EXPECT_EQ(Collect(list | views::utf8_decode), kUtf32);
+
+  auto upper = kUtf8 | views::utf8_decode |
+               std::views::filter([](char32_t ch) { return ch > 0x7F; }) |
+               std::views::take(2);
+  EXPECT_EQ(Collect(upper), U"\x416\x4E2D");
+}
+
+TEST(Views, Backwards) {
+  static_assert(std::ranges::bidirectional_range<
+                decltype(kUtf8 | views::utf8_decode)>);
+  static_assert(!std::ranges::bidirectional_range<
+                decltype(std::forward_list<char>() | views::utf8_decode)>);
+
+  EXPECT_EQ(Collect(kUtf8 | views::utf8_decode | std::views::reverse),
+            U"z\U0001F600\x4E2D\x416" U"a");
+  EXPECT_EQ(Collect(kUtf16 | views::utf16_decode | std::views::reverse),
+            U"z\U0001F600\x4E2D\x416" U"a");
+  EXPECT_EQ(Collect(kUtf32 | views::utf16_encode | std::views::reverse),
+            u"z\xDE00\xD83D\x4E2D\x416" u"a");
+
+  std::list<char> list(kUtf8.begin(), kUtf8.end());
+  auto decoded = list | views::utf8_decode;
+  auto iter = decoded.end();
+  EXPECT_EQ(*--iter, U'z');
+  EXPECT_EQ(*--iter, U'\U0001F600');
+  EXPECT_EQ(*iter--, U'\U0001F600');
+  EXPECT_EQ(*iter, U'\x4E2D');
+  EXPECT_EQ(*++iter, U'\U0001F600');
+}
+
+TEST(Views, ErrorPolicies) {
+  std::string utf8 = "a\xE4\xB8!\xED\xA0\x80\xF0\x9F\x98";
+  std::u16string utf16 = u"a\xD800!\xDC00";
+  std::u32string utf32 = U"a\xD800!";
+  utf32.push_back(0x110000);
+
+  for (ErrorPolicy policy :
+       {ErrorPolicy::kReplace, ErrorPolicy::kSkip, ErrorPolicy::kStop}) {
+    std::u32string expected_utf8;
+    Utf8Decode(utf8.begin(), utf8.end(), std::back_inserter(expected_utf8),
+               policy);
+    EXPECT_EQ(Collect(utf8 | views::utf8_decode(policy)), expected_utf8);
+    std::reverse(expected_utf8.begin(), expected_utf8.end());
+    EXPECT_EQ(Collect(utf8 | views::utf8_decode(policy) | std::views::reverse),
+              expected_utf8);
+
+    std::string expected_encoded;
+    Utf8Encode(utf32.begin(), utf32.end(),
+               std::back_inserter(expected_encoded), policy);
+    std::basic_string<uint8_t> encoded =
+        Collect(utf32 | views::utf8_encode(policy));
+    EXPECT_EQ(std::string(encoded.begin(), encoded.end()), expected_encoded);
+  }
+
+  EXPECT_EQ(Collect(utf16 | views::utf16_decode), U"a\xFFFD!\xFFFD");
+  EXPECT_EQ(Collect(utf16 | views::utf16_decode(ErrorPolicy::kSkip)), U"a!");
+  EXPECT_EQ(Collect(utf16 | views::utf16_decode(ErrorPolicy::kStop)), U"a");
+  EXPECT_EQ(Collect(utf32 | views::utf16_encode), u"a\xFFFD!\xFFFD");
+  EXPECT_EQ(Collect(utf32 | views::utf16_encode(ErrorPolicy::kStop)), u"a");
+}
+
+}  // namespace
+}  // namespace unicpp
+
+#endif  // defined(__cpp_lib_ranges)
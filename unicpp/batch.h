@@ -0,0 +1,159 @@
+#pragma once
+
+#include "utf8_utf16.h"
+#include "utf_common.h"
+
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#include <stdint.h>
+
+namespace unicpp {
+
+// Transcoding of many strings at once in the columnar layout of Apache Arrow:
+// string i of a batch is data[offsets[i], offsets[i + 1]) for non-decreasing
+// offsets, e.g. int32_t or int64_t. The output strings are written to a
+// single container, with `num_strings + 1` new offsets starting at 0.
+//
+// The whole batch is transcoded by one call in the common case of valid
+// strings. Errors are handled per string, with ErrorPolicy::kStop a string
+// ends before its first error.
+
+struct BatchSummary {
+  // strings with invalid sequences
+  size_t num_invalid_strings = 0;
+  // index of the first of them, or the number of strings if all are valid
+  size_t first_invalid_string = 0;
+  // the output doesn't fit the offset type, it is left empty then
+  bool overflow = false;
+};
+
+namespace detail {
+
+// `length(input, size)` returns the output length with replaced errors,
+// `transcode(input, size, output, output_size, policy, &written)` returns the
+// number of transcoded input values, `is_inside(value)` is true for the
+// values which can't start a character.
+template <class Result, class Offset, class Input, class Length,
+          class Transcode, class IsInside>
+BatchSummary TranscodeBatch(const Offset* offsets, size_t num_strings,
+                            const Input* data, Offset* output_offsets,
+                            Result& output, ErrorPolicy policy, Length length,
+                            Transcode transcode, IsInside is_inside) {
+  static_assert(std::is_integral_v<Offset>);
+
+  BatchSummary summary;
+  summary.first_invalid_string = num_strings;
+  output_offsets[0] = 0;
+  size_t total = 0;
+  for (size_t i = 0; i < num_strings; i++) {
+    total += length(data + offsets[i],
+                    static_cast<size_t>(offsets[i + 1] - offsets[i]));
+    if (total > static_cast<std::make_unsigned_t<Offset>>(
+                    std::numeric_limits<Offset>::max())) {
+      summary.overflow = true;
+      output.clear();
+      return summary;
+    }
+    output_offsets[i + 1] = static_cast<Offset>(total);
+  }
+
+  // the batch is valid if it is valid as a whole and no string starts inside
+  // a character, transcoding the whole with kStop checks the former
+  bool valid = true;
+  const Input* begin = data + offsets[0];
+  size_t size = static_cast<size_t>(offsets[num_strings] - offsets[0]);
+  for (size_t i = 1; i < num_strings && valid; i++) {
+    valid = offsets[i] == offsets[num_strings] || !is_inside(data[offsets[i]]);
+  }
+
+  ResizeAndOverwrite(output, total, [&](auto* result) {
+    size_t written = 0;
+    if (valid &&
+        transcode(begin, size, result, total, ErrorPolicy::kStop, &written) ==
+            size) {
+      return total;
+    }
+
+    // transcode every string up to its first error, then from the error with
+    // the policy
+    size_t pos = 0;
+    for (size_t i = 0; i < num_strings; i++) {
+      const Input* string = data + offsets[i];
+      size_t string_size = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+      size_t room = static_cast<size_t>(output_offsets[i + 1]) - pos;
+      size_t transcoded = transcode(string, string_size, result + pos, room,
+                                    ErrorPolicy::kStop, &written);
+      pos += written;
+      if (transcoded < string_size) {
+        if (summary.num_invalid_strings++ == 0) {
+          summary.first_invalid_string = i;
+        }
+        if (policy != ErrorPolicy::kStop) {
+          transcode(string + transcoded, string_size - transcoded,
+                    result + pos, room - written, policy, &written);
+          pos += written;
+        }
+      }
+      output_offsets[i + 1] = static_cast<Offset>(pos);
+    }
+    return pos;
+  });
+  return summary;
+}
+
+}  // namespace detail
+
+// Transcodes a batch of UTF-8 strings to UTF-16, Result is a container of
+// char16_t, e.g. std::u16string. `output_offsets` has room for
+// `num_strings + 1` offsets in code units.
+template <class Result, class Offset>
+BatchSummary Utf16BatchFromUtf8(const Offset* offsets, size_t num_strings,
+                                const uint8_t* data, Offset* output_offsets,
+                                Result& output,
+                                ErrorPolicy policy = ErrorPolicy::kReplace) {
+  static_assert(sizeof(typename Result::value_type) == 2);
+  return detail::TranscodeBatch(
+      offsets, num_strings, data, output_offsets, output, policy,
+      [](const uint8_t* bytes, size_t size) {
+        return Utf16LengthFromUtf8(
+            std::string_view(reinterpret_cast<const char*>(bytes), size));
+      },
+      [](const uint8_t* bytes, size_t size, auto* units, size_t units_size,
+         ErrorPolicy policy, size_t* units_written) {
+        *units_written = 0;
+        return size == 0 ? 0
+                         : detail::Utf8ToUtf16Contiguous(
+                               bytes, size, reinterpret_cast<char16_t*>(units),
+                               units_size, policy, units_written);
+      },
+      [](uint8_t byte) { return (byte & 0xC0) == 0x80; });
+}
+
+// Transcodes a batch of UTF-16 strings of native code units to UTF-8, Result
+// is a container of bytes, e.g. std::string. `output_offsets` has room for
+// `num_strings + 1` offsets in bytes.
+template <class Result, class Offset>
+BatchSummary Utf8BatchFromUtf16(const Offset* offsets, size_t num_strings,
+                                const char16_t* data, Offset* output_offsets,
+                                Result& output,
+                                ErrorPolicy policy = ErrorPolicy::kReplace) {
+  static_assert(sizeof(typename Result::value_type) == 1);
+  return detail::TranscodeBatch(
+      offsets, num_strings, data, output_offsets, output, policy,
+      [](const char16_t* units, size_t size) {
+        return Utf8LengthFromUtf16(std::u16string_view(units, size));
+      },
+      [](const char16_t* units, size_t size, auto* bytes, size_t bytes_size,
+         ErrorPolicy policy, size_t* bytes_written) {
+        *bytes_written = 0;
+        return size == 0 ? 0
+                         : detail::Utf16ToUtf8Contiguous(
+                               units, size, reinterpret_cast<uint8_t*>(bytes),
+                               bytes_size, policy, bytes_written);
+      },
+      [](char16_t unit) { return unit >= 0xDC00 && unit <= 0xDFFF; });
+}
+
+}  // namespace unicpp
@@ -1,15 +1,85 @@
 #pragma once
 
 #include "unicode_data.h"
+#include "unicode_tables.h"
+
+#include <stddef.h>
 
 namespace unicpp {
 
-char32_t toupper(char32_t code);
-char32_t tolower(char32_t code);
+namespace detail {
+
+// Index of the first entry of `table`, sorted by the first members, with the
+// first member greater than `code`.
+template <class Entry, size_t N>
+constexpr size_t TableUpperBound(const Entry (&table)[N], char32_t code) {
+  size_t begin = 0;
+  size_t end = N;
+  while (begin < end) {
+    size_t middle = begin + (end - begin) / 2;
+    if (table[middle].first <= code) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+// The entry of `table` for `code`, or nullptr if there's none.
+template <class Entry, size_t N>
+constexpr const Entry* TableFind(const Entry (&table)[N], char32_t code) {
+  size_t index = TableUpperBound(table, code);
+  return index > 0 && table[index - 1].first == code ? &table[index - 1]
+                                                     : nullptr;
+}
+
+// The property of the range `code` belongs to, or `none` above U+10FFFF.
+template <class Property, size_t N>
+constexpr Property RangeProperty(
+    const std::pair<char32_t, Property> (&ranges)[N], char32_t code,
+    Property none) {
+  size_t index = TableUpperBound(ranges, code);
+  return index < N ? ranges[index].second : none;
+}
+
+}  // namespace detail
+
+// The functions below are constexpr, e.g. static_assert(isalpha(U'A')).
+
+constexpr char32_t toupper(char32_t code) {
+  const auto* entry = detail::TableFind(kUpperTable, code);
+  return entry != nullptr ? entry->second : code;
+}
+
+constexpr char32_t tolower(char32_t code) {
+  const auto* entry = detail::TableFind(kLowerTable, code);
+  return entry != nullptr ? entry->second : code;
+}
+
+constexpr bool isalpha(char32_t code) {
+  return (static_cast<uint64_t>(detail::RangeProperty(
+              kGeneralCategoryRanges, code, GeneralCategory::None)) &
+          static_cast<uint64_t>(GeneralCategory::L)) != 0;
+}
+
+constexpr bool isdigit(char32_t code) {
+  const auto* entry = detail::TableFind(kNumericTypeTable, code);
+  return entry != nullptr && (entry->second == NumericType::Decimal ||
+                              entry->second == NumericType::Digit);
+}
+
+constexpr bool isspace(char32_t code) {
+  if (detail::RangeProperty(kGeneralCategoryRanges, code,
+                            GeneralCategory::None) == GeneralCategory::Zs) {
+    return true;
+  }
 
-bool isalpha(char32_t code);
-bool isdigit(char32_t code);
-bool isspace(char32_t code);
+  BidiClass bidi_class =
+      detail::RangeProperty(kBidiClassRanges, code, BidiClass::None);
+  return bidi_class == BidiClass::B || bidi_class == BidiClass::S ||
+         bidi_class == BidiClass::WS;
+}
 
 const Decomposition* decomposition(char32_t code);
 
@@ -0,0 +1,77 @@
+#include "detect.h"
+
+#include "simd.h"
+
+#include <algorithm>
+
+namespace unicpp {
+namespace {
+
+detail::ByteCounts CountBytes(const uint8_t* data, size_t size) {
+  detail::ByteCounts counts = {};
+  size_t pos = detail::ActiveKernels().count_bytes_blocks(data, size, counts);
+  for (; pos < size; pos++) {
+    uint8_t byte = data[pos];
+    if (byte == 0) {
+      ++(pos % 2 == 0 ? counts.even_zeros : counts.odd_zeros);
+    } else if (byte >= 0x80) {
+      ++counts.non_ascii;
+      if (byte <= 0x9F) {
+        ++counts.c1_controls;
+      }
+    }
+  }
+
+  return counts;
+}
+
+}  // namespace
+
+DetectedEncoding DetectEncoding(const uint8_t* data, size_t size) {
+  if (size >= 3 && data[0] == 0xEF && data[1] == 0xBB && data[2] == 0xBF) {
+    return {Encoding::kUtf8, 100, 3};
+  } else if (size >= 2 && data[0] == 0xFF && data[1] == 0xFE) {
+    return {Encoding::kUtf16Le, 100, 2};
+  } else if (size >= 2 && data[0] == 0xFE && data[1] == 0xFF) {
+    return {Encoding::kUtf16Be, 100, 2};
+  } else if (size == 0) {
+    return {Encoding::kUtf8, 0, 0};
+  }
+
+  size_t sample = std::min(size, kDetectionSampleSize);
+  detail::ByteCounts counts = CountBytes(data, sample);
+
+  // at least every tenth code unit has a zero byte at the same offset
+  size_t units = sample / 2;
+  size_t zeros = counts.even_zeros + counts.odd_zeros;
+  size_t skew = std::max(counts.even_zeros, counts.odd_zeros) -
+                std::min(counts.even_zeros, counts.odd_zeros);
+  if (units > 0 && 10 * skew >= units) {
+    int confidence =
+        static_cast<int>(std::min<size_t>(95, 60 + 70 * skew / units));
+    return {counts.odd_zeros > counts.even_zeros ? Encoding::kUtf16Le
+                                                 : Encoding::kUtf16Be,
+            confidence, 0};
+  }
+
+  // a sequence truncated by the end of the sample isn't an error
+  size_t utf8_size =
+      sample < size ? detail::Utf8CharacterBoundary(data, sample) : sample;
+  if (Utf8ValidPrefixLength(std::string_view(
+          reinterpret_cast<const char*>(data), utf8_size)) == utf8_size) {
+    if (counts.non_ascii == 0) {
+      // ASCII, which is the same in Latin-1
+      return {Encoding::kUtf8, zeros == 0 ? 60 : 30, 0};
+    }
+    int confidence =
+        static_cast<int>(80 + std::min<size_t>(19, counts.non_ascii / 2));
+    return {Encoding::kUtf8, confidence, 0};
+  }
+
+  size_t unusual = counts.c1_controls + zeros;
+  int confidence = static_cast<int>(
+      80 - 60 * unusual / std::max<size_t>(1, counts.non_ascii + zeros));
+  return {Encoding::kLatin1, confidence, 0};
+}
+
+}  // namespace unicpp
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "utf16.h"
+#include "utf8.h"
+#include "utf_common.h"
+
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+#include <iterator>
+#include <string_view>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace unicpp {
+
+// Guessing the encoding of bytes. A byte order mark decides it, otherwise the
+// guess is based on a sample from the beginning of the input: UTF-16 has zero
+// bytes at either even or odd offsets (the high bytes of ASCII characters),
+// text which isn't ASCII rarely happens to be valid UTF-8, and Latin-1 text
+// rarely has zeros or C1 control codes.
+
+// The number of bytes the guess is based on.
+constexpr size_t kDetectionSampleSize = 64 * 1024;
+
+struct DetectedEncoding {
+  Encoding encoding;
+  // how likely the guess is right, from 0 (empty input) to 100 (a byte order
+  // mark)
+  int confidence;
+  // length of the byte order mark the input starts with, 0 if there's none
+  size_t bom_length;
+};
+
+DetectedEncoding DetectEncoding(const uint8_t* data, size_t size);
+
+inline DetectedEncoding DetectEncoding(std::string_view bytes) {
+  return DetectEncoding(reinterpret_cast<const uint8_t*>(bytes.data()),
+                        bytes.size());
+}
+
+#if defined(__cpp_lib_span)
+inline DetectedEncoding DetectEncoding(std::span<const uint8_t> bytes) {
+  return DetectEncoding(bytes.data(), bytes.size());
+}
+#endif
+
+// Decodes contiguous `bytes` in the encoding DetectEncoding() guesses, the
+// byte order mark excluded. `bytes_decoded` counts the byte order mark too.
+template <class Wstring, class BytesContainer>
+Wstring DecodeAuto(const BytesContainer& bytes,
+                   ErrorPolicy policy = ErrorPolicy::kReplace,
+                   DetectedEncoding* detected = nullptr,
+                   size_t* bytes_decoded = nullptr) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+  static_assert(detail::IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1);
+
+  size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+  std::string_view input;
+  if (size > 0) {
+    input = std::string_view(
+        reinterpret_cast<const char*>(detail::IteratorAddress(bytes.begin())),
+        size);
+  }
+  DetectedEncoding encoding = DetectEncoding(input);
+  std::string_view text = input.substr(encoding.bom_length);
+
+  Wstring result;
+  size_t decoded = 0;
+  switch (encoding.encoding) {
+    case Encoding::kUtf8:
+      result = Utf8Wstring<Wstring>(text, policy, &decoded);
+      break;
+    case Encoding::kUtf16Le:
+      result = Utf16LeWstring<Wstring>(text, policy, &decoded);
+      break;
+    case Encoding::kUtf16Be:
+      result = Utf16BeWstring<Wstring>(text, policy, &decoded);
+      break;
+    case Encoding::kLatin1: {
+      const uint8_t* latin1 = reinterpret_cast<const uint8_t*>(text.data());
+      result = Wstring(latin1, latin1 + text.size());
+      decoded = text.size();
+      break;
+    }
+  }
+  if (detected != nullptr) {
+    *detected = encoding;
+  }
+  if (bytes_decoded != nullptr) {
+    *bytes_decoded = encoding.bom_length + decoded;
+  }
+
+  return result;
+}
+
+}  // namespace unicpp
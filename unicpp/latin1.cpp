@@ -0,0 +1,190 @@
+#include "latin1.h"
+
+#include "simd.h"
+
+#include <algorithm>
+
+namespace unicpp {
+namespace {
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool kBigEndianHost = true;
+#else
+constexpr bool kBigEndianHost = false;
+#endif
+
+size_t Latin1ToUtf16Impl(const uint8_t* bytes, size_t size, uint8_t* output,
+                         bool big_endian) {
+  detail::BlocksResult blocks =
+      detail::ActiveKernels().latin1_to_utf16_blocks(bytes, size, output,
+                                                     big_endian);
+  for (size_t pos = blocks.read; pos < size; pos++) {
+    detail::StoreUtf16Unit(bytes[pos], output + 2 * pos, big_endian);
+  }
+  return size;
+}
+
+size_t Utf16ToLatin1Impl(const uint8_t* bytes, size_t size, bool big_endian,
+                         uint8_t* output, ErrorPolicy policy,
+                         size_t* bytes_written) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos < size) {
+    detail::BlocksResult blocks = kernels.utf16_to_latin1_blocks(
+        bytes + pos, size - pos, big_endian, out);
+    pos += blocks.read;
+    out += blocks.written;
+
+    size_t end =
+        pos + std::min(2 * detail::kScalarBlockSize, (size - pos) & ~size_t{1});
+    uint16_t unit = 0xFFFF;
+    for (; pos < end; pos += 2) {
+      unit = detail::LoadUtf16Unit(bytes + pos, big_endian);
+      if (unit > 0xFF) {
+        break;
+      }
+      *out++ = static_cast<uint8_t>(unit);
+    }
+    if (pos == size || (pos == end && size - pos != 1)) {
+      continue;
+    }
+
+    if (policy == ErrorPolicy::kStop) {
+      break;
+    } else if (policy == ErrorPolicy::kReplace) {
+      *out++ = kLatin1ReplacementCharacter;
+    }
+    // a surrogate pair is a single character, otherwise skip a single code
+    // unit, or a trailing odd byte
+    size_t length = std::min<size_t>(2, size - pos);
+    if (unit >= 0xD800 && unit < 0xDC00 && size - pos >= 4) {
+      uint16_t next = detail::LoadUtf16Unit(bytes + pos + 2, big_endian);
+      if (next >= 0xDC00 && next < 0xE000) {
+        length = 4;
+      }
+    }
+    pos += length;
+  }
+
+  *bytes_written = out - output;
+  return pos;
+}
+
+}  // namespace
+
+size_t Utf8LengthFromLatin1(std::string_view latin1_string) {
+  size_t length = latin1_string.size();
+  for (char byte : latin1_string) {
+    length += static_cast<uint8_t>(byte) >> 7;
+  }
+  return length;
+}
+
+bool Utf8IsLatin1(std::string_view utf8_string) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(utf8_string.data());
+  size_t size = utf8_string.size();
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  size_t pos = 0;
+  while (pos < size) {
+    pos += kernels.utf8_to_latin1_blocks(bytes + pos, size - pos, nullptr).read;
+
+    const uint8_t* iter = bytes + pos;
+    const uint8_t* end = bytes + std::min(size, pos + detail::kScalarBlockSize);
+    while (iter < end) {
+      if (detail::Utf8DecodeCharacter(iter, bytes + size) > 0xFF) {
+        return false;
+      }
+    }
+    pos = iter - bytes;
+  }
+  return true;
+}
+
+namespace detail {
+
+// The kernels write past the end of their output, so they only get as much
+// input as they could transcode if all of it took the most output room.
+
+size_t Latin1ToUtf8Contiguous(const uint8_t* bytes, size_t size,
+                              uint8_t* output, size_t output_size,
+                              size_t* bytes_written) {
+  const Kernels& kernels = ActiveKernels();
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos < size) {
+    size_t room = (output_size - (out - output)) / 2;
+    BlocksResult blocks = kernels.latin1_to_utf8_blocks(
+        bytes + pos, std::min(size - pos, room), out);
+    pos += blocks.read;
+    out += blocks.written;
+
+    size_t end = std::min(size, pos + kScalarBlockSize);
+    for (; pos < end; pos++) {
+      out += StoreUtf8Character(bytes[pos], out);
+    }
+  }
+  *bytes_written = out - output;
+  return pos;
+}
+
+size_t Utf8ToLatin1Contiguous(const uint8_t* bytes, size_t size,
+                              uint8_t* output, ErrorPolicy policy,
+                              size_t* bytes_written) {
+  const Kernels& kernels = ActiveKernels();
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos < size) {
+    BlocksResult blocks =
+        kernels.utf8_to_latin1_blocks(bytes + pos, size - pos, out);
+    pos += blocks.read;
+    out += blocks.written;
+
+    const uint8_t* end = bytes + std::min(size, pos + kScalarBlockSize);
+    while (pos < size && bytes + pos < end) {
+      const uint8_t* iter = bytes + pos;
+      char32_t ch = Utf8DecodeCharacter(iter, bytes + size);
+      if (ch <= 0xFF) {
+        *out++ = static_cast<uint8_t>(ch);
+      } else if (policy == ErrorPolicy::kStop) {
+        *bytes_written = out - output;
+        return pos;
+      } else if (policy == ErrorPolicy::kReplace) {
+        *out++ = kLatin1ReplacementCharacter;
+      }
+      pos = iter - bytes;
+    }
+  }
+
+  *bytes_written = out - output;
+  return pos;
+}
+
+size_t Latin1ToUtf16Contiguous(const uint8_t* bytes, size_t size,
+                               uint8_t* output, Endian endian) {
+  return Latin1ToUtf16Impl(bytes, size, output, endian == Endian::kBig);
+}
+
+size_t Latin1ToUtf16Contiguous(const uint8_t* bytes, size_t size,
+                               char16_t* output) {
+  return Latin1ToUtf16Impl(bytes, size, reinterpret_cast<uint8_t*>(output),
+                           kBigEndianHost);
+}
+
+size_t Utf16ToLatin1Contiguous(const uint8_t* bytes, size_t size,
+                               Endian endian, uint8_t* output,
+                               ErrorPolicy policy, size_t* bytes_written) {
+  return Utf16ToLatin1Impl(bytes, size, endian == Endian::kBig, output, policy,
+                           bytes_written);
+}
+
+size_t Utf16ToLatin1Contiguous(const char16_t* units, size_t size,
+                               uint8_t* output, ErrorPolicy policy,
+                               size_t* bytes_written) {
+  return Utf16ToLatin1Impl(reinterpret_cast<const uint8_t*>(units), 2 * size,
+                           kBigEndianHost, output, policy, bytes_written) /
+         2;
+}
+
+}  // namespace detail
+}  // namespace unicpp
@@ -0,0 +1,398 @@
+#pragma once
+
+#include "utf16.h"
+#include "utf8.h"
+#include "utf_common.h"
+
+#include <iterator>
+#include <string_view>
+
+#include <stdint.h>
+
+namespace unicpp {
+
+// Latin-1 (ISO-8859-1) <-> UTF-8 and UTF-16 transcoding. Every Latin-1 byte is
+// the character of the same value, the characters above U+00FF aren't
+// representable and are errors handled by the ErrorPolicy. A replaced
+// character is written as '?'.
+
+constexpr uint8_t kLatin1ReplacementCharacter = '?';
+
+// Encodes Latin-1 bytes as UTF-8. Returns the number of written bytes.
+template <class BytesIterator, class OutputIterator>
+size_t Latin1ToUtf8(BytesIterator bytes_beg, BytesIterator bytes_end,
+                    OutputIterator output) {
+  size_t written = 0;
+  for (BytesIterator iter = bytes_beg; iter != bytes_end; ++iter) {
+    uint8_t byte = static_cast<uint8_t>(*iter);
+    if (byte <= 0x7F) {
+      *output = byte;
+      ++output;
+      written += 1;
+    } else {
+      *output = static_cast<uint8_t>(0xC0 | (byte >> 6));
+      ++output;
+      *output = static_cast<uint8_t>(0x80 | (byte & 0x3F));
+      ++output;
+      written += 2;
+    }
+  }
+  return written;
+}
+
+// Widens Latin-1 bytes to UTF-16 bytes in the given byte order.
+template <class BytesIterator, class OutputIterator,
+          Endian kEndian = Endian::kLittle>
+void Latin1ToUtf16Bytes(BytesIterator bytes_beg, BytesIterator bytes_end,
+                        OutputIterator output) {
+  for (BytesIterator iter = bytes_beg; iter != bytes_end; ++iter) {
+    output = detail::WriterWord<kEndian>(static_cast<uint8_t>(*iter), output);
+  }
+}
+
+template <class BytesIterator, class OutputIterator>
+void Latin1ToUtf16Le(BytesIterator bytes_beg, BytesIterator bytes_end,
+                     OutputIterator output) {
+  Latin1ToUtf16Bytes<BytesIterator, OutputIterator, Endian::kLittle>(
+      bytes_beg, bytes_end, output);
+}
+
+template <class BytesIterator, class OutputIterator>
+void Latin1ToUtf16Be(BytesIterator bytes_beg, BytesIterator bytes_end,
+                     OutputIterator output) {
+  Latin1ToUtf16Bytes<BytesIterator, OutputIterator, Endian::kBig>(
+      bytes_beg, bytes_end, output);
+}
+
+// Widens Latin-1 bytes to native char16_t code units.
+template <class BytesIterator, class OutputIterator>
+void Latin1ToUtf16(BytesIterator bytes_beg, BytesIterator bytes_end,
+                   OutputIterator output) {
+  for (BytesIterator iter = bytes_beg; iter != bytes_end; ++iter) {
+    *output = static_cast<char16_t>(static_cast<uint8_t>(*iter));
+    ++output;
+  }
+}
+
+// Transcodes UTF-8 bytes to Latin-1. An invalid sequence is an error per
+// byte, a valid character above U+00FF is a single error. Needs forward
+// iterators. Returns the number of transcoded input bytes.
+template <class BytesIterator, class OutputIterator>
+size_t Utf8ToLatin1(BytesIterator bytes_beg, BytesIterator bytes_end,
+                    OutputIterator output, ErrorPolicy policy) {
+  size_t transcoded = 0;
+  BytesIterator iter = bytes_beg;
+  while (iter != bytes_end) {
+    BytesIterator next = iter;
+    char32_t ch = detail::Utf8DecodeCharacter(next, bytes_end);
+    if (ch <= 0xFF) {
+      *output = static_cast<uint8_t>(ch);
+      ++output;
+    } else if (policy == ErrorPolicy::kStop) {
+      break;
+    } else if (policy == ErrorPolicy::kReplace) {
+      *output = kLatin1ReplacementCharacter;
+      ++output;
+    }
+    transcoded += static_cast<size_t>(std::distance(iter, next));
+    iter = next;
+  }
+  return transcoded;
+}
+
+// Transcodes UTF-16 to Latin-1. Input of 2-byte values is read as native code
+// units, otherwise as bytes in the given byte order. An unpaired surrogate or
+// a trailing odd byte is an error, as is a character above U+00FF, including
+// one encoded by a surrogate pair. Returns the number of transcoded input
+// values.
+template <class Utf16Iterator, class OutputIterator,
+          Endian kEndian = Endian::kLittle>
+size_t Utf16ToLatin1(Utf16Iterator input_beg, Utf16Iterator input_end,
+                     OutputIterator output, ErrorPolicy policy) {
+  constexpr std::ptrdiff_t kStep = detail::Utf16ValuesPerUnit<Utf16Iterator>();
+
+  size_t transcoded = 0;
+  Utf16Iterator iter = input_beg;
+  while (iter != input_end) {
+    std::ptrdiff_t step = 1;
+    uint16_t word = 0xFFFF;
+    if (detail::HasAtLeast(iter, input_end, kStep)) {
+      step = kStep;
+      word = detail::ReadWord<kEndian>(iter);
+      if (word >= 0xD800 && word < 0xDC00 &&
+          detail::HasAtLeast(iter, input_end, 2 * kStep)) {
+        uint16_t next = detail::ReadWord<kEndian>(std::next(iter, kStep));
+        if (next >= 0xDC00 && next < 0xE000) {
+          step = 2 * kStep;
+        }
+      }
+    }
+
+    if (word <= 0xFF) {
+      *output = static_cast<uint8_t>(word);
+      ++output;
+    } else if (policy == ErrorPolicy::kStop) {
+      break;
+    } else if (policy == ErrorPolicy::kReplace) {
+      *output = kLatin1ReplacementCharacter;
+      ++output;
+    }
+    std::advance(iter, step);
+    transcoded += static_cast<size_t>(step);
+  }
+  return transcoded;
+}
+
+template <class BytesIterator, class OutputIterator>
+size_t Utf16LeToLatin1(BytesIterator bytes_beg, BytesIterator bytes_end,
+                       OutputIterator output, ErrorPolicy policy) {
+  return Utf16ToLatin1<BytesIterator, OutputIterator, Endian::kLittle>(
+      bytes_beg, bytes_end, output, policy);
+}
+
+template <class BytesIterator, class OutputIterator>
+size_t Utf16BeToLatin1(BytesIterator bytes_beg, BytesIterator bytes_end,
+                       OutputIterator output, ErrorPolicy policy) {
+  return Utf16ToLatin1<BytesIterator, OutputIterator, Endian::kBig>(
+      bytes_beg, bytes_end, output, policy);
+}
+
+// Returns the length of the UTF-8 encoding of a Latin-1 string.
+size_t Utf8LengthFromLatin1(std::string_view latin1_string);
+
+// Returns true if `utf8_string` is valid UTF-8 with no characters above
+// U+00FF, i.e. transcodes to Latin-1 without errors.
+bool Utf8IsLatin1(std::string_view utf8_string);
+
+namespace detail {
+
+// Transcode contiguous input to `output` of `output_size` bytes (or units),
+// which must have room for the whole output: the length computed by
+// Utf8LengthFromLatin1() for UTF-8, a code unit per Latin-1 byte for UTF-16,
+// a byte per input byte (or unit) for Latin-1. Return the number of
+// transcoded input bytes (or units).
+size_t Latin1ToUtf8Contiguous(const uint8_t* bytes, size_t size,
+                              uint8_t* output, size_t output_size,
+                              size_t* bytes_written);
+size_t Utf8ToLatin1Contiguous(const uint8_t* bytes, size_t size,
+                              uint8_t* output, ErrorPolicy policy,
+                              size_t* bytes_written);
+size_t Latin1ToUtf16Contiguous(const uint8_t* bytes, size_t size,
+                               uint8_t* output, Endian endian);
+size_t Latin1ToUtf16Contiguous(const uint8_t* bytes, size_t size,
+                               char16_t* output);
+size_t Utf16ToLatin1Contiguous(const uint8_t* bytes, size_t size,
+                               Endian endian, uint8_t* output,
+                               ErrorPolicy policy, size_t* bytes_written);
+size_t Utf16ToLatin1Contiguous(const char16_t* units, size_t size,
+                               uint8_t* output, ErrorPolicy policy,
+                               size_t* bytes_written);
+
+// Returns `size` bytes starting from the first element of `container`.
+template <class Container>
+std::string_view Latin1BytesView(const Container& container, size_t size) {
+  return std::string_view(
+      reinterpret_cast<const char*>(IteratorAddress(container.begin())), size);
+}
+
+template <Endian kEndian, class Result, class BytesContainer>
+Result Utf16BytesFromLatin1(const BytesContainer& bytes) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+
+  Result result;
+  if constexpr (IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1 && IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 1) {
+    size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+    if (size > 0) {
+      std::string_view input = Latin1BytesView(bytes, size);
+      ResizeAndOverwrite(result, 2 * size, [&](auto* data) {
+        Latin1ToUtf16Contiguous(reinterpret_cast<const uint8_t*>(input.data()),
+                                size, reinterpret_cast<uint8_t*>(data),
+                                kEndian);
+        return 2 * size;
+      });
+    }
+  } else {
+    Latin1ToUtf16Bytes<BytesIterator, std::back_insert_iterator<Result>,
+                       kEndian>(bytes.begin(), bytes.end(),
+                                std::back_inserter(result));
+  }
+
+  return result;
+}
+
+template <Endian kEndian, class Result, class Utf16Container>
+Result Latin1BytesFromUtf16(const Utf16Container& input, ErrorPolicy policy,
+                            size_t* values_transcoded) {
+  using Utf16Iterator = decltype(input.begin());
+  using Value = typename std::iterator_traits<Utf16Iterator>::value_type;
+
+  Result result;
+  size_t transcoded = 0;
+  if constexpr (IsContiguousIterator<Utf16Iterator>() &&
+                (sizeof(Value) == 1 || sizeof(Value) == 2) &&
+                IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 1) {
+    size_t size = static_cast<size_t>(std::distance(input.begin(), input.end()));
+    if (size > 0) {
+      std::string_view bytes = Latin1BytesView(input, sizeof(Value) * size);
+      size_t length = sizeof(Value) == 2 ? size : (size + 1) / 2;
+      ResizeAndOverwrite(result, length, [&](auto* data) {
+        size_t written = 0;
+        if constexpr (sizeof(Value) == 2) {
+          transcoded = Utf16ToLatin1Contiguous(
+              reinterpret_cast<const char16_t*>(bytes.data()), size,
+              reinterpret_cast<uint8_t*>(data), policy, &written);
+        } else {
+          transcoded = Utf16ToLatin1Contiguous(
+              reinterpret_cast<const uint8_t*>(bytes.data()), size, kEndian,
+              reinterpret_cast<uint8_t*>(data), policy, &written);
+        }
+        return written;
+      });
+    }
+  } else {
+    transcoded = Utf16ToLatin1<Utf16Iterator,
+                               std::back_insert_iterator<Result>, kEndian>(
+        input.begin(), input.end(), std::back_inserter(result), policy);
+  }
+  if (values_transcoded != nullptr) {
+    *values_transcoded = transcoded;
+  }
+
+  return result;
+}
+
+}  // namespace detail
+
+template <class Result, class BytesContainer>
+Result Utf8BytesFromLatin1(const BytesContainer& bytes) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+
+  Result result;
+  if constexpr (detail::IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1 &&
+                detail::IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 1) {
+    size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+    if (size > 0) {
+      std::string_view input = detail::Latin1BytesView(bytes, size);
+      size_t length = Utf8LengthFromLatin1(input);
+      detail::ResizeAndOverwrite(result, length, [&](auto* data) {
+        size_t written = 0;
+        detail::Latin1ToUtf8Contiguous(
+            reinterpret_cast<const uint8_t*>(input.data()), size,
+            reinterpret_cast<uint8_t*>(data), length, &written);
+        return written;
+      });
+    }
+  } else {
+    Latin1ToUtf8(bytes.begin(), bytes.end(), std::back_inserter(result));
+  }
+
+  return result;
+}
+
+template <class Result, class BytesContainer>
+Result Latin1BytesFromUtf8(const BytesContainer& bytes,
+                           ErrorPolicy policy = ErrorPolicy::kReplace,
+                           size_t* bytes_transcoded = nullptr) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+
+  Result result;
+  size_t transcoded = 0;
+  if constexpr (detail::IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1 &&
+                detail::IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 1) {
+    size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+    if (size > 0) {
+      std::string_view input = detail::Latin1BytesView(bytes, size);
+      detail::ResizeAndOverwrite(result, size, [&](auto* data) {
+        size_t written = 0;
+        transcoded = detail::Utf8ToLatin1Contiguous(
+            reinterpret_cast<const uint8_t*>(input.data()), size,
+            reinterpret_cast<uint8_t*>(data), policy, &written);
+        return written;
+      });
+    }
+  } else {
+    transcoded = Utf8ToLatin1(bytes.begin(), bytes.end(),
+                              std::back_inserter(result), policy);
+  }
+  if (bytes_transcoded != nullptr) {
+    *bytes_transcoded = transcoded;
+  }
+
+  return result;
+}
+
+template <class Result, class BytesContainer>
+Result Utf16LeBytesFromLatin1(const BytesContainer& bytes) {
+  return detail::Utf16BytesFromLatin1<Endian::kLittle, Result>(bytes);
+}
+
+template <class Result, class BytesContainer>
+Result Utf16BeBytesFromLatin1(const BytesContainer& bytes) {
+  return detail::Utf16BytesFromLatin1<Endian::kBig, Result>(bytes);
+}
+
+// Result is a container of char16_t, e.g. std::u16string.
+template <class Result, class BytesContainer>
+Result Utf16StringFromLatin1(const BytesContainer& bytes) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+
+  Result result;
+  if constexpr (detail::IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1 &&
+                detail::IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 2) {
+    size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+    if (size > 0) {
+      std::string_view input = detail::Latin1BytesView(bytes, size);
+      detail::ResizeAndOverwrite(result, size, [&](auto* data) {
+        detail::Latin1ToUtf16Contiguous(
+            reinterpret_cast<const uint8_t*>(input.data()), size,
+            reinterpret_cast<char16_t*>(data));
+        return size;
+      });
+    }
+  } else {
+    Latin1ToUtf16(bytes.begin(), bytes.end(), std::back_inserter(result));
+  }
+
+  return result;
+}
+
+template <class Result, class BytesContainer>
+Result Latin1BytesFromUtf16Le(const BytesContainer& bytes,
+                              ErrorPolicy policy = ErrorPolicy::kReplace,
+                              size_t* bytes_transcoded = nullptr) {
+  return detail::Latin1BytesFromUtf16<Endian::kLittle, Result>(
+      bytes, policy, bytes_transcoded);
+}
+
+template <class Result, class BytesContainer>
+Result Latin1BytesFromUtf16Be(const BytesContainer& bytes,
+                              ErrorPolicy policy = ErrorPolicy::kReplace,
+                              size_t* bytes_transcoded = nullptr) {
+  return detail::Latin1BytesFromUtf16<Endian::kBig, Result>(bytes, policy,
+                                                            bytes_transcoded);
+}
+
+// Utf16String is a container of char16_t, e.g. std::u16string.
+template <class Result, class Utf16String>
+Result Latin1BytesFromUtf16(const Utf16String& utf16_string,
+                            ErrorPolicy policy = ErrorPolicy::kReplace,
+                            size_t* units_transcoded = nullptr) {
+  static_assert(sizeof(typename Utf16String::value_type) == 2);
+  return detail::Latin1BytesFromUtf16<Endian::kLittle, Result>(
+      utf16_string, policy, units_transcoded);
+}
+
+}  // namespace unicpp
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "utf8.h"
+#include "utf8_utf16.h"
+#include "utf_common.h"
+
+#include <string_view>
+
+#include <stddef.h>
+
+#if defined(__cpp_consteval)
+#define UNICPP_CONSTEVAL consteval
+#else
+#define UNICPP_CONSTEVAL constexpr
+#endif
+
+namespace unicpp {
+
+// Compile-time transcoding of UTF-8 string literals, e.g.
+//
+//   constexpr auto kName = Utf16Literal("Z\xC3\xBCrich");
+//   static_assert(kName.view() == u"Z\xFCrich");
+//
+// The functions are consteval in C++20, constexpr before that. Unlike the
+// other constexpr functions they don't need UNICPP_HAS_CONSTANT_EVALUATED.
+
+// UTF-16 code units or characters of a literal of N bytes with the
+// terminating zero. There are never more of them than bytes, so they are
+// zero-terminated too.
+template <class Char, size_t N>
+class LiteralString {
+public:
+  template <class Byte>
+  constexpr LiteralString(const Byte (&utf8)[N], ErrorPolicy policy) {
+    static_assert(sizeof(Byte) == 1);
+    static_assert(N > 0);
+    // never reaches the vectorized code, which can't tell compile time from
+    // runtime on every compiler
+    if constexpr (sizeof(Char) == 2) {
+      using Output = detail::Utf16EncodeOutputIterator<Appender, void>;
+      detail::Utf8DecodeForward<const Byte*, Output, /*kScalarOnly = */ true>(
+          utf8, utf8 + N - 1, Output(Appender{this}), policy);
+    } else {
+      detail::Utf8DecodeForward<const Byte*, Appender,
+                                /*kScalarOnly = */ true>(
+          utf8, utf8 + N - 1, Appender{this}, policy);
+    }
+  }
+
+  constexpr const Char* data() const {
+    return data_;
+  }
+  constexpr size_t size() const {
+    return size_;
+  }
+  constexpr const Char* begin() const {
+    return data_;
+  }
+  constexpr const Char* end() const {
+    return data_ + size_;
+  }
+  constexpr Char operator[](size_t index) const {
+    return data_[index];
+  }
+  constexpr std::basic_string_view<Char> view() const {
+    return std::basic_string_view<Char>(data_, size_);
+  }
+
+private:
+  struct Appender {
+    LiteralString* string;
+
+    constexpr Appender& operator=(char32_t ch) {
+      string->data_[string->size_++] = static_cast<Char>(ch);
+      return *this;
+    }
+    constexpr Appender& operator*() {
+      return *this;
+    }
+    constexpr Appender& operator++() {
+      return *this;
+    }
+  };
+
+  Char data_[N] = {};
+  size_t size_ = 0;
+};
+
+template <class Byte, size_t N>
+UNICPP_CONSTEVAL LiteralString<char16_t, N> Utf16Literal(
+    const Byte (&utf8)[N], ErrorPolicy policy = ErrorPolicy::kReplace) {
+  return LiteralString<char16_t, N>(utf8, policy);
+}
+
+template <class Byte, size_t N>
+UNICPP_CONSTEVAL LiteralString<char32_t, N> Utf32Literal(
+    const Byte (&utf8)[N], ErrorPolicy policy = ErrorPolicy::kReplace) {
+  return LiteralString<char32_t, N>(utf8, policy);
+}
+
+}  // namespace unicpp
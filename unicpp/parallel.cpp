@@ -0,0 +1,410 @@
+#include "parallel.h"
+
+#include "simd.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <thread>
+
+namespace unicpp {
+namespace detail {
+namespace {
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr Endian kNativeEndian = Endian::kBig;
+#else
+constexpr Endian kNativeEndian = Endian::kLittle;
+#endif
+
+// Runs `function(chunk)` for every chunk, the first one in the calling thread.
+template <class Function>
+void ForEachChunk(size_t num_chunks, const Function& function) {
+  std::vector<std::thread> threads;
+  threads.reserve(num_chunks - 1);
+  for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+    threads.emplace_back(function, chunk);
+  }
+  function(0);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+// Chunks may start at any byte which isn't a continuation byte. The decoder
+// never reads over such a byte from a preceding sequence, and neither over a
+// continuation byte preceded by 3 others. So `pos` is moved back by at most 3
+// bytes.
+size_t Utf8ChunkBoundary(const uint8_t* bytes, size_t pos) {
+  for (size_t back = 0; back <= 3 && back < pos; back++) {
+    if ((bytes[pos - back] & 0xC0) != 0x80) {
+      return pos - back;
+    }
+  }
+  return pos;
+}
+
+// Chunks may start at any code unit but the low surrogate of a pair.
+template <Endian kEndian>
+size_t Utf16ChunkBoundary(const uint8_t* bytes, size_t pos) {
+  pos &= ~size_t{1};
+  bool big_endian = kEndian == Endian::kBig;
+  uint16_t unit = LoadUtf16Unit(bytes + pos, big_endian);
+  if (pos >= 2 && unit >= 0xDC00 && unit < 0xE000) {
+    uint16_t prev = LoadUtf16Unit(bytes + pos - 2, big_endian);
+    if (prev >= 0xD800 && prev < 0xDC00) {
+      return pos - 2;
+    }
+  }
+  return pos;
+}
+
+// Every conversion has Input and Output value types, and functions finding
+// the boundary of a chunk at or before `pos`, computing the output length of
+// a chunk and transcoding it.
+
+template <class Char>
+struct Utf8ToUtf32 {
+  using Input = uint8_t;
+  using Output = Char;
+
+  static size_t Boundary(const uint8_t* input, size_t pos) {
+    return Utf8ChunkBoundary(input, pos);
+  }
+  static size_t Length(const uint8_t* input, size_t size) {
+    return Utf8NumCharsWithReplacement(
+        std::string_view(reinterpret_cast<const char*>(input), size));
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, Char* output,
+                          size_t, ErrorPolicy policy, size_t* written) {
+    return Utf8DecodeContiguous(input, size, output, policy, written);
+  }
+};
+
+struct Utf32ToUtf8 {
+  using Input = char32_t;
+  using Output = uint8_t;
+
+  static size_t Boundary(const char32_t*, size_t pos) {
+    return pos;
+  }
+  static size_t Length(const char32_t* input, size_t size) {
+    return Utf8LengthFromUtf32(std::u32string_view(input, size));
+  }
+  static size_t Transcode(const char32_t* input, size_t size, uint8_t* output,
+                          size_t output_size, ErrorPolicy policy,
+                          size_t* written) {
+    return Utf8EncodeContiguous(input, size, output, output_size, policy,
+                                written);
+  }
+};
+
+template <Endian kEndian>
+struct Utf32ToUtf16Bytes {
+  using Input = char32_t;
+  using Output = uint8_t;
+
+  static size_t Boundary(const char32_t*, size_t pos) {
+    return pos;
+  }
+  static size_t Length(const char32_t* input, size_t size) {
+    return 2 * Utf16LengthFromUtf32(std::u32string_view(input, size));
+  }
+  static size_t Transcode(const char32_t* input, size_t size, uint8_t* output,
+                          size_t, ErrorPolicy policy, size_t* written) {
+    return Utf16EncodeContiguous(input, size, output, kEndian, policy,
+                                 written);
+  }
+};
+
+template <Endian kEndian>
+struct Utf8ToUtf16Bytes {
+  using Input = uint8_t;
+  using Output = uint8_t;
+
+  static size_t Boundary(const uint8_t* input, size_t pos) {
+    return Utf8ChunkBoundary(input, pos);
+  }
+  static size_t Length(const uint8_t* input, size_t size) {
+    std::string_view bytes(reinterpret_cast<const char*>(input), size);
+    return 2 * Utf16LengthFromUtf8(bytes);
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t output_size, ErrorPolicy policy,
+                          size_t* written) {
+    return Utf8ToUtf16Contiguous(input, size, output, output_size, kEndian,
+                                 policy, written);
+  }
+};
+
+struct Utf8ToUtf16 {
+  using Input = uint8_t;
+  using Output = char16_t;
+
+  static size_t Boundary(const uint8_t* input, size_t pos) {
+    return Utf8ChunkBoundary(input, pos);
+  }
+  static size_t Length(const uint8_t* input, size_t size) {
+    return Utf16LengthFromUtf8(
+        std::string_view(reinterpret_cast<const char*>(input), size));
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, char16_t* output,
+                          size_t output_size, ErrorPolicy policy,
+                          size_t* written) {
+    return Utf8ToUtf16Contiguous(input, size, output, output_size, policy,
+                                 written);
+  }
+};
+
+template <Endian kEndian>
+struct Utf16BytesToUtf8 {
+  using Input = uint8_t;
+  using Output = uint8_t;
+
+  static size_t Boundary(const uint8_t* input, size_t pos) {
+    return Utf16ChunkBoundary<kEndian>(input, pos);
+  }
+  static size_t Length(const uint8_t* input, size_t size) {
+    std::string_view bytes(reinterpret_cast<const char*>(input), size);
+    return kEndian == Endian::kBig ? Utf8LengthFromUtf16Be(bytes)
+                                   : Utf8LengthFromUtf16Le(bytes);
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t output_size, ErrorPolicy policy,
+                          size_t* written) {
+    return Utf16ToUtf8Contiguous(input, size, kEndian, output, output_size,
+                                 policy, written);
+  }
+};
+
+struct Utf16ToUtf8 {
+  using Input = char16_t;
+  using Output = uint8_t;
+
+  static size_t Boundary(const char16_t* input, size_t pos) {
+    return Utf16ChunkBoundary<kNativeEndian>(
+               reinterpret_cast<const uint8_t*>(input), 2 * pos) /
+           2;
+  }
+  static size_t Length(const char16_t* input, size_t size) {
+    return Utf8LengthFromUtf16(std::u16string_view(input, size));
+  }
+  static size_t Transcode(const char16_t* input, size_t size, uint8_t* output,
+                          size_t output_size, ErrorPolicy policy,
+                          size_t* written) {
+    return Utf16ToUtf8Contiguous(input, size, output, output_size, policy,
+                                 written);
+  }
+};
+
+struct Latin1ToUtf8 {
+  using Input = uint8_t;
+  using Output = uint8_t;
+
+  static size_t Boundary(const uint8_t*, size_t pos) {
+    return pos;
+  }
+  static size_t Length(const uint8_t* input, size_t size) {
+    return Utf8LengthFromLatin1(
+        std::string_view(reinterpret_cast<const char*>(input), size));
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t output_size, ErrorPolicy, size_t* written) {
+    return Latin1ToUtf8Contiguous(input, size, output, output_size, written);
+  }
+};
+
+struct Utf8ToLatin1 {
+  using Input = uint8_t;
+  using Output = uint8_t;
+
+  static size_t Boundary(const uint8_t* input, size_t pos) {
+    return Utf8ChunkBoundary(input, pos);
+  }
+  // the kernels need a byte per input byte
+  static size_t Length(const uint8_t*, size_t size) {
+    return size;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t, ErrorPolicy policy, size_t* written) {
+    return Utf8ToLatin1Contiguous(input, size, output, policy, written);
+  }
+};
+
+template <Endian kEndian>
+struct Latin1ToUtf16Bytes {
+  using Input = uint8_t;
+  using Output = uint8_t;
+
+  static size_t Boundary(const uint8_t*, size_t pos) {
+    return pos;
+  }
+  static size_t Length(const uint8_t*, size_t size) {
+    return 2 * size;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t, ErrorPolicy, size_t* written) {
+    *written = 2 * size;
+    return Latin1ToUtf16Contiguous(input, size, output, kEndian);
+  }
+};
+
+template <Endian kEndian>
+struct Utf16BytesToLatin1 {
+  using Input = uint8_t;
+  using Output = uint8_t;
+
+  static size_t Boundary(const uint8_t* input, size_t pos) {
+    return Utf16ChunkBoundary<kEndian>(input, pos);
+  }
+  // a byte per code unit, less if there are surrogate pairs
+  static size_t Length(const uint8_t*, size_t size) {
+    return (size + 1) / 2;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t, ErrorPolicy policy, size_t* written) {
+    return Utf16ToLatin1Contiguous(input, size, kEndian, output, policy,
+                                   written);
+  }
+};
+
+template <class Function>
+auto WithConversion(ParallelConversion conversion, const Function& function) {
+  switch (conversion) {
+    case ParallelConversion::kUtf8ToUtf32:
+      return function(Utf8ToUtf32<char32_t>());
+#if WCHAR_MAX > 0xFFFF
+    case ParallelConversion::kUtf8ToWchar:
+      return function(Utf8ToUtf32<wchar_t>());
+#endif
+    case ParallelConversion::kUtf32ToUtf8:
+      return function(Utf32ToUtf8());
+    case ParallelConversion::kUtf32ToUtf16Le:
+      return function(Utf32ToUtf16Bytes<Endian::kLittle>());
+    case ParallelConversion::kUtf32ToUtf16Be:
+      return function(Utf32ToUtf16Bytes<Endian::kBig>());
+    case ParallelConversion::kUtf8ToUtf16Le:
+      return function(Utf8ToUtf16Bytes<Endian::kLittle>());
+    case ParallelConversion::kUtf8ToUtf16Be:
+      return function(Utf8ToUtf16Bytes<Endian::kBig>());
+    case ParallelConversion::kUtf8ToUtf16:
+      return function(Utf8ToUtf16());
+    case ParallelConversion::kUtf16LeToUtf8:
+      return function(Utf16BytesToUtf8<Endian::kLittle>());
+    case ParallelConversion::kUtf16BeToUtf8:
+      return function(Utf16BytesToUtf8<Endian::kBig>());
+    case ParallelConversion::kLatin1ToUtf8:
+      return function(Latin1ToUtf8());
+    case ParallelConversion::kUtf8ToLatin1:
+      return function(Utf8ToLatin1());
+    case ParallelConversion::kLatin1ToUtf16Le:
+      return function(Latin1ToUtf16Bytes<Endian::kLittle>());
+    case ParallelConversion::kLatin1ToUtf16Be:
+      return function(Latin1ToUtf16Bytes<Endian::kBig>());
+    case ParallelConversion::kUtf16LeToLatin1:
+      return function(Utf16BytesToLatin1<Endian::kLittle>());
+    case ParallelConversion::kUtf16BeToLatin1:
+      return function(Utf16BytesToLatin1<Endian::kBig>());
+    case ParallelConversion::kUtf16ToUtf8:
+      break;
+  }
+  // kUtf16ToUtf8, outside of the switch for the compilers warning about a
+  // missing return
+  return function(Utf16ToUtf8());
+}
+
+template <class Conversion>
+ParallelChunks Split(const void* data, size_t size, size_t num_threads) {
+  using Input = typename Conversion::Input;
+  const Input* input = static_cast<const Input*>(data);
+
+  if (num_threads == 0) {
+    num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  }
+  size_t num_chunks = std::clamp<size_t>(
+      size * sizeof(Input) / kParallelMinChunkSize, 1, num_threads);
+
+  ParallelChunks chunks;
+  chunks.input_offsets.resize(num_chunks + 1);
+  for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+    chunks.input_offsets[chunk] =
+        Conversion::Boundary(input, size / num_chunks * chunk);
+  }
+  chunks.input_offsets[num_chunks] = size;
+
+  chunks.output_offsets.resize(num_chunks + 1);
+  ForEachChunk(num_chunks, [&](size_t chunk) {
+    size_t begin = chunks.input_offsets[chunk];
+    size_t end = chunks.input_offsets[chunk + 1];
+    chunks.output_offsets[chunk + 1] =
+        Conversion::Length(input + begin, end - begin);
+  });
+  for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+    chunks.output_offsets[chunk + 1] += chunks.output_offsets[chunk];
+  }
+  return chunks;
+}
+
+template <class Conversion>
+size_t Transcode(const ParallelChunks& chunks, const void* data, void* out,
+                 ErrorPolicy policy, size_t* values_written) {
+  using Input = typename Conversion::Input;
+  using Output = typename Conversion::Output;
+  const Input* input = static_cast<const Input*>(data);
+  Output* output = static_cast<Output*>(out);
+
+  size_t num_chunks = chunks.input_offsets.size() - 1;
+  std::vector<size_t> read(num_chunks);
+  std::vector<size_t> written(num_chunks);
+  ForEachChunk(num_chunks, [&](size_t chunk) {
+    size_t begin = chunks.input_offsets[chunk];
+    size_t output_begin = chunks.output_offsets[chunk];
+    read[chunk] = Conversion::Transcode(
+        input + begin, chunks.input_offsets[chunk + 1] - begin,
+        output + output_begin, chunks.output_offsets[chunk + 1] - output_begin,
+        policy, &written[chunk]);
+  });
+
+  // skipped errors leave gaps between the chunks, and the output ends at the
+  // first chunk stopped at an error
+  size_t transcoded = 0;
+  size_t length = 0;
+  for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+    if (length != chunks.output_offsets[chunk]) {
+      std::memmove(output + length, output + chunks.output_offsets[chunk],
+                   written[chunk] * sizeof(Output));
+    }
+    transcoded += read[chunk];
+    length += written[chunk];
+    if (read[chunk] !=
+        chunks.input_offsets[chunk + 1] - chunks.input_offsets[chunk]) {
+      break;
+    }
+  }
+
+  *values_written = length;
+  return transcoded;
+}
+
+}  // namespace
+
+ParallelChunks SplitForParallel(ParallelConversion conversion,
+                                const void* input, size_t size,
+                                size_t num_threads) {
+  return WithConversion(conversion, [&](auto codec) {
+    return Split<decltype(codec)>(input, size, num_threads);
+  });
+}
+
+size_t TranscodeParallel(ParallelConversion conversion,
+                         const ParallelChunks& chunks, const void* input,
+                         void* output, ErrorPolicy policy,
+                         size_t* values_written) {
+  return WithConversion(conversion, [&](auto codec) {
+    return Transcode<decltype(codec)>(chunks, input, output, policy,
+                                      values_written);
+  });
+}
+
+}  // namespace detail
+}  // namespace unicpp
@@ -0,0 +1,250 @@
+#pragma once
+
+#include "latin1.h"
+#include "utf16.h"
+#include "utf8.h"
+#include "utf8_utf16.h"
+#include "utf_common.h"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <stdint.h>
+
+namespace unicpp {
+
+// Multi-threaded transcoding of large contiguous input. The input is split
+// into chunks at character boundaries, the output length of every chunk is
+// computed concurrently, then the chunks are transcoded concurrently into a
+// single buffer of the total length. The result is the same as of the
+// sequential functions, including the number of transcoded input values for
+// every ErrorPolicy.
+//
+// `num_threads` is the maximum number of threads, 0 for the number of
+// hardware threads. Input shorter than kParallelMinChunkSize bytes per thread
+// uses fewer threads.
+
+constexpr size_t kParallelMinChunkSize = 1 << 16;
+
+namespace detail {
+
+enum class ParallelConversion {
+  kUtf8ToUtf32,
+#if WCHAR_MAX > 0xFFFF
+  kUtf8ToWchar,
+#endif
+  kUtf32ToUtf8,
+  kUtf32ToUtf16Le,
+  kUtf32ToUtf16Be,
+  kUtf8ToUtf16Le,
+  kUtf8ToUtf16Be,
+  kUtf8ToUtf16,
+  kUtf16LeToUtf8,
+  kUtf16BeToUtf8,
+  kUtf16ToUtf8,
+  kLatin1ToUtf8,
+  kUtf8ToLatin1,
+  kLatin1ToUtf16Le,
+  kLatin1ToUtf16Be,
+  kUtf16LeToLatin1,
+  kUtf16BeToLatin1,
+};
+
+// Input values (bytes, code units or characters) and output values of every
+// chunk, the chunk i is [offsets[i], offsets[i + 1]).
+struct ParallelChunks {
+  std::vector<size_t> input_offsets;
+  std::vector<size_t> output_offsets;
+};
+
+// Splits `input` of `size` values and computes the output lengths of the
+// chunks with invalid sequences replaced.
+ParallelChunks SplitForParallel(ParallelConversion conversion,
+                                const void* input, size_t size,
+                                size_t num_threads);
+
+// Transcodes the chunks to `output`, which must have room for
+// output_offsets.back() values. Returns the number of transcoded input values.
+size_t TranscodeParallel(ParallelConversion conversion,
+                         const ParallelChunks& chunks, const void* input,
+                         void* output, ErrorPolicy policy,
+                         size_t* values_written);
+
+template <class Result, class Input>
+Result TranscodeInParallel(ParallelConversion conversion, const Input& input,
+                           ErrorPolicy policy, size_t* values_transcoded,
+                           size_t num_threads) {
+  static_assert(IsContiguousIterator<decltype(input.begin())>() &&
+                    IsContiguousContainer<Result>(),
+                "Parallel transcoding needs contiguous input and output");
+
+  Result result;
+  size_t transcoded = 0;
+  size_t size = static_cast<size_t>(std::distance(input.begin(), input.end()));
+  if (size > 0) {
+    const void* data = IteratorAddress(input.begin());
+    ParallelChunks chunks =
+        SplitForParallel(conversion, data, size, num_threads);
+    ResizeAndOverwrite(result, chunks.output_offsets.back(), [&](auto* out) {
+      size_t written = 0;
+      transcoded = TranscodeParallel(conversion, chunks, data, out, policy,
+                                     &written);
+      return written;
+    });
+  }
+  if (values_transcoded != nullptr) {
+    *values_transcoded = transcoded;
+  }
+
+  return result;
+}
+
+template <class Container>
+constexpr size_t ValueSize() {
+  using Iterator = decltype(std::declval<const Container&>().begin());
+  return sizeof(typename std::iterator_traits<Iterator>::value_type);
+}
+
+}  // namespace detail
+
+// Same as Utf8Wstring(), Wstring is a container of char32_t (or wchar_t on
+// platforms where it's 32-bit).
+template <class Wstring, class BytesContainer>
+Wstring Utf8WstringParallel(const BytesContainer& bytes,
+                            ErrorPolicy policy = ErrorPolicy::kReplace,
+                            size_t* bytes_decoded = nullptr,
+                            size_t num_threads = 0) {
+  using Char = typename Wstring::value_type;
+  static_assert(detail::ValueSize<BytesContainer>() == 1);
+  static_assert(std::is_same_v<Char, char32_t> ||
+                (std::is_same_v<Char, wchar_t> && WCHAR_MAX > 0xFFFF));
+
+  detail::ParallelConversion conversion =
+      detail::ParallelConversion::kUtf8ToUtf32;
+#if WCHAR_MAX > 0xFFFF
+  if constexpr (std::is_same_v<Char, wchar_t>) {
+    conversion = detail::ParallelConversion::kUtf8ToWchar;
+  }
+#endif
+  return detail::TranscodeInParallel<Wstring>(conversion, bytes, policy,
+                                              bytes_decoded, num_threads);
+}
+
+// Same as Utf8Bytes(), Wstring is a container of 32-bit characters.
+template <class Result, class Wstring>
+Result Utf8BytesParallel(const Wstring& wstring,
+                         ErrorPolicy policy = ErrorPolicy::kReplace,
+                         size_t* chars_encoded = nullptr,
+                         size_t num_threads = 0) {
+  static_assert(detail::ValueSize<Wstring>() == 4);
+  static_assert(sizeof(typename Result::value_type) == 1);
+  return detail::TranscodeInParallel<Result>(
+      detail::ParallelConversion::kUtf32ToUtf8, wstring, policy,
+      chars_encoded, num_threads);
+}
+
+// Same as Utf16LeBytes() and Utf16BeBytes().
+template <class Result, class Wstring>
+Result Utf16LeBytesParallel(const Wstring& wstring,
+                            ErrorPolicy policy = ErrorPolicy::kReplace,
+                            size_t* chars_encoded = nullptr,
+                            size_t num_threads = 0) {
+  static_assert(detail::ValueSize<Wstring>() == 4);
+  static_assert(sizeof(typename Result::value_type) == 1);
+  return detail::TranscodeInParallel<Result>(
+      detail::ParallelConversion::kUtf32ToUtf16Le, wstring, policy,
+      chars_encoded, num_threads);
+}
+
+template <class Result, class Wstring>
+Result Utf16BeBytesParallel(const Wstring& wstring,
+                            ErrorPolicy policy = ErrorPolicy::kReplace,
+                            size_t* chars_encoded = nullptr,
+                            size_t num_threads = 0) {
+  static_assert(detail::ValueSize<Wstring>() == 4);
+  static_assert(sizeof(typename Result::value_type) == 1);
+  return detail::TranscodeInParallel<Result>(
+      detail::ParallelConversion::kUtf32ToUtf16Be, wstring, policy,
+      chars_encoded, num_threads);
+}
+
+// Same as Utf16LeBytesFromUtf8(), Utf16BeBytesFromUtf8() and
+// Utf16StringFromUtf8().
+template <class Result, class BytesContainer>
+Result Utf16LeBytesFromUtf8Parallel(const BytesContainer& bytes,
+                                    ErrorPolicy policy = ErrorPolicy::kReplace,
+                                    size_t* bytes_transcoded = nullptr,
+                                    size_t num_threads = 0) {
+  static_assert(detail::ValueSize<BytesContainer>() == 1);
+  static_assert(sizeof(typename Result::value_type) == 1);
+  return detail::TranscodeInParallel<Result>(
+      detail::ParallelConversion::kUtf8ToUtf16Le, bytes, policy,
+      bytes_transcoded, num_threads);
+}
+
+template <class Result, class BytesContainer>
+Result Utf16BeBytesFromUtf8Parallel(const BytesContainer& bytes,
+                                    ErrorPolicy policy = ErrorPolicy::kReplace,
+                                    size_t* bytes_transcoded = nullptr,
+                                    size_t num_threads = 0) {
+  static_assert(detail::ValueSize<BytesContainer>() == 1);
+  static_assert(sizeof(typename Result::value_type) == 1);
+  return detail::TranscodeInParallel<Result>(
+      detail::ParallelConversion::kUtf8ToUtf16Be, bytes, policy,
+      bytes_transcoded, num_threads);
+}
+
+template <class Result, class BytesContainer>
+Result Utf16StringFromUtf8Parallel(const BytesContainer& bytes,
+                                   ErrorPolicy policy = ErrorPolicy::kReplace,
+                                   size_t* bytes_transcoded = nullptr,
+                                   size_t num_threads = 0) {
+  static_assert(detail::ValueSize<BytesContainer>() == 1);
+  static_assert(sizeof(typename Result::value_type) == 2);
+  return detail::TranscodeInParallel<Result>(
+      detail::ParallelConversion::kUtf8ToUtf16, bytes, policy,
+      bytes_transcoded, num_threads);
+}
+
+// Same as Utf8BytesFromUtf16Le(), Utf8BytesFromUtf16Be() and
+// Utf8BytesFromUtf16().
+template <class Result, class BytesContainer>
+Result Utf8BytesFromUtf16LeParallel(const BytesContainer& bytes,
+                                    ErrorPolicy policy = ErrorPolicy::kReplace,
+                                    size_t* bytes_transcoded = nullptr,
+                                    size_t num_threads = 0) {
+  static_assert(detail::ValueSize<BytesContainer>() == 1);
+  static_assert(sizeof(typename Result::value_type) == 1);
+  return detail::TranscodeInParallel<Result>(
+      detail::ParallelConversion::kUtf16LeToUtf8, bytes, policy,
+      bytes_transcoded, num_threads);
+}
+
+template <class Result, class BytesContainer>
+Result Utf8BytesFromUtf16BeParallel(const BytesContainer& bytes,
+                                    ErrorPolicy policy = ErrorPolicy::kReplace,
+                                    size_t* bytes_transcoded = nullptr,
+                                    size_t num_threads = 0) {
+  static_assert(detail::ValueSize<BytesContainer>() == 1);
+  static_assert(sizeof(typename Result::value_type) == 1);
+  return detail::TranscodeInParallel<Result>(
+      detail::ParallelConversion::kUtf16BeToUtf8, bytes, policy,
+      bytes_transcoded, num_threads);
+}
+
+// Utf16String is a container of char16_t, e.g. std::u16string.
+template <class Result, class Utf16String>
+Result Utf8BytesFromUtf16Parallel(const Utf16String& utf16_string,
+                                  ErrorPolicy policy = ErrorPolicy::kReplace,
+                                  size_t* units_transcoded = nullptr,
+                                  size_t num_threads = 0) {
+  static_assert(detail::ValueSize<Utf16String>() == 2);
+  static_assert(sizeof(typename Result::value_type) == 1);
+  return detail::TranscodeInParallel<Result>(
+      detail::ParallelConversion::kUtf16ToUtf8, utf16_string, policy,
+      units_transcoded, num_threads);
+}
+
+}  // namespace unicpp
@@ -0,0 +1,700 @@
+#pragma once
+
+#include "simd_level.h"
+#include "utf_common.h"
+
+#include <array>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+    defined(_M_IX86)
+#define UNICPP_X86 1
+#endif
+
+// The kernels are compiled for their instruction sets with function target
+// attributes regardless of the compiler flags, and are only called if the CPU
+// supports them, see ActiveKernels().
+#if defined(UNICPP_X86) && \
+    (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define UNICPP_HAS_AVX2 1
+#define UNICPP_HAS_SSE42 1
+#endif
+
+namespace unicpp {
+namespace detail {
+
+// Lookup tables of the UTF-8 validation algorithm from "Validating UTF-8 In
+// Less Than One Instruction Per Byte" (J. Keiser, D. Lemire). Every pair of
+// adjacent bytes is classified by the high and low nibbles of the first byte
+// and the high nibble of the second one; a non-zero AND of the three lookups
+// is an error.
+constexpr uint8_t kTooShort = 1 << 0;   // 11______ 0_______, 11______ 11______
+constexpr uint8_t kTooLong = 1 << 1;    // 0_______ 10______
+constexpr uint8_t kOverlong3 = 1 << 2;  // 11100000 100_____
+constexpr uint8_t kTooLarge = 1 << 3;   // 11110100 1001____, 11110100 101_____
+constexpr uint8_t kSurrogate = 1 << 4;  // 11101101 101_____
+constexpr uint8_t kOverlong2 = 1 << 5;  // 1100000_ 10______
+constexpr uint8_t kTooLarge1000 = 1 << 6;  // 11110101 1000____, 1111011_ ...
+constexpr uint8_t kOverlong4 = 1 << 6;     // 11110000 1000____
+constexpr uint8_t kTwoConts = 1 << 7;      // 10______ 10______
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+inline constexpr uint8_t kUtf8Byte1HighTable[16] = {
+    kTooLong,
+    kTooLong,
+    kTooLong,
+    kTooLong,
+    kTooLong,
+    kTooLong,
+    kTooLong,
+    kTooLong,
+    kTwoConts,
+    kTwoConts,
+    kTwoConts,
+    kTwoConts,
+    kTooShort | kOverlong2,
+    kTooShort,
+    kTooShort | kOverlong3 | kSurrogate,
+    kTooShort | kTooLarge | kTooLarge1000 | kOverlong4,
+};
+
+inline constexpr uint8_t kUtf8Byte1LowTable[16] = {
+    kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+    kCarry | kOverlong2,
+    kCarry,
+    kCarry,
+    kCarry | kTooLarge,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+    kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000,
+};
+
+inline constexpr uint8_t kUtf8Byte2HighTable[16] = {
+    kTooShort,
+    kTooShort,
+    kTooShort,
+    kTooShort,
+    kTooShort,
+    kTooShort,
+    kTooShort,
+    kTooShort,
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+    kTooShort,
+    kTooShort,
+    kTooShort,
+    kTooShort,
+};
+
+// Vectorized kernels work on whole blocks only. Each of them returns how far
+// it got, and the caller finishes the rest (the tail shorter than a block and
+// everything starting around the first error) with the scalar code.
+
+struct BlocksResult {
+  size_t read;
+  size_t written;
+};
+
+// Returns the length of a prefix of `data` which is valid UTF-8 and ends on a
+// character boundary. Any error is located after that prefix.
+size_t Utf8ValidBlocksLengthSse42(const uint8_t* data, size_t size);
+size_t Utf8ValidBlocksLengthAvx2(const uint8_t* data, size_t size);
+
+// Decodes a prefix of `data` to `output`, which must have room for `size`
+// characters. With ErrorPolicy::kStop the prefix is valid UTF-8, otherwise
+// invalid bytes are replaced or skipped the same way the scalar decoder does.
+BlocksResult Utf8ToUtf32BlocksSse42(const uint8_t* data, size_t size,
+                                    char32_t* output, ErrorPolicy policy);
+BlocksResult Utf8ToUtf32BlocksAvx2(const uint8_t* data, size_t size,
+                                   char32_t* output, ErrorPolicy policy);
+
+// Same as Utf8ToUtf32Blocks*, but writes UTF-16 code units stored in little or
+// big endian byte order. `output` must have room for `size` code units, the
+// number of written code units is returned.
+BlocksResult Utf8ToUtf16BlocksSse42(const uint8_t* data, size_t size,
+                                    uint8_t* output, bool big_endian,
+                                    ErrorPolicy policy);
+BlocksResult Utf8ToUtf16BlocksAvx2(const uint8_t* data, size_t size,
+                                   uint8_t* output, bool big_endian,
+                                   ErrorPolicy policy);
+
+// Transcodes a valid prefix of UTF-16 `data` of `size` bytes to UTF-8.
+// `output` must have room for 3 bytes per code unit.
+BlocksResult Utf16ToUtf8BlocksSse42(const uint8_t* data, size_t size,
+                                    bool big_endian, uint8_t* output);
+BlocksResult Utf16ToUtf8BlocksAvx2(const uint8_t* data, size_t size,
+                                   bool big_endian, uint8_t* output);
+
+// Decodes a valid prefix of UTF-16 `data` of `size` bytes to `output`, which
+// must have room for a character per code unit.
+BlocksResult Utf16ToUtf32BlocksSse42(const uint8_t* data, size_t size,
+                                     bool big_endian, char32_t* output);
+BlocksResult Utf16ToUtf32BlocksAvx2(const uint8_t* data, size_t size,
+                                    bool big_endian, char32_t* output);
+
+// Encodes a prefix of `data` with no invalid characters as UTF-8. `output`
+// must have room for 4 bytes per character.
+BlocksResult Utf32ToUtf8BlocksSse42(const char32_t* data, size_t size,
+                                    uint8_t* output);
+BlocksResult Utf32ToUtf8BlocksAvx2(const char32_t* data, size_t size,
+                                   uint8_t* output);
+
+// Decode a valid prefix of `data` in the given UTF-8 variant, see
+// utf8_variants.h, the same way as Utf8ToUtf32Blocks* and Utf8ToUtf16Blocks*
+// with ErrorPolicy::kStop. Encoded surrogates are decoded to single code
+// units, so a CESU-8 or Modified UTF-8 surrogate pair is only decoded to UTF-16
+// here and left to the scalar code otherwise.
+BlocksResult Utf8VariantToUtf32BlocksSse42(const uint8_t* data, size_t size,
+                                           Utf8Variant variant,
+                                           char32_t* output);
+BlocksResult Utf8VariantToUtf32BlocksAvx2(const uint8_t* data, size_t size,
+                                          Utf8Variant variant,
+                                          char32_t* output);
+BlocksResult Utf8VariantToUtf16BlocksSse42(const uint8_t* data, size_t size,
+                                           Utf8Variant variant,
+                                           uint8_t* output, bool big_endian);
+BlocksResult Utf8VariantToUtf16BlocksAvx2(const uint8_t* data, size_t size,
+                                          Utf8Variant variant, uint8_t* output,
+                                          bool big_endian);
+
+// Same as Utf16ToUtf8Blocks* for a UTF-8 variant, stops at an unpaired
+// surrogate in CESU-8 only.
+BlocksResult Utf16ToUtf8VariantBlocksSse42(const uint8_t* data, size_t size,
+                                           bool big_endian, Utf8Variant variant,
+                                           uint8_t* output);
+BlocksResult Utf16ToUtf8VariantBlocksAvx2(const uint8_t* data, size_t size,
+                                          bool big_endian, Utf8Variant variant,
+                                          uint8_t* output);
+
+// The length kernels count the output of whole blocks as transcoded with
+// ErrorPolicy::kReplace, `written` is the length in bytes for UTF-8 and in
+// code units for UTF-16.
+
+// Count the characters of full blocks, invalid ones as U+FFFD.
+BlocksResult Utf8LengthFromUtf32BlocksSse42(const char32_t* data, size_t size);
+BlocksResult Utf8LengthFromUtf32BlocksAvx2(const char32_t* data, size_t size);
+BlocksResult Utf16LengthFromUtf32BlocksSse42(const char32_t* data,
+                                             size_t size);
+BlocksResult Utf16LengthFromUtf32BlocksAvx2(const char32_t* data, size_t size);
+
+// Count the valid UTF-8 prefix of `data`, same as Utf8ValidBlocksLength*.
+BlocksResult Utf32LengthFromUtf8BlocksSse42(const uint8_t* data, size_t size);
+BlocksResult Utf32LengthFromUtf8BlocksAvx2(const uint8_t* data, size_t size);
+BlocksResult Utf16LengthFromUtf8BlocksSse42(const uint8_t* data, size_t size);
+BlocksResult Utf16LengthFromUtf8BlocksAvx2(const uint8_t* data, size_t size);
+
+// Counts a valid prefix of UTF-16 `data` of `size` bytes.
+BlocksResult Utf8LengthFromUtf16BlocksSse42(const uint8_t* data, size_t size,
+                                            bool big_endian);
+BlocksResult Utf8LengthFromUtf16BlocksAvx2(const uint8_t* data, size_t size,
+                                           bool big_endian);
+
+// Counts the characters of a valid prefix of UTF-16 `data` of `size` bytes.
+BlocksResult Utf32LengthFromUtf16BlocksSse42(const uint8_t* data, size_t size,
+                                             bool big_endian);
+BlocksResult Utf32LengthFromUtf16BlocksAvx2(const uint8_t* data, size_t size,
+                                            bool big_endian);
+
+// Encodes a prefix of Latin-1 `data` as UTF-8. `output` must have room for 2
+// bytes per input byte.
+BlocksResult Latin1ToUtf8BlocksSse42(const uint8_t* data, size_t size,
+                                     uint8_t* output);
+BlocksResult Latin1ToUtf8BlocksAvx2(const uint8_t* data, size_t size,
+                                    uint8_t* output);
+
+// Transcodes a prefix of UTF-8 `data` which is valid and has no characters
+// above U+00FF to Latin-1. `output` must have room for `size` bytes, or be
+// null to only find the prefix.
+BlocksResult Utf8ToLatin1BlocksSse42(const uint8_t* data, size_t size,
+                                     uint8_t* output);
+BlocksResult Utf8ToLatin1BlocksAvx2(const uint8_t* data, size_t size,
+                                    uint8_t* output);
+
+// Widens a prefix of Latin-1 `data` to UTF-16 code units stored in little or
+// big endian byte order. `output` must have room for `size` code units.
+BlocksResult Latin1ToUtf16BlocksSse42(const uint8_t* data, size_t size,
+                                      uint8_t* output, bool big_endian);
+BlocksResult Latin1ToUtf16BlocksAvx2(const uint8_t* data, size_t size,
+                                     uint8_t* output, bool big_endian);
+
+// Narrows a prefix of UTF-16 `data` of `size` bytes with no code units above
+// 0xFF to Latin-1. `output` must have room for a byte per code unit.
+BlocksResult Utf16ToLatin1BlocksSse42(const uint8_t* data, size_t size,
+                                      bool big_endian, uint8_t* output);
+BlocksResult Utf16ToLatin1BlocksAvx2(const uint8_t* data, size_t size,
+                                     bool big_endian, uint8_t* output);
+
+// Statistics of the bytes of text in an unknown encoding, see
+// DetectEncoding().
+struct ByteCounts {
+  // zero bytes at even and odd offsets
+  size_t even_zeros;
+  size_t odd_zeros;
+  // bytes 0x80-0xFF, and the C1 control codes 0x80-0x9F among them
+  size_t non_ascii;
+  size_t c1_controls;
+};
+
+// Adds the counts of the bytes of a prefix of `data` to `counts`, returns the
+// length of the prefix, which is even.
+size_t CountBytesBlocksSse42(const uint8_t* data, size_t size,
+                             ByteCounts& counts);
+size_t CountBytesBlocksAvx2(const uint8_t* data, size_t size,
+                            ByteCounts& counts);
+
+// Function pointers to the kernels of a single instruction set. The scalar
+// ones do nothing and return zeros.
+struct Kernels {
+  size_t (*utf8_valid_blocks_length)(const uint8_t* data, size_t size);
+  BlocksResult (*utf8_to_utf32_blocks)(const uint8_t* data, size_t size,
+                                       char32_t* output, ErrorPolicy policy);
+  BlocksResult (*utf8_to_utf16_blocks)(const uint8_t* data, size_t size,
+                                       uint8_t* output, bool big_endian,
+                                       ErrorPolicy policy);
+  BlocksResult (*utf16_to_utf8_blocks)(const uint8_t* data, size_t size,
+                                       bool big_endian, uint8_t* output);
+  BlocksResult (*utf16_to_utf32_blocks)(const uint8_t* data, size_t size,
+                                        bool big_endian, char32_t* output);
+  BlocksResult (*utf32_to_utf8_blocks)(const char32_t* data, size_t size,
+                                       uint8_t* output);
+  BlocksResult (*utf8_variant_to_utf32_blocks)(const uint8_t* data,
+                                               size_t size,
+                                               Utf8Variant variant,
+                                               char32_t* output);
+  BlocksResult (*utf8_variant_to_utf16_blocks)(const uint8_t* data,
+                                               size_t size,
+                                               Utf8Variant variant,
+                                               uint8_t* output,
+                                               bool big_endian);
+  BlocksResult (*utf16_to_utf8_variant_blocks)(const uint8_t* data,
+                                               size_t size, bool big_endian,
+                                               Utf8Variant variant,
+                                               uint8_t* output);
+  BlocksResult (*utf8_length_from_utf32_blocks)(const char32_t* data,
+                                                size_t size);
+  BlocksResult (*utf16_length_from_utf32_blocks)(const char32_t* data,
+                                                 size_t size);
+  BlocksResult (*utf32_length_from_utf8_blocks)(const uint8_t* data,
+                                                size_t size);
+  BlocksResult (*utf16_length_from_utf8_blocks)(const uint8_t* data,
+                                                size_t size);
+  BlocksResult (*utf8_length_from_utf16_blocks)(const uint8_t* data,
+                                                size_t size, bool big_endian);
+  BlocksResult (*utf32_length_from_utf16_blocks)(const uint8_t* data,
+                                                 size_t size, bool big_endian);
+  BlocksResult (*latin1_to_utf8_blocks)(const uint8_t* data, size_t size,
+                                        uint8_t* output);
+  BlocksResult (*utf8_to_latin1_blocks)(const uint8_t* data, size_t size,
+                                        uint8_t* output);
+  BlocksResult (*latin1_to_utf16_blocks)(const uint8_t* data, size_t size,
+                                         uint8_t* output, bool big_endian);
+  BlocksResult (*utf16_to_latin1_blocks)(const uint8_t* data, size_t size,
+                                         bool big_endian, uint8_t* output);
+  size_t (*count_bytes_blocks)(const uint8_t* data, size_t size,
+                               ByteCounts& counts);
+};
+
+// Kernels of the level returned by ActiveSimdLevel().
+const Kernels& ActiveKernels();
+
+// After a kernel stops, the callers handle at most that many values (bytes,
+// code units or characters) with the scalar code before giving the kernel
+// another try.
+constexpr size_t kScalarBlockSize = 64;
+
+// Moves `pos`, which is known to follow valid UTF-8 except possibly for a
+// truncated trailing sequence, back to the beginning of that sequence.
+inline size_t Utf8CharacterBoundary(const uint8_t* data, size_t pos) {
+  for (size_t i = 1; i <= 3 && i <= pos; i++) {
+    uint8_t byte = data[pos - i];
+    if (byte >= 0xC0) {
+      size_t length = byte >= 0xF0 ? 4 : byte >= 0xE0 ? 3 : 2;
+      return length > i ? pos - i : pos;
+    }
+    if (byte < 0x80) {
+      break;
+    }
+  }
+  return pos;
+}
+
+// Returns the length of the sequence starting `bytes` if its first `size`
+// bytes are valid, 0 otherwise. So the result is greater than `size` if the
+// sequence is valid so far, but truncated. The scalar decoder rejects exactly
+// the same sequences.
+inline size_t Utf8CheckSequence(const uint8_t* bytes, size_t size) {
+  uint8_t lead = bytes[0];
+  if (lead <= 0x7F) {
+    return 1;
+  }
+  size_t length = 0;
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    length = 2;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    length = 3;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    length = 4;
+  }
+  if (length == 0 || size < 2) {
+    return length;
+  }
+
+  // overlong sequences, surrogates and characters above U+10FFFF are
+  // rejected by the range of the second byte
+  uint8_t min_second = lead == 0xE0 ? 0xA0 : lead == 0xF0 ? 0x90 : 0x80;
+  uint8_t max_second = lead == 0xED ? 0x9F : lead == 0xF4 ? 0x8F : 0xBF;
+  if (bytes[1] < min_second || bytes[1] > max_second) {
+    return 0;
+  }
+  for (size_t i = 2; i < length && i < size; i++) {
+    if ((bytes[i] & 0xC0) != 0x80) {
+      return 0;
+    }
+  }
+
+  return length;
+}
+
+// Returns the length of the valid sequence starting `bytes`, 0 if it is
+// invalid or truncated.
+inline size_t Utf8ValidSequenceLength(const uint8_t* bytes, size_t size) {
+  size_t length = Utf8CheckSequence(bytes, size);
+  return length <= size ? length : 0;
+}
+
+// Decodes a valid sequence of `length` bytes.
+inline char32_t DecodeUtf8Sequence(const uint8_t* bytes, size_t length) {
+  static constexpr uint8_t kLeadPayload[] = {0, 0x7F, 0x1F, 0x0F, 0x07};
+  char32_t code = bytes[0] & kLeadPayload[length];
+  for (size_t i = 1; i < length; i++) {
+    code = (code << 6) | (bytes[i] & 0x3F);
+  }
+  return code;
+}
+
+// Decodes [pos, end) and the sequence crossing `end` one sequence at a time
+// writing them with `writer.WriteCharacter()`. Invalid bytes are replaced or
+// skipped one by one according to `policy`. Returns the position after the
+// decoded sequences.
+template <class Writer>
+size_t Utf8DecodeScalar(const uint8_t* data, size_t size, size_t pos,
+                        size_t end, ErrorPolicy policy, Writer& writer) {
+  while (pos < end) {
+    size_t length = Utf8ValidSequenceLength(data + pos, size - pos);
+    if (length != 0) {
+      writer.WriteCharacter(DecodeUtf8Sequence(data + pos, length));
+      pos += length;
+    } else {
+      if (policy == ErrorPolicy::kReplace) {
+        writer.WriteCharacter(kReplacementCharacter);
+      }
+      ++pos;
+    }
+  }
+  return pos;
+}
+
+// pshufb masks packing the first 1-4 bytes of each 32-bit lane of a 128-bit
+// vector. A mask is indexed by the lane lengths minus one stored in 2-bit
+// fields, see kUtf8PackedLength for the length of the result.
+inline constexpr std::array<std::array<uint8_t, 16>, 256> kUtf8PackBytes = [] {
+  std::array<std::array<uint8_t, 16>, 256> table = {};
+  for (size_t index = 0; index < table.size(); index++) {
+    uint8_t count = 0;
+    for (uint8_t lane = 0; lane < 4; lane++) {
+      size_t length = ((index >> (2 * lane)) & 3) + 1;
+      for (uint8_t byte = 0; byte < length && count < 16; byte++) {
+        table[index][count++] = 4 * lane + byte;
+      }
+    }
+    while (count < 16) {
+      table[index][count++] = 0x80;
+    }
+  }
+  return table;
+}();
+
+inline constexpr std::array<uint8_t, 256> kUtf8PackedLength = [] {
+  std::array<uint8_t, 256> table = {};
+  for (size_t index = 0; index < table.size(); index++) {
+    for (size_t lane = 0; lane < 4; lane++) {
+      table[index] += ((index >> (2 * lane)) & 3) + 1;
+    }
+  }
+  return table;
+}();
+
+// Spreads the lowest 4 bits of the index to the lowest bits of 2-bit fields.
+inline constexpr std::array<uint8_t, 16> kSpreadBits = [] {
+  std::array<uint8_t, 16> table = {};
+  for (size_t index = 0; index < table.size(); index++) {
+    for (size_t bit = 0; bit < 4; bit++) {
+      table[index] |= ((index >> bit) & 1) << (2 * bit);
+    }
+  }
+  return table;
+}();
+
+// pshufb masks packing the UTF-8 encoding of 8 Latin-1 characters held in
+// 16-bit lanes: the low byte of a lane with an ASCII character, both bytes of
+// the others. A mask is indexed by the bits of the non-ASCII lanes.
+inline constexpr std::array<std::array<uint8_t, 16>, 256> kLatin1PackBytes =
+    [] {
+      std::array<std::array<uint8_t, 16>, 256> table = {};
+      for (size_t index = 0; index < table.size(); index++) {
+        uint8_t count = 0;
+        for (uint8_t lane = 0; lane < 8; lane++) {
+          table[index][count++] = 2 * lane;
+          if ((index >> lane) & 1) {
+            table[index][count++] = 2 * lane + 1;
+          }
+        }
+        while (count < 16) {
+          table[index][count++] = 0x80;
+        }
+      }
+      return table;
+    }();
+
+// pshufb masks moving the bytes of an 8-byte group whose bits aren't set in
+// the index to its beginning.
+inline constexpr std::array<std::array<uint8_t, 8>, 256> kDropBytes = [] {
+  std::array<std::array<uint8_t, 8>, 256> table = {};
+  for (size_t index = 0; index < table.size(); index++) {
+    uint8_t count = 0;
+    for (uint8_t byte = 0; byte < 8; byte++) {
+      if (((index >> byte) & 1) == 0) {
+        table[index][count++] = byte;
+      }
+    }
+    while (count < 8) {
+      table[index][count++] = 0x80;
+    }
+  }
+  return table;
+}();
+
+inline uint16_t LoadUtf16Unit(const uint8_t* data, bool big_endian) {
+  return big_endian ? static_cast<uint16_t>((data[0] << 8) | data[1])
+                    : static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+inline void StoreUtf16Unit(uint16_t unit, uint8_t* output, bool big_endian) {
+  output[big_endian ? 1 : 0] = static_cast<uint8_t>(unit & 0xFF);
+  output[big_endian ? 0 : 1] = static_cast<uint8_t>(unit >> 8);
+}
+
+// Same as Utf8EncodeValidCharacter, returns the number of written bytes.
+inline size_t StoreUtf8Character(char32_t code, uint8_t* output) {
+  if (code <= 0x7F) {
+    output[0] = static_cast<uint8_t>(code);
+    return 1;
+  } else if (code <= 0x7FF) {
+    output[0] = static_cast<uint8_t>(0xC0 | (code >> 6));
+    output[1] = static_cast<uint8_t>(0x80 | (code & 0x3F));
+    return 2;
+  } else if (code <= 0xFFFF) {
+    output[0] = static_cast<uint8_t>(0xE0 | (code >> 12));
+    output[1] = static_cast<uint8_t>(0x80 | ((code >> 6) & 0x3F));
+    output[2] = static_cast<uint8_t>(0x80 | (code & 0x3F));
+    return 3;
+  }
+  output[0] = static_cast<uint8_t>(0xF0 | (code >> 18));
+  output[1] = static_cast<uint8_t>(0x80 | ((code >> 12) & 0x3F));
+  output[2] = static_cast<uint8_t>(0x80 | ((code >> 6) & 0x3F));
+  output[3] = static_cast<uint8_t>(0x80 | (code & 0x3F));
+  return 4;
+}
+
+// Transcodes UTF-16 code units located in [pos, end) one by one, advancing
+// `pos` and `output`. A surrogate pair starting before `end` may be read past
+// it as long as it fits in `size` bytes. Returns false on unpaired surrogate.
+inline bool Utf16ToUtf8Scalar(const uint8_t* data, size_t size, size_t& pos,
+                              size_t end, bool big_endian, uint8_t*& output) {
+  while (pos < end) {
+    char32_t unit = LoadUtf16Unit(data + pos, big_endian);
+    if (unit < 0xD800 || unit > 0xDFFF) {
+      output += StoreUtf8Character(unit, output);
+      pos += 2;
+      continue;
+    }
+    if (unit > 0xDBFF || pos + 4 > size) {
+      return false;
+    }
+    char32_t low = LoadUtf16Unit(data + pos + 2, big_endian);
+    if (low < 0xDC00 || low > 0xDFFF) {
+      return false;
+    }
+    output += StoreUtf8Character(
+        0x10000 + (((unit - 0xD800) << 10) | (low - 0xDC00)), output);
+    pos += 4;
+  }
+  return true;
+}
+
+// Same as Utf16ToUtf8Scalar, but decodes the code units to characters.
+inline bool Utf16ToUtf32Scalar(const uint8_t* data, size_t size, size_t& pos,
+                               size_t end, bool big_endian,
+                               char32_t*& output) {
+  while (pos < end) {
+    char32_t unit = LoadUtf16Unit(data + pos, big_endian);
+    if (unit < 0xD800 || unit > 0xDFFF) {
+      *output++ = unit;
+      pos += 2;
+      continue;
+    }
+    if (unit > 0xDBFF || pos + 4 > size) {
+      return false;
+    }
+    char32_t low = LoadUtf16Unit(data + pos + 2, big_endian);
+    if (low < 0xDC00 || low > 0xDFFF) {
+      return false;
+    }
+    *output++ = 0x10000 + (((unit - 0xD800) << 10) | (low - 0xDC00));
+    pos += 4;
+  }
+  return true;
+}
+
+// Same as Utf16ToUtf8Scalar for a UTF-8 variant: surrogate pairs are encoded
+// as a single character in WTF-8 only, unpaired surrogates in CESU-8 only are
+// errors. A surrogate at the end of `size` bytes is unpaired.
+inline bool Utf16ToUtf8VariantScalar(const uint8_t* data, size_t size,
+                                     size_t& pos, size_t end, bool big_endian,
+                                     Utf8Variant variant, uint8_t*& output) {
+  while (pos < end) {
+    char32_t unit = LoadUtf16Unit(data + pos, big_endian);
+    if (unit == 0 && variant == Utf8Variant::kModifiedUtf8) {
+      output[0] = 0xC0;
+      output[1] = 0x80;
+      output += 2;
+      pos += 2;
+      continue;
+    }
+    if (unit >= 0xD800 && unit <= 0xDBFF && pos + 4 <= size) {
+      char32_t low = LoadUtf16Unit(data + pos + 2, big_endian);
+      if (low >= 0xDC00 && low <= 0xDFFF) {
+        if (variant == Utf8Variant::kWtf8) {
+          output += StoreUtf8Character(
+              0x10000 + (((unit - 0xD800) << 10) | (low - 0xDC00)), output);
+        } else {
+          output += StoreUtf8Character(unit, output);
+          output += StoreUtf8Character(low, output);
+        }
+        pos += 4;
+        continue;
+      }
+    }
+    if (IsSurrogate(unit) && variant == Utf8Variant::kCesu8) {
+      return false;
+    }
+    output += StoreUtf8Character(unit, output);
+    pos += 2;
+  }
+  return true;
+}
+
+// Same as Utf16ToUtf8Scalar, but only adds the length of the output to
+// `length`.
+inline bool Utf8LengthFromUtf16Scalar(const uint8_t* data, size_t size,
+                                      size_t& pos, size_t end, bool big_endian,
+                                      size_t& length) {
+  while (pos < end) {
+    uint16_t unit = LoadUtf16Unit(data + pos, big_endian);
+    if (unit < 0xD800 || unit > 0xDFFF) {
+      length += unit <= 0x7F ? 1 : unit <= 0x7FF ? 2 : 3;
+      pos += 2;
+      continue;
+    }
+    if (unit > 0xDBFF || pos + 4 > size) {
+      return false;
+    }
+    uint16_t low = LoadUtf16Unit(data + pos + 2, big_endian);
+    if (low < 0xDC00 || low > 0xDFFF) {
+      return false;
+    }
+    length += 4;
+    pos += 4;
+  }
+  return true;
+}
+
+// Same as Utf16ToUtf32Scalar, but only adds the number of characters to
+// `length`.
+inline bool Utf32LengthFromUtf16Scalar(const uint8_t* data, size_t size,
+                                       size_t& pos, size_t end,
+                                       bool big_endian, size_t& length) {
+  while (pos < end) {
+    uint16_t unit = LoadUtf16Unit(data + pos, big_endian);
+    if (unit < 0xD800 || unit > 0xDFFF) {
+      ++length;
+      pos += 2;
+      continue;
+    }
+    if (unit > 0xDBFF || pos + 4 > size) {
+      return false;
+    }
+    uint16_t low = LoadUtf16Unit(data + pos + 2, big_endian);
+    if (low < 0xDC00 || low > 0xDFFF) {
+      return false;
+    }
+    ++length;
+    pos += 4;
+  }
+  return true;
+}
+
+// Lengths of the UTF-8 and UTF-16 encodings of `ch`, or of U+FFFD if `ch` is
+// invalid.
+inline size_t Utf8CharacterLength(char32_t ch) {
+  if (ch <= 0x7F) {
+    return 1;
+  } else if (ch <= 0x7FF) {
+    return 2;
+  } else if (ch <= 0xFFFF || ch > 0x10FFFF) {
+    return 3;
+  }
+  return 4;
+}
+
+inline size_t Utf16CharacterLength(char32_t ch) {
+  return ch > 0xFFFF && ch <= 0x10FFFF ? 2 : 1;
+}
+
+inline int PopCount(uint32_t value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return static_cast<int>(__popcnt(value));
+#else
+  return __builtin_popcount(value);
+#endif
+}
+
+// `value` must not be zero.
+inline int CountTrailingZeros(uint32_t value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index = 0;
+  _BitScanForward(&index, value);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctz(value);
+#endif
+}
+
+}  // namespace detail
+}  // namespace unicpp
@@ -0,0 +1,1201 @@
+#include "simd.h"
+
+#if defined(UNICPP_HAS_AVX2)
+
+#include <algorithm>
+#include <array>
+
+#include <immintrin.h>
+
+// everything below is compiled for AVX2, the headers above must not be
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,popcnt"))), \
+                             apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2,popcnt")
+#endif
+
+namespace unicpp {
+namespace detail {
+namespace {
+
+__m256i LoadTable(const uint8_t (&table)[16]) {
+  return _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+}
+
+__m256i Load(const uint8_t* data) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+}
+
+__m128i Load128(const void* data) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+void Store(__m256i value, void* output) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), value);
+}
+
+void Store128(__m128i value, void* output) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(output), value);
+}
+
+__m128i SwapBytes16(__m128i input) {
+  return _mm_shuffle_epi8(input, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8,
+                                               11, 10, 13, 12, 15, 14));
+}
+
+__m256i SwapBytes16(__m256i input) {
+  return _mm256_shuffle_epi8(
+      input, _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15,
+                              14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12,
+                              15, 14));
+}
+
+// Shifts the concatenation of `prev_input` and `input` so that every byte is
+// replaced by the one located `N` positions before it.
+template <int N>
+__m256i Prev(__m256i input, __m256i prev_input) {
+  return _mm256_alignr_epi8(
+      input, _mm256_permute2x128_si256(prev_input, input, 0x21), 16 - N);
+}
+
+__m256i HighNibbles(__m256i input) {
+  return _mm256_and_si256(_mm256_srli_epi16(input, 4), _mm256_set1_epi8(0x0F));
+}
+
+__m256i LowNibbles(__m256i input) {
+  return _mm256_and_si256(input, _mm256_set1_epi8(0x0F));
+}
+
+// Flags the bytes ending an invalid sequence. The lookup table errors which
+// aren't set in `special_cases_mask` are ignored.
+__m256i CheckBlock(__m256i input, __m256i prev_input,
+                   __m256i special_cases_mask) {
+  __m256i prev1 = Prev<1>(input, prev_input);
+  __m256i byte_1_high =
+      _mm256_shuffle_epi8(LoadTable(kUtf8Byte1HighTable), HighNibbles(prev1));
+  __m256i byte_1_low =
+      _mm256_shuffle_epi8(LoadTable(kUtf8Byte1LowTable), LowNibbles(prev1));
+  __m256i byte_2_high =
+      _mm256_shuffle_epi8(LoadTable(kUtf8Byte2HighTable), HighNibbles(input));
+  __m256i special_cases =
+      _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low),
+                       _mm256_and_si256(byte_2_high, special_cases_mask));
+
+  // third and fourth bytes of a sequence must be continuation bytes, it's the
+  // only case when two continuation bytes in a row are allowed
+  __m256i prev2 = Prev<2>(input, prev_input);
+  __m256i prev3 = Prev<3>(input, prev_input);
+  __m256i must_be_continuation =
+      _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80)),
+                      _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80)));
+  must_be_continuation = _mm256_and_si256(
+      must_be_continuation, _mm256_set1_epi8(static_cast<char>(0x80)));
+
+  return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+__m256i CheckBlock(__m256i input, __m256i prev_input) {
+  return CheckBlock(input, prev_input, _mm256_set1_epi8(-1));
+}
+
+// Non-zero if the block ends with a truncated sequence.
+__m256i IsIncomplete(__m256i input) {
+  const __m256i kMaxValue = _mm256_setr_epi8(
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(0xF0 - 1),
+      static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+  return _mm256_subs_epu8(input, kMaxValue);
+}
+
+// Indices of the set bits of every 8-bit mask, used to compress the selected
+// 32-bit lanes to the beginning of a vector.
+constexpr std::array<uint64_t, 256> kCompressLanes = [] {
+  std::array<uint64_t, 256> table = {};
+  for (size_t mask = 0; mask < table.size(); mask++) {
+    int count = 0;
+    for (uint64_t lane = 0; lane < 8; lane++) {
+      if ((mask & (1 << lane)) != 0) {
+        table[mask] |= lane << (8 * count++);
+      }
+    }
+  }
+  return table;
+}();
+
+__m256i CompressLanes(__m256i input, uint32_t mask) {
+  __m256i shuffle = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+      reinterpret_cast<const __m128i*>(&kCompressLanes[mask])));
+  return _mm256_permutevar8x32_epi32(input, shuffle);
+}
+
+class Utf32Writer {
+public:
+  explicit Utf32Writer(char32_t* output)
+      : output_(output) {}
+
+  void WriteAscii(__m128i bytes) {
+    Store(_mm256_cvtepu8_epi32(bytes), output_);
+    Store(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8)), output_ + 8);
+    output_ += 16;
+  }
+
+  // Writes the first `count` lanes, may store all of them.
+  void Write(__m256i code, int count) {
+    Store(code, output_);
+    output_ += count;
+  }
+
+  void WriteCharacter(char32_t ch) {
+    *output_++ = ch;
+  }
+
+  char32_t* output() const {
+    return output_;
+  }
+
+private:
+  char32_t* output_;
+};
+
+class Utf16Writer {
+public:
+  Utf16Writer(uint8_t* output, bool big_endian)
+      : output_(output)
+      , big_endian_(big_endian) {}
+
+  void WriteAscii(__m128i bytes) {
+    __m256i units = _mm256_cvtepu8_epi16(bytes);
+    Store(big_endian_ ? SwapBytes16(units) : units, output_);
+    output_ += 32;
+  }
+
+  // Writes the first `count` lanes, may store all of them if none is
+  // a supplementary character.
+  void Write(__m256i code, int count) {
+    __m256i supplementary = _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0xFFFF));
+    uint32_t mask = _mm256_movemask_ps(_mm256_castsi256_ps(supplementary)) &
+                    ((1u << count) - 1);
+    if (mask == 0) {
+      __m128i units = _mm_packus_epi32(_mm256_castsi256_si128(code),
+                                       _mm256_extracti128_si256(code, 1));
+      Store128(big_endian_ ? SwapBytes16(units) : units, output_);
+      output_ += 2 * count;
+      return;
+    }
+
+    alignas(32) uint32_t codes[8];
+    Store(code, codes);
+    for (int i = 0; i < count; i++) {
+      if (codes[i] <= 0xFFFF) {
+        StoreUtf16Unit(static_cast<uint16_t>(codes[i]), output_, big_endian_);
+        output_ += 2;
+      } else {
+        uint32_t offset = codes[i] - 0x10000;
+        StoreUtf16Unit(static_cast<uint16_t>(0xD800 + (offset >> 10)), output_,
+                       big_endian_);
+        StoreUtf16Unit(static_cast<uint16_t>(0xDC00 + (offset & 0x3FF)),
+                       output_ + 2, big_endian_);
+        output_ += 4;
+      }
+    }
+  }
+
+  void WriteCharacter(char32_t ch) {
+    if (ch <= 0xFFFF) {
+      StoreUtf16Unit(static_cast<uint16_t>(ch), output_, big_endian_);
+      output_ += 2;
+    } else {
+      uint32_t offset = ch - 0x10000;
+      StoreUtf16Unit(static_cast<uint16_t>(0xD800 + (offset >> 10)), output_,
+                     big_endian_);
+      StoreUtf16Unit(static_cast<uint16_t>(0xDC00 + (offset & 0x3FF)),
+                     output_ + 2, big_endian_);
+      output_ += 4;
+    }
+  }
+
+  uint8_t* output() const {
+    return output_;
+  }
+
+private:
+  uint8_t* output_;
+  bool big_endian_;
+};
+
+// Decodes valid UTF-8 characters located in [pos, end) handling 8 bytes at a
+// time. Every byte is decoded as if it started a character, then the lanes of
+// the continuation bytes are dropped. Reads up to 16 bytes starting from any
+// position in [pos, end).
+template <class Writer>
+void DecodeValidRange(const uint8_t* data, size_t pos, size_t end,
+                      Writer& writer) {
+  for (size_t i = pos; i < end; i += 8) {
+    __m128i raw = Load128(data + i);
+    __m256i byte0 = _mm256_cvtepu8_epi32(raw);
+    uint32_t lanes = end - i >= 8 ? 0xFF : (1u << (end - i)) - 1;
+    if (lanes == 0xFF && (_mm_movemask_epi8(raw) & 0xFF) == 0) {
+      writer.Write(byte0, 8);
+      continue;
+    }
+
+    const __m256i kPayload = _mm256_set1_epi32(0x3F);
+    __m256i byte1 =
+        _mm256_and_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(raw, 1)), kPayload);
+    __m256i byte2 =
+        _mm256_and_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(raw, 2)), kPayload);
+    __m256i byte3 =
+        _mm256_and_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(raw, 3)), kPayload);
+
+    __m256i two_bytes = _mm256_or_si256(
+        _mm256_slli_epi32(_mm256_and_si256(byte0, _mm256_set1_epi32(0x1F)), 6),
+        byte1);
+    __m256i three_bytes = _mm256_or_si256(
+        _mm256_or_si256(
+            _mm256_slli_epi32(_mm256_and_si256(byte0, _mm256_set1_epi32(0xF)),
+                              12),
+            _mm256_slli_epi32(byte1, 6)),
+        byte2);
+    __m256i four_bytes = _mm256_or_si256(
+        _mm256_or_si256(
+            _mm256_slli_epi32(_mm256_and_si256(byte0, _mm256_set1_epi32(0x7)),
+                              18),
+            _mm256_slli_epi32(byte1, 12)),
+        _mm256_or_si256(_mm256_slli_epi32(byte2, 6), byte3));
+
+    __m256i code = byte0;
+    code = _mm256_blendv_epi8(
+        code, two_bytes, _mm256_cmpgt_epi32(byte0, _mm256_set1_epi32(0xBF)));
+    code = _mm256_blendv_epi8(
+        code, three_bytes, _mm256_cmpgt_epi32(byte0, _mm256_set1_epi32(0xDF)));
+    code = _mm256_blendv_epi8(
+        code, four_bytes, _mm256_cmpgt_epi32(byte0, _mm256_set1_epi32(0xEF)));
+
+    __m256i is_continuation = _mm256_and_si256(
+        _mm256_cmpgt_epi32(byte0, _mm256_set1_epi32(0x7F)),
+        _mm256_cmpgt_epi32(_mm256_set1_epi32(0xC0), byte0));
+    uint32_t leads = ~static_cast<uint32_t>(_mm256_movemask_ps(
+                         _mm256_castsi256_ps(is_continuation))) &
+                     lanes;
+    writer.Write(CompressLanes(code, leads), PopCount(leads));
+  }
+}
+
+// Offset of the first byte flagged by CheckBlock() in the chunk of 2 blocks,
+// the chunk must have one.
+size_t FirstErrorOffset(__m256i error0, __m256i error1) {
+  const __m256i kZero = _mm256_setzero_si256();
+  uint32_t mask0 = ~static_cast<uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(error0, kZero)));
+  if (mask0 != 0) {
+    return CountTrailingZeros(mask0);
+  }
+  uint32_t mask1 = ~static_cast<uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(error1, kZero)));
+  return 32 + CountTrailingZeros(mask1);
+}
+
+// Validation of UTF-8 by DecodeBlocks().
+struct Utf8Checker {
+  // An error is flagged at most that many bytes after the beginning of the
+  // invalid sequence.
+  static constexpr size_t kErrorLag = 3;
+  // Chunks of ASCII bytes are valid unless they follow a truncated sequence.
+  static constexpr bool kAsciiIsValid = true;
+
+  __m256i Check(__m256i input, __m256i prev_input) const {
+    return CheckBlock(input, prev_input);
+  }
+
+  // Moves the end of the valid sequences, validated up to `checked_end`,
+  // before the ones which can still turn out invalid, but not before `pos`,
+  // the end of the decoded ones.
+  size_t HoldBack(const uint8_t*, size_t, size_t end, size_t) const {
+    return end;
+  }
+};
+
+// Validation of a UTF-8 variant by DecodeBlocks(), the UTF-8 lookup tables
+// with the restrictions of the variant on top. Encoded surrogates are valid
+// as single code units, if `pairs_as_units` the ones of a CESU-8 or Modified
+// UTF-8 surrogate pair too. Supports ErrorPolicy::kStop only.
+class Utf8VariantChecker {
+public:
+  // An unpaired lead surrogate is flagged at the second byte following it.
+  static constexpr size_t kErrorLag = 4;
+  static constexpr bool kAsciiIsValid = false;
+
+  Utf8VariantChecker(Utf8Variant variant, bool pairs_as_units)
+      : special_cases_mask_(_mm256_set1_epi8(-1))
+      , allow_four_bytes_(variant == Utf8Variant::kWtf8)
+      , allow_zero_bytes_(variant != Utf8Variant::kModifiedUtf8) {
+    if (variant == Utf8Variant::kWtf8) {
+      pairs_ = Pairs::kInvalid;
+    } else if (pairs_as_units) {
+      pairs_ = variant == Utf8Variant::kCesu8 ? Pairs::kRequired : Pairs::kAny;
+    }
+    if (pairs_ != Pairs::kNone) {
+      special_cases_mask_ = _mm256_set1_epi8(static_cast<char>(~kSurrogate));
+    }
+  }
+
+  __m256i Check(__m256i input, __m256i prev_input) const {
+    __m256i error = CheckBlock(input, prev_input, special_cases_mask_);
+    if (!allow_four_bytes_) {
+      error = _mm256_or_si256(
+          error,
+          _mm256_subs_epu8(input, _mm256_set1_epi8(static_cast<char>(0xEF))));
+    }
+    if (!allow_zero_bytes_) {
+      error = _mm256_or_si256(
+          error, _mm256_cmpeq_epi8(input, _mm256_setzero_si256()));
+    }
+    if (pairs_ == Pairs::kInvalid || pairs_ == Pairs::kRequired) {
+      // second bytes of trail surrogates, and bytes following a lead one by
+      // 2 bytes, where the second byte of its trail would be
+      const __m256i kEd = _mm256_set1_epi8(static_cast<char>(0xED));
+      __m256i trail = _mm256_and_si256(
+          _mm256_cmpeq_epi8(Prev<1>(input, prev_input), kEd),
+          _mm256_cmpeq_epi8(HighNibbles(input), _mm256_set1_epi8(0xB)));
+      __m256i after_lead = _mm256_and_si256(
+          _mm256_cmpeq_epi8(Prev<4>(input, prev_input), kEd),
+          _mm256_cmpeq_epi8(HighNibbles(Prev<3>(input, prev_input)),
+                            _mm256_set1_epi8(0xA)));
+      error = _mm256_or_si256(error, pairs_ == Pairs::kInvalid
+                                         ? _mm256_and_si256(trail, after_lead)
+                                         : _mm256_xor_si256(trail, after_lead));
+    }
+    return error;
+  }
+
+  // A lead surrogate is checked together with the 4 bytes following it, and
+  // isn't separated from a trail surrogate starting at `end`, so that the
+  // scalar code never resumes in the middle of a pair.
+  size_t HoldBack(const uint8_t* data, size_t pos, size_t end,
+                  size_t checked_end) const {
+    if (pairs_ != Pairs::kNone && end >= 3) {
+      size_t first = std::max(pos, std::min(checked_end - 4, end - 3));
+      for (size_t lead = first; lead + 3 <= end; lead++) {
+        if (data[lead] == 0xED && (data[lead + 1] & 0xF0) == 0xA0) {
+          return lead;
+        }
+      }
+    }
+    return end;
+  }
+
+private:
+  // Surrogates which are errors as single code units: all of them, pairs of
+  // them, none of them, unpaired ones.
+  enum class Pairs { kNone, kInvalid, kAny, kRequired };
+
+  __m256i special_cases_mask_;
+  bool allow_four_bytes_;
+  bool allow_zero_bytes_;
+  Pairs pairs_ = Pairs::kNone;
+};
+
+// Validates and decodes chunks of 64 bytes, returns the number of decoded
+// bytes. With ErrorPolicy::kStop it stops at the first invalid sequence,
+// otherwise the scalar code handles the invalid sequences and the vectorized
+// decoding resumes right after them.
+template <class Writer, class Checker = Utf8Checker>
+size_t DecodeBlocks(const uint8_t* data, size_t size, ErrorPolicy policy,
+                    Writer& writer, const Checker& checker = Checker()) {
+  constexpr size_t kChunkSize = 64;
+  constexpr size_t kReadAhead = 16;
+
+  __m256i prev_input = _mm256_setzero_si256();
+  __m256i prev_incomplete = _mm256_setzero_si256();
+  // [0, pos) is decoded, [0, chunk) is validated
+  size_t pos = 0;
+  size_t chunk = 0;
+  while (chunk + kChunkSize + kReadAhead <= size) {
+    __m256i input0 = Load(data + chunk);
+    __m256i input1 = Load(data + chunk + 32);
+    bool is_ascii =
+        _mm256_movemask_epi8(_mm256_or_si256(input0, input1)) == 0;
+    // offset of the first byte flagged as invalid
+    size_t error_offset = kChunkSize;
+    if (is_ascii && Checker::kAsciiIsValid) {
+      if (!_mm256_testz_si256(prev_incomplete, prev_incomplete)) {
+        error_offset = 0;
+      }
+    } else {
+      __m256i error0 = checker.Check(input0, prev_input);
+      __m256i error1 = checker.Check(input1, input0);
+      __m256i any_error = _mm256_or_si256(error0, error1);
+      if (!_mm256_testz_si256(any_error, any_error)) {
+        error_offset = FirstErrorOffset(error0, error1);
+      }
+    }
+
+    if (error_offset != kChunkSize) {
+      // the sequences starting before the error lag are valid
+      if (chunk + error_offset > pos + Checker::kErrorLag) {
+        size_t valid_end = checker.HoldBack(
+            data, pos,
+            Utf8CharacterBoundary(data,
+                                  chunk + error_offset - Checker::kErrorLag),
+            chunk + error_offset);
+        DecodeValidRange(data, pos, valid_end, writer);
+        pos = valid_end;
+      }
+      if (policy == ErrorPolicy::kStop) {
+        break;
+      }
+      // the scalar code stops at a character boundary past the flagged byte,
+      // the validation restarts there as if it was the beginning of `data`
+      pos = Utf8DecodeScalar(data, size, pos, chunk + error_offset + 1, policy,
+                             writer);
+      chunk = pos;
+      prev_input = _mm256_setzero_si256();
+      prev_incomplete = _mm256_setzero_si256();
+      continue;
+    }
+
+    // ASCII is written as is unless a sequence before it is held back
+    if (is_ascii && pos == chunk) {
+      prev_input = _mm256_setzero_si256();
+      writer.WriteAscii(_mm256_castsi256_si128(input0));
+      writer.WriteAscii(_mm256_extracti128_si256(input0, 1));
+      writer.WriteAscii(_mm256_castsi256_si128(input1));
+      writer.WriteAscii(_mm256_extracti128_si256(input1, 1));
+      chunk += kChunkSize;
+      pos = chunk;
+      continue;
+    }
+    prev_incomplete = IsIncomplete(input1);
+    prev_input = input1;
+
+    size_t end = checker.HoldBack(
+        data, pos, Utf8CharacterBoundary(data, chunk + kChunkSize),
+        chunk + kChunkSize);
+    DecodeValidRange(data, pos, end, writer);
+    pos = end;
+    chunk += kChunkSize;
+  }
+
+  return pos;
+}
+
+// Encodes 8 code units, none of which is a surrogate, as UTF-8. Every unit is
+// expanded to a 32-bit lane holding its 1-3 bytes, then the lanes are packed.
+void EncodeUtf16Units(__m128i units, uint8_t*& output) {
+  __m256i code = _mm256_cvtepu16_epi32(units);
+  const __m256i kPayload = _mm256_set1_epi32(0x3F);
+  const __m256i kContinuation = _mm256_set1_epi32(0x80);
+  __m256i last = _mm256_or_si256(_mm256_and_si256(code, kPayload), kContinuation);
+  __m256i middle = _mm256_or_si256(
+      _mm256_and_si256(_mm256_srli_epi32(code, 6), kPayload), kContinuation);
+
+  __m256i two_bytes = _mm256_or_si256(
+      _mm256_or_si256(_mm256_srli_epi32(code, 6), _mm256_set1_epi32(0xC0)),
+      _mm256_slli_epi32(last, 8));
+  __m256i three_bytes = _mm256_or_si256(
+      _mm256_or_si256(_mm256_srli_epi32(code, 12), _mm256_set1_epi32(0xE0)),
+      _mm256_or_si256(_mm256_slli_epi32(middle, 8),
+                      _mm256_slli_epi32(last, 16)));
+
+  __m256i is_two = _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x7F));
+  __m256i is_three = _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x7FF));
+  __m256i bytes = _mm256_blendv_epi8(code, two_bytes, is_two);
+  bytes = _mm256_blendv_epi8(bytes, three_bytes, is_three);
+
+  uint32_t two_mask = _mm256_movemask_ps(_mm256_castsi256_ps(is_two));
+  uint32_t three_mask = _mm256_movemask_ps(_mm256_castsi256_ps(is_three));
+  size_t lo = kSpreadBits[two_mask & 0xF] + kSpreadBits[three_mask & 0xF];
+  size_t hi = kSpreadBits[two_mask >> 4] + kSpreadBits[three_mask >> 4];
+
+  Store128(_mm_shuffle_epi8(_mm256_castsi256_si128(bytes),
+                            Load128(kUtf8PackBytes[lo].data())),
+           output);
+  output += kUtf8PackedLength[lo];
+  Store128(_mm_shuffle_epi8(_mm256_extracti128_si256(bytes, 1),
+                            Load128(kUtf8PackBytes[hi].data())),
+           output);
+  output += kUtf8PackedLength[hi];
+}
+
+// Validates chunks of 64 bytes until the first error and passes the two
+// blocks of every valid chunk to `on_valid_chunk`. Returns the length of the
+// valid chunks, which may end in the middle of a character.
+template <class OnValidChunk>
+size_t ValidChunksLength(const uint8_t* data, size_t size,
+                         OnValidChunk&& on_valid_chunk) {
+  constexpr size_t kChunkSize = 64;
+
+  __m256i prev_input = _mm256_setzero_si256();
+  __m256i prev_incomplete = _mm256_setzero_si256();
+  size_t pos = 0;
+  for (; pos + kChunkSize <= size; pos += kChunkSize) {
+    __m256i input0 = Load(data + pos);
+    __m256i input1 = Load(data + pos + 32);
+    __m256i error;
+    if (_mm256_movemask_epi8(_mm256_or_si256(input0, input1)) == 0) {
+      error = prev_incomplete;
+      prev_input = _mm256_setzero_si256();
+    } else {
+      error = _mm256_or_si256(CheckBlock(input0, prev_input),
+                              CheckBlock(input1, input0));
+      prev_incomplete = IsIncomplete(input1);
+      prev_input = input1;
+    }
+    if (!_mm256_testz_si256(error, error)) {
+      break;
+    }
+    on_valid_chunk(input0, input1);
+  }
+
+  return pos;
+}
+
+// Number of characters started in the block of valid UTF-8, i.e. of bytes
+// which aren't continuation ones.
+size_t CountCharacters(__m256i input) {
+  return PopCount(
+      _mm256_movemask_epi8(_mm256_cmpgt_epi8(input, _mm256_set1_epi8(-0x41))));
+}
+
+// Number of UTF-16 code units encoding the characters started in the block
+// of valid UTF-8, 4-byte sequences are encoded as surrogate pairs.
+size_t CountUtf16Units(__m256i input) {
+  __m256i four_byte_leads = _mm256_cmpeq_epi8(
+      _mm256_max_epu8(input, _mm256_set1_epi8(-0x10)), input);
+  return CountCharacters(input) +
+         PopCount(_mm256_movemask_epi8(four_byte_leads));
+}
+
+// Sums the 32-bit lanes.
+size_t HorizontalSum(__m256i value) {
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(value),
+                              _mm256_extracti128_si256(value, 1));
+  sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 8));
+  sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 4));
+  return static_cast<uint32_t>(_mm_cvtsi128_si32(sum));
+}
+
+// All-ones lanes where `code` > `threshold`, both are non-negative.
+__m256i Above(__m256i code, int threshold) {
+  return _mm256_cmpgt_epi32(code, _mm256_set1_epi32(threshold));
+}
+
+__m256i Utf8ExtraLength(__m256i code) {
+  // U+FFFD replacing invalid characters takes 3 bytes
+  __m256i extra = _mm256_add_epi32(Above(code, 0x7F), Above(code, 0x7FF));
+  extra = _mm256_add_epi32(extra, Above(code, 0xFFFF));
+  return _mm256_sub_epi32(Above(code, 0x10FFFF), extra);
+}
+
+__m256i Utf16ExtraLength(__m256i code) {
+  return _mm256_sub_epi32(Above(code, 0x10FFFF), Above(code, 0xFFFF));
+}
+
+// Counts the characters of full blocks of `data`. Every character adds 1 and
+// the lane returned by `ExtraLength` for it, invalid ones are clamped to
+// 0x110000 first.
+template <__m256i (*ExtraLength)(__m256i code)>
+BlocksResult LengthFromUtf32Blocks(const char32_t* data, size_t size) {
+  constexpr size_t kBlockSize = 8;
+  // the lanes of the counter can't overflow between the flushes
+  constexpr size_t kFlushInterval = kBlockSize << 24;
+
+  size_t length = 0;
+  size_t pos = 0;
+  while (pos + kBlockSize <= size) {
+    size_t end =
+        pos + std::min(kFlushInterval, (size - pos) & ~(kBlockSize - 1));
+    __m256i counter = _mm256_setzero_si256();
+    for (; pos < end; pos += kBlockSize) {
+      __m256i code = _mm256_min_epu32(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos)),
+          _mm256_set1_epi32(0x110000));
+      counter = _mm256_add_epi32(counter, ExtraLength(code));
+    }
+    length += HorizontalSum(counter);
+  }
+
+  return {pos, pos + length};
+}
+
+// Encodes 16 Latin-1 characters as UTF-8, `non_ascii` has the bits of the
+// ones above 0x7F.
+void EncodeLatin1(__m128i input, uint32_t non_ascii, uint8_t*& output) {
+  __m256i code = _mm256_cvtepu8_epi16(input);
+  // the lead byte goes to the low byte of the lane
+  __m256i lead =
+      _mm256_or_si256(_mm256_srli_epi16(code, 6), _mm256_set1_epi16(0xC0));
+  __m256i continuation = _mm256_or_si256(
+      _mm256_and_si256(code, _mm256_set1_epi16(0x3F)), _mm256_set1_epi16(0x80));
+  __m256i two_bytes =
+      _mm256_or_si256(lead, _mm256_slli_epi16(continuation, 8));
+  __m256i bytes = _mm256_blendv_epi8(
+      code, two_bytes, _mm256_cmpgt_epi16(code, _mm256_set1_epi16(0x7F)));
+
+  uint32_t lo = non_ascii & 0xFF;
+  uint32_t hi = non_ascii >> 8;
+  Store128(_mm_shuffle_epi8(_mm256_castsi256_si128(bytes),
+                            Load128(kLatin1PackBytes[lo].data())),
+           output);
+  output += 8 + PopCount(lo);
+  Store128(_mm_shuffle_epi8(_mm256_extracti128_si256(bytes, 1),
+                            Load128(kLatin1PackBytes[hi].data())),
+           output);
+  output += 8 + PopCount(hi);
+}
+
+// Writes the bytes of the block whose bits aren't set in `drop`.
+void StoreDroppingBytes(__m256i bytes, uint32_t drop, uint8_t*& output) {
+  __m128i halves[2] = {_mm256_castsi256_si128(bytes),
+                       _mm256_extracti128_si256(bytes, 1)};
+  for (int group = 0; group < 4; group++) {
+    uint32_t bits = (drop >> (8 * group)) & 0xFF;
+    __m128i mask = _mm_loadl_epi64(
+        reinterpret_cast<const __m128i*>(kDropBytes[bits].data()));
+    __m128i half = halves[group / 2];
+    if (group % 2 == 1) {
+      half = _mm_srli_si128(half, 8);
+    }
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(output),
+                     _mm_shuffle_epi8(half, mask));
+    output += 8 - PopCount(bits);
+  }
+}
+
+}  // namespace
+
+size_t Utf8ValidBlocksLengthAvx2(const uint8_t* data, size_t size) {
+  return Utf8CharacterBoundary(
+      data, ValidChunksLength(data, size, [](__m256i, __m256i) {}));
+}
+
+BlocksResult Utf8ToUtf32BlocksAvx2(const uint8_t* data, size_t size,
+                                   char32_t* output, ErrorPolicy policy) {
+  Utf32Writer writer(output);
+  size_t read = DecodeBlocks(data, size, policy, writer);
+  return {read, static_cast<size_t>(writer.output() - output)};
+}
+
+// Encodes 8 characters, all valid, as UTF-8 the same way as
+// EncodeUtf16Units() does, with up to 4 bytes per lane.
+void EncodeCharacters(__m256i code, uint8_t*& output) {
+  const __m256i kPayload = _mm256_set1_epi32(0x3F);
+  const __m256i kContinuation = _mm256_set1_epi32(0x80);
+  __m256i last = _mm256_or_si256(_mm256_and_si256(code, kPayload), kContinuation);
+  __m256i middle = _mm256_or_si256(
+      _mm256_and_si256(_mm256_srli_epi32(code, 6), kPayload), kContinuation);
+  __m256i first = _mm256_or_si256(
+      _mm256_and_si256(_mm256_srli_epi32(code, 12), kPayload), kContinuation);
+
+  __m256i two_bytes = _mm256_or_si256(
+      _mm256_or_si256(_mm256_srli_epi32(code, 6), _mm256_set1_epi32(0xC0)),
+      _mm256_slli_epi32(last, 8));
+  __m256i three_bytes = _mm256_or_si256(
+      _mm256_or_si256(_mm256_srli_epi32(code, 12), _mm256_set1_epi32(0xE0)),
+      _mm256_or_si256(_mm256_slli_epi32(middle, 8),
+                      _mm256_slli_epi32(last, 16)));
+  __m256i four_bytes = _mm256_or_si256(
+      _mm256_or_si256(_mm256_srli_epi32(code, 18), _mm256_set1_epi32(0xF0)),
+      _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(first, 8),
+                                      _mm256_slli_epi32(middle, 16)),
+                      _mm256_slli_epi32(last, 24)));
+
+  __m256i is_two = _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x7F));
+  __m256i is_three = _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0x7FF));
+  __m256i is_four = _mm256_cmpgt_epi32(code, _mm256_set1_epi32(0xFFFF));
+  __m256i bytes = _mm256_blendv_epi8(code, two_bytes, is_two);
+  bytes = _mm256_blendv_epi8(bytes, three_bytes, is_three);
+  bytes = _mm256_blendv_epi8(bytes, four_bytes, is_four);
+
+  uint32_t two_mask = _mm256_movemask_ps(_mm256_castsi256_ps(is_two));
+  uint32_t three_mask = _mm256_movemask_ps(_mm256_castsi256_ps(is_three));
+  uint32_t four_mask = _mm256_movemask_ps(_mm256_castsi256_ps(is_four));
+  size_t lo = kSpreadBits[two_mask & 0xF] + kSpreadBits[three_mask & 0xF] +
+              kSpreadBits[four_mask & 0xF];
+  size_t hi = kSpreadBits[two_mask >> 4] + kSpreadBits[three_mask >> 4] +
+              kSpreadBits[four_mask >> 4];
+
+  Store128(_mm_shuffle_epi8(_mm256_castsi256_si128(bytes),
+                            Load128(kUtf8PackBytes[lo].data())),
+           output);
+  output += kUtf8PackedLength[lo];
+  Store128(_mm_shuffle_epi8(_mm256_extracti128_si256(bytes, 1),
+                            Load128(kUtf8PackBytes[hi].data())),
+           output);
+  output += kUtf8PackedLength[hi];
+}
+
+// All-ones lanes with valid characters, neither surrogates nor above U+10FFFF.
+__m256i ValidCharacters(__m256i code) {
+  __m256i surrogates =
+      _mm256_cmpeq_epi32(_mm256_and_si256(code, _mm256_set1_epi32(-0x800)),
+                         _mm256_set1_epi32(0xD800));
+  __m256i in_range = _mm256_cmpeq_epi32(
+      _mm256_min_epu32(code, _mm256_set1_epi32(0x10FFFF)), code);
+  return _mm256_andnot_si256(surrogates, in_range);
+}
+
+BlocksResult Utf8ToUtf16BlocksAvx2(const uint8_t* data, size_t size,
+                                   uint8_t* output, bool big_endian,
+                                   ErrorPolicy policy) {
+  Utf16Writer writer(output, big_endian);
+  size_t read = DecodeBlocks(data, size, policy, writer);
+  return {read, static_cast<size_t>(writer.output() - output) / 2};
+}
+
+BlocksResult Utf8VariantToUtf32BlocksAvx2(const uint8_t* data, size_t size,
+                                          Utf8Variant variant,
+                                          char32_t* output) {
+  Utf32Writer writer(output);
+  size_t read =
+      DecodeBlocks(data, size, ErrorPolicy::kStop, writer,
+                   Utf8VariantChecker(variant, /*pairs_as_units = */ false));
+  return {read, static_cast<size_t>(writer.output() - output)};
+}
+
+BlocksResult Utf8VariantToUtf16BlocksAvx2(const uint8_t* data, size_t size,
+                                          Utf8Variant variant, uint8_t* output,
+                                          bool big_endian) {
+  Utf16Writer writer(output, big_endian);
+  size_t read =
+      DecodeBlocks(data, size, ErrorPolicy::kStop, writer,
+                   Utf8VariantChecker(variant, /*pairs_as_units = */ true));
+  return {read, static_cast<size_t>(writer.output() - output) / 2};
+}
+
+BlocksResult Utf16ToUtf8BlocksAvx2(const uint8_t* data, size_t size,
+                                   bool big_endian, uint8_t* output) {
+  constexpr size_t kBlockSize = 32;
+  // the packed stores may write 4 bytes more than the block produces
+  constexpr size_t kOutputSlack = 4;
+
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos + kBlockSize + kOutputSlack <= size) {
+    __m256i units = Load(data + pos);
+    if (big_endian) {
+      units = SwapBytes16(units);
+    }
+
+    if (_mm256_testz_si256(units, _mm256_set1_epi16(-0x80))) {
+      Store128(_mm_packus_epi16(_mm256_castsi256_si128(units),
+                                _mm256_extracti128_si256(units, 1)),
+               out);
+      out += kBlockSize / 2;
+      pos += kBlockSize;
+      continue;
+    }
+
+    __m256i surrogates = _mm256_cmpeq_epi16(
+        _mm256_and_si256(units, _mm256_set1_epi16(-0x800)),
+        _mm256_set1_epi16(-0x2800));
+    if (!_mm256_testz_si256(surrogates, surrogates)) {
+      if (!Utf16ToUtf8Scalar(data, size, pos, pos + kBlockSize, big_endian,
+                             out)) {
+        break;
+      }
+      continue;
+    }
+
+    EncodeUtf16Units(_mm256_castsi256_si128(units), out);
+    EncodeUtf16Units(_mm256_extracti128_si256(units, 1), out);
+    pos += kBlockSize;
+  }
+
+  return {pos, static_cast<size_t>(out - output)};
+}
+
+BlocksResult Utf16ToUtf32BlocksAvx2(const uint8_t* data, size_t size,
+                                    bool big_endian, char32_t* output) {
+  constexpr size_t kBlockSize = 32;
+
+  char32_t* out = output;
+  size_t pos = 0;
+  while (pos + kBlockSize <= size) {
+    __m256i units = Load(data + pos);
+    if (big_endian) {
+      units = SwapBytes16(units);
+    }
+
+    __m256i surrogates = _mm256_cmpeq_epi16(
+        _mm256_and_si256(units, _mm256_set1_epi16(-0x800)),
+        _mm256_set1_epi16(-0x2800));
+    if (!_mm256_testz_si256(surrogates, surrogates)) {
+      if (!Utf16ToUtf32Scalar(data, size, pos, pos + kBlockSize, big_endian,
+                              out)) {
+        break;
+      }
+      continue;
+    }
+
+    Store(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(units)), out);
+    Store(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(units, 1)), out + 8);
+    out += kBlockSize / 2;
+    pos += kBlockSize;
+  }
+
+  return {pos, static_cast<size_t>(out - output)};
+}
+
+BlocksResult Utf16ToUtf8VariantBlocksAvx2(const uint8_t* data, size_t size,
+                                          bool big_endian, Utf8Variant variant,
+                                          uint8_t* output) {
+  constexpr size_t kBlockSize = 32;
+  // the packed stores may write 4 bytes more than the block produces, and a
+  // surrogate pair may cross the end of the block
+  constexpr size_t kOutputSlack = 4;
+
+  bool encode_zero = variant == Utf8Variant::kModifiedUtf8;
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos + kBlockSize + kOutputSlack <= size) {
+    __m256i units = Load(data + pos);
+    if (big_endian) {
+      units = SwapBytes16(units);
+    }
+
+    // surrogates, and zeros in Modified UTF-8, are left to the scalar code
+    __m256i special = _mm256_cmpeq_epi16(
+        _mm256_and_si256(units, _mm256_set1_epi16(-0x800)),
+        _mm256_set1_epi16(-0x2800));
+    if (encode_zero) {
+      special = _mm256_or_si256(
+          special, _mm256_cmpeq_epi16(units, _mm256_setzero_si256()));
+    }
+    if (!_mm256_testz_si256(special, special)) {
+      if (!Utf16ToUtf8VariantScalar(data, size, pos, pos + kBlockSize,
+                                    big_endian, variant, out)) {
+        break;
+      }
+      continue;
+    }
+
+    if (_mm256_testz_si256(units, _mm256_set1_epi16(-0x80))) {
+      Store128(_mm_packus_epi16(_mm256_castsi256_si128(units),
+                                _mm256_extracti128_si256(units, 1)),
+               out);
+      out += kBlockSize / 2;
+      pos += kBlockSize;
+      continue;
+    }
+
+    EncodeUtf16Units(_mm256_castsi256_si128(units), out);
+    EncodeUtf16Units(_mm256_extracti128_si256(units, 1), out);
+    pos += kBlockSize;
+  }
+
+  return {pos, static_cast<size_t>(out - output)};
+}
+
+BlocksResult Utf32ToUtf8BlocksAvx2(const char32_t* data, size_t size,
+                                   uint8_t* output) {
+  constexpr size_t kBlockSize = 16;
+
+  uint8_t* out = output;
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m256i code0 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+    __m256i code1 =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 8));
+
+    if (_mm256_testz_si256(_mm256_or_si256(code0, code1),
+                           _mm256_set1_epi32(-0x80))) {
+      // packing works within 128-bit lanes, the permutation restores the order
+      __m256i units = _mm256_permute4x64_epi64(
+          _mm256_packus_epi32(code0, code1), 0xD8);
+      Store128(_mm_packus_epi16(_mm256_castsi256_si128(units),
+                                _mm256_extracti128_si256(units, 1)),
+               out);
+      out += kBlockSize;
+      continue;
+    }
+
+    __m256i valid =
+        _mm256_and_si256(ValidCharacters(code0), ValidCharacters(code1));
+    if (_mm256_movemask_epi8(valid) != -1) {
+      break;
+    }
+    EncodeCharacters(code0, out);
+    EncodeCharacters(code1, out);
+  }
+
+  return {pos, static_cast<size_t>(out - output)};
+}
+
+BlocksResult Utf8LengthFromUtf32BlocksAvx2(const char32_t* data, size_t size) {
+  return LengthFromUtf32Blocks<Utf8ExtraLength>(data, size);
+}
+
+BlocksResult Utf16LengthFromUtf32BlocksAvx2(const char32_t* data, size_t size) {
+  return LengthFromUtf32Blocks<Utf16ExtraLength>(data, size);
+}
+
+BlocksResult Utf32LengthFromUtf8BlocksAvx2(const uint8_t* data, size_t size) {
+  size_t chars = 0;
+  size_t valid =
+      ValidChunksLength(data, size, [&](__m256i input0, __m256i input1) {
+        chars += CountCharacters(input0) + CountCharacters(input1);
+      });
+
+  // drop the truncated character at the end
+  size_t read = Utf8CharacterBoundary(data, valid);
+  if (read != valid) {
+    chars -= 1;
+  }
+  return {read, chars};
+}
+
+BlocksResult Utf16LengthFromUtf8BlocksAvx2(const uint8_t* data, size_t size) {
+  size_t units = 0;
+  size_t valid =
+      ValidChunksLength(data, size, [&](__m256i input0, __m256i input1) {
+        units += CountUtf16Units(input0) + CountUtf16Units(input1);
+      });
+
+  // drop the truncated character at the end
+  size_t read = Utf8CharacterBoundary(data, valid);
+  if (read != valid) {
+    units -= data[read] >= 0xF0 ? 2 : 1;
+  }
+  return {read, units};
+}
+
+BlocksResult Utf8LengthFromUtf16BlocksAvx2(const uint8_t* data, size_t size,
+                                           bool big_endian) {
+  constexpr size_t kBlockSize = 32;
+
+  size_t length = 0;
+  size_t pos = 0;
+  while (pos + kBlockSize <= size) {
+    __m256i units = Load(data + pos);
+    if (big_endian) {
+      units = SwapBytes16(units);
+    }
+
+    __m256i surrogates = _mm256_cmpeq_epi16(
+        _mm256_and_si256(units, _mm256_set1_epi16(-0x800)),
+        _mm256_set1_epi16(-0x2800));
+    if (!_mm256_testz_si256(surrogates, surrogates)) {
+      if (!Utf8LengthFromUtf16Scalar(data, size, pos, pos + kBlockSize,
+                                     big_endian, length)) {
+        break;
+      }
+      continue;
+    }
+
+    // 3 bytes per unit, minus 1 for units below 0x800 and 1 more for ASCII;
+    // every unit sets 2 bits of the masks
+    const __m256i kZero = _mm256_setzero_si256();
+    __m256i ascii = _mm256_cmpeq_epi16(
+        _mm256_and_si256(units, _mm256_set1_epi16(-0x80)), kZero);
+    __m256i two_bytes = _mm256_cmpeq_epi16(
+        _mm256_and_si256(units, _mm256_set1_epi16(-0x800)), kZero);
+    length += 3 * kBlockSize / 2 -
+              (PopCount(_mm256_movemask_epi8(ascii)) +
+               PopCount(_mm256_movemask_epi8(two_bytes))) /
+                  2;
+    pos += kBlockSize;
+  }
+
+  return {pos, length};
+}
+
+BlocksResult Utf32LengthFromUtf16BlocksAvx2(const uint8_t* data, size_t size,
+                                            bool big_endian) {
+  constexpr size_t kBlockSize = 32;
+  // the mask bits of the last code unit of a block
+  constexpr uint32_t kLastUnit = 0xC0000000;
+
+  size_t length = 0;
+  size_t pos = 0;
+  while (pos + kBlockSize <= size) {
+    __m256i units = Load(data + pos);
+    if (big_endian) {
+      units = SwapBytes16(units);
+    }
+
+    // every unit sets 2 bits of the masks
+    __m256i prefixes = _mm256_and_si256(units, _mm256_set1_epi16(-0x400));
+    uint32_t high = _mm256_movemask_epi8(
+        _mm256_cmpeq_epi16(prefixes, _mm256_set1_epi16(-0x2800)));
+    uint32_t low = _mm256_movemask_epi8(
+        _mm256_cmpeq_epi16(prefixes, _mm256_set1_epi16(-0x2400)));
+    // a high surrogate in the last unit is left to the next block, every
+    // other one must be followed by a low surrogate and vice versa
+    uint32_t last_high = high & kLastUnit;
+    if (((high ^ last_high) << 2) != low) {
+      if (!Utf32LengthFromUtf16Scalar(data, size, pos, pos + kBlockSize,
+                                      big_endian, length)) {
+        break;
+      }
+      continue;
+    }
+
+    // a surrogate pair is a single character
+    size_t block_size = last_high == 0 ? kBlockSize : kBlockSize - 2;
+    length += (block_size - PopCount(low)) / 2;
+    pos += block_size;
+  }
+
+  return {pos, length};
+}
+
+BlocksResult Latin1ToUtf8BlocksAvx2(const uint8_t* data, size_t size,
+                                    uint8_t* output) {
+  constexpr size_t kBlockSize = 32;
+
+  uint8_t* out = output;
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m256i input = Load(data + pos);
+    uint32_t non_ascii = _mm256_movemask_epi8(input);
+    if (non_ascii == 0) {
+      Store(input, out);
+      out += kBlockSize;
+      continue;
+    }
+    EncodeLatin1(_mm256_castsi256_si128(input), non_ascii & 0xFFFF, out);
+    EncodeLatin1(_mm256_extracti128_si256(input, 1), non_ascii >> 16, out);
+  }
+
+  return {pos, static_cast<size_t>(out - output)};
+}
+
+BlocksResult Utf8ToLatin1BlocksAvx2(const uint8_t* data, size_t size,
+                                    uint8_t* output) {
+  constexpr size_t kBlockSize = 32;
+
+  // U+0080..U+00FF are encoded by the lead bytes 0xC2 and 0xC3 followed by a
+  // single continuation byte
+  __m256i prev_input = _mm256_setzero_si256();
+  uint32_t prev_lead = 0;
+  size_t written = 0;
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m256i input = Load(data + pos);
+    uint32_t non_ascii = _mm256_movemask_epi8(input);
+    if (non_ascii == 0 && prev_lead == 0) {
+      if (output != nullptr) {
+        Store(input, output + written);
+      }
+      written += kBlockSize;
+      prev_input = input;
+      continue;
+    }
+
+    uint32_t leads = _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+        _mm256_and_si256(input, _mm256_set1_epi8(-2)),
+        _mm256_set1_epi8(-0x3E)));
+    __m256i is_continuation = _mm256_cmpeq_epi8(
+        _mm256_and_si256(input, _mm256_set1_epi8(-0x40)),
+        _mm256_set1_epi8(-0x80));
+    uint32_t continuations = _mm256_movemask_epi8(is_continuation);
+    if ((leads | continuations) != non_ascii ||
+        continuations != ((leads << 1) | prev_lead)) {
+      break;
+    }
+
+    if (output != nullptr) {
+      // a continuation byte gets the 2 low bits of the lead byte before it
+      __m256i high_bits = _mm256_slli_epi16(
+          _mm256_and_si256(Prev<1>(input, prev_input), _mm256_set1_epi8(0x03)),
+          6);
+      __m256i chars = _mm256_blendv_epi8(
+          input,
+          _mm256_or_si256(_mm256_and_si256(input, _mm256_set1_epi8(0x3F)),
+                          high_bits),
+          is_continuation);
+      uint8_t* out = output + written;
+      StoreDroppingBytes(chars, leads, out);
+    }
+    written += kBlockSize - PopCount(leads);
+    prev_input = input;
+    prev_lead = leads >> (kBlockSize - 1);
+  }
+
+  // the character of a lead byte ending the last block isn't written
+  return {pos - prev_lead, written};
+}
+
+BlocksResult Latin1ToUtf16BlocksAvx2(const uint8_t* data, size_t size,
+                                     uint8_t* output, bool big_endian) {
+  constexpr size_t kBlockSize = 32;
+
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m256i units0 = _mm256_cvtepu8_epi16(Load128(data + pos));
+    __m256i units1 = _mm256_cvtepu8_epi16(Load128(data + pos + 16));
+    if (big_endian) {
+      units0 = SwapBytes16(units0);
+      units1 = SwapBytes16(units1);
+    }
+    Store(units0, output + 2 * pos);
+    Store(units1, output + 2 * pos + 32);
+  }
+
+  return {pos, pos};
+}
+
+BlocksResult Utf16ToLatin1BlocksAvx2(const uint8_t* data, size_t size,
+                                     bool big_endian, uint8_t* output) {
+  constexpr size_t kBlockSize = 64;
+
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m256i units0 = Load(data + pos);
+    __m256i units1 = Load(data + pos + 32);
+    if (big_endian) {
+      units0 = SwapBytes16(units0);
+      units1 = SwapBytes16(units1);
+    }
+    if (!_mm256_testz_si256(_mm256_or_si256(units0, units1),
+                            _mm256_set1_epi16(-0x100))) {
+      break;
+    }
+    // packing works within 128-bit lanes
+    __m256i bytes = _mm256_permute4x64_epi64(
+        _mm256_packus_epi16(units0, units1), _MM_SHUFFLE(3, 1, 2, 0));
+    Store(bytes, output + pos / 2);
+  }
+
+  return {pos, pos / 2};
+}
+
+size_t CountBytesBlocksAvx2(const uint8_t* data, size_t size,
+                            ByteCounts& counts) {
+  constexpr size_t kBlockSize = 32;
+
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m256i bytes = Load(data + pos);
+    uint32_t zeros = static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(bytes, _mm256_setzero_si256())));
+    uint32_t c1_controls = static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(
+            _mm256_and_si256(bytes,
+                             _mm256_set1_epi8(static_cast<char>(0xE0))),
+            _mm256_set1_epi8(static_cast<char>(0x80)))));
+    counts.even_zeros += PopCount(zeros & 0x55555555);
+    counts.odd_zeros += PopCount(zeros & 0xAAAAAAAA);
+    counts.non_ascii +=
+        PopCount(static_cast<uint32_t>(_mm256_movemask_epi8(bytes)));
+    counts.c1_controls += PopCount(c1_controls);
+  }
+
+  return pos;
+}
+
+}  // namespace detail
+}  // namespace unicpp
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif  // defined(UNICPP_HAS_AVX2)
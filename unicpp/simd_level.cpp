@@ -0,0 +1,270 @@
+#include "simd_level.h"
+
+#include "simd.h"
+
+#include <atomic>
+
+#if defined(UNICPP_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace unicpp {
+namespace {
+
+size_t Utf8ValidBlocksLengthScalar(const uint8_t*, size_t) {
+  return 0;
+}
+
+detail::BlocksResult Utf8ToUtf32BlocksScalar(const uint8_t*, size_t,
+                                             char32_t*, ErrorPolicy) {
+  return {0, 0};
+}
+
+detail::BlocksResult Utf8ToUtf16BlocksScalar(const uint8_t*, size_t, uint8_t*,
+                                             bool, ErrorPolicy) {
+  return {0, 0};
+}
+
+detail::BlocksResult Utf16ToUtf8BlocksScalar(const uint8_t*, size_t, bool,
+                                             uint8_t*) {
+  return {0, 0};
+}
+
+detail::BlocksResult Utf16ToUtf32BlocksScalar(const uint8_t*, size_t, bool,
+                                              char32_t*) {
+  return {0, 0};
+}
+
+detail::BlocksResult Utf32ToUtf8BlocksScalar(const char32_t*, size_t,
+                                             uint8_t*) {
+  return {0, 0};
+}
+
+detail::BlocksResult Utf8VariantToUtf32BlocksScalar(const uint8_t*, size_t,
+                                                    Utf8Variant, char32_t*) {
+  return {0, 0};
+}
+
+detail::BlocksResult Utf8VariantToUtf16BlocksScalar(const uint8_t*, size_t,
+                                                    Utf8Variant, uint8_t*,
+                                                    bool) {
+  return {0, 0};
+}
+
+detail::BlocksResult Utf16ToUtf8VariantBlocksScalar(const uint8_t*, size_t,
+                                                    bool, Utf8Variant,
+                                                    uint8_t*) {
+  return {0, 0};
+}
+
+detail::BlocksResult LengthFromUtf32BlocksScalar(const char32_t*, size_t) {
+  return {0, 0};
+}
+
+detail::BlocksResult LengthFromUtf8BlocksScalar(const uint8_t*, size_t) {
+  return {0, 0};
+}
+
+detail::BlocksResult LengthFromUtf16BlocksScalar(const uint8_t*, size_t,
+                                                 bool) {
+  return {0, 0};
+}
+
+detail::BlocksResult Latin1Utf8BlocksScalar(const uint8_t*, size_t,
+                                            uint8_t*) {
+  return {0, 0};
+}
+
+detail::BlocksResult Latin1ToUtf16BlocksScalar(const uint8_t*, size_t,
+                                               uint8_t*, bool) {
+  return {0, 0};
+}
+
+detail::BlocksResult Utf16ToLatin1BlocksScalar(const uint8_t*, size_t, bool,
+                                               uint8_t*) {
+  return {0, 0};
+}
+
+size_t CountBytesBlocksScalar(const uint8_t*, size_t, detail::ByteCounts&) {
+  return 0;
+}
+
+constexpr detail::Kernels kScalarKernels = {
+    Utf8ValidBlocksLengthScalar,
+    Utf8ToUtf32BlocksScalar,
+    Utf8ToUtf16BlocksScalar,
+    Utf16ToUtf8BlocksScalar,
+    Utf16ToUtf32BlocksScalar,
+    Utf32ToUtf8BlocksScalar,
+    Utf8VariantToUtf32BlocksScalar,
+    Utf8VariantToUtf16BlocksScalar,
+    Utf16ToUtf8VariantBlocksScalar,
+    LengthFromUtf32BlocksScalar,
+    LengthFromUtf32BlocksScalar,
+    LengthFromUtf8BlocksScalar,
+    LengthFromUtf8BlocksScalar,
+    LengthFromUtf16BlocksScalar,
+    LengthFromUtf16BlocksScalar,
+    Latin1Utf8BlocksScalar,
+    Latin1Utf8BlocksScalar,
+    Latin1ToUtf16BlocksScalar,
+    Utf16ToLatin1BlocksScalar,
+    CountBytesBlocksScalar,
+};
+
+#if defined(UNICPP_HAS_SSE42)
+constexpr detail::Kernels kSse42Kernels = {
+    detail::Utf8ValidBlocksLengthSse42,
+    detail::Utf8ToUtf32BlocksSse42,
+    detail::Utf8ToUtf16BlocksSse42,
+    detail::Utf16ToUtf8BlocksSse42,
+    detail::Utf16ToUtf32BlocksSse42,
+    detail::Utf32ToUtf8BlocksSse42,
+    detail::Utf8VariantToUtf32BlocksSse42,
+    detail::Utf8VariantToUtf16BlocksSse42,
+    detail::Utf16ToUtf8VariantBlocksSse42,
+    detail::Utf8LengthFromUtf32BlocksSse42,
+    detail::Utf16LengthFromUtf32BlocksSse42,
+    detail::Utf32LengthFromUtf8BlocksSse42,
+    detail::Utf16LengthFromUtf8BlocksSse42,
+    detail::Utf8LengthFromUtf16BlocksSse42,
+    detail::Utf32LengthFromUtf16BlocksSse42,
+    detail::Latin1ToUtf8BlocksSse42,
+    detail::Utf8ToLatin1BlocksSse42,
+    detail::Latin1ToUtf16BlocksSse42,
+    detail::Utf16ToLatin1BlocksSse42,
+    detail::CountBytesBlocksSse42,
+};
+#endif
+
+#if defined(UNICPP_HAS_AVX2)
+constexpr detail::Kernels kAvx2Kernels = {
+    detail::Utf8ValidBlocksLengthAvx2,
+    detail::Utf8ToUtf32BlocksAvx2,
+    detail::Utf8ToUtf16BlocksAvx2,
+    detail::Utf16ToUtf8BlocksAvx2,
+    detail::Utf16ToUtf32BlocksAvx2,
+    detail::Utf32ToUtf8BlocksAvx2,
+    detail::Utf8VariantToUtf32BlocksAvx2,
+    detail::Utf8VariantToUtf16BlocksAvx2,
+    detail::Utf16ToUtf8VariantBlocksAvx2,
+    detail::Utf8LengthFromUtf32BlocksAvx2,
+    detail::Utf16LengthFromUtf32BlocksAvx2,
+    detail::Utf32LengthFromUtf8BlocksAvx2,
+    detail::Utf16LengthFromUtf8BlocksAvx2,
+    detail::Utf8LengthFromUtf16BlocksAvx2,
+    detail::Utf32LengthFromUtf16BlocksAvx2,
+    detail::Latin1ToUtf8BlocksAvx2,
+    detail::Utf8ToLatin1BlocksAvx2,
+    detail::Latin1ToUtf16BlocksAvx2,
+    detail::Utf16ToLatin1BlocksAvx2,
+    detail::CountBytesBlocksAvx2,
+};
+#endif
+
+const detail::Kernels* KernelsFor(SimdLevel level) {
+  switch (level) {
+#if defined(UNICPP_HAS_AVX2)
+    case SimdLevel::kAvx2:
+      return &kAvx2Kernels;
+#endif
+#if defined(UNICPP_HAS_SSE42)
+    case SimdLevel::kSse42:
+      return &kSse42Kernels;
+#endif
+    default:
+      return &kScalarKernels;
+  }
+}
+
+SimdLevel DetectSimdLevel() {
+#if defined(UNICPP_X86) && defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  int max_leaf = info[0];
+  __cpuid(info, 1);
+  bool sse42 = (info[2] & (1 << 20)) != 0;
+  bool popcnt = (info[2] & (1 << 23)) != 0;
+  bool osxsave = (info[2] & (1 << 27)) != 0;
+  bool avx2 = false;
+  if (max_leaf >= 7) {
+    __cpuidex(info, 7, 0);
+    avx2 = (info[1] & (1 << 5)) != 0;
+  }
+  // the operating system has to save the upper halves of YMM registers
+  bool ymm_enabled = osxsave && (_xgetbv(0) & 0x6) == 0x6;
+  if (avx2 && ymm_enabled && popcnt) {
+    return SimdLevel::kAvx2;
+  }
+  if (sse42 && popcnt) {
+    return SimdLevel::kSse42;
+  }
+#elif defined(UNICPP_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+    return SimdLevel::kAvx2;
+  }
+  if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) {
+    return SimdLevel::kSse42;
+  }
+#endif
+  return SimdLevel::kScalar;
+}
+
+std::atomic<const detail::Kernels*>& ActiveKernelsPointer() {
+  static std::atomic<const detail::Kernels*> kernels(
+      KernelsFor(SupportedSimdLevel()));
+  return kernels;
+}
+
+}  // namespace
+
+SimdLevel SupportedSimdLevel() {
+  static const SimdLevel level = DetectSimdLevel();
+  return level;
+}
+
+SimdLevel ActiveSimdLevel() {
+  const detail::Kernels* kernels = &detail::ActiveKernels();
+#if defined(UNICPP_HAS_AVX2)
+  if (kernels == &kAvx2Kernels) {
+    return SimdLevel::kAvx2;
+  }
+#endif
+#if defined(UNICPP_HAS_SSE42)
+  if (kernels == &kSse42Kernels) {
+    return SimdLevel::kSse42;
+  }
+#endif
+  return SimdLevel::kScalar;
+}
+
+bool SetSimdLevel(SimdLevel level) {
+  if (level > SupportedSimdLevel()) {
+    return false;
+  }
+  ActiveKernelsPointer().store(KernelsFor(level), std::memory_order_release);
+  return true;
+}
+
+const char* SimdLevelName(SimdLevel level) {
+  switch (level) {
+    case SimdLevel::kScalar:
+      return "scalar";
+    case SimdLevel::kSse42:
+      return "sse4.2";
+    case SimdLevel::kAvx2:
+      return "avx2";
+  }
+  return "unknown";
+}
+
+namespace detail {
+
+const Kernels& ActiveKernels() {
+  return *ActiveKernelsPointer().load(std::memory_order_acquire);
+}
+
+}  // namespace detail
+}  // namespace unicpp
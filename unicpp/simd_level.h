@@ -0,0 +1,27 @@
+#pragma once
+
+namespace unicpp {
+
+// Instruction sets of the vectorized codec kernels. The best one supported by
+// the CPU is detected once per process, everything else runs the same scalar
+// code as the header-only templates.
+enum class SimdLevel {
+  kScalar,
+  kSse42,
+  kAvx2,
+};
+
+// The best level supported by the CPU and the operating system.
+SimdLevel SupportedSimdLevel();
+
+// The level used by the codecs, SupportedSimdLevel() unless changed with
+// SetSimdLevel().
+SimdLevel ActiveSimdLevel();
+
+// Switches the codecs to another level, e.g. to test or benchmark the lower
+// ones. Returns false and does nothing if the level isn't supported.
+bool SetSimdLevel(SimdLevel level);
+
+const char* SimdLevelName(SimdLevel level);
+
+}  // namespace unicpp
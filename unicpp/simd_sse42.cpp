@@ -0,0 +1,1142 @@
+#include "simd.h"
+
+#if defined(UNICPP_HAS_SSE42)
+
+#include <algorithm>
+#include <array>
+
+#include <nmmintrin.h>
+
+// everything below is compiled for SSE4.2, the headers above must not be
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sse4.2,popcnt"))), \
+                             apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse4.2,popcnt")
+#endif
+
+namespace unicpp {
+namespace detail {
+namespace {
+
+__m128i LoadTable(const uint8_t (&table)[16]) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+}
+
+__m128i Load(const void* data) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+void Store(__m128i value, void* output) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(output), value);
+}
+
+template <int N>
+__m128i Prev(__m128i input, __m128i prev_input) {
+  return _mm_alignr_epi8(input, prev_input, 16 - N);
+}
+
+__m128i HighNibbles(__m128i input) {
+  return _mm_and_si128(_mm_srli_epi16(input, 4), _mm_set1_epi8(0x0F));
+}
+
+__m128i LowNibbles(__m128i input) {
+  return _mm_and_si128(input, _mm_set1_epi8(0x0F));
+}
+
+// Flags the bytes ending an invalid sequence. The lookup table errors which
+// aren't set in `special_cases_mask` are ignored.
+__m128i CheckBlock(__m128i input, __m128i prev_input,
+                   __m128i special_cases_mask) {
+  __m128i prev1 = Prev<1>(input, prev_input);
+  __m128i byte_1_high =
+      _mm_shuffle_epi8(LoadTable(kUtf8Byte1HighTable), HighNibbles(prev1));
+  __m128i byte_1_low =
+      _mm_shuffle_epi8(LoadTable(kUtf8Byte1LowTable), LowNibbles(prev1));
+  __m128i byte_2_high =
+      _mm_shuffle_epi8(LoadTable(kUtf8Byte2HighTable), HighNibbles(input));
+  __m128i special_cases =
+      _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low),
+                    _mm_and_si128(byte_2_high, special_cases_mask));
+
+  // third and fourth bytes of a sequence must be continuation bytes, it's the
+  // only case when two continuation bytes in a row are allowed
+  __m128i prev2 = Prev<2>(input, prev_input);
+  __m128i prev3 = Prev<3>(input, prev_input);
+  __m128i must_be_continuation =
+      _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)),
+                   _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80)));
+  must_be_continuation = _mm_and_si128(
+      must_be_continuation, _mm_set1_epi8(static_cast<char>(0x80)));
+
+  return _mm_xor_si128(must_be_continuation, special_cases);
+}
+
+__m128i CheckBlock(__m128i input, __m128i prev_input) {
+  return CheckBlock(input, prev_input, _mm_set1_epi8(-1));
+}
+
+// Non-zero if the block ends with a truncated sequence.
+__m128i IsIncomplete(__m128i input) {
+  const __m128i kMaxValue = _mm_setr_epi8(
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1),
+      static_cast<char>(0xC0 - 1));
+  return _mm_subs_epu8(input, kMaxValue);
+}
+
+// pshufb masks moving the 32-bit lanes selected by every 4-bit mask to the
+// beginning of a vector.
+constexpr std::array<std::array<uint8_t, 16>, 16> kCompressLanes = [] {
+  std::array<std::array<uint8_t, 16>, 16> table = {};
+  for (size_t mask = 0; mask < table.size(); mask++) {
+    size_t count = 0;
+    for (uint8_t lane = 0; lane < 4; lane++) {
+      if ((mask & (1 << lane)) != 0) {
+        for (uint8_t byte = 0; byte < 4; byte++) {
+          table[mask][4 * count + byte] = 4 * lane + byte;
+        }
+        count++;
+      }
+    }
+  }
+  return table;
+}();
+
+__m128i SwapBytes16(__m128i input) {
+  return _mm_shuffle_epi8(input, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8,
+                                               11, 10, 13, 12, 15, 14));
+}
+
+class Utf32Writer {
+public:
+  explicit Utf32Writer(char32_t* output)
+      : output_(output) {}
+
+  void WriteAscii(__m128i bytes) {
+    const __m128i kZero = _mm_setzero_si128();
+    __m128i lo = _mm_unpacklo_epi8(bytes, kZero);
+    __m128i hi = _mm_unpackhi_epi8(bytes, kZero);
+    Store(_mm_unpacklo_epi16(lo, kZero), output_);
+    Store(_mm_unpackhi_epi16(lo, kZero), output_ + 4);
+    Store(_mm_unpacklo_epi16(hi, kZero), output_ + 8);
+    Store(_mm_unpackhi_epi16(hi, kZero), output_ + 12);
+    output_ += 16;
+  }
+
+  // Writes the first `count` lanes, may store all of them.
+  void Write(__m128i code, int count) {
+    Store(code, output_);
+    output_ += count;
+  }
+
+  void WriteCharacter(char32_t ch) {
+    *output_++ = ch;
+  }
+
+  char32_t* output() const {
+    return output_;
+  }
+
+private:
+  char32_t* output_;
+};
+
+class Utf16Writer {
+public:
+  Utf16Writer(uint8_t* output, bool big_endian)
+      : output_(output)
+      , big_endian_(big_endian) {}
+
+  void WriteAscii(__m128i bytes) {
+    const __m128i kZero = _mm_setzero_si128();
+    __m128i lo = _mm_unpacklo_epi8(bytes, kZero);
+    __m128i hi = _mm_unpackhi_epi8(bytes, kZero);
+    Store(big_endian_ ? SwapBytes16(lo) : lo, output_);
+    Store(big_endian_ ? SwapBytes16(hi) : hi, output_ + 16);
+    output_ += 32;
+  }
+
+  // Writes the first `count` lanes, may store all of them if none is
+  // a supplementary character.
+  void Write(__m128i code, int count) {
+    __m128i supplementary = _mm_cmpgt_epi32(code, _mm_set1_epi32(0xFFFF));
+    uint32_t mask = _mm_movemask_ps(_mm_castsi128_ps(supplementary)) &
+                    ((1u << count) - 1);
+    if (mask == 0) {
+      __m128i units = _mm_packus_epi32(code, code);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(output_),
+                       big_endian_ ? SwapBytes16(units) : units);
+      output_ += 2 * count;
+      return;
+    }
+
+    alignas(16) uint32_t codes[4];
+    Store(code, codes);
+    for (int i = 0; i < count; i++) {
+      if (codes[i] <= 0xFFFF) {
+        StoreUtf16Unit(static_cast<uint16_t>(codes[i]), output_, big_endian_);
+        output_ += 2;
+      } else {
+        uint32_t offset = codes[i] - 0x10000;
+        StoreUtf16Unit(static_cast<uint16_t>(0xD800 + (offset >> 10)), output_,
+                       big_endian_);
+        StoreUtf16Unit(static_cast<uint16_t>(0xDC00 + (offset & 0x3FF)),
+                       output_ + 2, big_endian_);
+        output_ += 4;
+      }
+    }
+  }
+
+  void WriteCharacter(char32_t ch) {
+    if (ch <= 0xFFFF) {
+      StoreUtf16Unit(static_cast<uint16_t>(ch), output_, big_endian_);
+      output_ += 2;
+    } else {
+      uint32_t offset = ch - 0x10000;
+      StoreUtf16Unit(static_cast<uint16_t>(0xD800 + (offset >> 10)), output_,
+                     big_endian_);
+      StoreUtf16Unit(static_cast<uint16_t>(0xDC00 + (offset & 0x3FF)),
+                     output_ + 2, big_endian_);
+      output_ += 4;
+    }
+  }
+
+  uint8_t* output() const {
+    return output_;
+  }
+
+private:
+  uint8_t* output_;
+  bool big_endian_;
+};
+
+// Decodes valid UTF-8 characters located in [pos, end) handling 4 bytes at a
+// time. Every byte is decoded as if it started a character, then the lanes of
+// the continuation bytes are dropped. Reads up to 16 bytes starting from any
+// position in [pos, end).
+template <class Writer>
+void DecodeValidRange(const uint8_t* data, size_t pos, size_t end,
+                      Writer& writer) {
+  for (size_t i = pos; i < end; i += 4) {
+    __m128i raw = Load(data + i);
+    __m128i byte0 = _mm_cvtepu8_epi32(raw);
+    uint32_t lanes = end - i >= 4 ? 0xF : (1u << (end - i)) - 1;
+
+    const __m128i kPayload = _mm_set1_epi32(0x3F);
+    __m128i byte1 =
+        _mm_and_si128(_mm_cvtepu8_epi32(_mm_srli_si128(raw, 1)), kPayload);
+    __m128i byte2 =
+        _mm_and_si128(_mm_cvtepu8_epi32(_mm_srli_si128(raw, 2)), kPayload);
+    __m128i byte3 =
+        _mm_and_si128(_mm_cvtepu8_epi32(_mm_srli_si128(raw, 3)), kPayload);
+
+    __m128i two_bytes = _mm_or_si128(
+        _mm_slli_epi32(_mm_and_si128(byte0, _mm_set1_epi32(0x1F)), 6), byte1);
+    __m128i three_bytes = _mm_or_si128(
+        _mm_or_si128(
+            _mm_slli_epi32(_mm_and_si128(byte0, _mm_set1_epi32(0xF)), 12),
+            _mm_slli_epi32(byte1, 6)),
+        byte2);
+    __m128i four_bytes = _mm_or_si128(
+        _mm_or_si128(
+            _mm_slli_epi32(_mm_and_si128(byte0, _mm_set1_epi32(0x7)), 18),
+            _mm_slli_epi32(byte1, 12)),
+        _mm_or_si128(_mm_slli_epi32(byte2, 6), byte3));
+
+    __m128i code = byte0;
+    code = _mm_blendv_epi8(code, two_bytes,
+                           _mm_cmpgt_epi32(byte0, _mm_set1_epi32(0xBF)));
+    code = _mm_blendv_epi8(code, three_bytes,
+                           _mm_cmpgt_epi32(byte0, _mm_set1_epi32(0xDF)));
+    code = _mm_blendv_epi8(code, four_bytes,
+                           _mm_cmpgt_epi32(byte0, _mm_set1_epi32(0xEF)));
+
+    __m128i is_continuation =
+        _mm_and_si128(_mm_cmpgt_epi32(byte0, _mm_set1_epi32(0x7F)),
+                      _mm_cmpgt_epi32(_mm_set1_epi32(0xC0), byte0));
+    uint32_t leads = ~static_cast<uint32_t>(
+                         _mm_movemask_ps(_mm_castsi128_ps(is_continuation))) &
+                     lanes;
+    writer.Write(_mm_shuffle_epi8(code, Load(kCompressLanes[leads].data())),
+                 PopCount(leads));
+  }
+}
+
+// Offset of the first byte flagged by CheckBlock() in the chunk of 4 blocks,
+// the chunk must have one.
+size_t FirstErrorOffset(const __m128i* error) {
+  size_t offset = 0;
+  while (true) {
+    uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(
+                        _mm_cmpeq_epi8(*error, _mm_setzero_si128()))) &
+                    0xFFFF;
+    if (mask != 0) {
+      return offset + CountTrailingZeros(mask);
+    }
+    offset += 16;
+    ++error;
+  }
+}
+
+// Validation of UTF-8 by DecodeBlocks().
+struct Utf8Checker {
+  // An error is flagged at most that many bytes after the beginning of the
+  // invalid sequence.
+  static constexpr size_t kErrorLag = 3;
+  // Chunks of ASCII bytes are valid unless they follow a truncated sequence.
+  static constexpr bool kAsciiIsValid = true;
+
+  __m128i Check(__m128i input, __m128i prev_input) const {
+    return CheckBlock(input, prev_input);
+  }
+
+  // Moves the end of the valid sequences, validated up to `checked_end`,
+  // before the ones which can still turn out invalid, but not before `pos`,
+  // the end of the decoded ones.
+  size_t HoldBack(const uint8_t*, size_t, size_t end, size_t) const {
+    return end;
+  }
+};
+
+// Validation of a UTF-8 variant by DecodeBlocks(), the UTF-8 lookup tables
+// with the restrictions of the variant on top. Encoded surrogates are valid
+// as single code units, if `pairs_as_units` the ones of a CESU-8 or Modified
+// UTF-8 surrogate pair too. Supports ErrorPolicy::kStop only.
+class Utf8VariantChecker {
+public:
+  // An unpaired lead surrogate is flagged at the second byte following it.
+  static constexpr size_t kErrorLag = 4;
+  static constexpr bool kAsciiIsValid = false;
+
+  Utf8VariantChecker(Utf8Variant variant, bool pairs_as_units)
+      : special_cases_mask_(_mm_set1_epi8(-1))
+      , allow_four_bytes_(variant == Utf8Variant::kWtf8)
+      , allow_zero_bytes_(variant != Utf8Variant::kModifiedUtf8) {
+    if (variant == Utf8Variant::kWtf8) {
+      pairs_ = Pairs::kInvalid;
+    } else if (pairs_as_units) {
+      pairs_ = variant == Utf8Variant::kCesu8 ? Pairs::kRequired : Pairs::kAny;
+    }
+    if (pairs_ != Pairs::kNone) {
+      special_cases_mask_ = _mm_set1_epi8(static_cast<char>(~kSurrogate));
+    }
+  }
+
+  __m128i Check(__m128i input, __m128i prev_input) const {
+    __m128i error = CheckBlock(input, prev_input, special_cases_mask_);
+    if (!allow_four_bytes_) {
+      error = _mm_or_si128(
+          error, _mm_subs_epu8(input, _mm_set1_epi8(static_cast<char>(0xEF))));
+    }
+    if (!allow_zero_bytes_) {
+      error = _mm_or_si128(error, _mm_cmpeq_epi8(input, _mm_setzero_si128()));
+    }
+    if (pairs_ == Pairs::kInvalid || pairs_ == Pairs::kRequired) {
+      // second bytes of trail surrogates, and bytes following a lead one by
+      // 2 bytes, where the second byte of its trail would be
+      const __m128i kEd = _mm_set1_epi8(static_cast<char>(0xED));
+      __m128i trail = _mm_and_si128(
+          _mm_cmpeq_epi8(Prev<1>(input, prev_input), kEd),
+          _mm_cmpeq_epi8(HighNibbles(input), _mm_set1_epi8(0xB)));
+      __m128i after_lead = _mm_and_si128(
+          _mm_cmpeq_epi8(Prev<4>(input, prev_input), kEd),
+          _mm_cmpeq_epi8(HighNibbles(Prev<3>(input, prev_input)),
+                         _mm_set1_epi8(0xA)));
+      error = _mm_or_si128(error, pairs_ == Pairs::kInvalid
+                                      ? _mm_and_si128(trail, after_lead)
+                                      : _mm_xor_si128(trail, after_lead));
+    }
+    return error;
+  }
+
+  // A lead surrogate is checked together with the 4 bytes following it, and
+  // isn't separated from a trail surrogate starting at `end`, so that the
+  // scalar code never resumes in the middle of a pair.
+  size_t HoldBack(const uint8_t* data, size_t pos, size_t end,
+                  size_t checked_end) const {
+    if (pairs_ != Pairs::kNone && end >= 3) {
+      size_t first = std::max(pos, std::min(checked_end - 4, end - 3));
+      for (size_t lead = first; lead + 3 <= end; lead++) {
+        if (data[lead] == 0xED && (data[lead + 1] & 0xF0) == 0xA0) {
+          return lead;
+        }
+      }
+    }
+    return end;
+  }
+
+private:
+  // Surrogates which are errors as single code units: all of them, pairs of
+  // them, none of them, unpaired ones.
+  enum class Pairs { kNone, kInvalid, kAny, kRequired };
+
+  __m128i special_cases_mask_;
+  bool allow_four_bytes_;
+  bool allow_zero_bytes_;
+  Pairs pairs_ = Pairs::kNone;
+};
+
+// Validates and decodes chunks of 64 bytes, returns the number of decoded
+// bytes. With ErrorPolicy::kStop it stops at the first invalid sequence,
+// otherwise the scalar code handles the invalid sequences and the vectorized
+// decoding resumes right after them.
+template <class Writer, class Checker = Utf8Checker>
+size_t DecodeBlocks(const uint8_t* data, size_t size, ErrorPolicy policy,
+                    Writer& writer, const Checker& checker = Checker()) {
+  constexpr size_t kChunkSize = 64;
+  constexpr size_t kReadAhead = 16;
+
+  __m128i prev_input = _mm_setzero_si128();
+  __m128i prev_incomplete = _mm_setzero_si128();
+  // [0, pos) is decoded, [0, chunk) is validated
+  size_t pos = 0;
+  size_t chunk = 0;
+  while (chunk + kChunkSize + kReadAhead <= size) {
+    __m128i input[4];
+    for (int i = 0; i < 4; i++) {
+      input[i] = Load(data + chunk + 16 * i);
+    }
+    __m128i any = _mm_or_si128(_mm_or_si128(input[0], input[1]),
+                               _mm_or_si128(input[2], input[3]));
+    bool is_ascii = _mm_movemask_epi8(any) == 0;
+    // offset of the first byte flagged as invalid
+    size_t error_offset = kChunkSize;
+    if (is_ascii && Checker::kAsciiIsValid) {
+      if (!_mm_testz_si128(prev_incomplete, prev_incomplete)) {
+        error_offset = 0;
+      }
+    } else {
+      __m128i error[4];
+      error[0] = checker.Check(input[0], prev_input);
+      for (int i = 1; i < 4; i++) {
+        error[i] = checker.Check(input[i], input[i - 1]);
+      }
+      __m128i any_error = _mm_or_si128(_mm_or_si128(error[0], error[1]),
+                                       _mm_or_si128(error[2], error[3]));
+      if (!_mm_testz_si128(any_error, any_error)) {
+        error_offset = FirstErrorOffset(error);
+      }
+    }
+
+    if (error_offset != kChunkSize) {
+      // the sequences starting before the error lag are valid
+      if (chunk + error_offset > pos + Checker::kErrorLag) {
+        size_t valid_end = checker.HoldBack(
+            data, pos,
+            Utf8CharacterBoundary(data,
+                                  chunk + error_offset - Checker::kErrorLag),
+            chunk + error_offset);
+        DecodeValidRange(data, pos, valid_end, writer);
+        pos = valid_end;
+      }
+      if (policy == ErrorPolicy::kStop) {
+        break;
+      }
+      // the scalar code stops at a character boundary past the flagged byte,
+      // the validation restarts there as if it was the beginning of `data`
+      pos = Utf8DecodeScalar(data, size, pos, chunk + error_offset + 1, policy,
+                             writer);
+      chunk = pos;
+      prev_input = _mm_setzero_si128();
+      prev_incomplete = _mm_setzero_si128();
+      continue;
+    }
+
+    // ASCII is written as is unless a sequence before it is held back
+    if (is_ascii && pos == chunk) {
+      prev_input = _mm_setzero_si128();
+      for (int i = 0; i < 4; i++) {
+        writer.WriteAscii(input[i]);
+      }
+      chunk += kChunkSize;
+      pos = chunk;
+      continue;
+    }
+    prev_incomplete = IsIncomplete(input[3]);
+    prev_input = input[3];
+
+    size_t end = checker.HoldBack(
+        data, pos, Utf8CharacterBoundary(data, chunk + kChunkSize),
+        chunk + kChunkSize);
+    DecodeValidRange(data, pos, end, writer);
+    pos = end;
+    chunk += kChunkSize;
+  }
+
+  return pos;
+}
+
+// Encodes the 4 lower code units, none of which is a surrogate, as UTF-8.
+// Every unit is expanded to a 32-bit lane holding its 1-3 bytes, then the
+// lanes are packed.
+void EncodeUtf16Units(__m128i units, uint8_t*& output) {
+  __m128i code = _mm_cvtepu16_epi32(units);
+  const __m128i kPayload = _mm_set1_epi32(0x3F);
+  const __m128i kContinuation = _mm_set1_epi32(0x80);
+  __m128i last = _mm_or_si128(_mm_and_si128(code, kPayload), kContinuation);
+  __m128i middle = _mm_or_si128(
+      _mm_and_si128(_mm_srli_epi32(code, 6), kPayload), kContinuation);
+
+  __m128i two_bytes =
+      _mm_or_si128(_mm_or_si128(_mm_srli_epi32(code, 6), _mm_set1_epi32(0xC0)),
+                   _mm_slli_epi32(last, 8));
+  __m128i three_bytes = _mm_or_si128(
+      _mm_or_si128(_mm_srli_epi32(code, 12), _mm_set1_epi32(0xE0)),
+      _mm_or_si128(_mm_slli_epi32(middle, 8), _mm_slli_epi32(last, 16)));
+
+  __m128i is_two = _mm_cmpgt_epi32(code, _mm_set1_epi32(0x7F));
+  __m128i is_three = _mm_cmpgt_epi32(code, _mm_set1_epi32(0x7FF));
+  __m128i bytes = _mm_blendv_epi8(code, two_bytes, is_two);
+  bytes = _mm_blendv_epi8(bytes, three_bytes, is_three);
+
+  size_t index = kSpreadBits[_mm_movemask_ps(_mm_castsi128_ps(is_two))] +
+                 kSpreadBits[_mm_movemask_ps(_mm_castsi128_ps(is_three))];
+  Store(_mm_shuffle_epi8(bytes, Load(kUtf8PackBytes[index].data())), output);
+  output += kUtf8PackedLength[index];
+}
+
+// Encodes the 4 characters, all valid, as UTF-8 the same way as
+// EncodeUtf16Units() does, with up to 4 bytes per lane.
+void EncodeCharacters(__m128i code, uint8_t*& output) {
+  const __m128i kPayload = _mm_set1_epi32(0x3F);
+  const __m128i kContinuation = _mm_set1_epi32(0x80);
+  __m128i last = _mm_or_si128(_mm_and_si128(code, kPayload), kContinuation);
+  __m128i middle = _mm_or_si128(
+      _mm_and_si128(_mm_srli_epi32(code, 6), kPayload), kContinuation);
+  __m128i first = _mm_or_si128(
+      _mm_and_si128(_mm_srli_epi32(code, 12), kPayload), kContinuation);
+
+  __m128i two_bytes =
+      _mm_or_si128(_mm_or_si128(_mm_srli_epi32(code, 6), _mm_set1_epi32(0xC0)),
+                   _mm_slli_epi32(last, 8));
+  __m128i three_bytes = _mm_or_si128(
+      _mm_or_si128(_mm_srli_epi32(code, 12), _mm_set1_epi32(0xE0)),
+      _mm_or_si128(_mm_slli_epi32(middle, 8), _mm_slli_epi32(last, 16)));
+  __m128i four_bytes = _mm_or_si128(
+      _mm_or_si128(_mm_srli_epi32(code, 18), _mm_set1_epi32(0xF0)),
+      _mm_or_si128(_mm_or_si128(_mm_slli_epi32(first, 8),
+                                _mm_slli_epi32(middle, 16)),
+                   _mm_slli_epi32(last, 24)));
+
+  __m128i is_two = _mm_cmpgt_epi32(code, _mm_set1_epi32(0x7F));
+  __m128i is_three = _mm_cmpgt_epi32(code, _mm_set1_epi32(0x7FF));
+  __m128i is_four = _mm_cmpgt_epi32(code, _mm_set1_epi32(0xFFFF));
+  __m128i bytes = _mm_blendv_epi8(code, two_bytes, is_two);
+  bytes = _mm_blendv_epi8(bytes, three_bytes, is_three);
+  bytes = _mm_blendv_epi8(bytes, four_bytes, is_four);
+
+  size_t index = kSpreadBits[_mm_movemask_ps(_mm_castsi128_ps(is_two))] +
+                 kSpreadBits[_mm_movemask_ps(_mm_castsi128_ps(is_three))] +
+                 kSpreadBits[_mm_movemask_ps(_mm_castsi128_ps(is_four))];
+  Store(_mm_shuffle_epi8(bytes, Load(kUtf8PackBytes[index].data())), output);
+  output += kUtf8PackedLength[index];
+}
+
+// All-ones lanes with valid characters, neither surrogates nor above U+10FFFF.
+__m128i ValidCharacters(__m128i code) {
+  __m128i surrogates = _mm_cmpeq_epi32(
+      _mm_and_si128(code, _mm_set1_epi32(-0x800)), _mm_set1_epi32(0xD800));
+  __m128i in_range =
+      _mm_cmpeq_epi32(_mm_min_epu32(code, _mm_set1_epi32(0x10FFFF)), code);
+  return _mm_andnot_si128(surrogates, in_range);
+}
+
+// Validates chunks of 64 bytes until the first error and passes the four
+// blocks of every valid chunk to `on_valid_chunk`. Returns the length of the
+// valid chunks, which may end in the middle of a character.
+template <class OnValidChunk>
+size_t ValidChunksLength(const uint8_t* data, size_t size,
+                         OnValidChunk&& on_valid_chunk) {
+  constexpr size_t kChunkSize = 64;
+
+  __m128i prev_input = _mm_setzero_si128();
+  __m128i prev_incomplete = _mm_setzero_si128();
+  size_t pos = 0;
+  for (; pos + kChunkSize <= size; pos += kChunkSize) {
+    __m128i input[4];
+    for (int i = 0; i < 4; i++) {
+      input[i] = Load(data + pos + 16 * i);
+    }
+    __m128i any = _mm_or_si128(_mm_or_si128(input[0], input[1]),
+                               _mm_or_si128(input[2], input[3]));
+    __m128i error;
+    if (_mm_movemask_epi8(any) == 0) {
+      error = prev_incomplete;
+      prev_input = _mm_setzero_si128();
+    } else {
+      error = CheckBlock(input[0], prev_input);
+      for (int i = 1; i < 4; i++) {
+        error = _mm_or_si128(error, CheckBlock(input[i], input[i - 1]));
+      }
+      prev_incomplete = IsIncomplete(input[3]);
+      prev_input = input[3];
+    }
+    if (!_mm_testz_si128(error, error)) {
+      break;
+    }
+    on_valid_chunk(input);
+  }
+
+  return pos;
+}
+
+// Number of characters started in the block of valid UTF-8, i.e. of bytes
+// which aren't continuation ones.
+size_t CountCharacters(__m128i input) {
+  return PopCount(
+      _mm_movemask_epi8(_mm_cmpgt_epi8(input, _mm_set1_epi8(-0x41))));
+}
+
+// Number of UTF-16 code units encoding the characters started in the block
+// of valid UTF-8, 4-byte sequences are encoded as surrogate pairs.
+size_t CountUtf16Units(__m128i input) {
+  __m128i four_byte_leads =
+      _mm_cmpeq_epi8(_mm_max_epu8(input, _mm_set1_epi8(-0x10)), input);
+  return CountCharacters(input) +
+         PopCount(_mm_movemask_epi8(four_byte_leads));
+}
+
+// Sums the 32-bit lanes.
+size_t HorizontalSum(__m128i value) {
+  value = _mm_add_epi32(value, _mm_srli_si128(value, 8));
+  value = _mm_add_epi32(value, _mm_srli_si128(value, 4));
+  return static_cast<uint32_t>(_mm_cvtsi128_si32(value));
+}
+
+// All-ones lanes where `code` > `threshold`, both are non-negative.
+__m128i Above(__m128i code, int threshold) {
+  return _mm_cmpgt_epi32(code, _mm_set1_epi32(threshold));
+}
+
+__m128i Utf8ExtraLength(__m128i code) {
+  // U+FFFD replacing invalid characters takes 3 bytes
+  __m128i extra = _mm_add_epi32(Above(code, 0x7F), Above(code, 0x7FF));
+  extra = _mm_add_epi32(extra, Above(code, 0xFFFF));
+  return _mm_sub_epi32(Above(code, 0x10FFFF), extra);
+}
+
+__m128i Utf16ExtraLength(__m128i code) {
+  return _mm_sub_epi32(Above(code, 0x10FFFF), Above(code, 0xFFFF));
+}
+
+// Counts the characters of full blocks of `data`. Every character adds 1 and
+// the lane returned by `ExtraLength` for it, invalid ones are clamped to
+// 0x110000 first.
+template <__m128i (*ExtraLength)(__m128i code)>
+BlocksResult LengthFromUtf32Blocks(const char32_t* data, size_t size) {
+  constexpr size_t kBlockSize = 4;
+  // the lanes of the counter can't overflow between the flushes
+  constexpr size_t kFlushInterval = kBlockSize << 24;
+
+  size_t length = 0;
+  size_t pos = 0;
+  while (pos + kBlockSize <= size) {
+    size_t end =
+        pos + std::min(kFlushInterval, (size - pos) & ~(kBlockSize - 1));
+    __m128i counter = _mm_setzero_si128();
+    for (; pos < end; pos += kBlockSize) {
+      __m128i code =
+          _mm_min_epu32(Load(data + pos), _mm_set1_epi32(0x110000));
+      counter = _mm_add_epi32(counter, ExtraLength(code));
+    }
+    length += HorizontalSum(counter);
+  }
+
+  return {pos, pos + length};
+}
+
+// Encodes 8 Latin-1 characters held in 16-bit lanes as UTF-8, `non_ascii`
+// has the bits of the lanes above 0x7F.
+void EncodeLatin1(__m128i code, uint32_t non_ascii, uint8_t*& output) {
+  // the lead byte goes to the low byte of the lane
+  __m128i lead = _mm_or_si128(_mm_srli_epi16(code, 6), _mm_set1_epi16(0xC0));
+  __m128i continuation = _mm_or_si128(_mm_and_si128(code, _mm_set1_epi16(0x3F)),
+                                      _mm_set1_epi16(0x80));
+  __m128i two_bytes = _mm_or_si128(lead, _mm_slli_epi16(continuation, 8));
+  __m128i bytes = _mm_blendv_epi8(code, two_bytes,
+                                  _mm_cmpgt_epi16(code, _mm_set1_epi16(0x7F)));
+
+  Store(_mm_shuffle_epi8(bytes, Load(kLatin1PackBytes[non_ascii].data())),
+        output);
+  output += 8 + PopCount(non_ascii);
+}
+
+// Writes the bytes of the block whose bits aren't set in `drop`.
+void StoreDroppingBytes(__m128i bytes, uint32_t drop, uint8_t*& output) {
+  for (int half = 0; half < 2; half++) {
+    uint32_t group = (drop >> (8 * half)) & 0xFF;
+    __m128i mask = _mm_loadl_epi64(
+        reinterpret_cast<const __m128i*>(kDropBytes[group].data()));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(output),
+                     _mm_shuffle_epi8(bytes, mask));
+    output += 8 - PopCount(group);
+    bytes = _mm_srli_si128(bytes, 8);
+  }
+}
+
+}  // namespace
+
+size_t Utf8ValidBlocksLengthSse42(const uint8_t* data, size_t size) {
+  return Utf8CharacterBoundary(
+      data, ValidChunksLength(data, size, [](const __m128i*) {}));
+}
+
+BlocksResult Utf8ToUtf32BlocksSse42(const uint8_t* data, size_t size,
+                                    char32_t* output, ErrorPolicy policy) {
+  Utf32Writer writer(output);
+  size_t read = DecodeBlocks(data, size, policy, writer);
+  return {read, static_cast<size_t>(writer.output() - output)};
+}
+
+BlocksResult Utf8ToUtf16BlocksSse42(const uint8_t* data, size_t size,
+                                    uint8_t* output, bool big_endian,
+                                    ErrorPolicy policy) {
+  Utf16Writer writer(output, big_endian);
+  size_t read = DecodeBlocks(data, size, policy, writer);
+  return {read, static_cast<size_t>(writer.output() - output) / 2};
+}
+
+BlocksResult Utf8VariantToUtf32BlocksSse42(const uint8_t* data, size_t size,
+                                           Utf8Variant variant,
+                                           char32_t* output) {
+  Utf32Writer writer(output);
+  size_t read =
+      DecodeBlocks(data, size, ErrorPolicy::kStop, writer,
+                   Utf8VariantChecker(variant, /*pairs_as_units = */ false));
+  return {read, static_cast<size_t>(writer.output() - output)};
+}
+
+BlocksResult Utf8VariantToUtf16BlocksSse42(const uint8_t* data, size_t size,
+                                           Utf8Variant variant,
+                                           uint8_t* output, bool big_endian) {
+  Utf16Writer writer(output, big_endian);
+  size_t read =
+      DecodeBlocks(data, size, ErrorPolicy::kStop, writer,
+                   Utf8VariantChecker(variant, /*pairs_as_units = */ true));
+  return {read, static_cast<size_t>(writer.output() - output) / 2};
+}
+
+BlocksResult Utf16ToUtf8BlocksSse42(const uint8_t* data, size_t size,
+                                    bool big_endian, uint8_t* output) {
+  constexpr size_t kBlockSize = 16;
+  // the packed stores may write 4 bytes more than the block produces
+  constexpr size_t kOutputSlack = 4;
+
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos + kBlockSize + kOutputSlack <= size) {
+    __m128i units = Load(data + pos);
+    if (big_endian) {
+      units = SwapBytes16(units);
+    }
+
+    if (_mm_testz_si128(units, _mm_set1_epi16(-0x80))) {
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(out),
+                       _mm_packus_epi16(units, units));
+      out += kBlockSize / 2;
+      pos += kBlockSize;
+      continue;
+    }
+
+    __m128i surrogates =
+        _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x800)),
+                        _mm_set1_epi16(-0x2800));
+    if (!_mm_testz_si128(surrogates, surrogates)) {
+      if (!Utf16ToUtf8Scalar(data, size, pos, pos + kBlockSize, big_endian,
+                             out)) {
+        break;
+      }
+      continue;
+    }
+
+    EncodeUtf16Units(units, out);
+    EncodeUtf16Units(_mm_srli_si128(units, 8), out);
+    pos += kBlockSize;
+  }
+
+  return {pos, static_cast<size_t>(out - output)};
+}
+
+BlocksResult Utf16ToUtf32BlocksSse42(const uint8_t* data, size_t size,
+                                     bool big_endian, char32_t* output) {
+  constexpr size_t kBlockSize = 16;
+
+  char32_t* out = output;
+  size_t pos = 0;
+  while (pos + kBlockSize <= size) {
+    __m128i units = Load(data + pos);
+    if (big_endian) {
+      units = SwapBytes16(units);
+    }
+
+    __m128i surrogates =
+        _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x800)),
+                        _mm_set1_epi16(-0x2800));
+    if (!_mm_testz_si128(surrogates, surrogates)) {
+      if (!Utf16ToUtf32Scalar(data, size, pos, pos + kBlockSize, big_endian,
+                              out)) {
+        break;
+      }
+      continue;
+    }
+
+    Store(_mm_cvtepu16_epi32(units), out);
+    Store(_mm_cvtepu16_epi32(_mm_srli_si128(units, 8)), out + 4);
+    out += kBlockSize / 2;
+    pos += kBlockSize;
+  }
+
+  return {pos, static_cast<size_t>(out - output)};
+}
+
+BlocksResult Utf16ToUtf8VariantBlocksSse42(const uint8_t* data, size_t size,
+                                           bool big_endian, Utf8Variant variant,
+                                           uint8_t* output) {
+  constexpr size_t kBlockSize = 16;
+  // the packed stores may write 4 bytes more than the block produces, and a
+  // surrogate pair may cross the end of the block
+  constexpr size_t kOutputSlack = 4;
+
+  bool encode_zero = variant == Utf8Variant::kModifiedUtf8;
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos + kBlockSize + kOutputSlack <= size) {
+    __m128i units = Load(data + pos);
+    if (big_endian) {
+      units = SwapBytes16(units);
+    }
+
+    // surrogates, and zeros in Modified UTF-8, are left to the scalar code
+    __m128i special =
+        _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x800)),
+                        _mm_set1_epi16(-0x2800));
+    if (encode_zero) {
+      special =
+          _mm_or_si128(special, _mm_cmpeq_epi16(units, _mm_setzero_si128()));
+    }
+    if (!_mm_testz_si128(special, special)) {
+      if (!Utf16ToUtf8VariantScalar(data, size, pos, pos + kBlockSize,
+                                    big_endian, variant, out)) {
+        break;
+      }
+      continue;
+    }
+
+    if (_mm_testz_si128(units, _mm_set1_epi16(-0x80))) {
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(out),
+                       _mm_packus_epi16(units, units));
+      out += kBlockSize / 2;
+      pos += kBlockSize;
+      continue;
+    }
+
+    EncodeUtf16Units(units, out);
+    EncodeUtf16Units(_mm_srli_si128(units, 8), out);
+    pos += kBlockSize;
+  }
+
+  return {pos, static_cast<size_t>(out - output)};
+}
+
+BlocksResult Utf32ToUtf8BlocksSse42(const char32_t* data, size_t size,
+                                    uint8_t* output) {
+  constexpr size_t kBlockSize = 8;
+
+  uint8_t* out = output;
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m128i code0 = Load(data + pos);
+    __m128i code1 = Load(data + pos + 4);
+
+    if (_mm_testz_si128(_mm_or_si128(code0, code1), _mm_set1_epi32(-0x80))) {
+      __m128i units = _mm_packus_epi32(code0, code1);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(out),
+                       _mm_packus_epi16(units, units));
+      out += kBlockSize;
+      continue;
+    }
+
+    __m128i valid =
+        _mm_and_si128(ValidCharacters(code0), ValidCharacters(code1));
+    if (_mm_movemask_epi8(valid) != 0xFFFF) {
+      break;
+    }
+    EncodeCharacters(code0, out);
+    EncodeCharacters(code1, out);
+  }
+
+  return {pos, static_cast<size_t>(out - output)};
+}
+
+BlocksResult Utf8LengthFromUtf32BlocksSse42(const char32_t* data,
+                                            size_t size) {
+  return LengthFromUtf32Blocks<Utf8ExtraLength>(data, size);
+}
+
+BlocksResult Utf16LengthFromUtf32BlocksSse42(const char32_t* data,
+                                             size_t size) {
+  return LengthFromUtf32Blocks<Utf16ExtraLength>(data, size);
+}
+
+BlocksResult Utf32LengthFromUtf8BlocksSse42(const uint8_t* data, size_t size) {
+  size_t chars = 0;
+  size_t valid = ValidChunksLength(data, size, [&](const __m128i* input) {
+    for (int i = 0; i < 4; i++) {
+      chars += CountCharacters(input[i]);
+    }
+  });
+
+  // drop the truncated character at the end
+  size_t read = Utf8CharacterBoundary(data, valid);
+  if (read != valid) {
+    chars -= 1;
+  }
+  return {read, chars};
+}
+
+BlocksResult Utf16LengthFromUtf8BlocksSse42(const uint8_t* data, size_t size) {
+  size_t units = 0;
+  size_t valid = ValidChunksLength(data, size, [&](const __m128i* input) {
+    for (int i = 0; i < 4; i++) {
+      units += CountUtf16Units(input[i]);
+    }
+  });
+
+  // drop the truncated character at the end
+  size_t read = Utf8CharacterBoundary(data, valid);
+  if (read != valid) {
+    units -= data[read] >= 0xF0 ? 2 : 1;
+  }
+  return {read, units};
+}
+
+BlocksResult Utf8LengthFromUtf16BlocksSse42(const uint8_t* data, size_t size,
+                                            bool big_endian) {
+  constexpr size_t kBlockSize = 16;
+
+  size_t length = 0;
+  size_t pos = 0;
+  while (pos + kBlockSize <= size) {
+    __m128i units = Load(data + pos);
+    if (big_endian) {
+      units = SwapBytes16(units);
+    }
+
+    __m128i surrogates =
+        _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x800)),
+                        _mm_set1_epi16(-0x2800));
+    if (!_mm_testz_si128(surrogates, surrogates)) {
+      if (!Utf8LengthFromUtf16Scalar(data, size, pos, pos + kBlockSize,
+                                     big_endian, length)) {
+        break;
+      }
+      continue;
+    }
+
+    // 3 bytes per unit, minus 1 for units below 0x800 and 1 more for ASCII;
+    // every unit sets 2 bits of the masks
+    const __m128i kZero = _mm_setzero_si128();
+    __m128i ascii =
+        _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x80)), kZero);
+    __m128i two_bytes =
+        _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x800)), kZero);
+    length += 3 * kBlockSize / 2 -
+              (PopCount(_mm_movemask_epi8(ascii)) +
+               PopCount(_mm_movemask_epi8(two_bytes))) /
+                  2;
+    pos += kBlockSize;
+  }
+
+  return {pos, length};
+}
+
+BlocksResult Utf32LengthFromUtf16BlocksSse42(const uint8_t* data, size_t size,
+                                             bool big_endian) {
+  constexpr size_t kBlockSize = 16;
+  // the mask bits of the last code unit of a block
+  constexpr uint32_t kLastUnit = 0xC000;
+
+  size_t length = 0;
+  size_t pos = 0;
+  while (pos + kBlockSize <= size) {
+    __m128i units = Load(data + pos);
+    if (big_endian) {
+      units = SwapBytes16(units);
+    }
+
+    // every unit sets 2 bits of the masks
+    __m128i prefixes = _mm_and_si128(units, _mm_set1_epi16(-0x400));
+    uint32_t high = _mm_movemask_epi8(
+        _mm_cmpeq_epi16(prefixes, _mm_set1_epi16(-0x2800)));
+    uint32_t low = _mm_movemask_epi8(
+        _mm_cmpeq_epi16(prefixes, _mm_set1_epi16(-0x2400)));
+    // a high surrogate in the last unit is left to the next block, every
+    // other one must be followed by a low surrogate and vice versa
+    uint32_t last_high = high & kLastUnit;
+    if (((high ^ last_high) << 2) != low) {
+      if (!Utf32LengthFromUtf16Scalar(data, size, pos, pos + kBlockSize,
+                                      big_endian, length)) {
+        break;
+      }
+      continue;
+    }
+
+    // a surrogate pair is a single character
+    size_t block_size = last_high == 0 ? kBlockSize : kBlockSize - 2;
+    length += (block_size - PopCount(low)) / 2;
+    pos += block_size;
+  }
+
+  return {pos, length};
+}
+
+BlocksResult Latin1ToUtf8BlocksSse42(const uint8_t* data, size_t size,
+                                     uint8_t* output) {
+  constexpr size_t kBlockSize = 16;
+
+  uint8_t* out = output;
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m128i input = Load(data + pos);
+    uint32_t non_ascii = _mm_movemask_epi8(input);
+    if (non_ascii == 0) {
+      Store(input, out);
+      out += kBlockSize;
+      continue;
+    }
+    EncodeLatin1(_mm_cvtepu8_epi16(input), non_ascii & 0xFF, out);
+    EncodeLatin1(_mm_cvtepu8_epi16(_mm_srli_si128(input, 8)), non_ascii >> 8,
+                 out);
+  }
+
+  return {pos, static_cast<size_t>(out - output)};
+}
+
+BlocksResult Utf8ToLatin1BlocksSse42(const uint8_t* data, size_t size,
+                                     uint8_t* output) {
+  constexpr size_t kBlockSize = 16;
+
+  // U+0080..U+00FF are encoded by the lead bytes 0xC2 and 0xC3 followed by a
+  // single continuation byte
+  __m128i prev_input = _mm_setzero_si128();
+  uint32_t prev_lead = 0;
+  size_t written = 0;
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m128i input = Load(data + pos);
+    uint32_t non_ascii = _mm_movemask_epi8(input);
+    if (non_ascii == 0 && prev_lead == 0) {
+      if (output != nullptr) {
+        Store(input, output + written);
+      }
+      written += kBlockSize;
+      prev_input = input;
+      continue;
+    }
+
+    uint32_t leads = _mm_movemask_epi8(_mm_cmpeq_epi8(
+        _mm_and_si128(input, _mm_set1_epi8(-2)), _mm_set1_epi8(-0x3E)));
+    __m128i is_continuation = _mm_cmpeq_epi8(
+        _mm_and_si128(input, _mm_set1_epi8(-0x40)), _mm_set1_epi8(-0x80));
+    uint32_t continuations = _mm_movemask_epi8(is_continuation);
+    if ((leads | continuations) != non_ascii ||
+        continuations != (((leads << 1) | prev_lead) & 0xFFFF)) {
+      break;
+    }
+
+    if (output != nullptr) {
+      // a continuation byte gets the 2 low bits of the lead byte before it
+      __m128i high_bits = _mm_slli_epi16(
+          _mm_and_si128(Prev<1>(input, prev_input), _mm_set1_epi8(0x03)), 6);
+      __m128i chars = _mm_blendv_epi8(
+          input,
+          _mm_or_si128(_mm_and_si128(input, _mm_set1_epi8(0x3F)), high_bits),
+          is_continuation);
+      uint8_t* out = output + written;
+      StoreDroppingBytes(chars, leads, out);
+    }
+    written += kBlockSize - PopCount(leads);
+    prev_input = input;
+    prev_lead = leads >> (kBlockSize - 1);
+  }
+
+  // the character of a lead byte ending the last block isn't written
+  return {pos - prev_lead, written};
+}
+
+BlocksResult Latin1ToUtf16BlocksSse42(const uint8_t* data, size_t size,
+                                      uint8_t* output, bool big_endian) {
+  constexpr size_t kBlockSize = 16;
+
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m128i input = Load(data + pos);
+    __m128i units0 = _mm_cvtepu8_epi16(input);
+    __m128i units1 = _mm_cvtepu8_epi16(_mm_srli_si128(input, 8));
+    if (big_endian) {
+      units0 = SwapBytes16(units0);
+      units1 = SwapBytes16(units1);
+    }
+    Store(units0, output + 2 * pos);
+    Store(units1, output + 2 * pos + 16);
+  }
+
+  return {pos, pos};
+}
+
+BlocksResult Utf16ToLatin1BlocksSse42(const uint8_t* data, size_t size,
+                                      bool big_endian, uint8_t* output) {
+  constexpr size_t kBlockSize = 32;
+
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m128i units0 = Load(data + pos);
+    __m128i units1 = Load(data + pos + 16);
+    if (big_endian) {
+      units0 = SwapBytes16(units0);
+      units1 = SwapBytes16(units1);
+    }
+    if (!_mm_testz_si128(_mm_or_si128(units0, units1),
+                         _mm_set1_epi16(-0x100))) {
+      break;
+    }
+    Store(_mm_packus_epi16(units0, units1), output + pos / 2);
+  }
+
+  return {pos, pos / 2};
+}
+
+size_t CountBytesBlocksSse42(const uint8_t* data, size_t size,
+                             ByteCounts& counts) {
+  constexpr size_t kBlockSize = 16;
+
+  size_t pos = 0;
+  for (; pos + kBlockSize <= size; pos += kBlockSize) {
+    __m128i bytes = Load(data + pos);
+    uint32_t zeros = static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_setzero_si128())));
+    uint32_t c1_controls = static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(
+            _mm_and_si128(bytes, _mm_set1_epi8(static_cast<char>(0xE0))),
+            _mm_set1_epi8(static_cast<char>(0x80)))));
+    counts.even_zeros += PopCount(zeros & 0x5555);
+    counts.odd_zeros += PopCount(zeros & 0xAAAA);
+    counts.non_ascii += PopCount(_mm_movemask_epi8(bytes));
+    counts.c1_controls += PopCount(c1_controls);
+  }
+
+  return pos;
+}
+
+}  // namespace detail
+}  // namespace unicpp
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif  // defined(UNICPP_HAS_SSE42)
@@ -0,0 +1,435 @@
+#include "transcode.h"
+
+#include "latin1.h"
+#include "simd.h"
+#include "utf16.h"
+#include "utf8.h"
+#include "utf8_utf16.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+namespace unicpp {
+namespace {
+
+// A character read from the input, kInvalidCharacter for an invalid sequence
+// of `length` values. `length` is 0 if the input ends inside a character.
+struct ReadResult {
+  char32_t ch;
+  size_t length;
+};
+
+// Readers take the same invalid sequences as the decoders: a UTF-8 byte, a
+// UTF-16 code unit or a trailing odd byte.
+
+struct Utf8Reader {
+  using Value = uint8_t;
+  static ReadResult Read(const uint8_t* input, size_t size, bool end) {
+    size_t length = detail::Utf8CheckSequence(input, size);
+    if (length > size) {
+      return {kInvalidCharacter, end ? size_t{1} : 0};
+    } else if (length == 0) {
+      return {kInvalidCharacter, 1};
+    }
+    return {detail::DecodeUtf8Sequence(input, length), length};
+  }
+};
+
+template <bool kBigEndian>
+struct Utf16Reader {
+  using Value = uint8_t;
+  static ReadResult Read(const uint8_t* input, size_t size, bool end) {
+    if (size < 2) {
+      return {kInvalidCharacter, end ? size : 0};
+    }
+    char32_t unit = detail::LoadUtf16Unit(input, kBigEndian);
+    if (!IsSurrogate(unit)) {
+      return {unit, 2};
+    } else if (unit >= 0xDC00) {
+      return {kInvalidCharacter, 2};
+    } else if (size < 4) {
+      return {kInvalidCharacter, end ? size_t{2} : 0};
+    }
+    char32_t next = detail::LoadUtf16Unit(input + 2, kBigEndian);
+    if (next < 0xDC00 || next > 0xDFFF) {
+      return {kInvalidCharacter, 2};
+    }
+    return {0x10000 + ((unit - 0xD800) << 10) + (next - 0xDC00), 4};
+  }
+};
+
+struct Latin1Reader {
+  using Value = uint8_t;
+  static ReadResult Read(const uint8_t* input, size_t, bool) {
+    return {input[0], 1};
+  }
+};
+
+struct Utf32Reader {
+  using Value = char32_t;
+  static ReadResult Read(const char32_t* input, size_t, bool) {
+    return {IsValidCharacter(input[0]) ? input[0] : kInvalidCharacter, 1};
+  }
+};
+
+// Writers encode valid characters, CanWrite() is false for the characters
+// the encoding can't represent.
+
+struct Utf8Writer {
+  using Value = uint8_t;
+  static constexpr char32_t kReplacement = kReplacementCharacter;
+  static bool CanWrite(char32_t) {
+    return true;
+  }
+  static size_t Length(char32_t ch) {
+    return ch <= 0x7F ? 1 : ch <= 0x7FF ? 2 : ch <= 0xFFFF ? 3 : 4;
+  }
+  static void Write(char32_t ch, uint8_t* output) {
+    detail::StoreUtf8Character(ch, output);
+  }
+};
+
+template <bool kBigEndian>
+struct Utf16Writer {
+  using Value = uint8_t;
+  static constexpr char32_t kReplacement = kReplacementCharacter;
+  static bool CanWrite(char32_t) {
+    return true;
+  }
+  static size_t Length(char32_t ch) {
+    return ch <= 0xFFFF ? 2 : 4;
+  }
+  static void Write(char32_t ch, uint8_t* output) {
+    if (ch <= 0xFFFF) {
+      detail::StoreUtf16Unit(static_cast<uint16_t>(ch), output, kBigEndian);
+      return;
+    }
+    uint32_t sur = ch - 0x10000;
+    detail::StoreUtf16Unit(static_cast<uint16_t>((sur >> 10) + 0xD800),
+                           output, kBigEndian);
+    detail::StoreUtf16Unit(static_cast<uint16_t>((sur & 0x3FF) + 0xDC00),
+                           output + 2, kBigEndian);
+  }
+};
+
+struct Latin1Writer {
+  using Value = uint8_t;
+  static constexpr char32_t kReplacement = kLatin1ReplacementCharacter;
+  static bool CanWrite(char32_t ch) {
+    return ch <= 0xFF;
+  }
+  static size_t Length(char32_t) {
+    return 1;
+  }
+  static void Write(char32_t ch, uint8_t* output) {
+    *output = static_cast<uint8_t>(ch);
+  }
+};
+
+struct Utf32Writer {
+  using Value = char32_t;
+  static constexpr char32_t kReplacement = kReplacementCharacter;
+  static bool CanWrite(char32_t) {
+    return true;
+  }
+  static size_t Length(char32_t) {
+    return 1;
+  }
+  static void Write(char32_t ch, char32_t* output) {
+    *output = ch;
+  }
+};
+
+// The vectorized transcoding of the valid prefix of the input, which
+// Transcode() stops at the first error or at a character truncated by the
+// end of the input. The output must have room for the replaced output of
+// MaxInput() of its size, the most input Transcode() may get. The primary
+// template is for the pairs of encodings without one.
+template <class Reader, class Writer>
+struct Bulk {
+  static size_t MaxInput(size_t) {
+    return 0;
+  }
+  static size_t Transcode(const typename Reader::Value*, size_t,
+                          typename Writer::Value*, size_t, size_t* written) {
+    *written = 0;
+    return 0;
+  }
+};
+
+size_t CopyValidUtf8(const uint8_t* input, size_t size, uint8_t* output,
+                     size_t* written) {
+  *written = Utf8ValidPrefixLength(
+      std::string_view(reinterpret_cast<const char*>(input), size));
+  std::memcpy(output, input, *written);
+  return *written;
+}
+
+template <>
+struct Bulk<Utf8Reader, Utf8Writer> {
+  static size_t MaxInput(size_t room) {
+    return room;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t, size_t* written) {
+    return CopyValidUtf8(input, size, output, written);
+  }
+};
+
+template <bool kBigEndian>
+struct Bulk<Utf8Reader, Utf16Writer<kBigEndian>> {
+  static size_t MaxInput(size_t room) {
+    return room / 2;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t output_size, size_t* written) {
+    return detail::Utf8ToUtf16Contiguous(
+        input, size, output, output_size,
+        kBigEndian ? Endian::kBig : Endian::kLittle, ErrorPolicy::kStop,
+        written);
+  }
+};
+
+template <>
+struct Bulk<Utf8Reader, Latin1Writer> {
+  static size_t MaxInput(size_t room) {
+    return room;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t, size_t* written) {
+    return detail::Utf8ToLatin1Contiguous(input, size, output,
+                                          ErrorPolicy::kStop, written);
+  }
+};
+
+template <>
+struct Bulk<Utf8Reader, Utf32Writer> {
+  static size_t MaxInput(size_t room) {
+    return room;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, char32_t* output,
+                          size_t, size_t* written) {
+    return detail::Utf8DecodeContiguous(input, size, output,
+                                        ErrorPolicy::kStop, written);
+  }
+};
+
+template <bool kBigEndian>
+struct Bulk<Utf16Reader<kBigEndian>, Utf8Writer> {
+  static size_t MaxInput(size_t room) {
+    // a code unit takes at most 3 bytes
+    return room / 3 * 2;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t output_size, size_t* written) {
+    return detail::Utf16ToUtf8Contiguous(
+        input, size, kBigEndian ? Endian::kBig : Endian::kLittle, output,
+        output_size, ErrorPolicy::kStop, written);
+  }
+};
+
+template <bool kBigEndian>
+struct Bulk<Utf16Reader<kBigEndian>, Latin1Writer> {
+  static size_t MaxInput(size_t room) {
+    return std::min(room, std::numeric_limits<size_t>::max() / 2) * 2;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t, size_t* written) {
+    return detail::Utf16ToLatin1Contiguous(
+        input, size, kBigEndian ? Endian::kBig : Endian::kLittle, output,
+        ErrorPolicy::kStop, written);
+  }
+};
+
+template <>
+struct Bulk<Latin1Reader, Utf8Writer> {
+  static size_t MaxInput(size_t room) {
+    return room / 2;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t output_size, size_t* written) {
+    return detail::Latin1ToUtf8Contiguous(input, size, output, output_size,
+                                          written);
+  }
+};
+
+template <bool kBigEndian>
+struct Bulk<Latin1Reader, Utf16Writer<kBigEndian>> {
+  static size_t MaxInput(size_t room) {
+    return room / 2;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t, size_t* written) {
+    *written = 2 * size;
+    return detail::Latin1ToUtf16Contiguous(
+        input, size, output, kBigEndian ? Endian::kBig : Endian::kLittle);
+  }
+};
+
+template <>
+struct Bulk<Latin1Reader, Latin1Writer> {
+  static size_t MaxInput(size_t room) {
+    return room;
+  }
+  static size_t Transcode(const uint8_t* input, size_t size, uint8_t* output,
+                          size_t, size_t* written) {
+    std::memcpy(output, input, size);
+    *written = size;
+    return size;
+  }
+};
+
+template <>
+struct Bulk<Utf32Reader, Utf8Writer> {
+  static size_t MaxInput(size_t room) {
+    return room / 4;
+  }
+  static size_t Transcode(const char32_t* input, size_t size, uint8_t* output,
+                          size_t output_size, size_t* written) {
+    return detail::Utf8EncodeContiguous(input, size, output, output_size,
+                                        ErrorPolicy::kStop, written);
+  }
+};
+
+template <bool kBigEndian>
+struct Bulk<Utf32Reader, Utf16Writer<kBigEndian>> {
+  static size_t MaxInput(size_t room) {
+    return room / 4;
+  }
+  static size_t Transcode(const char32_t* input, size_t size, uint8_t* output,
+                          size_t, size_t* written) {
+    return detail::Utf16EncodeContiguous(
+        input, size, output, kBigEndian ? Endian::kBig : Endian::kLittle,
+        ErrorPolicy::kStop, written);
+  }
+};
+
+template <class Reader, class Writer>
+TranscodeResult TranscodeImpl(const typename Reader::Value* input,
+                              size_t input_size,
+                              typename Writer::Value* output,
+                              size_t output_size, ErrorPolicy policy,
+                              bool end_of_input) {
+  using BulkTranscoder = Bulk<Reader, Writer>;
+
+  size_t pos = 0;
+  size_t out = 0;
+  while (true) {
+    size_t limit = std::min(input_size - pos,
+                            BulkTranscoder::MaxInput(output_size - out));
+    if (limit >= detail::kScalarBlockSize) {
+      size_t written = 0;
+      pos += BulkTranscoder::Transcode(input + pos, limit, output + out,
+                                       output_size - out, &written);
+      out += written;
+    }
+
+    for (size_t i = 0; i < detail::kScalarBlockSize; i++) {
+      if (pos == input_size) {
+        return {TranscodeStatus::kDone, pos, out};
+      }
+      ReadResult read =
+          Reader::Read(input + pos, input_size - pos, end_of_input);
+      if (read.length == 0) {
+        return {TranscodeStatus::kNeedMoreInput, pos, out};
+      }
+      char32_t ch = read.ch;
+      if (ch == kInvalidCharacter || !Writer::CanWrite(ch)) {
+        if (policy == ErrorPolicy::kStop) {
+          return {TranscodeStatus::kError, pos, out};
+        } else if (policy == ErrorPolicy::kSkip) {
+          pos += read.length;
+          continue;
+        }
+        ch = Writer::kReplacement;
+      }
+      size_t length = Writer::Length(ch);
+      if (length > output_size - out) {
+        return {TranscodeStatus::kOutputFull, pos, out};
+      }
+      Writer::Write(ch, output + out);
+      out += length;
+      pos += read.length;
+    }
+  }
+}
+
+template <class Reader, class Output>
+TranscodeResult TranscodeFrom(Encoding to, const typename Reader::Value* input,
+                              size_t input_size, Output* output,
+                              size_t output_size, ErrorPolicy policy,
+                              bool end_of_input) {
+  switch (to) {
+    case Encoding::kUtf8:
+      return TranscodeImpl<Reader, Utf8Writer>(input, input_size, output,
+                                               output_size, policy,
+                                               end_of_input);
+    case Encoding::kUtf16Le:
+      return TranscodeImpl<Reader, Utf16Writer<false>>(
+          input, input_size, output, output_size, policy, end_of_input);
+    case Encoding::kUtf16Be:
+      return TranscodeImpl<Reader, Utf16Writer<true>>(
+          input, input_size, output, output_size, policy, end_of_input);
+    case Encoding::kLatin1:
+      break;
+  }
+  return TranscodeImpl<Reader, Latin1Writer>(input, input_size, output,
+                                             output_size, policy,
+                                             end_of_input);
+}
+
+}  // namespace
+
+TranscodeResult Transcode(Encoding from, Encoding to, const uint8_t* input,
+                          size_t input_size, uint8_t* output,
+                          size_t output_size, ErrorPolicy policy,
+                          bool end_of_input) {
+  switch (from) {
+    case Encoding::kUtf8:
+      return TranscodeFrom<Utf8Reader>(to, input, input_size, output,
+                                       output_size, policy, end_of_input);
+    case Encoding::kUtf16Le:
+      return TranscodeFrom<Utf16Reader<false>>(
+          to, input, input_size, output, output_size, policy, end_of_input);
+    case Encoding::kUtf16Be:
+      return TranscodeFrom<Utf16Reader<true>>(
+          to, input, input_size, output, output_size, policy, end_of_input);
+    case Encoding::kLatin1:
+      break;
+  }
+  return TranscodeFrom<Latin1Reader>(to, input, input_size, output,
+                                     output_size, policy, end_of_input);
+}
+
+TranscodeResult TranscodeFromUtf32(const char32_t* input, size_t input_size,
+                                   Encoding to, uint8_t* output,
+                                   size_t output_size, ErrorPolicy policy) {
+  return TranscodeFrom<Utf32Reader>(to, input, input_size, output,
+                                    output_size, policy,
+                                    /*end_of_input = */ true);
+}
+
+TranscodeResult TranscodeToUtf32(Encoding from, const uint8_t* input,
+                                 size_t input_size, char32_t* output,
+                                 size_t output_size, ErrorPolicy policy,
+                                 bool end_of_input) {
+  switch (from) {
+    case Encoding::kUtf8:
+      return TranscodeImpl<Utf8Reader, Utf32Writer>(
+          input, input_size, output, output_size, policy, end_of_input);
+    case Encoding::kUtf16Le:
+      return TranscodeImpl<Utf16Reader<false>, Utf32Writer>(
+          input, input_size, output, output_size, policy, end_of_input);
+    case Encoding::kUtf16Be:
+      return TranscodeImpl<Utf16Reader<true>, Utf32Writer>(
+          input, input_size, output, output_size, policy, end_of_input);
+    case Encoding::kLatin1:
+      break;
+  }
+  return TranscodeImpl<Latin1Reader, Utf32Writer>(
+      input, input_size, output, output_size, policy, end_of_input);
+}
+
+}  // namespace unicpp
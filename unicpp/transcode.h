@@ -0,0 +1,75 @@
+#pragma once
+
+#include "utf_common.h"
+
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace unicpp {
+
+// Transcoding into a fixed-size output buffer. As much input is transcoded as
+// fits in the output, whole characters only, nothing is allocated. The result
+// tells how many input and output values were consumed and produced, calling
+// again with the rest of the input and a new output buffer continues exactly
+// where the previous call stopped.
+
+// Transcodes `input` in the encoding `from` to `output` in the encoding `to`.
+// Unless `end_of_input`, a truncated character at the end of the input isn't
+// an error, but returns TranscodeStatus::kNeedMoreInput. Invalid sequences
+// and the characters above U+00FF in Latin-1 output are handled according to
+// `policy`, the replacement in Latin-1 is kLatin1ReplacementCharacter.
+TranscodeResult Transcode(Encoding from, Encoding to, const uint8_t* input,
+                          size_t input_size, uint8_t* output,
+                          size_t output_size,
+                          ErrorPolicy policy = ErrorPolicy::kReplace,
+                          bool end_of_input = true);
+
+// The same for UTF-32 input or output, counted in characters.
+TranscodeResult TranscodeFromUtf32(const char32_t* input, size_t input_size,
+                                   Encoding to, uint8_t* output,
+                                   size_t output_size,
+                                   ErrorPolicy policy = ErrorPolicy::kReplace);
+TranscodeResult TranscodeToUtf32(Encoding from, const uint8_t* input,
+                                 size_t input_size, char32_t* output,
+                                 size_t output_size,
+                                 ErrorPolicy policy = ErrorPolicy::kReplace,
+                                 bool end_of_input = true);
+
+#if defined(__cpp_lib_span)
+
+inline TranscodeResult Transcode(Encoding from, Encoding to,
+                                 std::span<const uint8_t> input,
+                                 std::span<uint8_t> output,
+                                 ErrorPolicy policy = ErrorPolicy::kReplace,
+                                 bool end_of_input = true) {
+  return Transcode(from, to, input.data(), input.size(), output.data(),
+                   output.size(), policy, end_of_input);
+}
+
+inline TranscodeResult TranscodeFromUtf32(
+    std::span<const char32_t> input, Encoding to, std::span<uint8_t> output,
+    ErrorPolicy policy = ErrorPolicy::kReplace) {
+  return TranscodeFromUtf32(input.data(), input.size(), to, output.data(),
+                            output.size(), policy);
+}
+
+inline TranscodeResult TranscodeToUtf32(
+    Encoding from, std::span<const uint8_t> input, std::span<char32_t> output,
+    ErrorPolicy policy = ErrorPolicy::kReplace, bool end_of_input = true) {
+  return TranscodeToUtf32(from, input.data(), input.size(), output.data(),
+                          output.size(), policy, end_of_input);
+}
+
+#endif
+
+}  // namespace unicpp
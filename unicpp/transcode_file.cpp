@@ -0,0 +1,321 @@
+#include "transcode_file.h"
+
+#include "parallel.h"
+#include "simd.h"
+#include "utf16.h"
+#include "utf8.h"
+
+#include <utility>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace unicpp {
+namespace {
+
+// Owns a file descriptor.
+class FileDescriptor {
+public:
+  explicit FileDescriptor(int fd)
+      : fd_(fd) {}
+  FileDescriptor(const FileDescriptor&) = delete;
+  FileDescriptor& operator=(const FileDescriptor&) = delete;
+  ~FileDescriptor() {
+    if (fd_ >= 0) {
+      int saved_errno = errno;
+      ::close(fd_);
+      errno = saved_errno;
+    }
+  }
+
+  int get() const {
+    return fd_;
+  }
+
+  // Returns false if closing failed, e.g. on delayed write errors.
+  bool Close() {
+    int fd = std::exchange(fd_, -1);
+    return ::close(fd) == 0;
+  }
+
+private:
+  int fd_;
+};
+
+// Owns a memory mapping of a whole file, which is empty for empty files.
+class FileMapping {
+public:
+  FileMapping() = default;
+  FileMapping(const FileMapping&) = delete;
+  FileMapping& operator=(const FileMapping&) = delete;
+  ~FileMapping() {
+    Unmap();
+  }
+
+  bool Map(int fd, size_t size, int protection, int flags) {
+    if (size == 0) {
+      return true;
+    }
+    void* data = ::mmap(nullptr, size, protection, flags, fd, 0);
+    if (data == MAP_FAILED) {
+      return false;
+    }
+    data_ = static_cast<uint8_t*>(data);
+    size_ = size;
+    // a hint, failures don't matter
+    ::madvise(data, size, MADV_SEQUENTIAL);
+    return true;
+  }
+
+  void Unmap() {
+    if (data_ != nullptr) {
+      int saved_errno = errno;
+      ::munmap(data_, size_);
+      errno = saved_errno;
+      data_ = nullptr;
+      size_ = 0;
+    }
+  }
+
+  uint8_t* data() const {
+    return data_;
+  }
+
+private:
+  uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+bool FindParallelConversion(Encoding from, Encoding to,
+                            detail::ParallelConversion* conversion) {
+  using detail::ParallelConversion;
+
+  constexpr struct {
+    Encoding from;
+    Encoding to;
+    ParallelConversion conversion;
+  } kConversions[] = {
+      {Encoding::kUtf8, Encoding::kUtf16Le, ParallelConversion::kUtf8ToUtf16Le},
+      {Encoding::kUtf8, Encoding::kUtf16Be, ParallelConversion::kUtf8ToUtf16Be},
+      {Encoding::kUtf8, Encoding::kLatin1, ParallelConversion::kUtf8ToLatin1},
+      {Encoding::kUtf16Le, Encoding::kUtf8, ParallelConversion::kUtf16LeToUtf8},
+      {Encoding::kUtf16Be, Encoding::kUtf8, ParallelConversion::kUtf16BeToUtf8},
+      {Encoding::kUtf16Le, Encoding::kLatin1,
+       ParallelConversion::kUtf16LeToLatin1},
+      {Encoding::kUtf16Be, Encoding::kLatin1,
+       ParallelConversion::kUtf16BeToLatin1},
+      {Encoding::kLatin1, Encoding::kUtf8, ParallelConversion::kLatin1ToUtf8},
+      {Encoding::kLatin1, Encoding::kUtf16Le,
+       ParallelConversion::kLatin1ToUtf16Le},
+      {Encoding::kLatin1, Encoding::kUtf16Be,
+       ParallelConversion::kLatin1ToUtf16Be},
+  };
+  for (const auto& entry : kConversions) {
+    if (entry.from == from && entry.to == to) {
+      *conversion = entry.conversion;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Output iterator accepting valid characters, writing them in the encoding.
+class CharacterWriter {
+public:
+  CharacterWriter(uint8_t** output, Encoding encoding)
+      : output_(output)
+      , encoding_(encoding) {}
+
+  CharacterWriter& operator=(char32_t ch) {
+    uint8_t*& out = *output_;
+    if (encoding_ == Encoding::kUtf8) {
+      out += detail::StoreUtf8Character(ch, out);
+    } else if (encoding_ == Encoding::kLatin1) {
+      *out++ = static_cast<uint8_t>(ch);
+    } else {
+      bool big_endian = encoding_ == Encoding::kUtf16Be;
+      if (ch <= 0xFFFF) {
+        detail::StoreUtf16Unit(static_cast<uint16_t>(ch), out, big_endian);
+        out += 2;
+      } else {
+        uint32_t sur = ch - 0x10000;
+        detail::StoreUtf16Unit(static_cast<uint16_t>((sur >> 10) + 0xD800),
+                               out, big_endian);
+        detail::StoreUtf16Unit(static_cast<uint16_t>((sur & 0x3FF) + 0xDC00),
+                               out + 2, big_endian);
+        out += 4;
+      }
+    }
+    return *this;
+  }
+  CharacterWriter& operator*() {
+    return *this;
+  }
+  CharacterWriter& operator++() {
+    return *this;
+  }
+  CharacterWriter operator++(int) {
+    return *this;
+  }
+
+private:
+  uint8_t** output_;
+  Encoding encoding_;
+};
+
+// Output iterator counting characters, and the ones above U+00FF.
+class CharacterCounter {
+public:
+  CharacterCounter(size_t* count, size_t* above_latin1)
+      : count_(count)
+      , above_latin1_(above_latin1) {}
+
+  CharacterCounter& operator=(char32_t ch) {
+    ++*count_;
+    if (ch > 0xFF) {
+      ++*above_latin1_;
+    }
+    return *this;
+  }
+  CharacterCounter& operator*() {
+    return *this;
+  }
+  CharacterCounter& operator++() {
+    return *this;
+  }
+  CharacterCounter operator++(int) {
+    return *this;
+  }
+
+private:
+  size_t* count_;
+  size_t* above_latin1_;
+};
+
+template <class OutputIterator>
+size_t Decode(Encoding encoding, const uint8_t* data, size_t size,
+              OutputIterator output, ErrorPolicy policy) {
+  switch (encoding) {
+    case Encoding::kUtf8:
+      return Utf8Decode(data, data + size, output, policy);
+    case Encoding::kUtf16Le:
+      return Utf16LeDecode(data, data + size, output, policy);
+    case Encoding::kUtf16Be:
+      return Utf16BeDecode(data, data + size, output, policy);
+    case Encoding::kLatin1:
+      break;
+  }
+  for (size_t pos = 0; pos < size; pos++) {
+    *output = data[pos];
+    ++output;
+  }
+  return size;
+}
+
+// The output length of the conversions without a parallel one, from an
+// encoding to itself or between the UTF-16 byte orders: an invalid byte is
+// replaced with 3 UTF-8 bytes, a trailing odd byte with a UTF-16 code unit.
+size_t MaxOutputLength(Encoding to, size_t size) {
+  if (to == Encoding::kUtf8) {
+    return 3 * size;
+  } else if (to == Encoding::kLatin1) {
+    return size;
+  }
+  return size + 1;
+}
+
+size_t CountErrors(Encoding from, Encoding to, const uint8_t* data,
+                   size_t size) {
+  size_t replaced = 0;
+  size_t replaced_above_latin1 = 0;
+  Decode(from, data, size, CharacterCounter(&replaced, &replaced_above_latin1),
+         ErrorPolicy::kReplace);
+  size_t valid = 0;
+  size_t valid_above_latin1 = 0;
+  Decode(from, data, size, CharacterCounter(&valid, &valid_above_latin1),
+         ErrorPolicy::kSkip);
+
+  size_t errors = replaced - valid;
+  if (to == Encoding::kLatin1) {
+    errors += valid_above_latin1;
+  }
+  return errors;
+}
+
+}  // namespace
+
+bool TranscodeFile(const std::string& input_path,
+                   const std::string& output_path, Encoding from, Encoding to,
+                   ErrorPolicy policy, size_t num_threads,
+                   TranscodeFileStats* stats, bool count_errors) {
+  FileDescriptor input(::open(input_path.c_str(), O_RDONLY | O_CLOEXEC));
+  struct stat input_stat;
+  if (input.get() < 0 || ::fstat(input.get(), &input_stat) != 0) {
+    return false;
+  }
+  size_t size = static_cast<size_t>(input_stat.st_size);
+  FileMapping input_mapping;
+  if (!input_mapping.Map(input.get(), size, PROT_READ, MAP_PRIVATE)) {
+    return false;
+  }
+  const uint8_t* data = input_mapping.data();
+
+  detail::ParallelConversion conversion = {};
+  bool parallel = FindParallelConversion(from, to, &conversion);
+  detail::ParallelChunks chunks;
+  size_t output_size = 0;
+  if (size > 0) {
+    if (parallel) {
+      chunks = detail::SplitForParallel(conversion, data, size, num_threads);
+      output_size = chunks.output_offsets.back();
+    } else {
+      output_size = MaxOutputLength(to, size);
+    }
+  }
+
+  FileDescriptor output(::open(output_path.c_str(),
+                               O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0666));
+  if (output.get() < 0 ||
+      ::ftruncate(output.get(), static_cast<off_t>(output_size)) != 0) {
+    return false;
+  }
+  FileMapping output_mapping;
+  if (!output_mapping.Map(output.get(), output_size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED)) {
+    return false;
+  }
+
+  size_t transcoded = 0;
+  size_t written = 0;
+  if (size > 0) {
+    if (parallel) {
+      transcoded = detail::TranscodeParallel(conversion, chunks, data,
+                                             output_mapping.data(), policy,
+                                             &written);
+    } else {
+      uint8_t* out = output_mapping.data();
+      transcoded = Decode(from, data, size, CharacterWriter(&out, to), policy);
+      written = out - output_mapping.data();
+    }
+  }
+
+  output_mapping.Unmap();
+  if (::ftruncate(output.get(), static_cast<off_t>(written)) != 0 ||
+      !output.Close()) {
+    return false;
+  }
+
+  if (stats != nullptr) {
+    stats->bytes_read = transcoded;
+    stats->bytes_written = written;
+    if (count_errors) {
+      stats->errors = CountErrors(from, to, data, size);
+    }
+  }
+  return true;
+}
+
+}  // namespace unicpp
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "utf_common.h"
+
+#include <string>
+
+#include <stddef.h>
+
+namespace unicpp {
+
+struct TranscodeFileStats {
+  // transcoded input bytes, less than the file size if stopped at an error
+  size_t bytes_read = 0;
+  size_t bytes_written = 0;
+  // invalid sequences in the input and characters not representable in the
+  // output encoding, if counted
+  size_t errors = 0;
+};
+
+// Transcodes the file at `input_path` to a new file at `output_path`, which
+// is overwritten if it exists. Both files are memory mapped, the output file
+// is sized from the output length of the input with replaced errors and
+// truncated to the written bytes. Conversions between different encodings
+// use up to `num_threads` threads (0 for the number of hardware threads) and
+// the vectorized code, from an encoding to itself (e.g. to fix invalid UTF-8)
+// or between the UTF-16 byte orders is single-threaded and scalar.
+//
+// Returns false with errno set on I/O errors, the output file may be left
+// incomplete. Counting the errors for `stats` takes an extra pass over the
+// input.
+bool TranscodeFile(const std::string& input_path,
+                   const std::string& output_path, Encoding from, Encoding to,
+                   ErrorPolicy policy = ErrorPolicy::kReplace,
+                   size_t num_threads = 1, TranscodeFileStats* stats = nullptr,
+                   bool count_errors = false);
+
+}  // namespace unicpp
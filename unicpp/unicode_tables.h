@@ -0,0 +1,4817 @@
+#pragma once
+
+#include "unicode_data.h"
+
+#include <utility>
+
+namespace unicpp {
+
+// Case mappings sorted by the character.
+inline constexpr std::pair<char32_t, char32_t> kUpperTable[] = {
+    {0x61, 0x41},       {0x62, 0x42},       {0x63, 0x43},
+    {0x64, 0x44},       {0x65, 0x45},       {0x66, 0x46},
+    {0x67, 0x47},       {0x68, 0x48},       {0x69, 0x49},
+    {0x6a, 0x4a},       {0x6b, 0x4b},       {0x6c, 0x4c},
+    {0x6d, 0x4d},       {0x6e, 0x4e},       {0x6f, 0x4f},
+    {0x70, 0x50},       {0x71, 0x51},       {0x72, 0x52},
+    {0x73, 0x53},       {0x74, 0x54},       {0x75, 0x55},
+    {0x76, 0x56},       {0x77, 0x57},       {0x78, 0x58},
+    {0x79, 0x59},       {0x7a, 0x5a},       {0xb5, 0x39c},
+    {0xe0, 0xc0},       {0xe1, 0xc1},       {0xe2, 0xc2},
+    {0xe3, 0xc3},       {0xe4, 0xc4},       {0xe5, 0xc5},
+    {0xe6, 0xc6},       {0xe7, 0xc7},       {0xe8, 0xc8},
+    {0xe9, 0xc9},       {0xea, 0xca},       {0xeb, 0xcb},
+    {0xec, 0xcc},       {0xed, 0xcd},       {0xee, 0xce},
+    {0xef, 0xcf},       {0xf0, 0xd0},       {0xf1, 0xd1},
+    {0xf2, 0xd2},       {0xf3, 0xd3},       {0xf4, 0xd4},
+    {0xf5, 0xd5},       {0xf6, 0xd6},       {0xf8, 0xd8},
+    {0xf9, 0xd9},       {0xfa, 0xda},       {0xfb, 0xdb},
+    {0xfc, 0xdc},       {0xfd, 0xdd},       {0xfe, 0xde},
+    {0xff, 0x178},      {0x101, 0x100},     {0x103, 0x102},
+    {0x105, 0x104},     {0x107, 0x106},     {0x109, 0x108},
+    {0x10b, 0x10a},     {0x10d, 0x10c},     {0x10f, 0x10e},
+    {0x111, 0x110},     {0x113, 0x112},     {0x115, 0x114},
+    {0x117, 0x116},     {0x119, 0x118},     {0x11b, 0x11a},
+    {0x11d, 0x11c},     {0x11f, 0x11e},     {0x121, 0x120},
+    {0x123, 0x122},     {0x125, 0x124},     {0x127, 0x126},
+    {0x129, 0x128},     {0x12b, 0x12a},     {0x12d, 0x12c},
+    {0x12f, 0x12e},     {0x131, 0x49},      {0x133, 0x132},
+    {0x135, 0x134},     {0x137, 0x136},     {0x13a, 0x139},
+    {0x13c, 0x13b},     {0x13e, 0x13d},     {0x140, 0x13f},
+    {0x142, 0x141},     {0x144, 0x143},     {0x146, 0x145},
+    {0x148, 0x147},     {0x14b, 0x14a},     {0x14d, 0x14c},
+    {0x14f, 0x14e},     {0x151, 0x150},     {0x153, 0x152},
+    {0x155, 0x154},     {0x157, 0x156},     {0x159, 0x158},
+    {0x15b, 0x15a},     {0x15d, 0x15c},     {0x15f, 0x15e},
+    {0x161, 0x160},     {0x163, 0x162},     {0x165, 0x164},
+    {0x167, 0x166},     {0x169, 0x168},     {0x16b, 0x16a},
+    {0x16d, 0x16c},     {0x16f, 0x16e},     {0x171, 0x170},
+    {0x173, 0x172},     {0x175, 0x174},     {0x177, 0x176},
+    {0x17a, 0x179},     {0x17c, 0x17b},     {0x17e, 0x17d},
+    {0x17f, 0x53},      {0x180, 0x243},     {0x183, 0x182},
+    {0x185, 0x184},     {0x188, 0x187},     {0x18c, 0x18b},
+    {0x192, 0x191},     {0x195, 0x1f6},     {0x199, 0x198},
+    {0x19a, 0x23d},     {0x19e, 0x220},     {0x1a1, 0x1a0},
+    {0x1a3, 0x1a2},     {0x1a5, 0x1a4},     {0x1a8, 0x1a7},
+    {0x1ad, 0x1ac},     {0x1b0, 0x1af},     {0x1b4, 0x1b3},
+    {0x1b6, 0x1b5},     {0x1b9, 0x1b8},     {0x1bd, 0x1bc},
+    {0x1bf, 0x1f7},     {0x1c5, 0x1c4},     {0x1c6, 0x1c4},
+    {0x1c8, 0x1c7},     {0x1c9, 0x1c7},     {0x1cb, 0x1ca},
+    {0x1cc, 0x1ca},     {0x1ce, 0x1cd},     {0x1d0, 0x1cf},
+    {0x1d2, 0x1d1},     {0x1d4, 0x1d3},     {0x1d6, 0x1d5},
+    {0x1d8, 0x1d7},     {0x1da, 0x1d9},     {0x1dc, 0x1db},
+    {0x1dd, 0x18e},     {0x1df, 0x1de},     {0x1e1, 0x1e0},
+    {0x1e3, 0x1e2},     {0x1e5, 0x1e4},     {0x1e7, 0x1e6},
+    {0x1e9, 0x1e8},     {0x1eb, 0x1ea},     {0x1ed, 0x1ec},
+    {0x1ef, 0x1ee},     {0x1f2, 0x1f1},     {0x1f3, 0x1f1},
+    {0x1f5, 0x1f4},     {0x1f9, 0x1f8},     {0x1fb, 0x1fa},
+    {0x1fd, 0x1fc},     {0x1ff, 0x1fe},     {0x201, 0x200},
+    {0x203, 0x202},     {0x205, 0x204},     {0x207, 0x206},
+    {0x209, 0x208},     {0x20b, 0x20a},     {0x20d, 0x20c},
+    {0x20f, 0x20e},     {0x211, 0x210},     {0x213, 0x212},
+    {0x215, 0x214},     {0x217, 0x216},     {0x219, 0x218},
+    {0x21b, 0x21a},     {0x21d, 0x21c},     {0x21f, 0x21e},
+    {0x223, 0x222},     {0x225, 0x224},     {0x227, 0x226},
+    {0x229, 0x228},     {0x22b, 0x22a},     {0x22d, 0x22c},
+    {0x22f, 0x22e},     {0x231, 0x230},     {0x233, 0x232},
+    {0x23c, 0x23b},     {0x23f, 0x2c7e},    {0x240, 0x2c7f},
+    {0x242, 0x241},     {0x247, 0x246},     {0x249, 0x248},
+    {0x24b, 0x24a},     {0x24d, 0x24c},     {0x24f, 0x24e},
+    {0x250, 0x2c6f},    {0x251, 0x2c6d},    {0x252, 0x2c70},
+    {0x253, 0x181},     {0x254, 0x186},     {0x256, 0x189},
+    {0x257, 0x18a},     {0x259, 0x18f},     {0x25b, 0x190},
+    {0x25c, 0xa7ab},    {0x260, 0x193},     {0x261, 0xa7ac},
+    {0x263, 0x194},     {0x265, 0xa78d},    {0x266, 0xa7aa},
+    {0x268, 0x197},     {0x269, 0x196},     {0x26a, 0xa7ae},
+    {0x26b, 0x2c62},    {0x26c, 0xa7ad},    {0x26f, 0x19c},
+    {0x271, 0x2c6e},    {0x272, 0x19d},     {0x275, 0x19f},
+    {0x27d, 0x2c64},    {0x280, 0x1a6},     {0x282, 0xa7c5},
+    {0x283, 0x1a9},     {0x287, 0xa7b1},    {0x288, 0x1ae},
+    {0x289, 0x244},     {0x28a, 0x1b1},     {0x28b, 0x1b2},
+    {0x28c, 0x245},     {0x292, 0x1b7},     {0x29d, 0xa7b2},
+    {0x29e, 0xa7b0},    {0x345, 0x399},     {0x371, 0x370},
+    {0x373, 0x372},     {0x377, 0x376},     {0x37b, 0x3fd},
+    {0x37c, 0x3fe},     {0x37d, 0x3ff},     {0x3ac, 0x386},
+    {0x3ad, 0x388},     {0x3ae, 0x389},     {0x3af, 0x38a},
+    {0x3b1, 0x391},     {0x3b2, 0x392},     {0x3b3, 0x393},
+    {0x3b4, 0x394},     {0x3b5, 0x395},     {0x3b6, 0x396},
+    {0x3b7, 0x397},     {0x3b8, 0x398},     {0x3b9, 0x399},
+    {0x3ba, 0x39a},     {0x3bb, 0x39b},     {0x3bc, 0x39c},
+    {0x3bd, 0x39d},     {0x3be, 0x39e},     {0x3bf, 0x39f},
+    {0x3c0, 0x3a0},     {0x3c1, 0x3a1},     {0x3c2, 0x3a3},
+    {0x3c3, 0x3a3},     {0x3c4, 0x3a4},     {0x3c5, 0x3a5},
+    {0x3c6, 0x3a6},     {0x3c7, 0x3a7},     {0x3c8, 0x3a8},
+    {0x3c9, 0x3a9},     {0x3ca, 0x3aa},     {0x3cb, 0x3ab},
+    {0x3cc, 0x38c},     {0x3cd, 0x38e},     {0x3ce, 0x38f},
+    {0x3d0, 0x392},     {0x3d1, 0x398},     {0x3d5, 0x3a6},
+    {0x3d6, 0x3a0},     {0x3d7, 0x3cf},     {0x3d9, 0x3d8},
+    {0x3db, 0x3da},     {0x3dd, 0x3dc},     {0x3df, 0x3de},
+    {0x3e1, 0x3e0},     {0x3e3, 0x3e2},     {0x3e5, 0x3e4},
+    {0x3e7, 0x3e6},     {0x3e9, 0x3e8},     {0x3eb, 0x3ea},
+    {0x3ed, 0x3ec},     {0x3ef, 0x3ee},     {0x3f0, 0x39a},
+    {0x3f1, 0x3a1},     {0x3f2, 0x3f9},     {0x3f3, 0x37f},
+    {0x3f5, 0x395},     {0x3f8, 0x3f7},     {0x3fb, 0x3fa},
+    {0x430, 0x410},     {0x431, 0x411},     {0x432, 0x412},
+    {0x433, 0x413},     {0x434, 0x414},     {0x435, 0x415},
+    {0x436, 0x416},     {0x437, 0x417},     {0x438, 0x418},
+    {0x439, 0x419},     {0x43a, 0x41a},     {0x43b, 0x41b},
+    {0x43c, 0x41c},     {0x43d, 0x41d},     {0x43e, 0x41e},
+    {0x43f, 0x41f},     {0x440, 0x420},     {0x441, 0x421},
+    {0x442, 0x422},     {0x443, 0x423},     {0x444, 0x424},
+    {0x445, 0x425},     {0x446, 0x426},     {0x447, 0x427},
+    {0x448, 0x428},     {0x449, 0x429},     {0x44a, 0x42a},
+    {0x44b, 0x42b},     {0x44c, 0x42c},     {0x44d, 0x42d},
+    {0x44e, 0x42e},     {0x44f, 0x42f},     {0x450, 0x400},
+    {0x451, 0x401},     {0x452, 0x402},     {0x453, 0x403},
+    {0x454, 0x404},     {0x455, 0x405},     {0x456, 0x406},
+    {0x457, 0x407},     {0x458, 0x408},     {0x459, 0x409},
+    {0x45a, 0x40a},     {0x45b, 0x40b},     {0x45c, 0x40c},
+    {0x45d, 0x40d},     {0x45e, 0x40e},     {0x45f, 0x40f},
+    {0x461, 0x460},     {0x463, 0x462},     {0x465, 0x464},
+    {0x467, 0x466},     {0x469, 0x468},     {0x46b, 0x46a},
+    {0x46d, 0x46c},     {0x46f, 0x46e},     {0x471, 0x470},
+    {0x473, 0x472},     {0x475, 0x474},     {0x477, 0x476},
+    {0x479, 0x478},     {0x47b, 0x47a},     {0x47d, 0x47c},
+    {0x47f, 0x47e},     {0x481, 0x480},     {0x48b, 0x48a},
+    {0x48d, 0x48c},     {0x48f, 0x48e},     {0x491, 0x490},
+    {0x493, 0x492},     {0x495, 0x494},     {0x497, 0x496},
+    {0x499, 0x498},     {0x49b, 0x49a},     {0x49d, 0x49c},
+    {0x49f, 0x49e},     {0x4a1, 0x4a0},     {0x4a3, 0x4a2},
+    {0x4a5, 0x4a4},     {0x4a7, 0x4a6},     {0x4a9, 0x4a8},
+    {0x4ab, 0x4aa},     {0x4ad, 0x4ac},     {0x4af, 0x4ae},
+    {0x4b1, 0x4b0},     {0x4b3, 0x4b2},     {0x4b5, 0x4b4},
+    {0x4b7, 0x4b6},     {0x4b9, 0x4b8},     {0x4bb, 0x4ba},
+    {0x4bd, 0x4bc},     {0x4bf, 0x4be},     {0x4c2, 0x4c1},
+    {0x4c4, 0x4c3},     {0x4c6, 0x4c5},     {0x4c8, 0x4c7},
+    {0x4ca, 0x4c9},     {0x4cc, 0x4cb},     {0x4ce, 0x4cd},
+    {0x4cf, 0x4c0},     {0x4d1, 0x4d0},     {0x4d3, 0x4d2},
+    {0x4d5, 0x4d4},     {0x4d7, 0x4d6},     {0x4d9, 0x4d8},
+    {0x4db, 0x4da},     {0x4dd, 0x4dc},     {0x4df, 0x4de},
+    {0x4e1, 0x4e0},     {0x4e3, 0x4e2},     {0x4e5, 0x4e4},
+    {0x4e7, 0x4e6},     {0x4e9, 0x4e8},     {0x4eb, 0x4ea},
+    {0x4ed, 0x4ec},     {0x4ef, 0x4ee},     {0x4f1, 0x4f0},
+    {0x4f3, 0x4f2},     {0x4f5, 0x4f4},     {0x4f7, 0x4f6},
+    {0x4f9, 0x4f8},     {0x4fb, 0x4fa},     {0x4fd, 0x4fc},
+    {0x4ff, 0x4fe},     {0x501, 0x500},     {0x503, 0x502},
+    {0x505, 0x504},     {0x507, 0x506},     {0x509, 0x508},
+    {0x50b, 0x50a},     {0x50d, 0x50c},     {0x50f, 0x50e},
+    {0x511, 0x510},     {0x513, 0x512},     {0x515, 0x514},
+    {0x517, 0x516},     {0x519, 0x518},     {0x51b, 0x51a},
+    {0x51d, 0x51c},     {0x51f, 0x51e},     {0x521, 0x520},
+    {0x523, 0x522},     {0x525, 0x524},     {0x527, 0x526},
+    {0x529, 0x528},     {0x52b, 0x52a},     {0x52d, 0x52c},
+    {0x52f, 0x52e},     {0x561, 0x531},     {0x562, 0x532},
+    {0x563, 0x533},     {0x564, 0x534},     {0x565, 0x535},
+    {0x566, 0x536},     {0x567, 0x537},     {0x568, 0x538},
+    {0x569, 0x539},     {0x56a, 0x53a},     {0x56b, 0x53b},
+    {0x56c, 0x53c},     {0x56d, 0x53d},     {0x56e, 0x53e},
+    {0x56f, 0x53f},     {0x570, 0x540},     {0x571, 0x541},
+    {0x572, 0x542},     {0x573, 0x543},     {0x574, 0x544},
+    {0x575, 0x545},     {0x576, 0x546},     {0x577, 0x547},
+    {0x578, 0x548},     {0x579, 0x549},     {0x57a, 0x54a},
+    {0x57b, 0x54b},     {0x57c, 0x54c},     {0x57d, 0x54d},
+    {0x57e, 0x54e},     {0x57f, 0x54f},     {0x580, 0x550},
+    {0x581, 0x551},     {0x582, 0x552},     {0x583, 0x553},
+    {0x584, 0x554},     {0x585, 0x555},     {0x586, 0x556},
+    {0x10d0, 0x1c90},   {0x10d1, 0x1c91},   {0x10d2, 0x1c92},
+    {0x10d3, 0x1c93},   {0x10d4, 0x1c94},   {0x10d5, 0x1c95},
+    {0x10d6, 0x1c96},   {0x10d7, 0x1c97},   {0x10d8, 0x1c98},
+    {0x10d9, 0x1c99},   {0x10da, 0x1c9a},   {0x10db, 0x1c9b},
+    {0x10dc, 0x1c9c},   {0x10dd, 0x1c9d},   {0x10de, 0x1c9e},
+    {0x10df, 0x1c9f},   {0x10e0, 0x1ca0},   {0x10e1, 0x1ca1},
+    {0x10e2, 0x1ca2},   {0x10e3, 0x1ca3},   {0x10e4, 0x1ca4},
+    {0x10e5, 0x1ca5},   {0x10e6, 0x1ca6},   {0x10e7, 0x1ca7},
+    {0x10e8, 0x1ca8},   {0x10e9, 0x1ca9},   {0x10ea, 0x1caa},
+    {0x10eb, 0x1cab},   {0x10ec, 0x1cac},   {0x10ed, 0x1cad},
+    {0x10ee, 0x1cae},   {0x10ef, 0x1caf},   {0x10f0, 0x1cb0},
+    {0x10f1, 0x1cb1},   {0x10f2, 0x1cb2},   {0x10f3, 0x1cb3},
+    {0x10f4, 0x1cb4},   {0x10f5, 0x1cb5},   {0x10f6, 0x1cb6},
+    {0x10f7, 0x1cb7},   {0x10f8, 0x1cb8},   {0x10f9, 0x1cb9},
+    {0x10fa, 0x1cba},   {0x10fd, 0x1cbd},   {0x10fe, 0x1cbe},
+    {0x10ff, 0x1cbf},   {0x13f8, 0x13f0},   {0x13f9, 0x13f1},
+    {0x13fa, 0x13f2},   {0x13fb, 0x13f3},   {0x13fc, 0x13f4},
+    {0x13fd, 0x13f5},   {0x1c80, 0x412},    {0x1c81, 0x414},
+    {0x1c82, 0x41e},    {0x1c83, 0x421},    {0x1c84, 0x422},
+    {0x1c85, 0x422},    {0x1c86, 0x42a},    {0x1c87, 0x462},
+    {0x1c88, 0xa64a},   {0x1d79, 0xa77d},   {0x1d7d, 0x2c63},
+    {0x1d8e, 0xa7c6},   {0x1e01, 0x1e00},   {0x1e03, 0x1e02},
+    {0x1e05, 0x1e04},   {0x1e07, 0x1e06},   {0x1e09, 0x1e08},
+    {0x1e0b, 0x1e0a},   {0x1e0d, 0x1e0c},   {0x1e0f, 0x1e0e},
+    {0x1e11, 0x1e10},   {0x1e13, 0x1e12},   {0x1e15, 0x1e14},
+    {0x1e17, 0x1e16},   {0x1e19, 0x1e18},   {0x1e1b, 0x1e1a},
+    {0x1e1d, 0x1e1c},   {0x1e1f, 0x1e1e},   {0x1e21, 0x1e20},
+    {0x1e23, 0x1e22},   {0x1e25, 0x1e24},   {0x1e27, 0x1e26},
+    {0x1e29, 0x1e28},   {0x1e2b, 0x1e2a},   {0x1e2d, 0x1e2c},
+    {0x1e2f, 0x1e2e},   {0x1e31, 0x1e30},   {0x1e33, 0x1e32},
+    {0x1e35, 0x1e34},   {0x1e37, 0x1e36},   {0x1e39, 0x1e38},
+    {0x1e3b, 0x1e3a},   {0x1e3d, 0x1e3c},   {0x1e3f, 0x1e3e},
+    {0x1e41, 0x1e40},   {0x1e43, 0x1e42},   {0x1e45, 0x1e44},
+    {0x1e47, 0x1e46},   {0x1e49, 0x1e48},   {0x1e4b, 0x1e4a},
+    {0x1e4d, 0x1e4c},   {0x1e4f, 0x1e4e},   {0x1e51, 0x1e50},
+    {0x1e53, 0x1e52},   {0x1e55, 0x1e54},   {0x1e57, 0x1e56},
+    {0x1e59, 0x1e58},   {0x1e5b, 0x1e5a},   {0x1e5d, 0x1e5c},
+    {0x1e5f, 0x1e5e},   {0x1e61, 0x1e60},   {0x1e63, 0x1e62},
+    {0x1e65, 0x1e64},   {0x1e67, 0x1e66},   {0x1e69, 0x1e68},
+    {0x1e6b, 0x1e6a},   {0x1e6d, 0x1e6c},   {0x1e6f, 0x1e6e},
+    {0x1e71, 0x1e70},   {0x1e73, 0x1e72},   {0x1e75, 0x1e74},
+    {0x1e77, 0x1e76},   {0x1e79, 0x1e78},   {0x1e7b, 0x1e7a},
+    {0x1e7d, 0x1e7c},   {0x1e7f, 0x1e7e},   {0x1e81, 0x1e80},
+    {0x1e83, 0x1e82},   {0x1e85, 0x1e84},   {0x1e87, 0x1e86},
+    {0x1e89, 0x1e88},   {0x1e8b, 0x1e8a},   {0x1e8d, 0x1e8c},
+    {0x1e8f, 0x1e8e},   {0x1e91, 0x1e90},   {0x1e93, 0x1e92},
+    {0x1e95, 0x1e94},   {0x1e9b, 0x1e60},   {0x1ea1, 0x1ea0},
+    {0x1ea3, 0x1ea2},   {0x1ea5, 0x1ea4},   {0x1ea7, 0x1ea6},
+    {0x1ea9, 0x1ea8},   {0x1eab, 0x1eaa},   {0x1ead, 0x1eac},
+    {0x1eaf, 0x1eae},   {0x1eb1, 0x1eb0},   {0x1eb3, 0x1eb2},
+    {0x1eb5, 0x1eb4},   {0x1eb7, 0x1eb6},   {0x1eb9, 0x1eb8},
+    {0x1ebb, 0x1eba},   {0x1ebd, 0x1ebc},   {0x1ebf, 0x1ebe},
+    {0x1ec1, 0x1ec0},   {0x1ec3, 0x1ec2},   {0x1ec5, 0x1ec4},
+    {0x1ec7, 0x1ec6},   {0x1ec9, 0x1ec8},   {0x1ecb, 0x1eca},
+    {0x1ecd, 0x1ecc},   {0x1ecf, 0x1ece},   {0x1ed1, 0x1ed0},
+    {0x1ed3, 0x1ed2},   {0x1ed5, 0x1ed4},   {0x1ed7, 0x1ed6},
+    {0x1ed9, 0x1ed8},   {0x1edb, 0x1eda},   {0x1edd, 0x1edc},
+    {0x1edf, 0x1ede},   {0x1ee1, 0x1ee0},   {0x1ee3, 0x1ee2},
+    {0x1ee5, 0x1ee4},   {0x1ee7, 0x1ee6},   {0x1ee9, 0x1ee8},
+    {0x1eeb, 0x1eea},   {0x1eed, 0x1eec},   {0x1eef, 0x1eee},
+    {0x1ef1, 0x1ef0},   {0x1ef3, 0x1ef2},   {0x1ef5, 0x1ef4},
+    {0x1ef7, 0x1ef6},   {0x1ef9, 0x1ef8},   {0x1efb, 0x1efa},
+    {0x1efd, 0x1efc},   {0x1eff, 0x1efe},   {0x1f00, 0x1f08},
+    {0x1f01, 0x1f09},   {0x1f02, 0x1f0a},   {0x1f03, 0x1f0b},
+    {0x1f04, 0x1f0c},   {0x1f05, 0x1f0d},   {0x1f06, 0x1f0e},
+    {0x1f07, 0x1f0f},   {0x1f10, 0x1f18},   {0x1f11, 0x1f19},
+    {0x1f12, 0x1f1a},   {0x1f13, 0x1f1b},   {0x1f14, 0x1f1c},
+    {0x1f15, 0x1f1d},   {0x1f20, 0x1f28},   {0x1f21, 0x1f29},
+    {0x1f22, 0x1f2a},   {0x1f23, 0x1f2b},   {0x1f24, 0x1f2c},
+    {0x1f25, 0x1f2d},   {0x1f26, 0x1f2e},   {0x1f27, 0x1f2f},
+    {0x1f30, 0x1f38},   {0x1f31, 0x1f39},   {0x1f32, 0x1f3a},
+    {0x1f33, 0x1f3b},   {0x1f34, 0x1f3c},   {0x1f35, 0x1f3d},
+    {0x1f36, 0x1f3e},   {0x1f37, 0x1f3f},   {0x1f40, 0x1f48},
+    {0x1f41, 0x1f49},   {0x1f42, 0x1f4a},   {0x1f43, 0x1f4b},
+    {0x1f44, 0x1f4c},   {0x1f45, 0x1f4d},   {0x1f51, 0x1f59},
+    {0x1f53, 0x1f5b},   {0x1f55, 0x1f5d},   {0x1f57, 0x1f5f},
+    {0x1f60, 0x1f68},   {0x1f61, 0x1f69},   {0x1f62, 0x1f6a},
+    {0x1f63, 0x1f6b},   {0x1f64, 0x1f6c},   {0x1f65, 0x1f6d},
+    {0x1f66, 0x1f6e},   {0x1f67, 0x1f6f},   {0x1f70, 0x1fba},
+    {0x1f71, 0x1fbb},   {0x1f72, 0x1fc8},   {0x1f73, 0x1fc9},
+    {0x1f74, 0x1fca},   {0x1f75, 0x1fcb},   {0x1f76, 0x1fda},
+    {0x1f77, 0x1fdb},   {0x1f78, 0x1ff8},   {0x1f79, 0x1ff9},
+    {0x1f7a, 0x1fea},   {0x1f7b, 0x1feb},   {0x1f7c, 0x1ffa},
+    {0x1f7d, 0x1ffb},   {0x1f80, 0x1f88},   {0x1f81, 0x1f89},
+    {0x1f82, 0x1f8a},   {0x1f83, 0x1f8b},   {0x1f84, 0x1f8c},
+    {0x1f85, 0x1f8d},   {0x1f86, 0x1f8e},   {0x1f87, 0x1f8f},
+    {0x1f90, 0x1f98},   {0x1f91, 0x1f99},   {0x1f92, 0x1f9a},
+    {0x1f93, 0x1f9b},   {0x1f94, 0x1f9c},   {0x1f95, 0x1f9d},
+    {0x1f96, 0x1f9e},   {0x1f97, 0x1f9f},   {0x1fa0, 0x1fa8},
+    {0x1fa1, 0x1fa9},   {0x1fa2, 0x1faa},   {0x1fa3, 0x1fab},
+    {0x1fa4, 0x1fac},   {0x1fa5, 0x1fad},   {0x1fa6, 0x1fae},
+    {0x1fa7, 0x1faf},   {0x1fb0, 0x1fb8},   {0x1fb1, 0x1fb9},
+    {0x1fb3, 0x1fbc},   {0x1fbe, 0x399},    {0x1fc3, 0x1fcc},
+    {0x1fd0, 0x1fd8},   {0x1fd1, 0x1fd9},   {0x1fe0, 0x1fe8},
+    {0x1fe1, 0x1fe9},   {0x1fe5, 0x1fec},   {0x1ff3, 0x1ffc},
+    {0x214e, 0x2132},   {0x2170, 0x2160},   {0x2171, 0x2161},
+    {0x2172, 0x2162},   {0x2173, 0x2163},   {0x2174, 0x2164},
+    {0x2175, 0x2165},   {0x2176, 0x2166},   {0x2177, 0x2167},
+    {0x2178, 0x2168},   {0x2179, 0x2169},   {0x217a, 0x216a},
+    {0x217b, 0x216b},   {0x217c, 0x216c},   {0x217d, 0x216d},
+    {0x217e, 0x216e},   {0x217f, 0x216f},   {0x2184, 0x2183},
+    {0x24d0, 0x24b6},   {0x24d1, 0x24b7},   {0x24d2, 0x24b8},
+    {0x24d3, 0x24b9},   {0x24d4, 0x24ba},   {0x24d5, 0x24bb},
+    {0x24d6, 0x24bc},   {0x24d7, 0x24bd},   {0x24d8, 0x24be},
+    {0x24d9, 0x24bf},   {0x24da, 0x24c0},   {0x24db, 0x24c1},
+    {0x24dc, 0x24c2},   {0x24dd, 0x24c3},   {0x24de, 0x24c4},
+    {0x24df, 0x24c5},   {0x24e0, 0x24c6},   {0x24e1, 0x24c7},
+    {0x24e2, 0x24c8},   {0x24e3, 0x24c9},   {0x24e4, 0x24ca},
+    {0x24e5, 0x24cb},   {0x24e6, 0x24cc},   {0x24e7, 0x24cd},
+    {0x24e8, 0x24ce},   {0x24e9, 0x24cf},   {0x2c30, 0x2c00},
+    {0x2c31, 0x2c01},   {0x2c32, 0x2c02},   {0x2c33, 0x2c03},
+    {0x2c34, 0x2c04},   {0x2c35, 0x2c05},   {0x2c36, 0x2c06},
+    {0x2c37, 0x2c07},   {0x2c38, 0x2c08},   {0x2c39, 0x2c09},
+    {0x2c3a, 0x2c0a},   {0x2c3b, 0x2c0b},   {0x2c3c, 0x2c0c},
+    {0x2c3d, 0x2c0d},   {0x2c3e, 0x2c0e},   {0x2c3f, 0x2c0f},
+    {0x2c40, 0x2c10},   {0x2c41, 0x2c11},   {0x2c42, 0x2c12},
+    {0x2c43, 0x2c13},   {0x2c44, 0x2c14},   {0x2c45, 0x2c15},
+    {0x2c46, 0x2c16},   {0x2c47, 0x2c17},   {0x2c48, 0x2c18},
+    {0x2c49, 0x2c19},   {0x2c4a, 0x2c1a},   {0x2c4b, 0x2c1b},
+    {0x2c4c, 0x2c1c},   {0x2c4d, 0x2c1d},   {0x2c4e, 0x2c1e},
+    {0x2c4f, 0x2c1f},   {0x2c50, 0x2c20},   {0x2c51, 0x2c21},
+    {0x2c52, 0x2c22},   {0x2c53, 0x2c23},   {0x2c54, 0x2c24},
+    {0x2c55, 0x2c25},   {0x2c56, 0x2c26},   {0x2c57, 0x2c27},
+    {0x2c58, 0x2c28},   {0x2c59, 0x2c29},   {0x2c5a, 0x2c2a},
+    {0x2c5b, 0x2c2b},   {0x2c5c, 0x2c2c},   {0x2c5d, 0x2c2d},
+    {0x2c5e, 0x2c2e},   {0x2c61, 0x2c60},   {0x2c65, 0x23a},
+    {0x2c66, 0x23e},    {0x2c68, 0x2c67},   {0x2c6a, 0x2c69},
+    {0x2c6c, 0x2c6b},   {0x2c73, 0x2c72},   {0x2c76, 0x2c75},
+    {0x2c81, 0x2c80},   {0x2c83, 0x2c82},   {0x2c85, 0x2c84},
+    {0x2c87, 0x2c86},   {0x2c89, 0x2c88},   {0x2c8b, 0x2c8a},
+    {0x2c8d, 0x2c8c},   {0x2c8f, 0x2c8e},   {0x2c91, 0x2c90},
+    {0x2c93, 0x2c92},   {0x2c95, 0x2c94},   {0x2c97, 0x2c96},
+    {0x2c99, 0x2c98},   {0x2c9b, 0x2c9a},   {0x2c9d, 0x2c9c},
+    {0x2c9f, 0x2c9e},   {0x2ca1, 0x2ca0},   {0x2ca3, 0x2ca2},
+    {0x2ca5, 0x2ca4},   {0x2ca7, 0x2ca6},   {0x2ca9, 0x2ca8},
+    {0x2cab, 0x2caa},   {0x2cad, 0x2cac},   {0x2caf, 0x2cae},
+    {0x2cb1, 0x2cb0},   {0x2cb3, 0x2cb2},   {0x2cb5, 0x2cb4},
+    {0x2cb7, 0x2cb6},   {0x2cb9, 0x2cb8},   {0x2cbb, 0x2cba},
+    {0x2cbd, 0x2cbc},   {0x2cbf, 0x2cbe},   {0x2cc1, 0x2cc0},
+    {0x2cc3, 0x2cc2},   {0x2cc5, 0x2cc4},   {0x2cc7, 0x2cc6},
+    {0x2cc9, 0x2cc8},   {0x2ccb, 0x2cca},   {0x2ccd, 0x2ccc},
+    {0x2ccf, 0x2cce},   {0x2cd1, 0x2cd0},   {0x2cd3, 0x2cd2},
+    {0x2cd5, 0x2cd4},   {0x2cd7, 0x2cd6},   {0x2cd9, 0x2cd8},
+    {0x2cdb, 0x2cda},   {0x2cdd, 0x2cdc},   {0x2cdf, 0x2cde},
+    {0x2ce1, 0x2ce0},   {0x2ce3, 0x2ce2},   {0x2cec, 0x2ceb},
+    {0x2cee, 0x2ced},   {0x2cf3, 0x2cf2},   {0x2d00, 0x10a0},
+    {0x2d01, 0x10a1},   {0x2d02, 0x10a2},   {0x2d03, 0x10a3},
+    {0x2d04, 0x10a4},   {0x2d05, 0x10a5},   {0x2d06, 0x10a6},
+    {0x2d07, 0x10a7},   {0x2d08, 0x10a8},   {0x2d09, 0x10a9},
+    {0x2d0a, 0x10aa},   {0x2d0b, 0x10ab},   {0x2d0c, 0x10ac},
+    {0x2d0d, 0x10ad},   {0x2d0e, 0x10ae},   {0x2d0f, 0x10af},
+    {0x2d10, 0x10b0},   {0x2d11, 0x10b1},   {0x2d12, 0x10b2},
+    {0x2d13, 0x10b3},   {0x2d14, 0x10b4},   {0x2d15, 0x10b5},
+    {0x2d16, 0x10b6},   {0x2d17, 0x10b7},   {0x2d18, 0x10b8},
+    {0x2d19, 0x10b9},   {0x2d1a, 0x10ba},   {0x2d1b, 0x10bb},
+    {0x2d1c, 0x10bc},   {0x2d1d, 0x10bd},   {0x2d1e, 0x10be},
+    {0x2d1f, 0x10bf},   {0x2d20, 0x10c0},   {0x2d21, 0x10c1},
+    {0x2d22, 0x10c2},   {0x2d23, 0x10c3},   {0x2d24, 0x10c4},
+    {0x2d25, 0x10c5},   {0x2d27, 0x10c7},   {0x2d2d, 0x10cd},
+    {0xa641, 0xa640},   {0xa643, 0xa642},   {0xa645, 0xa644},
+    {0xa647, 0xa646},   {0xa649, 0xa648},   {0xa64b, 0xa64a},
+    {0xa64d, 0xa64c},   {0xa64f, 0xa64e},   {0xa651, 0xa650},
+    {0xa653, 0xa652},   {0xa655, 0xa654},   {0xa657, 0xa656},
+    {0xa659, 0xa658},   {0xa65b, 0xa65a},   {0xa65d, 0xa65c},
+    {0xa65f, 0xa65e},   {0xa661, 0xa660},   {0xa663, 0xa662},
+    {0xa665, 0xa664},   {0xa667, 0xa666},   {0xa669, 0xa668},
+    {0xa66b, 0xa66a},   {0xa66d, 0xa66c},   {0xa681, 0xa680},
+    {0xa683, 0xa682},   {0xa685, 0xa684},   {0xa687, 0xa686},
+    {0xa689, 0xa688},   {0xa68b, 0xa68a},   {0xa68d, 0xa68c},
+    {0xa68f, 0xa68e},   {0xa691, 0xa690},   {0xa693, 0xa692},
+    {0xa695, 0xa694},   {0xa697, 0xa696},   {0xa699, 0xa698},
+    {0xa69b, 0xa69a},   {0xa723, 0xa722},   {0xa725, 0xa724},
+    {0xa727, 0xa726},   {0xa729, 0xa728},   {0xa72b, 0xa72a},
+    {0xa72d, 0xa72c},   {0xa72f, 0xa72e},   {0xa733, 0xa732},
+    {0xa735, 0xa734},   {0xa737, 0xa736},   {0xa739, 0xa738},
+    {0xa73b, 0xa73a},   {0xa73d, 0xa73c},   {0xa73f, 0xa73e},
+    {0xa741, 0xa740},   {0xa743, 0xa742},   {0xa745, 0xa744},
+    {0xa747, 0xa746},   {0xa749, 0xa748},   {0xa74b, 0xa74a},
+    {0xa74d, 0xa74c},   {0xa74f, 0xa74e},   {0xa751, 0xa750},
+    {0xa753, 0xa752},   {0xa755, 0xa754},   {0xa757, 0xa756},
+    {0xa759, 0xa758},   {0xa75b, 0xa75a},   {0xa75d, 0xa75c},
+    {0xa75f, 0xa75e},   {0xa761, 0xa760},   {0xa763, 0xa762},
+    {0xa765, 0xa764},   {0xa767, 0xa766},   {0xa769, 0xa768},
+    {0xa76b, 0xa76a},   {0xa76d, 0xa76c},   {0xa76f, 0xa76e},
+    {0xa77a, 0xa779},   {0xa77c, 0xa77b},   {0xa77f, 0xa77e},
+    {0xa781, 0xa780},   {0xa783, 0xa782},   {0xa785, 0xa784},
+    {0xa787, 0xa786},   {0xa78c, 0xa78b},   {0xa791, 0xa790},
+    {0xa793, 0xa792},   {0xa794, 0xa7c4},   {0xa797, 0xa796},
+    {0xa799, 0xa798},   {0xa79b, 0xa79a},   {0xa79d, 0xa79c},
+    {0xa79f, 0xa79e},   {0xa7a1, 0xa7a0},   {0xa7a3, 0xa7a2},
+    {0xa7a5, 0xa7a4},   {0xa7a7, 0xa7a6},   {0xa7a9, 0xa7a8},
+    {0xa7b5, 0xa7b4},   {0xa7b7, 0xa7b6},   {0xa7b9, 0xa7b8},
+    {0xa7bb, 0xa7ba},   {0xa7bd, 0xa7bc},   {0xa7bf, 0xa7be},
+    {0xa7c3, 0xa7c2},   {0xa7c8, 0xa7c7},   {0xa7ca, 0xa7c9},
+    {0xa7f6, 0xa7f5},   {0xab53, 0xa7b3},   {0xab70, 0x13a0},
+    {0xab71, 0x13a1},   {0xab72, 0x13a2},   {0xab73, 0x13a3},
+    {0xab74, 0x13a4},   {0xab75, 0x13a5},   {0xab76, 0x13a6},
+    {0xab77, 0x13a7},   {0xab78, 0x13a8},   {0xab79, 0x13a9},
+    {0xab7a, 0x13aa},   {0xab7b, 0x13ab},   {0xab7c, 0x13ac},
+    {0xab7d, 0x13ad},   {0xab7e, 0x13ae},   {0xab7f, 0x13af},
+    {0xab80, 0x13b0},   {0xab81, 0x13b1},   {0xab82, 0x13b2},
+    {0xab83, 0x13b3},   {0xab84, 0x13b4},   {0xab85, 0x13b5},
+    {0xab86, 0x13b6},   {0xab87, 0x13b7},   {0xab88, 0x13b8},
+    {0xab89, 0x13b9},   {0xab8a, 0x13ba},   {0xab8b, 0x13bb},
+    {0xab8c, 0x13bc},   {0xab8d, 0x13bd},   {0xab8e, 0x13be},
+    {0xab8f, 0x13bf},   {0xab90, 0x13c0},   {0xab91, 0x13c1},
+    {0xab92, 0x13c2},   {0xab93, 0x13c3},   {0xab94, 0x13c4},
+    {0xab95, 0x13c5},   {0xab96, 0x13c6},   {0xab97, 0x13c7},
+    {0xab98, 0x13c8},   {0xab99, 0x13c9},   {0xab9a, 0x13ca},
+    {0xab9b, 0x13cb},   {0xab9c, 0x13cc},   {0xab9d, 0x13cd},
+    {0xab9e, 0x13ce},   {0xab9f, 0x13cf},   {0xaba0, 0x13d0},
+    {0xaba1, 0x13d1},   {0xaba2, 0x13d2},   {0xaba3, 0x13d3},
+    {0xaba4, 0x13d4},   {0xaba5, 0x13d5},   {0xaba6, 0x13d6},
+    {0xaba7, 0x13d7},   {0xaba8, 0x13d8},   {0xaba9, 0x13d9},
+    {0xabaa, 0x13da},   {0xabab, 0x13db},   {0xabac, 0x13dc},
+    {0xabad, 0x13dd},   {0xabae, 0x13de},   {0xabaf, 0x13df},
+    {0xabb0, 0x13e0},   {0xabb1, 0x13e1},   {0xabb2, 0x13e2},
+    {0xabb3, 0x13e3},   {0xabb4, 0x13e4},   {0xabb5, 0x13e5},
+    {0xabb6, 0x13e6},   {0xabb7, 0x13e7},   {0xabb8, 0x13e8},
+    {0xabb9, 0x13e9},   {0xabba, 0x13ea},   {0xabbb, 0x13eb},
+    {0xabbc, 0x13ec},   {0xabbd, 0x13ed},   {0xabbe, 0x13ee},
+    {0xabbf, 0x13ef},   {0xff41, 0xff21},   {0xff42, 0xff22},
+    {0xff43, 0xff23},   {0xff44, 0xff24},   {0xff45, 0xff25},
+    {0xff46, 0xff26},   {0xff47, 0xff27},   {0xff48, 0xff28},
+    {0xff49, 0xff29},   {0xff4a, 0xff2a},   {0xff4b, 0xff2b},
+    {0xff4c, 0xff2c},   {0xff4d, 0xff2d},   {0xff4e, 0xff2e},
+    {0xff4f, 0xff2f},   {0xff50, 0xff30},   {0xff51, 0xff31},
+    {0xff52, 0xff32},   {0xff53, 0xff33},   {0xff54, 0xff34},
+    {0xff55, 0xff35},   {0xff56, 0xff36},   {0xff57, 0xff37},
+    {0xff58, 0xff38},   {0xff59, 0xff39},   {0xff5a, 0xff3a},
+    {0x10428, 0x10400}, {0x10429, 0x10401}, {0x1042a, 0x10402},
+    {0x1042b, 0x10403}, {0x1042c, 0x10404}, {0x1042d, 0x10405},
+    {0x1042e, 0x10406}, {0x1042f, 0x10407}, {0x10430, 0x10408},
+    {0x10431, 0x10409}, {0x10432, 0x1040a}, {0x10433, 0x1040b},
+    {0x10434, 0x1040c}, {0x10435, 0x1040d}, {0x10436, 0x1040e},
+    {0x10437, 0x1040f}, {0x10438, 0x10410}, {0x10439, 0x10411},
+    {0x1043a, 0x10412}, {0x1043b, 0x10413}, {0x1043c, 0x10414},
+    {0x1043d, 0x10415}, {0x1043e, 0x10416}, {0x1043f, 0x10417},
+    {0x10440, 0x10418}, {0x10441, 0x10419}, {0x10442, 0x1041a},
+    {0x10443, 0x1041b}, {0x10444, 0x1041c}, {0x10445, 0x1041d},
+    {0x10446, 0x1041e}, {0x10447, 0x1041f}, {0x10448, 0x10420},
+    {0x10449, 0x10421}, {0x1044a, 0x10422}, {0x1044b, 0x10423},
+    {0x1044c, 0x10424}, {0x1044d, 0x10425}, {0x1044e, 0x10426},
+    {0x1044f, 0x10427}, {0x104d8, 0x104b0}, {0x104d9, 0x104b1},
+    {0x104da, 0x104b2}, {0x104db, 0x104b3}, {0x104dc, 0x104b4},
+    {0x104dd, 0x104b5}, {0x104de, 0x104b6}, {0x104df, 0x104b7},
+    {0x104e0, 0x104b8}, {0x104e1, 0x104b9}, {0x104e2, 0x104ba},
+    {0x104e3, 0x104bb}, {0x104e4, 0x104bc}, {0x104e5, 0x104bd},
+    {0x104e6, 0x104be}, {0x104e7, 0x104bf}, {0x104e8, 0x104c0},
+    {0x104e9, 0x104c1}, {0x104ea, 0x104c2}, {0x104eb, 0x104c3},
+    {0x104ec, 0x104c4}, {0x104ed, 0x104c5}, {0x104ee, 0x104c6},
+    {0x104ef, 0x104c7}, {0x104f0, 0x104c8}, {0x104f1, 0x104c9},
+    {0x104f2, 0x104ca}, {0x104f3, 0x104cb}, {0x104f4, 0x104cc},
+    {0x104f5, 0x104cd}, {0x104f6, 0x104ce}, {0x104f7, 0x104cf},
+    {0x104f8, 0x104d0}, {0x104f9, 0x104d1}, {0x104fa, 0x104d2},
+    {0x104fb, 0x104d3}, {0x10cc0, 0x10c80}, {0x10cc1, 0x10c81},
+    {0x10cc2, 0x10c82}, {0x10cc3, 0x10c83}, {0x10cc4, 0x10c84},
+    {0x10cc5, 0x10c85}, {0x10cc6, 0x10c86}, {0x10cc7, 0x10c87},
+    {0x10cc8, 0x10c88}, {0x10cc9, 0x10c89}, {0x10cca, 0x10c8a},
+    {0x10ccb, 0x10c8b}, {0x10ccc, 0x10c8c}, {0x10ccd, 0x10c8d},
+    {0x10cce, 0x10c8e}, {0x10ccf, 0x10c8f}, {0x10cd0, 0x10c90},
+    {0x10cd1, 0x10c91}, {0x10cd2, 0x10c92}, {0x10cd3, 0x10c93},
+    {0x10cd4, 0x10c94}, {0x10cd5, 0x10c95}, {0x10cd6, 0x10c96},
+    {0x10cd7, 0x10c97}, {0x10cd8, 0x10c98}, {0x10cd9, 0x10c99},
+    {0x10cda, 0x10c9a}, {0x10cdb, 0x10c9b}, {0x10cdc, 0x10c9c},
+    {0x10cdd, 0x10c9d}, {0x10cde, 0x10c9e}, {0x10cdf, 0x10c9f},
+    {0x10ce0, 0x10ca0}, {0x10ce1, 0x10ca1}, {0x10ce2, 0x10ca2},
+    {0x10ce3, 0x10ca3}, {0x10ce4, 0x10ca4}, {0x10ce5, 0x10ca5},
+    {0x10ce6, 0x10ca6}, {0x10ce7, 0x10ca7}, {0x10ce8, 0x10ca8},
+    {0x10ce9, 0x10ca9}, {0x10cea, 0x10caa}, {0x10ceb, 0x10cab},
+    {0x10cec, 0x10cac}, {0x10ced, 0x10cad}, {0x10cee, 0x10cae},
+    {0x10cef, 0x10caf}, {0x10cf0, 0x10cb0}, {0x10cf1, 0x10cb1},
+    {0x10cf2, 0x10cb2}, {0x118c0, 0x118a0}, {0x118c1, 0x118a1},
+    {0x118c2, 0x118a2}, {0x118c3, 0x118a3}, {0x118c4, 0x118a4},
+    {0x118c5, 0x118a5}, {0x118c6, 0x118a6}, {0x118c7, 0x118a7},
+    {0x118c8, 0x118a8}, {0x118c9, 0x118a9}, {0x118ca, 0x118aa},
+    {0x118cb, 0x118ab}, {0x118cc, 0x118ac}, {0x118cd, 0x118ad},
+    {0x118ce, 0x118ae}, {0x118cf, 0x118af}, {0x118d0, 0x118b0},
+    {0x118d1, 0x118b1}, {0x118d2, 0x118b2}, {0x118d3, 0x118b3},
+    {0x118d4, 0x118b4}, {0x118d5, 0x118b5}, {0x118d6, 0x118b6},
+    {0x118d7, 0x118b7}, {0x118d8, 0x118b8}, {0x118d9, 0x118b9},
+    {0x118da, 0x118ba}, {0x118db, 0x118bb}, {0x118dc, 0x118bc},
+    {0x118dd, 0x118bd}, {0x118de, 0x118be}, {0x118df, 0x118bf},
+    {0x16e60, 0x16e40}, {0x16e61, 0x16e41}, {0x16e62, 0x16e42},
+    {0x16e63, 0x16e43}, {0x16e64, 0x16e44}, {0x16e65, 0x16e45},
+    {0x16e66, 0x16e46}, {0x16e67, 0x16e47}, {0x16e68, 0x16e48},
+    {0x16e69, 0x16e49}, {0x16e6a, 0x16e4a}, {0x16e6b, 0x16e4b},
+    {0x16e6c, 0x16e4c}, {0x16e6d, 0x16e4d}, {0x16e6e, 0x16e4e},
+    {0x16e6f, 0x16e4f}, {0x16e70, 0x16e50}, {0x16e71, 0x16e51},
+    {0x16e72, 0x16e52}, {0x16e73, 0x16e53}, {0x16e74, 0x16e54},
+    {0x16e75, 0x16e55}, {0x16e76, 0x16e56}, {0x16e77, 0x16e57},
+    {0x16e78, 0x16e58}, {0x16e79, 0x16e59}, {0x16e7a, 0x16e5a},
+    {0x16e7b, 0x16e5b}, {0x16e7c, 0x16e5c}, {0x16e7d, 0x16e5d},
+    {0x16e7e, 0x16e5e}, {0x16e7f, 0x16e5f}, {0x1e922, 0x1e900},
+    {0x1e923, 0x1e901}, {0x1e924, 0x1e902}, {0x1e925, 0x1e903},
+    {0x1e926, 0x1e904}, {0x1e927, 0x1e905}, {0x1e928, 0x1e906},
+    {0x1e929, 0x1e907}, {0x1e92a, 0x1e908}, {0x1e92b, 0x1e909},
+    {0x1e92c, 0x1e90a}, {0x1e92d, 0x1e90b}, {0x1e92e, 0x1e90c},
+    {0x1e92f, 0x1e90d}, {0x1e930, 0x1e90e}, {0x1e931, 0x1e90f},
+    {0x1e932, 0x1e910}, {0x1e933, 0x1e911}, {0x1e934, 0x1e912},
+    {0x1e935, 0x1e913}, {0x1e936, 0x1e914}, {0x1e937, 0x1e915},
+    {0x1e938, 0x1e916}, {0x1e939, 0x1e917}, {0x1e93a, 0x1e918},
+    {0x1e93b, 0x1e919}, {0x1e93c, 0x1e91a}, {0x1e93d, 0x1e91b},
+    {0x1e93e, 0x1e91c}, {0x1e93f, 0x1e91d}, {0x1e940, 0x1e91e},
+    {0x1e941, 0x1e91f}, {0x1e942, 0x1e920}, {0x1e943, 0x1e921},
+};
+
+inline constexpr std::pair<char32_t, char32_t> kLowerTable[] = {
+    {0x41, 0x61},       {0x42, 0x62},       {0x43, 0x63},
+    {0x44, 0x64},       {0x45, 0x65},       {0x46, 0x66},
+    {0x47, 0x67},       {0x48, 0x68},       {0x49, 0x69},
+    {0x4a, 0x6a},       {0x4b, 0x6b},       {0x4c, 0x6c},
+    {0x4d, 0x6d},       {0x4e, 0x6e},       {0x4f, 0x6f},
+    {0x50, 0x70},       {0x51, 0x71},       {0x52, 0x72},
+    {0x53, 0x73},       {0x54, 0x74},       {0x55, 0x75},
+    {0x56, 0x76},       {0x57, 0x77},       {0x58, 0x78},
+    {0x59, 0x79},       {0x5a, 0x7a},       {0xc0, 0xe0},
+    {0xc1, 0xe1},       {0xc2, 0xe2},       {0xc3, 0xe3},
+    {0xc4, 0xe4},       {0xc5, 0xe5},       {0xc6, 0xe6},
+    {0xc7, 0xe7},       {0xc8, 0xe8},       {0xc9, 0xe9},
+    {0xca, 0xea},       {0xcb, 0xeb},       {0xcc, 0xec},
+    {0xcd, 0xed},       {0xce, 0xee},       {0xcf, 0xef},
+    {0xd0, 0xf0},       {0xd1, 0xf1},       {0xd2, 0xf2},
+    {0xd3, 0xf3},       {0xd4, 0xf4},       {0xd5, 0xf5},
+    {0xd6, 0xf6},       {0xd8, 0xf8},       {0xd9, 0xf9},
+    {0xda, 0xfa},       {0xdb, 0xfb},       {0xdc, 0xfc},
+    {0xdd, 0xfd},       {0xde, 0xfe},       {0x100, 0x101},
+    {0x102, 0x103},     {0x104, 0x105},     {0x106, 0x107},
+    {0x108, 0x109},     {0x10a, 0x10b},     {0x10c, 0x10d},
+    {0x10e, 0x10f},     {0x110, 0x111},     {0x112, 0x113},
+    {0x114, 0x115},     {0x116, 0x117},     {0x118, 0x119},
+    {0x11a, 0x11b},     {0x11c, 0x11d},     {0x11e, 0x11f},
+    {0x120, 0x121},     {0x122, 0x123},     {0x124, 0x125},
+    {0x126, 0x127},     {0x128, 0x129},     {0x12a, 0x12b},
+    {0x12c, 0x12d},     {0x12e, 0x12f},     {0x130, 0x69},
+    {0x132, 0x133},     {0x134, 0x135},     {0x136, 0x137},
+    {0x139, 0x13a},     {0x13b, 0x13c},     {0x13d, 0x13e},
+    {0x13f, 0x140},     {0x141, 0x142},     {0x143, 0x144},
+    {0x145, 0x146},     {0x147, 0x148},     {0x14a, 0x14b},
+    {0x14c, 0x14d},     {0x14e, 0x14f},     {0x150, 0x151},
+    {0x152, 0x153},     {0x154, 0x155},     {0x156, 0x157},
+    {0x158, 0x159},     {0x15a, 0x15b},     {0x15c, 0x15d},
+    {0x15e, 0x15f},     {0x160, 0x161},     {0x162, 0x163},
+    {0x164, 0x165},     {0x166, 0x167},     {0x168, 0x169},
+    {0x16a, 0x16b},     {0x16c, 0x16d},     {0x16e, 0x16f},
+    {0x170, 0x171},     {0x172, 0x173},     {0x174, 0x175},
+    {0x176, 0x177},     {0x178, 0xff},      {0x179, 0x17a},
+    {0x17b, 0x17c},     {0x17d, 0x17e},     {0x181, 0x253},
+    {0x182, 0x183},     {0x184, 0x185},     {0x186, 0x254},
+    {0x187, 0x188},     {0x189, 0x256},     {0x18a, 0x257},
+    {0x18b, 0x18c},     {0x18e, 0x1dd},     {0x18f, 0x259},
+    {0x190, 0x25b},     {0x191, 0x192},     {0x193, 0x260},
+    {0x194, 0x263},     {0x196, 0x269},     {0x197, 0x268},
+    {0x198, 0x199},     {0x19c, 0x26f},     {0x19d, 0x272},
+    {0x19f, 0x275},     {0x1a0, 0x1a1},     {0x1a2, 0x1a3},
+    {0x1a4, 0x1a5},     {0x1a6, 0x280},     {0x1a7, 0x1a8},
+    {0x1a9, 0x283},     {0x1ac, 0x1ad},     {0x1ae, 0x288},
+    {0x1af, 0x1b0},     {0x1b1, 0x28a},     {0x1b2, 0x28b},
+    {0x1b3, 0x1b4},     {0x1b5, 0x1b6},     {0x1b7, 0x292},
+    {0x1b8, 0x1b9},     {0x1bc, 0x1bd},     {0x1c4, 0x1c6},
+    {0x1c5, 0x1c6},     {0x1c7, 0x1c9},     {0x1c8, 0x1c9},
+    {0x1ca, 0x1cc},     {0x1cb, 0x1cc},     {0x1cd, 0x1ce},
+    {0x1cf, 0x1d0},     {0x1d1, 0x1d2},     {0x1d3, 0x1d4},
+    {0x1d5, 0x1d6},     {0x1d7, 0x1d8},     {0x1d9, 0x1da},
+    {0x1db, 0x1dc},     {0x1de, 0x1df},     {0x1e0, 0x1e1},
+    {0x1e2, 0x1e3},     {0x1e4, 0x1e5},     {0x1e6, 0x1e7},
+    {0x1e8, 0x1e9},     {0x1ea, 0x1eb},     {0x1ec, 0x1ed},
+    {0x1ee, 0x1ef},     {0x1f1, 0x1f3},     {0x1f2, 0x1f3},
+    {0x1f4, 0x1f5},     {0x1f6, 0x195},     {0x1f7, 0x1bf},
+    {0x1f8, 0x1f9},     {0x1fa, 0x1fb},     {0x1fc, 0x1fd},
+    {0x1fe, 0x1ff},     {0x200, 0x201},     {0x202, 0x203},
+    {0x204, 0x205},     {0x206, 0x207},     {0x208, 0x209},
+    {0x20a, 0x20b},     {0x20c, 0x20d},     {0x20e, 0x20f},
+    {0x210, 0x211},     {0x212, 0x213},     {0x214, 0x215},
+    {0x216, 0x217},     {0x218, 0x219},     {0x21a, 0x21b},
+    {0x21c, 0x21d},     {0x21e, 0x21f},     {0x220, 0x19e},
+    {0x222, 0x223},     {0x224, 0x225},     {0x226, 0x227},
+    {0x228, 0x229},     {0x22a, 0x22b},     {0x22c, 0x22d},
+    {0x22e, 0x22f},     {0x230, 0x231},     {0x232, 0x233},
+    {0x23a, 0x2c65},    {0x23b, 0x23c},     {0x23d, 0x19a},
+    {0x23e, 0x2c66},    {0x241, 0x242},     {0x243, 0x180},
+    {0x244, 0x289},     {0x245, 0x28c},     {0x246, 0x247},
+    {0x248, 0x249},     {0x24a, 0x24b},     {0x24c, 0x24d},
+    {0x24e, 0x24f},     {0x370, 0x371},     {0x372, 0x373},
+    {0x376, 0x377},     {0x37f, 0x3f3},     {0x386, 0x3ac},
+    {0x388, 0x3ad},     {0x389, 0x3ae},     {0x38a, 0x3af},
+    {0x38c, 0x3cc},     {0x38e, 0x3cd},     {0x38f, 0x3ce},
+    {0x391, 0x3b1},     {0x392, 0x3b2},     {0x393, 0x3b3},
+    {0x394, 0x3b4},     {0x395, 0x3b5},     {0x396, 0x3b6},
+    {0x397, 0x3b7},     {0x398, 0x3b8},     {0x399, 0x3b9},
+    {0x39a, 0x3ba},     {0x39b, 0x3bb},     {0x39c, 0x3bc},
+    {0x39d, 0x3bd},     {0x39e, 0x3be},     {0x39f, 0x3bf},
+    {0x3a0, 0x3c0},     {0x3a1, 0x3c1},     {0x3a3, 0x3c3},
+    {0x3a4, 0x3c4},     {0x3a5, 0x3c5},     {0x3a6, 0x3c6},
+    {0x3a7, 0x3c7},     {0x3a8, 0x3c8},     {0x3a9, 0x3c9},
+    {0x3aa, 0x3ca},     {0x3ab, 0x3cb},     {0x3cf, 0x3d7},
+    {0x3d8, 0x3d9},     {0x3da, 0x3db},     {0x3dc, 0x3dd},
+    {0x3de, 0x3df},     {0x3e0, 0x3e1},     {0x3e2, 0x3e3},
+    {0x3e4, 0x3e5},     {0x3e6, 0x3e7},     {0x3e8, 0x3e9},
+    {0x3ea, 0x3eb},     {0x3ec, 0x3ed},     {0x3ee, 0x3ef},
+    {0x3f4, 0x3b8},     {0x3f7, 0x3f8},     {0x3f9, 0x3f2},
+    {0x3fa, 0x3fb},     {0x3fd, 0x37b},     {0x3fe, 0x37c},
+    {0x3ff, 0x37d},     {0x400, 0x450},     {0x401, 0x451},
+    {0x402, 0x452},     {0x403, 0x453},     {0x404, 0x454},
+    {0x405, 0x455},     {0x406, 0x456},     {0x407, 0x457},
+    {0x408, 0x458},     {0x409, 0x459},     {0x40a, 0x45a},
+    {0x40b, 0x45b},     {0x40c, 0x45c},     {0x40d, 0x45d},
+    {0x40e, 0x45e},     {0x40f, 0x45f},     {0x410, 0x430},
+    {0x411, 0x431},     {0x412, 0x432},     {0x413, 0x433},
+    {0x414, 0x434},     {0x415, 0x435},     {0x416, 0x436},
+    {0x417, 0x437},     {0x418, 0x438},     {0x419, 0x439},
+    {0x41a, 0x43a},     {0x41b, 0x43b},     {0x41c, 0x43c},
+    {0x41d, 0x43d},     {0x41e, 0x43e},     {0x41f, 0x43f},
+    {0x420, 0x440},     {0x421, 0x441},     {0x422, 0x442},
+    {0x423, 0x443},     {0x424, 0x444},     {0x425, 0x445},
+    {0x426, 0x446},     {0x427, 0x447},     {0x428, 0x448},
+    {0x429, 0x449},     {0x42a, 0x44a},     {0x42b, 0x44b},
+    {0x42c, 0x44c},     {0x42d, 0x44d},     {0x42e, 0x44e},
+    {0x42f, 0x44f},     {0x460, 0x461},     {0x462, 0x463},
+    {0x464, 0x465},     {0x466, 0x467},     {0x468, 0x469},
+    {0x46a, 0x46b},     {0x46c, 0x46d},     {0x46e, 0x46f},
+    {0x470, 0x471},     {0x472, 0x473},     {0x474, 0x475},
+    {0x476, 0x477},     {0x478, 0x479},     {0x47a, 0x47b},
+    {0x47c, 0x47d},     {0x47e, 0x47f},     {0x480, 0x481},
+    {0x48a, 0x48b},     {0x48c, 0x48d},     {0x48e, 0x48f},
+    {0x490, 0x491},     {0x492, 0x493},     {0x494, 0x495},
+    {0x496, 0x497},     {0x498, 0x499},     {0x49a, 0x49b},
+    {0x49c, 0x49d},     {0x49e, 0x49f},     {0x4a0, 0x4a1},
+    {0x4a2, 0x4a3},     {0x4a4, 0x4a5},     {0x4a6, 0x4a7},
+    {0x4a8, 0x4a9},     {0x4aa, 0x4ab},     {0x4ac, 0x4ad},
+    {0x4ae, 0x4af},     {0x4b0, 0x4b1},     {0x4b2, 0x4b3},
+    {0x4b4, 0x4b5},     {0x4b6, 0x4b7},     {0x4b8, 0x4b9},
+    {0x4ba, 0x4bb},     {0x4bc, 0x4bd},     {0x4be, 0x4bf},
+    {0x4c0, 0x4cf},     {0x4c1, 0x4c2},     {0x4c3, 0x4c4},
+    {0x4c5, 0x4c6},     {0x4c7, 0x4c8},     {0x4c9, 0x4ca},
+    {0x4cb, 0x4cc},     {0x4cd, 0x4ce},     {0x4d0, 0x4d1},
+    {0x4d2, 0x4d3},     {0x4d4, 0x4d5},     {0x4d6, 0x4d7},
+    {0x4d8, 0x4d9},     {0x4da, 0x4db},     {0x4dc, 0x4dd},
+    {0x4de, 0x4df},     {0x4e0, 0x4e1},     {0x4e2, 0x4e3},
+    {0x4e4, 0x4e5},     {0x4e6, 0x4e7},     {0x4e8, 0x4e9},
+    {0x4ea, 0x4eb},     {0x4ec, 0x4ed},     {0x4ee, 0x4ef},
+    {0x4f0, 0x4f1},     {0x4f2, 0x4f3},     {0x4f4, 0x4f5},
+    {0x4f6, 0x4f7},     {0x4f8, 0x4f9},     {0x4fa, 0x4fb},
+    {0x4fc, 0x4fd},     {0x4fe, 0x4ff},     {0x500, 0x501},
+    {0x502, 0x503},     {0x504, 0x505},     {0x506, 0x507},
+    {0x508, 0x509},     {0x50a, 0x50b},     {0x50c, 0x50d},
+    {0x50e, 0x50f},     {0x510, 0x511},     {0x512, 0x513},
+    {0x514, 0x515},     {0x516, 0x517},     {0x518, 0x519},
+    {0x51a, 0x51b},     {0x51c, 0x51d},     {0x51e, 0x51f},
+    {0x520, 0x521},     {0x522, 0x523},     {0x524, 0x525},
+    {0x526, 0x527},     {0x528, 0x529},     {0x52a, 0x52b},
+    {0x52c, 0x52d},     {0x52e, 0x52f},     {0x531, 0x561},
+    {0x532, 0x562},     {0x533, 0x563},     {0x534, 0x564},
+    {0x535, 0x565},     {0x536, 0x566},     {0x537, 0x567},
+    {0x538, 0x568},     {0x539, 0x569},     {0x53a, 0x56a},
+    {0x53b, 0x56b},     {0x53c, 0x56c},     {0x53d, 0x56d},
+    {0x53e, 0x56e},     {0x53f, 0x56f},     {0x540, 0x570},
+    {0x541, 0x571},     {0x542, 0x572},     {0x543, 0x573},
+    {0x544, 0x574},     {0x545, 0x575},     {0x546, 0x576},
+    {0x547, 0x577},     {0x548, 0x578},     {0x549, 0x579},
+    {0x54a, 0x57a},     {0x54b, 0x57b},     {0x54c, 0x57c},
+    {0x54d, 0x57d},     {0x54e, 0x57e},     {0x54f, 0x57f},
+    {0x550, 0x580},     {0x551, 0x581},     {0x552, 0x582},
+    {0x553, 0x583},     {0x554, 0x584},     {0x555, 0x585},
+    {0x556, 0x586},     {0x10a0, 0x2d00},   {0x10a1, 0x2d01},
+    {0x10a2, 0x2d02},   {0x10a3, 0x2d03},   {0x10a4, 0x2d04},
+    {0x10a5, 0x2d05},   {0x10a6, 0x2d06},   {0x10a7, 0x2d07},
+    {0x10a8, 0x2d08},   {0x10a9, 0x2d09},   {0x10aa, 0x2d0a},
+    {0x10ab, 0x2d0b},   {0x10ac, 0x2d0c},   {0x10ad, 0x2d0d},
+    {0x10ae, 0x2d0e},   {0x10af, 0x2d0f},   {0x10b0, 0x2d10},
+    {0x10b1, 0x2d11},   {0x10b2, 0x2d12},   {0x10b3, 0x2d13},
+    {0x10b4, 0x2d14},   {0x10b5, 0x2d15},   {0x10b6, 0x2d16},
+    {0x10b7, 0x2d17},   {0x10b8, 0x2d18},   {0x10b9, 0x2d19},
+    {0x10ba, 0x2d1a},   {0x10bb, 0x2d1b},   {0x10bc, 0x2d1c},
+    {0x10bd, 0x2d1d},   {0x10be, 0x2d1e},   {0x10bf, 0x2d1f},
+    {0x10c0, 0x2d20},   {0x10c1, 0x2d21},   {0x10c2, 0x2d22},
+    {0x10c3, 0x2d23},   {0x10c4, 0x2d24},   {0x10c5, 0x2d25},
+    {0x10c7, 0x2d27},   {0x10cd, 0x2d2d},   {0x13a0, 0xab70},
+    {0x13a1, 0xab71},   {0x13a2, 0xab72},   {0x13a3, 0xab73},
+    {0x13a4, 0xab74},   {0x13a5, 0xab75},   {0x13a6, 0xab76},
+    {0x13a7, 0xab77},   {0x13a8, 0xab78},   {0x13a9, 0xab79},
+    {0x13aa, 0xab7a},   {0x13ab, 0xab7b},   {0x13ac, 0xab7c},
+    {0x13ad, 0xab7d},   {0x13ae, 0xab7e},   {0x13af, 0xab7f},
+    {0x13b0, 0xab80},   {0x13b1, 0xab81},   {0x13b2, 0xab82},
+    {0x13b3, 0xab83},   {0x13b4, 0xab84},   {0x13b5, 0xab85},
+    {0x13b6, 0xab86},   {0x13b7, 0xab87},   {0x13b8, 0xab88},
+    {0x13b9, 0xab89},   {0x13ba, 0xab8a},   {0x13bb, 0xab8b},
+    {0x13bc, 0xab8c},   {0x13bd, 0xab8d},   {0x13be, 0xab8e},
+    {0x13bf, 0xab8f},   {0x13c0, 0xab90},   {0x13c1, 0xab91},
+    {0x13c2, 0xab92},   {0x13c3, 0xab93},   {0x13c4, 0xab94},
+    {0x13c5, 0xab95},   {0x13c6, 0xab96},   {0x13c7, 0xab97},
+    {0x13c8, 0xab98},   {0x13c9, 0xab99},   {0x13ca, 0xab9a},
+    {0x13cb, 0xab9b},   {0x13cc, 0xab9c},   {0x13cd, 0xab9d},
+    {0x13ce, 0xab9e},   {0x13cf, 0xab9f},   {0x13d0, 0xaba0},
+    {0x13d1, 0xaba1},   {0x13d2, 0xaba2},   {0x13d3, 0xaba3},
+    {0x13d4, 0xaba4},   {0x13d5, 0xaba5},   {0x13d6, 0xaba6},
+    {0x13d7, 0xaba7},   {0x13d8, 0xaba8},   {0x13d9, 0xaba9},
+    {0x13da, 0xabaa},   {0x13db, 0xabab},   {0x13dc, 0xabac},
+    {0x13dd, 0xabad},   {0x13de, 0xabae},   {0x13df, 0xabaf},
+    {0x13e0, 0xabb0},   {0x13e1, 0xabb1},   {0x13e2, 0xabb2},
+    {0x13e3, 0xabb3},   {0x13e4, 0xabb4},   {0x13e5, 0xabb5},
+    {0x13e6, 0xabb6},   {0x13e7, 0xabb7},   {0x13e8, 0xabb8},
+    {0x13e9, 0xabb9},   {0x13ea, 0xabba},   {0x13eb, 0xabbb},
+    {0x13ec, 0xabbc},   {0x13ed, 0xabbd},   {0x13ee, 0xabbe},
+    {0x13ef, 0xabbf},   {0x13f0, 0x13f8},   {0x13f1, 0x13f9},
+    {0x13f2, 0x13fa},   {0x13f3, 0x13fb},   {0x13f4, 0x13fc},
+    {0x13f5, 0x13fd},   {0x1c90, 0x10d0},   {0x1c91, 0x10d1},
+    {0x1c92, 0x10d2},   {0x1c93, 0x10d3},   {0x1c94, 0x10d4},
+    {0x1c95, 0x10d5},   {0x1c96, 0x10d6},   {0x1c97, 0x10d7},
+    {0x1c98, 0x10d8},   {0x1c99, 0x10d9},   {0x1c9a, 0x10da},
+    {0x1c9b, 0x10db},   {0x1c9c, 0x10dc},   {0x1c9d, 0x10dd},
+    {0x1c9e, 0x10de},   {0x1c9f, 0x10df},   {0x1ca0, 0x10e0},
+    {0x1ca1, 0x10e1},   {0x1ca2, 0x10e2},   {0x1ca3, 0x10e3},
+    {0x1ca4, 0x10e4},   {0x1ca5, 0x10e5},   {0x1ca6, 0x10e6},
+    {0x1ca7, 0x10e7},   {0x1ca8, 0x10e8},   {0x1ca9, 0x10e9},
+    {0x1caa, 0x10ea},   {0x1cab, 0x10eb},   {0x1cac, 0x10ec},
+    {0x1cad, 0x10ed},   {0x1cae, 0x10ee},   {0x1caf, 0x10ef},
+    {0x1cb0, 0x10f0},   {0x1cb1, 0x10f1},   {0x1cb2, 0x10f2},
+    {0x1cb3, 0x10f3},   {0x1cb4, 0x10f4},   {0x1cb5, 0x10f5},
+    {0x1cb6, 0x10f6},   {0x1cb7, 0x10f7},   {0x1cb8, 0x10f8},
+    {0x1cb9, 0x10f9},   {0x1cba, 0x10fa},   {0x1cbd, 0x10fd},
+    {0x1cbe, 0x10fe},   {0x1cbf, 0x10ff},   {0x1e00, 0x1e01},
+    {0x1e02, 0x1e03},   {0x1e04, 0x1e05},   {0x1e06, 0x1e07},
+    {0x1e08, 0x1e09},   {0x1e0a, 0x1e0b},   {0x1e0c, 0x1e0d},
+    {0x1e0e, 0x1e0f},   {0x1e10, 0x1e11},   {0x1e12, 0x1e13},
+    {0x1e14, 0x1e15},   {0x1e16, 0x1e17},   {0x1e18, 0x1e19},
+    {0x1e1a, 0x1e1b},   {0x1e1c, 0x1e1d},   {0x1e1e, 0x1e1f},
+    {0x1e20, 0x1e21},   {0x1e22, 0x1e23},   {0x1e24, 0x1e25},
+    {0x1e26, 0x1e27},   {0x1e28, 0x1e29},   {0x1e2a, 0x1e2b},
+    {0x1e2c, 0x1e2d},   {0x1e2e, 0x1e2f},   {0x1e30, 0x1e31},
+    {0x1e32, 0x1e33},   {0x1e34, 0x1e35},   {0x1e36, 0x1e37},
+    {0x1e38, 0x1e39},   {0x1e3a, 0x1e3b},   {0x1e3c, 0x1e3d},
+    {0x1e3e, 0x1e3f},   {0x1e40, 0x1e41},   {0x1e42, 0x1e43},
+    {0x1e44, 0x1e45},   {0x1e46, 0x1e47},   {0x1e48, 0x1e49},
+    {0x1e4a, 0x1e4b},   {0x1e4c, 0x1e4d},   {0x1e4e, 0x1e4f},
+    {0x1e50, 0x1e51},   {0x1e52, 0x1e53},   {0x1e54, 0x1e55},
+    {0x1e56, 0x1e57},   {0x1e58, 0x1e59},   {0x1e5a, 0x1e5b},
+    {0x1e5c, 0x1e5d},   {0x1e5e, 0x1e5f},   {0x1e60, 0x1e61},
+    {0x1e62, 0x1e63},   {0x1e64, 0x1e65},   {0x1e66, 0x1e67},
+    {0x1e68, 0x1e69},   {0x1e6a, 0x1e6b},   {0x1e6c, 0x1e6d},
+    {0x1e6e, 0x1e6f},   {0x1e70, 0x1e71},   {0x1e72, 0x1e73},
+    {0x1e74, 0x1e75},   {0x1e76, 0x1e77},   {0x1e78, 0x1e79},
+    {0x1e7a, 0x1e7b},   {0x1e7c, 0x1e7d},   {0x1e7e, 0x1e7f},
+    {0x1e80, 0x1e81},   {0x1e82, 0x1e83},   {0x1e84, 0x1e85},
+    {0x1e86, 0x1e87},   {0x1e88, 0x1e89},   {0x1e8a, 0x1e8b},
+    {0x1e8c, 0x1e8d},   {0x1e8e, 0x1e8f},   {0x1e90, 0x1e91},
+    {0x1e92, 0x1e93},   {0x1e94, 0x1e95},   {0x1e9e, 0xdf},
+    {0x1ea0, 0x1ea1},   {0x1ea2, 0x1ea3},   {0x1ea4, 0x1ea5},
+    {0x1ea6, 0x1ea7},   {0x1ea8, 0x1ea9},   {0x1eaa, 0x1eab},
+    {0x1eac, 0x1ead},   {0x1eae, 0x1eaf},   {0x1eb0, 0x1eb1},
+    {0x1eb2, 0x1eb3},   {0x1eb4, 0x1eb5},   {0x1eb6, 0x1eb7},
+    {0x1eb8, 0x1eb9},   {0x1eba, 0x1ebb},   {0x1ebc, 0x1ebd},
+    {0x1ebe, 0x1ebf},   {0x1ec0, 0x1ec1},   {0x1ec2, 0x1ec3},
+    {0x1ec4, 0x1ec5},   {0x1ec6, 0x1ec7},   {0x1ec8, 0x1ec9},
+    {0x1eca, 0x1ecb},   {0x1ecc, 0x1ecd},   {0x1ece, 0x1ecf},
+    {0x1ed0, 0x1ed1},   {0x1ed2, 0x1ed3},   {0x1ed4, 0x1ed5},
+    {0x1ed6, 0x1ed7},   {0x1ed8, 0x1ed9},   {0x1eda, 0x1edb},
+    {0x1edc, 0x1edd},   {0x1ede, 0x1edf},   {0x1ee0, 0x1ee1},
+    {0x1ee2, 0x1ee3},   {0x1ee4, 0x1ee5},   {0x1ee6, 0x1ee7},
+    {0x1ee8, 0x1ee9},   {0x1eea, 0x1eeb},   {0x1eec, 0x1eed},
+    {0x1eee, 0x1eef},   {0x1ef0, 0x1ef1},   {0x1ef2, 0x1ef3},
+    {0x1ef4, 0x1ef5},   {0x1ef6, 0x1ef7},   {0x1ef8, 0x1ef9},
+    {0x1efa, 0x1efb},   {0x1efc, 0x1efd},   {0x1efe, 0x1eff},
+    {0x1f08, 0x1f00},   {0x1f09, 0x1f01},   {0x1f0a, 0x1f02},
+    {0x1f0b, 0x1f03},   {0x1f0c, 0x1f04},   {0x1f0d, 0x1f05},
+    {0x1f0e, 0x1f06},   {0x1f0f, 0x1f07},   {0x1f18, 0x1f10},
+    {0x1f19, 0x1f11},   {0x1f1a, 0x1f12},   {0x1f1b, 0x1f13},
+    {0x1f1c, 0x1f14},   {0x1f1d, 0x1f15},   {0x1f28, 0x1f20},
+    {0x1f29, 0x1f21},   {0x1f2a, 0x1f22},   {0x1f2b, 0x1f23},
+    {0x1f2c, 0x1f24},   {0x1f2d, 0x1f25},   {0x1f2e, 0x1f26},
+    {0x1f2f, 0x1f27},   {0x1f38, 0x1f30},   {0x1f39, 0x1f31},
+    {0x1f3a, 0x1f32},   {0x1f3b, 0x1f33},   {0x1f3c, 0x1f34},
+    {0x1f3d, 0x1f35},   {0x1f3e, 0x1f36},   {0x1f3f, 0x1f37},
+    {0x1f48, 0x1f40},   {0x1f49, 0x1f41},   {0x1f4a, 0x1f42},
+    {0x1f4b, 0x1f43},   {0x1f4c, 0x1f44},   {0x1f4d, 0x1f45},
+    {0x1f59, 0x1f51},   {0x1f5b, 0x1f53},   {0x1f5d, 0x1f55},
+    {0x1f5f, 0x1f57},   {0x1f68, 0x1f60},   {0x1f69, 0x1f61},
+    {0x1f6a, 0x1f62},   {0x1f6b, 0x1f63},   {0x1f6c, 0x1f64},
+    {0x1f6d, 0x1f65},   {0x1f6e, 0x1f66},   {0x1f6f, 0x1f67},
+    {0x1f88, 0x1f80},   {0x1f89, 0x1f81},   {0x1f8a, 0x1f82},
+    {0x1f8b, 0x1f83},   {0x1f8c, 0x1f84},   {0x1f8d, 0x1f85},
+    {0x1f8e, 0x1f86},   {0x1f8f, 0x1f87},   {0x1f98, 0x1f90},
+    {0x1f99, 0x1f91},   {0x1f9a, 0x1f92},   {0x1f9b, 0x1f93},
+    {0x1f9c, 0x1f94},   {0x1f9d, 0x1f95},   {0x1f9e, 0x1f96},
+    {0x1f9f, 0x1f97},   {0x1fa8, 0x1fa0},   {0x1fa9, 0x1fa1},
+    {0x1faa, 0x1fa2},   {0x1fab, 0x1fa3},   {0x1fac, 0x1fa4},
+    {0x1fad, 0x1fa5},   {0x1fae, 0x1fa6},   {0x1faf, 0x1fa7},
+    {0x1fb8, 0x1fb0},   {0x1fb9, 0x1fb1},   {0x1fba, 0x1f70},
+    {0x1fbb, 0x1f71},   {0x1fbc, 0x1fb3},   {0x1fc8, 0x1f72},
+    {0x1fc9, 0x1f73},   {0x1fca, 0x1f74},   {0x1fcb, 0x1f75},
+    {0x1fcc, 0x1fc3},   {0x1fd8, 0x1fd0},   {0x1fd9, 0x1fd1},
+    {0x1fda, 0x1f76},   {0x1fdb, 0x1f77},   {0x1fe8, 0x1fe0},
+    {0x1fe9, 0x1fe1},   {0x1fea, 0x1f7a},   {0x1feb, 0x1f7b},
+    {0x1fec, 0x1fe5},   {0x1ff8, 0x1f78},   {0x1ff9, 0x1f79},
+    {0x1ffa, 0x1f7c},   {0x1ffb, 0x1f7d},   {0x1ffc, 0x1ff3},
+    {0x2126, 0x3c9},    {0x212a, 0x6b},     {0x212b, 0xe5},
+    {0x2132, 0x214e},   {0x2160, 0x2170},   {0x2161, 0x2171},
+    {0x2162, 0x2172},   {0x2163, 0x2173},   {0x2164, 0x2174},
+    {0x2165, 0x2175},   {0x2166, 0x2176},   {0x2167, 0x2177},
+    {0x2168, 0x2178},   {0x2169, 0x2179},   {0x216a, 0x217a},
+    {0x216b, 0x217b},   {0x216c, 0x217c},   {0x216d, 0x217d},
+    {0x216e, 0x217e},   {0x216f, 0x217f},   {0x2183, 0x2184},
+    {0x24b6, 0x24d0},   {0x24b7, 0x24d1},   {0x24b8, 0x24d2},
+    {0x24b9, 0x24d3},   {0x24ba, 0x24d4},   {0x24bb, 0x24d5},
+    {0x24bc, 0x24d6},   {0x24bd, 0x24d7},   {0x24be, 0x24d8},
+    {0x24bf, 0x24d9},   {0x24c0, 0x24da},   {0x24c1, 0x24db},
+    {0x24c2, 0x24dc},   {0x24c3, 0x24dd},   {0x24c4, 0x24de},
+    {0x24c5, 0x24df},   {0x24c6, 0x24e0},   {0x24c7, 0x24e1},
+    {0x24c8, 0x24e2},   {0x24c9, 0x24e3},   {0x24ca, 0x24e4},
+    {0x24cb, 0x24e5},   {0x24cc, 0x24e6},   {0x24cd, 0x24e7},
+    {0x24ce, 0x24e8},   {0x24cf, 0x24e9},   {0x2c00, 0x2c30},
+    {0x2c01, 0x2c31},   {0x2c02, 0x2c32},   {0x2c03, 0x2c33},
+    {0x2c04, 0x2c34},   {0x2c05, 0x2c35},   {0x2c06, 0x2c36},
+    {0x2c07, 0x2c37},   {0x2c08, 0x2c38},   {0x2c09, 0x2c39},
+    {0x2c0a, 0x2c3a},   {0x2c0b, 0x2c3b},   {0x2c0c, 0x2c3c},
+    {0x2c0d, 0x2c3d},   {0x2c0e, 0x2c3e},   {0x2c0f, 0x2c3f},
+    {0x2c10, 0x2c40},   {0x2c11, 0x2c41},   {0x2c12, 0x2c42},
+    {0x2c13, 0x2c43},   {0x2c14, 0x2c44},   {0x2c15, 0x2c45},
+    {0x2c16, 0x2c46},   {0x2c17, 0x2c47},   {0x2c18, 0x2c48},
+    {0x2c19, 0x2c49},   {0x2c1a, 0x2c4a},   {0x2c1b, 0x2c4b},
+    {0x2c1c, 0x2c4c},   {0x2c1d, 0x2c4d},   {0x2c1e, 0x2c4e},
+    {0x2c1f, 0x2c4f},   {0x2c20, 0x2c50},   {0x2c21, 0x2c51},
+    {0x2c22, 0x2c52},   {0x2c23, 0x2c53},   {0x2c24, 0x2c54},
+    {0x2c25, 0x2c55},   {0x2c26, 0x2c56},   {0x2c27, 0x2c57},
+    {0x2c28, 0x2c58},   {0x2c29, 0x2c59},   {0x2c2a, 0x2c5a},
+    {0x2c2b, 0x2c5b},   {0x2c2c, 0x2c5c},   {0x2c2d, 0x2c5d},
+    {0x2c2e, 0x2c5e},   {0x2c60, 0x2c61},   {0x2c62, 0x26b},
+    {0x2c63, 0x1d7d},   {0x2c64, 0x27d},    {0x2c67, 0x2c68},
+    {0x2c69, 0x2c6a},   {0x2c6b, 0x2c6c},   {0x2c6d, 0x251},
+    {0x2c6e, 0x271},    {0x2c6f, 0x250},    {0x2c70, 0x252},
+    {0x2c72, 0x2c73},   {0x2c75, 0x2c76},   {0x2c7e, 0x23f},
+    {0x2c7f, 0x240},    {0x2c80, 0x2c81},   {0x2c82, 0x2c83},
+    {0x2c84, 0x2c85},   {0x2c86, 0x2c87},   {0x2c88, 0x2c89},
+    {0x2c8a, 0x2c8b},   {0x2c8c, 0x2c8d},   {0x2c8e, 0x2c8f},
+    {0x2c90, 0x2c91},   {0x2c92, 0x2c93},   {0x2c94, 0x2c95},
+    {0x2c96, 0x2c97},   {0x2c98, 0x2c99},   {0x2c9a, 0x2c9b},
+    {0x2c9c, 0x2c9d},   {0x2c9e, 0x2c9f},   {0x2ca0, 0x2ca1},
+    {0x2ca2, 0x2ca3},   {0x2ca4, 0x2ca5},   {0x2ca6, 0x2ca7},
+    {0x2ca8, 0x2ca9},   {0x2caa, 0x2cab},   {0x2cac, 0x2cad},
+    {0x2cae, 0x2caf},   {0x2cb0, 0x2cb1},   {0x2cb2, 0x2cb3},
+    {0x2cb4, 0x2cb5},   {0x2cb6, 0x2cb7},   {0x2cb8, 0x2cb9},
+    {0x2cba, 0x2cbb},   {0x2cbc, 0x2cbd},   {0x2cbe, 0x2cbf},
+    {0x2cc0, 0x2cc1},   {0x2cc2, 0x2cc3},   {0x2cc4, 0x2cc5},
+    {0x2cc6, 0x2cc7},   {0x2cc8, 0x2cc9},   {0x2cca, 0x2ccb},
+    {0x2ccc, 0x2ccd},   {0x2cce, 0x2ccf},   {0x2cd0, 0x2cd1},
+    {0x2cd2, 0x2cd3},   {0x2cd4, 0x2cd5},   {0x2cd6, 0x2cd7},
+    {0x2cd8, 0x2cd9},   {0x2cda, 0x2cdb},   {0x2cdc, 0x2cdd},
+    {0x2cde, 0x2cdf},   {0x2ce0, 0x2ce1},   {0x2ce2, 0x2ce3},
+    {0x2ceb, 0x2cec},   {0x2ced, 0x2cee},   {0x2cf2, 0x2cf3},
+    {0xa640, 0xa641},   {0xa642, 0xa643},   {0xa644, 0xa645},
+    {0xa646, 0xa647},   {0xa648, 0xa649},   {0xa64a, 0xa64b},
+    {0xa64c, 0xa64d},   {0xa64e, 0xa64f},   {0xa650, 0xa651},
+    {0xa652, 0xa653},   {0xa654, 0xa655},   {0xa656, 0xa657},
+    {0xa658, 0xa659},   {0xa65a, 0xa65b},   {0xa65c, 0xa65d},
+    {0xa65e, 0xa65f},   {0xa660, 0xa661},   {0xa662, 0xa663},
+    {0xa664, 0xa665},   {0xa666, 0xa667},   {0xa668, 0xa669},
+    {0xa66a, 0xa66b},   {0xa66c, 0xa66d},   {0xa680, 0xa681},
+    {0xa682, 0xa683},   {0xa684, 0xa685},   {0xa686, 0xa687},
+    {0xa688, 0xa689},   {0xa68a, 0xa68b},   {0xa68c, 0xa68d},
+    {0xa68e, 0xa68f},   {0xa690, 0xa691},   {0xa692, 0xa693},
+    {0xa694, 0xa695},   {0xa696, 0xa697},   {0xa698, 0xa699},
+    {0xa69a, 0xa69b},   {0xa722, 0xa723},   {0xa724, 0xa725},
+    {0xa726, 0xa727},   {0xa728, 0xa729},   {0xa72a, 0xa72b},
+    {0xa72c, 0xa72d},   {0xa72e, 0xa72f},   {0xa732, 0xa733},
+    {0xa734, 0xa735},   {0xa736, 0xa737},   {0xa738, 0xa739},
+    {0xa73a, 0xa73b},   {0xa73c, 0xa73d},   {0xa73e, 0xa73f},
+    {0xa740, 0xa741},   {0xa742, 0xa743},   {0xa744, 0xa745},
+    {0xa746, 0xa747},   {0xa748, 0xa749},   {0xa74a, 0xa74b},
+    {0xa74c, 0xa74d},   {0xa74e, 0xa74f},   {0xa750, 0xa751},
+    {0xa752, 0xa753},   {0xa754, 0xa755},   {0xa756, 0xa757},
+    {0xa758, 0xa759},   {0xa75a, 0xa75b},   {0xa75c, 0xa75d},
+    {0xa75e, 0xa75f},   {0xa760, 0xa761},   {0xa762, 0xa763},
+    {0xa764, 0xa765},   {0xa766, 0xa767},   {0xa768, 0xa769},
+    {0xa76a, 0xa76b},   {0xa76c, 0xa76d},   {0xa76e, 0xa76f},
+    {0xa779, 0xa77a},   {0xa77b, 0xa77c},   {0xa77d, 0x1d79},
+    {0xa77e, 0xa77f},   {0xa780, 0xa781},   {0xa782, 0xa783},
+    {0xa784, 0xa785},   {0xa786, 0xa787},   {0xa78b, 0xa78c},
+    {0xa78d, 0x265},    {0xa790, 0xa791},   {0xa792, 0xa793},
+    {0xa796, 0xa797},   {0xa798, 0xa799},   {0xa79a, 0xa79b},
+    {0xa79c, 0xa79d},   {0xa79e, 0xa79f},   {0xa7a0, 0xa7a1},
+    {0xa7a2, 0xa7a3},   {0xa7a4, 0xa7a5},   {0xa7a6, 0xa7a7},
+    {0xa7a8, 0xa7a9},   {0xa7aa, 0x266},    {0xa7ab, 0x25c},
+    {0xa7ac, 0x261},    {0xa7ad, 0x26c},    {0xa7ae, 0x26a},
+    {0xa7b0, 0x29e},    {0xa7b1, 0x287},    {0xa7b2, 0x29d},
+    {0xa7b3, 0xab53},   {0xa7b4, 0xa7b5},   {0xa7b6, 0xa7b7},
+    {0xa7b8, 0xa7b9},   {0xa7ba, 0xa7bb},   {0xa7bc, 0xa7bd},
+    {0xa7be, 0xa7bf},   {0xa7c2, 0xa7c3},   {0xa7c4, 0xa794},
+    {0xa7c5, 0x282},    {0xa7c6, 0x1d8e},   {0xa7c7, 0xa7c8},
+    {0xa7c9, 0xa7ca},   {0xa7f5, 0xa7f6},   {0xff21, 0xff41},
+    {0xff22, 0xff42},   {0xff23, 0xff43},   {0xff24, 0xff44},
+    {0xff25, 0xff45},   {0xff26, 0xff46},   {0xff27, 0xff47},
+    {0xff28, 0xff48},   {0xff29, 0xff49},   {0xff2a, 0xff4a},
+    {0xff2b, 0xff4b},   {0xff2c, 0xff4c},   {0xff2d, 0xff4d},
+    {0xff2e, 0xff4e},   {0xff2f, 0xff4f},   {0xff30, 0xff50},
+    {0xff31, 0xff51},   {0xff32, 0xff52},   {0xff33, 0xff53},
+    {0xff34, 0xff54},   {0xff35, 0xff55},   {0xff36, 0xff56},
+    {0xff37, 0xff57},   {0xff38, 0xff58},   {0xff39, 0xff59},
+    {0xff3a, 0xff5a},   {0x10400, 0x10428}, {0x10401, 0x10429},
+    {0x10402, 0x1042a}, {0x10403, 0x1042b}, {0x10404, 0x1042c},
+    {0x10405, 0x1042d}, {0x10406, 0x1042e}, {0x10407, 0x1042f},
+    {0x10408, 0x10430}, {0x10409, 0x10431}, {0x1040a, 0x10432},
+    {0x1040b, 0x10433}, {0x1040c, 0x10434}, {0x1040d, 0x10435},
+    {0x1040e, 0x10436}, {0x1040f, 0x10437}, {0x10410, 0x10438},
+    {0x10411, 0x10439}, {0x10412, 0x1043a}, {0x10413, 0x1043b},
+    {0x10414, 0x1043c}, {0x10415, 0x1043d}, {0x10416, 0x1043e},
+    {0x10417, 0x1043f}, {0x10418, 0x10440}, {0x10419, 0x10441},
+    {0x1041a, 0x10442}, {0x1041b, 0x10443}, {0x1041c, 0x10444},
+    {0x1041d, 0x10445}, {0x1041e, 0x10446}, {0x1041f, 0x10447},
+    {0x10420, 0x10448}, {0x10421, 0x10449}, {0x10422, 0x1044a},
+    {0x10423, 0x1044b}, {0x10424, 0x1044c}, {0x10425, 0x1044d},
+    {0x10426, 0x1044e}, {0x10427, 0x1044f}, {0x104b0, 0x104d8},
+    {0x104b1, 0x104d9}, {0x104b2, 0x104da}, {0x104b3, 0x104db},
+    {0x104b4, 0x104dc}, {0x104b5, 0x104dd}, {0x104b6, 0x104de},
+    {0x104b7, 0x104df}, {0x104b8, 0x104e0}, {0x104b9, 0x104e1},
+    {0x104ba, 0x104e2}, {0x104bb, 0x104e3}, {0x104bc, 0x104e4},
+    {0x104bd, 0x104e5}, {0x104be, 0x104e6}, {0x104bf, 0x104e7},
+    {0x104c0, 0x104e8}, {0x104c1, 0x104e9}, {0x104c2, 0x104ea},
+    {0x104c3, 0x104eb}, {0x104c4, 0x104ec}, {0x104c5, 0x104ed},
+    {0x104c6, 0x104ee}, {0x104c7, 0x104ef}, {0x104c8, 0x104f0},
+    {0x104c9, 0x104f1}, {0x104ca, 0x104f2}, {0x104cb, 0x104f3},
+    {0x104cc, 0x104f4}, {0x104cd, 0x104f5}, {0x104ce, 0x104f6},
+    {0x104cf, 0x104f7}, {0x104d0, 0x104f8}, {0x104d1, 0x104f9},
+    {0x104d2, 0x104fa}, {0x104d3, 0x104fb}, {0x10c80, 0x10cc0},
+    {0x10c81, 0x10cc1}, {0x10c82, 0x10cc2}, {0x10c83, 0x10cc3},
+    {0x10c84, 0x10cc4}, {0x10c85, 0x10cc5}, {0x10c86, 0x10cc6},
+    {0x10c87, 0x10cc7}, {0x10c88, 0x10cc8}, {0x10c89, 0x10cc9},
+    {0x10c8a, 0x10cca}, {0x10c8b, 0x10ccb}, {0x10c8c, 0x10ccc},
+    {0x10c8d, 0x10ccd}, {0x10c8e, 0x10cce}, {0x10c8f, 0x10ccf},
+    {0x10c90, 0x10cd0}, {0x10c91, 0x10cd1}, {0x10c92, 0x10cd2},
+    {0x10c93, 0x10cd3}, {0x10c94, 0x10cd4}, {0x10c95, 0x10cd5},
+    {0x10c96, 0x10cd6}, {0x10c97, 0x10cd7}, {0x10c98, 0x10cd8},
+    {0x10c99, 0x10cd9}, {0x10c9a, 0x10cda}, {0x10c9b, 0x10cdb},
+    {0x10c9c, 0x10cdc}, {0x10c9d, 0x10cdd}, {0x10c9e, 0x10cde},
+    {0x10c9f, 0x10cdf}, {0x10ca0, 0x10ce0}, {0x10ca1, 0x10ce1},
+    {0x10ca2, 0x10ce2}, {0x10ca3, 0x10ce3}, {0x10ca4, 0x10ce4},
+    {0x10ca5, 0x10ce5}, {0x10ca6, 0x10ce6}, {0x10ca7, 0x10ce7},
+    {0x10ca8, 0x10ce8}, {0x10ca9, 0x10ce9}, {0x10caa, 0x10cea},
+    {0x10cab, 0x10ceb}, {0x10cac, 0x10cec}, {0x10cad, 0x10ced},
+    {0x10cae, 0x10cee}, {0x10caf, 0x10cef}, {0x10cb0, 0x10cf0},
+    {0x10cb1, 0x10cf1}, {0x10cb2, 0x10cf2}, {0x118a0, 0x118c0},
+    {0x118a1, 0x118c1}, {0x118a2, 0x118c2}, {0x118a3, 0x118c3},
+    {0x118a4, 0x118c4}, {0x118a5, 0x118c5}, {0x118a6, 0x118c6},
+    {0x118a7, 0x118c7}, {0x118a8, 0x118c8}, {0x118a9, 0x118c9},
+    {0x118aa, 0x118ca}, {0x118ab, 0x118cb}, {0x118ac, 0x118cc},
+    {0x118ad, 0x118cd}, {0x118ae, 0x118ce}, {0x118af, 0x118cf},
+    {0x118b0, 0x118d0}, {0x118b1, 0x118d1}, {0x118b2, 0x118d2},
+    {0x118b3, 0x118d3}, {0x118b4, 0x118d4}, {0x118b5, 0x118d5},
+    {0x118b6, 0x118d6}, {0x118b7, 0x118d7}, {0x118b8, 0x118d8},
+    {0x118b9, 0x118d9}, {0x118ba, 0x118da}, {0x118bb, 0x118db},
+    {0x118bc, 0x118dc}, {0x118bd, 0x118dd}, {0x118be, 0x118de},
+    {0x118bf, 0x118df}, {0x16e40, 0x16e60}, {0x16e41, 0x16e61},
+    {0x16e42, 0x16e62}, {0x16e43, 0x16e63}, {0x16e44, 0x16e64},
+    {0x16e45, 0x16e65}, {0x16e46, 0x16e66}, {0x16e47, 0x16e67},
+    {0x16e48, 0x16e68}, {0x16e49, 0x16e69}, {0x16e4a, 0x16e6a},
+    {0x16e4b, 0x16e6b}, {0x16e4c, 0x16e6c}, {0x16e4d, 0x16e6d},
+    {0x16e4e, 0x16e6e}, {0x16e4f, 0x16e6f}, {0x16e50, 0x16e70},
+    {0x16e51, 0x16e71}, {0x16e52, 0x16e72}, {0x16e53, 0x16e73},
+    {0x16e54, 0x16e74}, {0x16e55, 0x16e75}, {0x16e56, 0x16e76},
+    {0x16e57, 0x16e77}, {0x16e58, 0x16e78}, {0x16e59, 0x16e79},
+    {0x16e5a, 0x16e7a}, {0x16e5b, 0x16e7b}, {0x16e5c, 0x16e7c},
+    {0x16e5d, 0x16e7d}, {0x16e5e, 0x16e7e}, {0x16e5f, 0x16e7f},
+    {0x1e900, 0x1e922}, {0x1e901, 0x1e923}, {0x1e902, 0x1e924},
+    {0x1e903, 0x1e925}, {0x1e904, 0x1e926}, {0x1e905, 0x1e927},
+    {0x1e906, 0x1e928}, {0x1e907, 0x1e929}, {0x1e908, 0x1e92a},
+    {0x1e909, 0x1e92b}, {0x1e90a, 0x1e92c}, {0x1e90b, 0x1e92d},
+    {0x1e90c, 0x1e92e}, {0x1e90d, 0x1e92f}, {0x1e90e, 0x1e930},
+    {0x1e90f, 0x1e931}, {0x1e910, 0x1e932}, {0x1e911, 0x1e933},
+    {0x1e912, 0x1e934}, {0x1e913, 0x1e935}, {0x1e914, 0x1e936},
+    {0x1e915, 0x1e937}, {0x1e916, 0x1e938}, {0x1e917, 0x1e939},
+    {0x1e918, 0x1e93a}, {0x1e919, 0x1e93b}, {0x1e91a, 0x1e93c},
+    {0x1e91b, 0x1e93d}, {0x1e91c, 0x1e93e}, {0x1e91d, 0x1e93f},
+    {0x1e91e, 0x1e940}, {0x1e91f, 0x1e941}, {0x1e920, 0x1e942},
+    {0x1e921, 0x1e943},
+};
+
+// Ranges of characters with the same property, each entry holds the end of a
+// range, exclusive, and the property of the characters in it.
+inline constexpr std::pair<char32_t, GeneralCategory>
+    kGeneralCategoryRanges[] = {
+    {0x20, GeneralCategory::Cc},     {0x21, GeneralCategory::Zs},
+    {0x24, GeneralCategory::Po},     {0x25, GeneralCategory::Sc},
+    {0x28, GeneralCategory::Po},     {0x29, GeneralCategory::Ps},
+    {0x2a, GeneralCategory::Pe},     {0x2b, GeneralCategory::Po},
+    {0x2c, GeneralCategory::Sm},     {0x2d, GeneralCategory::Po},
+    {0x2e, GeneralCategory::Pd},     {0x30, GeneralCategory::Po},
+    {0x3a, GeneralCategory::Nd},     {0x3c, GeneralCategory::Po},
+    {0x3f, GeneralCategory::Sm},     {0x41, GeneralCategory::Po},
+    {0x5b, GeneralCategory::Lu},     {0x5c, GeneralCategory::Ps},
+    {0x5d, GeneralCategory::Po},     {0x5e, GeneralCategory::Pe},
+    {0x5f, GeneralCategory::Sk},     {0x60, GeneralCategory::Pc},
+    {0x61, GeneralCategory::Sk},     {0x7b, GeneralCategory::Ll},
+    {0x7c, GeneralCategory::Ps},     {0x7d, GeneralCategory::Sm},
+    {0x7e, GeneralCategory::Pe},     {0x7f, GeneralCategory::Sm},
+    {0xa0, GeneralCategory::Cc},     {0xa1, GeneralCategory::Zs},
+    {0xa2, GeneralCategory::Po},     {0xa6, GeneralCategory::Sc},
+    {0xa7, GeneralCategory::So},     {0xa8, GeneralCategory::Po},
+    {0xa9, GeneralCategory::Sk},     {0xaa, GeneralCategory::So},
+    {0xab, GeneralCategory::Lo},     {0xac, GeneralCategory::Pi},
+    {0xad, GeneralCategory::Sm},     {0xae, GeneralCategory::Cf},
+    {0xaf, GeneralCategory::So},     {0xb0, GeneralCategory::Sk},
+    {0xb1, GeneralCategory::So},     {0xb2, GeneralCategory::Sm},
+    {0xb4, GeneralCategory::No},     {0xb5, GeneralCategory::Sk},
+    {0xb6, GeneralCategory::Ll},     {0xb8, GeneralCategory::Po},
+    {0xb9, GeneralCategory::Sk},     {0xba, GeneralCategory::No},
+    {0xbb, GeneralCategory::Lo},     {0xbc, GeneralCategory::Pf},
+    {0xbf, GeneralCategory::No},     {0xc0, GeneralCategory::Po},
+    {0xd7, GeneralCategory::Lu},     {0xd8, GeneralCategory::Sm},
+    {0xdf, GeneralCategory::Lu},     {0xf7, GeneralCategory::Ll},
+    {0xf8, GeneralCategory::Sm},     {0x100, GeneralCategory::Ll},
+    {0x101, GeneralCategory::Lu},    {0x102, GeneralCategory::Ll},
+    {0x103, GeneralCategory::Lu},    {0x104, GeneralCategory::Ll},
+    {0x105, GeneralCategory::Lu},    {0x106, GeneralCategory::Ll},
+    {0x107, GeneralCategory::Lu},    {0x108, GeneralCategory::Ll},
+    {0x109, GeneralCategory::Lu},    {0x10a, GeneralCategory::Ll},
+    {0x10b, GeneralCategory::Lu},    {0x10c, GeneralCategory::Ll},
+    {0x10d, GeneralCategory::Lu},    {0x10e, GeneralCategory::Ll},
+    {0x10f, GeneralCategory::Lu},    {0x110, GeneralCategory::Ll},
+    {0x111, GeneralCategory::Lu},    {0x112, GeneralCategory::Ll},
+    {0x113, GeneralCategory::Lu},    {0x114, GeneralCategory::Ll},
+    {0x115, GeneralCategory::Lu},    {0x116, GeneralCategory::Ll},
+    {0x117, GeneralCategory::Lu},    {0x118, GeneralCategory::Ll},
+    {0x119, GeneralCategory::Lu},    {0x11a, GeneralCategory::Ll},
+    {0x11b, GeneralCategory::Lu},    {0x11c, GeneralCategory::Ll},
+    {0x11d, GeneralCategory::Lu},    {0x11e, GeneralCategory::Ll},
+    {0x11f, GeneralCategory::Lu},    {0x120, GeneralCategory::Ll},
+    {0x121, GeneralCategory::Lu},    {0x122, GeneralCategory::Ll},
+    {0x123, GeneralCategory::Lu},    {0x124, GeneralCategory::Ll},
+    {0x125, GeneralCategory::Lu},    {0x126, GeneralCategory::Ll},
+    {0x127, GeneralCategory::Lu},    {0x128, GeneralCategory::Ll},
+    {0x129, GeneralCategory::Lu},    {0x12a, GeneralCategory::Ll},
+    {0x12b, GeneralCategory::Lu},    {0x12c, GeneralCategory::Ll},
+    {0x12d, GeneralCategory::Lu},    {0x12e, GeneralCategory::Ll},
+    {0x12f, GeneralCategory::Lu},    {0x130, GeneralCategory::Ll},
+    {0x131, GeneralCategory::Lu},    {0x132, GeneralCategory::Ll},
+    {0x133, GeneralCategory::Lu},    {0x134, GeneralCategory::Ll},
+    {0x135, GeneralCategory::Lu},    {0x136, GeneralCategory::Ll},
+    {0x137, GeneralCategory::Lu},    {0x139, GeneralCategory::Ll},
+    {0x13a, GeneralCategory::Lu},    {0x13b, GeneralCategory::Ll},
+    {0x13c, GeneralCategory::Lu},    {0x13d, GeneralCategory::Ll},
+    {0x13e, GeneralCategory::Lu},    {0x13f, GeneralCategory::Ll},
+    {0x140, GeneralCategory::Lu},    {0x141, GeneralCategory::Ll},
+    {0x142, GeneralCategory::Lu},    {0x143, GeneralCategory::Ll},
+    {0x144, GeneralCategory::Lu},    {0x145, GeneralCategory::Ll},
+    {0x146, GeneralCategory::Lu},    {0x147, GeneralCategory::Ll},
+    {0x148, GeneralCategory::Lu},    {0x14a, GeneralCategory::Ll},
+    {0x14b, GeneralCategory::Lu},    {0x14c, GeneralCategory::Ll},
+    {0x14d, GeneralCategory::Lu},    {0x14e, GeneralCategory::Ll},
+    {0x14f, GeneralCategory::Lu},    {0x150, GeneralCategory::Ll},
+    {0x151, GeneralCategory::Lu},    {0x152, GeneralCategory::Ll},
+    {0x153, GeneralCategory::Lu},    {0x154, GeneralCategory::Ll},
+    {0x155, GeneralCategory::Lu},    {0x156, GeneralCategory::Ll},
+    {0x157, GeneralCategory::Lu},    {0x158, GeneralCategory::Ll},
+    {0x159, GeneralCategory::Lu},    {0x15a, GeneralCategory::Ll},
+    {0x15b, GeneralCategory::Lu},    {0x15c, GeneralCategory::Ll},
+    {0x15d, GeneralCategory::Lu},    {0x15e, GeneralCategory::Ll},
+    {0x15f, GeneralCategory::Lu},    {0x160, GeneralCategory::Ll},
+    {0x161, GeneralCategory::Lu},    {0x162, GeneralCategory::Ll},
+    {0x163, GeneralCategory::Lu},    {0x164, GeneralCategory::Ll},
+    {0x165, GeneralCategory::Lu},    {0x166, GeneralCategory::Ll},
+    {0x167, GeneralCategory::Lu},    {0x168, GeneralCategory::Ll},
+    {0x169, GeneralCategory::Lu},    {0x16a, GeneralCategory::Ll},
+    {0x16b, GeneralCategory::Lu},    {0x16c, GeneralCategory::Ll},
+    {0x16d, GeneralCategory::Lu},    {0x16e, GeneralCategory::Ll},
+    {0x16f, GeneralCategory::Lu},    {0x170, GeneralCategory::Ll},
+    {0x171, GeneralCategory::Lu},    {0x172, GeneralCategory::Ll},
+    {0x173, GeneralCategory::Lu},    {0x174, GeneralCategory::Ll},
+    {0x175, GeneralCategory::Lu},    {0x176, GeneralCategory::Ll},
+    {0x177, GeneralCategory::Lu},    {0x178, GeneralCategory::Ll},
+    {0x17a, GeneralCategory::Lu},    {0x17b, GeneralCategory::Ll},
+    {0x17c, GeneralCategory::Lu},    {0x17d, GeneralCategory::Ll},
+    {0x17e, GeneralCategory::Lu},    {0x181, GeneralCategory::Ll},
+    {0x183, GeneralCategory::Lu},    {0x184, GeneralCategory::Ll},
+    {0x185, GeneralCategory::Lu},    {0x186, GeneralCategory::Ll},
+    {0x188, GeneralCategory::Lu},    {0x189, GeneralCategory::Ll},
+    {0x18c, GeneralCategory::Lu},    {0x18e, GeneralCategory::Ll},
+    {0x192, GeneralCategory::Lu},    {0x193, GeneralCategory::Ll},
+    {0x195, GeneralCategory::Lu},    {0x196, GeneralCategory::Ll},
+    {0x199, GeneralCategory::Lu},    {0x19c, GeneralCategory::Ll},
+    {0x19e, GeneralCategory::Lu},    {0x19f, GeneralCategory::Ll},
+    {0x1a1, GeneralCategory::Lu},    {0x1a2, GeneralCategory::Ll},
+    {0x1a3, GeneralCategory::Lu},    {0x1a4, GeneralCategory::Ll},
+    {0x1a5, GeneralCategory::Lu},    {0x1a6, GeneralCategory::Ll},
+    {0x1a8, GeneralCategory::Lu},    {0x1a9, GeneralCategory::Ll},
+    {0x1aa, GeneralCategory::Lu},    {0x1ac, GeneralCategory::Ll},
+    {0x1ad, GeneralCategory::Lu},    {0x1ae, GeneralCategory::Ll},
+    {0x1b0, GeneralCategory::Lu},    {0x1b1, GeneralCategory::Ll},
+    {0x1b4, GeneralCategory::Lu},    {0x1b5, GeneralCategory::Ll},
+    {0x1b6, GeneralCategory::Lu},    {0x1b7, GeneralCategory::Ll},
+    {0x1b9, GeneralCategory::Lu},    {0x1bb, GeneralCategory::Ll},
+    {0x1bc, GeneralCategory::Lo},    {0x1bd, GeneralCategory::Lu},
+    {0x1c0, GeneralCategory::Ll},    {0x1c4, GeneralCategory::Lo},
+    {0x1c5, GeneralCategory::Lu},    {0x1c6, GeneralCategory::Lt},
+    {0x1c7, GeneralCategory::Ll},    {0x1c8, GeneralCategory::Lu},
+    {0x1c9, GeneralCategory::Lt},    {0x1ca, GeneralCategory::Ll},
+    {0x1cb, GeneralCategory::Lu},    {0x1cc, GeneralCategory::Lt},
+    {0x1cd, GeneralCategory::Ll},    {0x1ce, GeneralCategory::Lu},
+    {0x1cf, GeneralCategory::Ll},    {0x1d0, GeneralCategory::Lu},
+    {0x1d1, GeneralCategory::Ll},    {0x1d2, GeneralCategory::Lu},
+    {0x1d3, GeneralCategory::Ll},    {0x1d4, GeneralCategory::Lu},
+    {0x1d5, GeneralCategory::Ll},    {0x1d6, GeneralCategory::Lu},
+    {0x1d7, GeneralCategory::Ll},    {0x1d8, GeneralCategory::Lu},
+    {0x1d9, GeneralCategory::Ll},    {0x1da, GeneralCategory::Lu},
+    {0x1db, GeneralCategory::Ll},    {0x1dc, GeneralCategory::Lu},
+    {0x1de, GeneralCategory::Ll},    {0x1df, GeneralCategory::Lu},
+    {0x1e0, GeneralCategory::Ll},    {0x1e1, GeneralCategory::Lu},
+    {0x1e2, GeneralCategory::Ll},    {0x1e3, GeneralCategory::Lu},
+    {0x1e4, GeneralCategory::Ll},    {0x1e5, GeneralCategory::Lu},
+    {0x1e6, GeneralCategory::Ll},    {0x1e7, GeneralCategory::Lu},
+    {0x1e8, GeneralCategory::Ll},    {0x1e9, GeneralCategory::Lu},
+    {0x1ea, GeneralCategory::Ll},    {0x1eb, GeneralCategory::Lu},
+    {0x1ec, GeneralCategory::Ll},    {0x1ed, GeneralCategory::Lu},
+    {0x1ee, GeneralCategory::Ll},    {0x1ef, GeneralCategory::Lu},
+    {0x1f1, GeneralCategory::Ll},    {0x1f2, GeneralCategory::Lu},
+    {0x1f3, GeneralCategory::Lt},    {0x1f4, GeneralCategory::Ll},
+    {0x1f5, GeneralCategory::Lu},    {0x1f6, GeneralCategory::Ll},
+    {0x1f9, GeneralCategory::Lu},    {0x1fa, GeneralCategory::Ll},
+    {0x1fb, GeneralCategory::Lu},    {0x1fc, GeneralCategory::Ll},
+    {0x1fd, GeneralCategory::Lu},    {0x1fe, GeneralCategory::Ll},
+    {0x1ff, GeneralCategory::Lu},    {0x200, GeneralCategory::Ll},
+    {0x201, GeneralCategory::Lu},    {0x202, GeneralCategory::Ll},
+    {0x203, GeneralCategory::Lu},    {0x204, GeneralCategory::Ll},
+    {0x205, GeneralCategory::Lu},    {0x206, GeneralCategory::Ll},
+    {0x207, GeneralCategory::Lu},    {0x208, GeneralCategory::Ll},
+    {0x209, GeneralCategory::Lu},    {0x20a, GeneralCategory::Ll},
+    {0x20b, GeneralCategory::Lu},    {0x20c, GeneralCategory::Ll},
+    {0x20d, GeneralCategory::Lu},    {0x20e, GeneralCategory::Ll},
+    {0x20f, GeneralCategory::Lu},    {0x210, GeneralCategory::Ll},
+    {0x211, GeneralCategory::Lu},    {0x212, GeneralCategory::Ll},
+    {0x213, GeneralCategory::Lu},    {0x214, GeneralCategory::Ll},
+    {0x215, GeneralCategory::Lu},    {0x216, GeneralCategory::Ll},
+    {0x217, GeneralCategory::Lu},    {0x218, GeneralCategory::Ll},
+    {0x219, GeneralCategory::Lu},    {0x21a, GeneralCategory::Ll},
+    {0x21b, GeneralCategory::Lu},    {0x21c, GeneralCategory::Ll},
+    {0x21d, GeneralCategory::Lu},    {0x21e, GeneralCategory::Ll},
+    {0x21f, GeneralCategory::Lu},    {0x220, GeneralCategory::Ll},
+    {0x221, GeneralCategory::Lu},    {0x222, GeneralCategory::Ll},
+    {0x223, GeneralCategory::Lu},    {0x224, GeneralCategory::Ll},
+    {0x225, GeneralCategory::Lu},    {0x226, GeneralCategory::Ll},
+    {0x227, GeneralCategory::Lu},    {0x228, GeneralCategory::Ll},
+    {0x229, GeneralCategory::Lu},    {0x22a, GeneralCategory::Ll},
+    {0x22b, GeneralCategory::Lu},    {0x22c, GeneralCategory::Ll},
+    {0x22d, GeneralCategory::Lu},    {0x22e, GeneralCategory::Ll},
+    {0x22f, GeneralCategory::Lu},    {0x230, GeneralCategory::Ll},
+    {0x231, GeneralCategory::Lu},    {0x232, GeneralCategory::Ll},
+    {0x233, GeneralCategory::Lu},    {0x23a, GeneralCategory::Ll},
+    {0x23c, GeneralCategory::Lu},    {0x23d, GeneralCategory::Ll},
+    {0x23f, GeneralCategory::Lu},    {0x241, GeneralCategory::Ll},
+    {0x242, GeneralCategory::Lu},    {0x243, GeneralCategory::Ll},
+    {0x247, GeneralCategory::Lu},    {0x248, GeneralCategory::Ll},
+    {0x249, GeneralCategory::Lu},    {0x24a, GeneralCategory::Ll},
+    {0x24b, GeneralCategory::Lu},    {0x24c, GeneralCategory::Ll},
+    {0x24d, GeneralCategory::Lu},    {0x24e, GeneralCategory::Ll},
+    {0x24f, GeneralCategory::Lu},    {0x294, GeneralCategory::Ll},
+    {0x295, GeneralCategory::Lo},    {0x2b0, GeneralCategory::Ll},
+    {0x2c2, GeneralCategory::Lm},    {0x2c6, GeneralCategory::Sk},
+    {0x2d2, GeneralCategory::Lm},    {0x2e0, GeneralCategory::Sk},
+    {0x2e5, GeneralCategory::Lm},    {0x2ec, GeneralCategory::Sk},
+    {0x2ed, GeneralCategory::Lm},    {0x2ee, GeneralCategory::Sk},
+    {0x2ef, GeneralCategory::Lm},    {0x300, GeneralCategory::Sk},
+    {0x370, GeneralCategory::Mn},    {0x371, GeneralCategory::Lu},
+    {0x372, GeneralCategory::Ll},    {0x373, GeneralCategory::Lu},
+    {0x374, GeneralCategory::Ll},    {0x375, GeneralCategory::Lm},
+    {0x376, GeneralCategory::Sk},    {0x377, GeneralCategory::Lu},
+    {0x378, GeneralCategory::Ll},    {0x37a, GeneralCategory::Cn},
+    {0x37b, GeneralCategory::Lm},    {0x37e, GeneralCategory::Ll},
+    {0x37f, GeneralCategory::Po},    {0x380, GeneralCategory::Lu},
+    {0x384, GeneralCategory::Cn},    {0x386, GeneralCategory::Sk},
+    {0x387, GeneralCategory::Lu},    {0x388, GeneralCategory::Po},
+    {0x38b, GeneralCategory::Lu},    {0x38c, GeneralCategory::Cn},
+    {0x38d, GeneralCategory::Lu},    {0x38e, GeneralCategory::Cn},
+    {0x390, GeneralCategory::Lu},    {0x391, GeneralCategory::Ll},
+    {0x3a2, GeneralCategory::Lu},    {0x3a3, GeneralCategory::Cn},
+    {0x3ac, GeneralCategory::Lu},    {0x3cf, GeneralCategory::Ll},
+    {0x3d0, GeneralCategory::Lu},    {0x3d2, GeneralCategory::Ll},
+    {0x3d5, GeneralCategory::Lu},    {0x3d8, GeneralCategory::Ll},
+    {0x3d9, GeneralCategory::Lu},    {0x3da, GeneralCategory::Ll},
+    {0x3db, GeneralCategory::Lu},    {0x3dc, GeneralCategory::Ll},
+    {0x3dd, GeneralCategory::Lu},    {0x3de, GeneralCategory::Ll},
+    {0x3df, GeneralCategory::Lu},    {0x3e0, GeneralCategory::Ll},
+    {0x3e1, GeneralCategory::Lu},    {0x3e2, GeneralCategory::Ll},
+    {0x3e3, GeneralCategory::Lu},    {0x3e4, GeneralCategory::Ll},
+    {0x3e5, GeneralCategory::Lu},    {0x3e6, GeneralCategory::Ll},
+    {0x3e7, GeneralCategory::Lu},    {0x3e8, GeneralCategory::Ll},
+    {0x3e9, GeneralCategory::Lu},    {0x3ea, GeneralCategory::Ll},
+    {0x3eb, GeneralCategory::Lu},    {0x3ec, GeneralCategory::Ll},
+    {0x3ed, GeneralCategory::Lu},    {0x3ee, GeneralCategory::Ll},
+    {0x3ef, GeneralCategory::Lu},    {0x3f4, GeneralCategory::Ll},
+    {0x3f5, GeneralCategory::Lu},    {0x3f6, GeneralCategory::Ll},
+    {0x3f7, GeneralCategory::Sm},    {0x3f8, GeneralCategory::Lu},
+    {0x3f9, GeneralCategory::Ll},    {0x3fb, GeneralCategory::Lu},
+    {0x3fd, GeneralCategory::Ll},    {0x430, GeneralCategory::Lu},
+    {0x460, GeneralCategory::Ll},    {0x461, GeneralCategory::Lu},
+    {0x462, GeneralCategory::Ll},    {0x463, GeneralCategory::Lu},
+    {0x464, GeneralCategory::Ll},    {0x465, GeneralCategory::Lu},
+    {0x466, GeneralCategory::Ll},    {0x467, GeneralCategory::Lu},
+    {0x468, GeneralCategory::Ll},    {0x469, GeneralCategory::Lu},
+    {0x46a, GeneralCategory::Ll},    {0x46b, GeneralCategory::Lu},
+    {0x46c, GeneralCategory::Ll},    {0x46d, GeneralCategory::Lu},
+    {0x46e, GeneralCategory::Ll},    {0x46f, GeneralCategory::Lu},
+    {0x470, GeneralCategory::Ll},    {0x471, GeneralCategory::Lu},
+    {0x472, GeneralCategory::Ll},    {0x473, GeneralCategory::Lu},
+    {0x474, GeneralCategory::Ll},    {0x475, GeneralCategory::Lu},
+    {0x476, GeneralCategory::Ll},    {0x477, GeneralCategory::Lu},
+    {0x478, GeneralCategory::Ll},    {0x479, GeneralCategory::Lu},
+    {0x47a, GeneralCategory::Ll},    {0x47b, GeneralCategory::Lu},
+    {0x47c, GeneralCategory::Ll},    {0x47d, GeneralCategory::Lu},
+    {0x47e, GeneralCategory::Ll},    {0x47f, GeneralCategory::Lu},
+    {0x480, GeneralCategory::Ll},    {0x481, GeneralCategory::Lu},
+    {0x482, GeneralCategory::Ll},    {0x483, GeneralCategory::So},
+    {0x488, GeneralCategory::Mn},    {0x48a, GeneralCategory::Me},
+    {0x48b, GeneralCategory::Lu},    {0x48c, GeneralCategory::Ll},
+    {0x48d, GeneralCategory::Lu},    {0x48e, GeneralCategory::Ll},
+    {0x48f, GeneralCategory::Lu},    {0x490, GeneralCategory::Ll},
+    {0x491, GeneralCategory::Lu},    {0x492, GeneralCategory::Ll},
+    {0x493, GeneralCategory::Lu},    {0x494, GeneralCategory::Ll},
+    {0x495, GeneralCategory::Lu},    {0x496, GeneralCategory::Ll},
+    {0x497, GeneralCategory::Lu},    {0x498, GeneralCategory::Ll},
+    {0x499, GeneralCategory::Lu},    {0x49a, GeneralCategory::Ll},
+    {0x49b, GeneralCategory::Lu},    {0x49c, GeneralCategory::Ll},
+    {0x49d, GeneralCategory::Lu},    {0x49e, GeneralCategory::Ll},
+    {0x49f, GeneralCategory::Lu},    {0x4a0, GeneralCategory::Ll},
+    {0x4a1, GeneralCategory::Lu},    {0x4a2, GeneralCategory::Ll},
+    {0x4a3, GeneralCategory::Lu},    {0x4a4, GeneralCategory::Ll},
+    {0x4a5, GeneralCategory::Lu},    {0x4a6, GeneralCategory::Ll},
+    {0x4a7, GeneralCategory::Lu},    {0x4a8, GeneralCategory::Ll},
+    {0x4a9, GeneralCategory::Lu},    {0x4aa, GeneralCategory::Ll},
+    {0x4ab, GeneralCategory::Lu},    {0x4ac, GeneralCategory::Ll},
+    {0x4ad, GeneralCategory::Lu},    {0x4ae, GeneralCategory::Ll},
+    {0x4af, GeneralCategory::Lu},    {0x4b0, GeneralCategory::Ll},
+    {0x4b1, GeneralCategory::Lu},    {0x4b2, GeneralCategory::Ll},
+    {0x4b3, GeneralCategory::Lu},    {0x4b4, GeneralCategory::Ll},
+    {0x4b5, GeneralCategory::Lu},    {0x4b6, GeneralCategory::Ll},
+    {0x4b7, GeneralCategory::Lu},    {0x4b8, GeneralCategory::Ll},
+    {0x4b9, GeneralCategory::Lu},    {0x4ba, GeneralCategory::Ll},
+    {0x4bb, GeneralCategory::Lu},    {0x4bc, GeneralCategory::Ll},
+    {0x4bd, GeneralCategory::Lu},    {0x4be, GeneralCategory::Ll},
+    {0x4bf, GeneralCategory::Lu},    {0x4c0, GeneralCategory::Ll},
+    {0x4c2, GeneralCategory::Lu},    {0x4c3, GeneralCategory::Ll},
+    {0x4c4, GeneralCategory::Lu},    {0x4c5, GeneralCategory::Ll},
+    {0x4c6, GeneralCategory::Lu},    {0x4c7, GeneralCategory::Ll},
+    {0x4c8, GeneralCategory::Lu},    {0x4c9, GeneralCategory::Ll},
+    {0x4ca, GeneralCategory::Lu},    {0x4cb, GeneralCategory::Ll},
+    {0x4cc, GeneralCategory::Lu},    {0x4cd, GeneralCategory::Ll},
+    {0x4ce, GeneralCategory::Lu},    {0x4d0, GeneralCategory::Ll},
+    {0x4d1, GeneralCategory::Lu},    {0x4d2, GeneralCategory::Ll},
+    {0x4d3, GeneralCategory::Lu},    {0x4d4, GeneralCategory::Ll},
+    {0x4d5, GeneralCategory::Lu},    {0x4d6, GeneralCategory::Ll},
+    {0x4d7, GeneralCategory::Lu},    {0x4d8, GeneralCategory::Ll},
+    {0x4d9, GeneralCategory::Lu},    {0x4da, GeneralCategory::Ll},
+    {0x4db, GeneralCategory::Lu},    {0x4dc, GeneralCategory::Ll},
+    {0x4dd, GeneralCategory::Lu},    {0x4de, GeneralCategory::Ll},
+    {0x4df, GeneralCategory::Lu},    {0x4e0, GeneralCategory::Ll},
+    {0x4e1, GeneralCategory::Lu},    {0x4e2, GeneralCategory::Ll},
+    {0x4e3, GeneralCategory::Lu},    {0x4e4, GeneralCategory::Ll},
+    {0x4e5, GeneralCategory::Lu},    {0x4e6, GeneralCategory::Ll},
+    {0x4e7, GeneralCategory::Lu},    {0x4e8, GeneralCategory::Ll},
+    {0x4e9, GeneralCategory::Lu},    {0x4ea, GeneralCategory::Ll},
+    {0x4eb, GeneralCategory::Lu},    {0x4ec, GeneralCategory::Ll},
+    {0x4ed, GeneralCategory::Lu},    {0x4ee, GeneralCategory::Ll},
+    {0x4ef, GeneralCategory::Lu},    {0x4f0, GeneralCategory::Ll},
+    {0x4f1, GeneralCategory::Lu},    {0x4f2, GeneralCategory::Ll},
+    {0x4f3, GeneralCategory::Lu},    {0x4f4, GeneralCategory::Ll},
+    {0x4f5, GeneralCategory::Lu},    {0x4f6, GeneralCategory::Ll},
+    {0x4f7, GeneralCategory::Lu},    {0x4f8, GeneralCategory::Ll},
+    {0x4f9, GeneralCategory::Lu},    {0x4fa, GeneralCategory::Ll},
+    {0x4fb, GeneralCategory::Lu},    {0x4fc, GeneralCategory::Ll},
+    {0x4fd, GeneralCategory::Lu},    {0x4fe, GeneralCategory::Ll},
+    {0x4ff, GeneralCategory::Lu},    {0x500, GeneralCategory::Ll},
+    {0x501, GeneralCategory::Lu},    {0x502, GeneralCategory::Ll},
+    {0x503, GeneralCategory::Lu},    {0x504, GeneralCategory::Ll},
+    {0x505, GeneralCategory::Lu},    {0x506, GeneralCategory::Ll},
+    {0x507, GeneralCategory::Lu},    {0x508, GeneralCategory::Ll},
+    {0x509, GeneralCategory::Lu},    {0x50a, GeneralCategory::Ll},
+    {0x50b, GeneralCategory::Lu},    {0x50c, GeneralCategory::Ll},
+    {0x50d, GeneralCategory::Lu},    {0x50e, GeneralCategory::Ll},
+    {0x50f, GeneralCategory::Lu},    {0x510, GeneralCategory::Ll},
+    {0x511, GeneralCategory::Lu},    {0x512, GeneralCategory::Ll},
+    {0x513, GeneralCategory::Lu},    {0x514, GeneralCategory::Ll},
+    {0x515, GeneralCategory::Lu},    {0x516, GeneralCategory::Ll},
+    {0x517, GeneralCategory::Lu},    {0x518, GeneralCategory::Ll},
+    {0x519, GeneralCategory::Lu},    {0x51a, GeneralCategory::Ll},
+    {0x51b, GeneralCategory::Lu},    {0x51c, GeneralCategory::Ll},
+    {0x51d, GeneralCategory::Lu},    {0x51e, GeneralCategory::Ll},
+    {0x51f, GeneralCategory::Lu},    {0x520, GeneralCategory::Ll},
+    {0x521, GeneralCategory::Lu},    {0x522, GeneralCategory::Ll},
+    {0x523, GeneralCategory::Lu},    {0x524, GeneralCategory::Ll},
+    {0x525, GeneralCategory::Lu},    {0x526, GeneralCategory::Ll},
+    {0x527, GeneralCategory::Lu},    {0x528, GeneralCategory::Ll},
+    {0x529, GeneralCategory::Lu},    {0x52a, GeneralCategory::Ll},
+    {0x52b, GeneralCategory::Lu},    {0x52c, GeneralCategory::Ll},
+    {0x52d, GeneralCategory::Lu},    {0x52e, GeneralCategory::Ll},
+    {0x52f, GeneralCategory::Lu},    {0x530, GeneralCategory::Ll},
+    {0x531, GeneralCategory::Cn},    {0x557, GeneralCategory::Lu},
+    {0x559, GeneralCategory::Cn},    {0x55a, GeneralCategory::Lm},
+    {0x560, GeneralCategory::Po},    {0x589, GeneralCategory::Ll},
+    {0x58a, GeneralCategory::Po},    {0x58b, GeneralCategory::Pd},
+    {0x58d, GeneralCategory::Cn},    {0x58f, GeneralCategory::So},
+    {0x590, GeneralCategory::Sc},    {0x591, GeneralCategory::Cn},
+    {0x5be, GeneralCategory::Mn},    {0x5bf, GeneralCategory::Pd},
+    {0x5c0, GeneralCategory::Mn},    {0x5c1, GeneralCategory::Po},
+    {0x5c3, GeneralCategory::Mn},    {0x5c4, GeneralCategory::Po},
+    {0x5c6, GeneralCategory::Mn},    {0x5c7, GeneralCategory::Po},
+    {0x5c8, GeneralCategory::Mn},    {0x5d0, GeneralCategory::Cn},
+    {0x5eb, GeneralCategory::Lo},    {0x5ef, GeneralCategory::Cn},
+    {0x5f3, GeneralCategory::Lo},    {0x5f5, GeneralCategory::Po},
+    {0x600, GeneralCategory::Cn},    {0x606, GeneralCategory::Cf},
+    {0x609, GeneralCategory::Sm},    {0x60b, GeneralCategory::Po},
+    {0x60c, GeneralCategory::Sc},    {0x60e, GeneralCategory::Po},
+    {0x610, GeneralCategory::So},    {0x61b, GeneralCategory::Mn},
+    {0x61c, GeneralCategory::Po},    {0x61d, GeneralCategory::Cf},
+    {0x61e, GeneralCategory::Cn},    {0x620, GeneralCategory::Po},
+    {0x640, GeneralCategory::Lo},    {0x641, GeneralCategory::Lm},
+    {0x64b, GeneralCategory::Lo},    {0x660, GeneralCategory::Mn},
+    {0x66a, GeneralCategory::Nd},    {0x66e, GeneralCategory::Po},
+    {0x670, GeneralCategory::Lo},    {0x671, GeneralCategory::Mn},
+    {0x6d4, GeneralCategory::Lo},    {0x6d5, GeneralCategory::Po},
+    {0x6d6, GeneralCategory::Lo},    {0x6dd, GeneralCategory::Mn},
+    {0x6de, GeneralCategory::Cf},    {0x6df, GeneralCategory::So},
+    {0x6e5, GeneralCategory::Mn},    {0x6e7, GeneralCategory::Lm},
+    {0x6e9, GeneralCategory::Mn},    {0x6ea, GeneralCategory::So},
+    {0x6ee, GeneralCategory::Mn},    {0x6f0, GeneralCategory::Lo},
+    {0x6fa, GeneralCategory::Nd},    {0x6fd, GeneralCategory::Lo},
+    {0x6ff, GeneralCategory::So},    {0x700, GeneralCategory::Lo},
+    {0x70e, GeneralCategory::Po},    {0x70f, GeneralCategory::Cn},
+    {0x710, GeneralCategory::Cf},    {0x711, GeneralCategory::Lo},
+    {0x712, GeneralCategory::Mn},    {0x730, GeneralCategory::Lo},
+    {0x74b, GeneralCategory::Mn},    {0x74d, GeneralCategory::Cn},
+    {0x7a6, GeneralCategory::Lo},    {0x7b1, GeneralCategory::Mn},
+    {0x7b2, GeneralCategory::Lo},    {0x7c0, GeneralCategory::Cn},
+    {0x7ca, GeneralCategory::Nd},    {0x7eb, GeneralCategory::Lo},
+    {0x7f4, GeneralCategory::Mn},    {0x7f6, GeneralCategory::Lm},
+    {0x7f7, GeneralCategory::So},    {0x7fa, GeneralCategory::Po},
+    {0x7fb, GeneralCategory::Lm},    {0x7fd, GeneralCategory::Cn},
+    {0x7fe, GeneralCategory::Mn},    {0x800, GeneralCategory::Sc},
+    {0x816, GeneralCategory::Lo},    {0x81a, GeneralCategory::Mn},
+    {0x81b, GeneralCategory::Lm},    {0x824, GeneralCategory::Mn},
+    {0x825, GeneralCategory::Lm},    {0x828, GeneralCategory::Mn},
+    {0x829, GeneralCategory::Lm},    {0x82e, GeneralCategory::Mn},
+    {0x830, GeneralCategory::Cn},    {0x83f, GeneralCategory::Po},
+    {0x840, GeneralCategory::Cn},    {0x859, GeneralCategory::Lo},
+    {0x85c, GeneralCategory::Mn},    {0x85e, GeneralCategory::Cn},
+    {0x85f, GeneralCategory::Po},    {0x860, GeneralCategory::Cn},
+    {0x86b, GeneralCategory::Lo},    {0x8a0, GeneralCategory::Cn},
+    {0x8b5, GeneralCategory::Lo},    {0x8b6, GeneralCategory::Cn},
+    {0x8c8, GeneralCategory::Lo},    {0x8d3, GeneralCategory::Cn},
+    {0x8e2, GeneralCategory::Mn},    {0x8e3, GeneralCategory::Cf},
+    {0x903, GeneralCategory::Mn},    {0x904, GeneralCategory::Mc},
+    {0x93a, GeneralCategory::Lo},    {0x93b, GeneralCategory::Mn},
+    {0x93c, GeneralCategory::Mc},    {0x93d, GeneralCategory::Mn},
+    {0x93e, GeneralCategory::Lo},    {0x941, GeneralCategory::Mc},
+    {0x949, GeneralCategory::Mn},    {0x94d, GeneralCategory::Mc},
+    {0x94e, GeneralCategory::Mn},    {0x950, GeneralCategory::Mc},
+    {0x951, GeneralCategory::Lo},    {0x958, GeneralCategory::Mn},
+    {0x962, GeneralCategory::Lo},    {0x964, GeneralCategory::Mn},
+    {0x966, GeneralCategory::Po},    {0x970, GeneralCategory::Nd},
+    {0x971, GeneralCategory::Po},    {0x972, GeneralCategory::Lm},
+    {0x981, GeneralCategory::Lo},    {0x982, GeneralCategory::Mn},
+    {0x984, GeneralCategory::Mc},    {0x985, GeneralCategory::Cn},
+    {0x98d, GeneralCategory::Lo},    {0x98f, GeneralCategory::Cn},
+    {0x991, GeneralCategory::Lo},    {0x993, GeneralCategory::Cn},
+    {0x9a9, GeneralCategory::Lo},    {0x9aa, GeneralCategory::Cn},
+    {0x9b1, GeneralCategory::Lo},    {0x9b2, GeneralCategory::Cn},
+    {0x9b3, GeneralCategory::Lo},    {0x9b6, GeneralCategory::Cn},
+    {0x9ba, GeneralCategory::Lo},    {0x9bc, GeneralCategory::Cn},
+    {0x9bd, GeneralCategory::Mn},    {0x9be, GeneralCategory::Lo},
+    {0x9c1, GeneralCategory::Mc},    {0x9c5, GeneralCategory::Mn},
+    {0x9c7, GeneralCategory::Cn},    {0x9c9, GeneralCategory::Mc},
+    {0x9cb, GeneralCategory::Cn},    {0x9cd, GeneralCategory::Mc},
+    {0x9ce, GeneralCategory::Mn},    {0x9cf, GeneralCategory::Lo},
+    {0x9d7, GeneralCategory::Cn},    {0x9d8, GeneralCategory::Mc},
+    {0x9dc, GeneralCategory::Cn},    {0x9de, GeneralCategory::Lo},
+    {0x9df, GeneralCategory::Cn},    {0x9e2, GeneralCategory::Lo},
+    {0x9e4, GeneralCategory::Mn},    {0x9e6, GeneralCategory::Cn},
+    {0x9f0, GeneralCategory::Nd},    {0x9f2, GeneralCategory::Lo},
+    {0x9f4, GeneralCategory::Sc},    {0x9fa, GeneralCategory::No},
+    {0x9fb, GeneralCategory::So},    {0x9fc, GeneralCategory::Sc},
+    {0x9fd, GeneralCategory::Lo},    {0x9fe, GeneralCategory::Po},
+    {0x9ff, GeneralCategory::Mn},    {0xa01, GeneralCategory::Cn},
+    {0xa03, GeneralCategory::Mn},    {0xa04, GeneralCategory::Mc},
+    {0xa05, GeneralCategory::Cn},    {0xa0b, GeneralCategory::Lo},
+    {0xa0f, GeneralCategory::Cn},    {0xa11, GeneralCategory::Lo},
+    {0xa13, GeneralCategory::Cn},    {0xa29, GeneralCategory::Lo},
+    {0xa2a, GeneralCategory::Cn},    {0xa31, GeneralCategory::Lo},
+    {0xa32, GeneralCategory::Cn},    {0xa34, GeneralCategory::Lo},
+    {0xa35, GeneralCategory::Cn},    {0xa37, GeneralCategory::Lo},
+    {0xa38, GeneralCategory::Cn},    {0xa3a, GeneralCategory::Lo},
+    {0xa3c, GeneralCategory::Cn},    {0xa3d, GeneralCategory::Mn},
+    {0xa3e, GeneralCategory::Cn},    {0xa41, GeneralCategory::Mc},
+    {0xa43, GeneralCategory::Mn},    {0xa47, GeneralCategory::Cn},
+    {0xa49, GeneralCategory::Mn},    {0xa4b, GeneralCategory::Cn},
+    {0xa4e, GeneralCategory::Mn},    {0xa51, GeneralCategory::Cn},
+    {0xa52, GeneralCategory::Mn},    {0xa59, GeneralCategory::Cn},
+    {0xa5d, GeneralCategory::Lo},    {0xa5e, GeneralCategory::Cn},
+    {0xa5f, GeneralCategory::Lo},    {0xa66, GeneralCategory::Cn},
+    {0xa70, GeneralCategory::Nd},    {0xa72, GeneralCategory::Mn},
+    {0xa75, GeneralCategory::Lo},    {0xa76, GeneralCategory::Mn},
+    {0xa77, GeneralCategory::Po},    {0xa81, GeneralCategory::Cn},
+    {0xa83, GeneralCategory::Mn},    {0xa84, GeneralCategory::Mc},
+    {0xa85, GeneralCategory::Cn},    {0xa8e, GeneralCategory::Lo},
+    {0xa8f, GeneralCategory::Cn},    {0xa92, GeneralCategory::Lo},
+    {0xa93, GeneralCategory::Cn},    {0xaa9, GeneralCategory::Lo},
+    {0xaaa, GeneralCategory::Cn},    {0xab1, GeneralCategory::Lo},
+    {0xab2, GeneralCategory::Cn},    {0xab4, GeneralCategory::Lo},
+    {0xab5, GeneralCategory::Cn},    {0xaba, GeneralCategory::Lo},
+    {0xabc, GeneralCategory::Cn},    {0xabd, GeneralCategory::Mn},
+    {0xabe, GeneralCategory::Lo},    {0xac1, GeneralCategory::Mc},
+    {0xac6, GeneralCategory::Mn},    {0xac7, GeneralCategory::Cn},
+    {0xac9, GeneralCategory::Mn},    {0xaca, GeneralCategory::Mc},
+    {0xacb, GeneralCategory::Cn},    {0xacd, GeneralCategory::Mc},
+    {0xace, GeneralCategory::Mn},    {0xad0, GeneralCategory::Cn},
+    {0xad1, GeneralCategory::Lo},    {0xae0, GeneralCategory::Cn},
+    {0xae2, GeneralCategory::Lo},    {0xae4, GeneralCategory::Mn},
+    {0xae6, GeneralCategory::Cn},    {0xaf0, GeneralCategory::Nd},
+    {0xaf1, GeneralCategory::Po},    {0xaf2, GeneralCategory::Sc},
+    {0xaf9, GeneralCategory::Cn},    {0xafa, GeneralCategory::Lo},
+    {0xb00, GeneralCategory::Mn},    {0xb01, GeneralCategory::Cn},
+    {0xb02, GeneralCategory::Mn},    {0xb04, GeneralCategory::Mc},
+    {0xb05, GeneralCategory::Cn},    {0xb0d, GeneralCategory::Lo},
+    {0xb0f, GeneralCategory::Cn},    {0xb11, GeneralCategory::Lo},
+    {0xb13, GeneralCategory::Cn},    {0xb29, GeneralCategory::Lo},
+    {0xb2a, GeneralCategory::Cn},    {0xb31, GeneralCategory::Lo},
+    {0xb32, GeneralCategory::Cn},    {0xb34, GeneralCategory::Lo},
+    {0xb35, GeneralCategory::Cn},    {0xb3a, GeneralCategory::Lo},
+    {0xb3c, GeneralCategory::Cn},    {0xb3d, GeneralCategory::Mn},
+    {0xb3e, GeneralCategory::Lo},    {0xb3f, GeneralCategory::Mc},
+    {0xb40, GeneralCategory::Mn},    {0xb41, GeneralCategory::Mc},
+    {0xb45, GeneralCategory::Mn},    {0xb47, GeneralCategory::Cn},
+    {0xb49, GeneralCategory::Mc},    {0xb4b, GeneralCategory::Cn},
+    {0xb4d, GeneralCategory::Mc},    {0xb4e, GeneralCategory::Mn},
+    {0xb55, GeneralCategory::Cn},    {0xb57, GeneralCategory::Mn},
+    {0xb58, GeneralCategory::Mc},    {0xb5c, GeneralCategory::Cn},
+    {0xb5e, GeneralCategory::Lo},    {0xb5f, GeneralCategory::Cn},
+    {0xb62, GeneralCategory::Lo},    {0xb64, GeneralCategory::Mn},
+    {0xb66, GeneralCategory::Cn},    {0xb70, GeneralCategory::Nd},
+    {0xb71, GeneralCategory::So},    {0xb72, GeneralCategory::Lo},
+    {0xb78, GeneralCategory::No},    {0xb82, GeneralCategory::Cn},
+    {0xb83, GeneralCategory::Mn},    {0xb84, GeneralCategory::Lo},
+    {0xb85, GeneralCategory::Cn},    {0xb8b, GeneralCategory::Lo},
+    {0xb8e, GeneralCategory::Cn},    {0xb91, GeneralCategory::Lo},
+    {0xb92, GeneralCategory::Cn},    {0xb96, GeneralCategory::Lo},
+    {0xb99, GeneralCategory::Cn},    {0xb9b, GeneralCategory::Lo},
+    {0xb9c, GeneralCategory::Cn},    {0xb9d, GeneralCategory::Lo},
+    {0xb9e, GeneralCategory::Cn},    {0xba0, GeneralCategory::Lo},
+    {0xba3, GeneralCategory::Cn},    {0xba5, GeneralCategory::Lo},
+    {0xba8, GeneralCategory::Cn},    {0xbab, GeneralCategory::Lo},
+    {0xbae, GeneralCategory::Cn},    {0xbba, GeneralCategory::Lo},
+    {0xbbe, GeneralCategory::Cn},    {0xbc0, GeneralCategory::Mc},
+    {0xbc1, GeneralCategory::Mn},    {0xbc3, GeneralCategory::Mc},
+    {0xbc6, GeneralCategory::Cn},    {0xbc9, GeneralCategory::Mc},
+    {0xbca, GeneralCategory::Cn},    {0xbcd, GeneralCategory::Mc},
+    {0xbce, GeneralCategory::Mn},    {0xbd0, GeneralCategory::Cn},
+    {0xbd1, GeneralCategory::Lo},    {0xbd7, GeneralCategory::Cn},
+    {0xbd8, GeneralCategory::Mc},    {0xbe6, GeneralCategory::Cn},
+    {0xbf0, GeneralCategory::Nd},    {0xbf3, GeneralCategory::No},
+    {0xbf9, GeneralCategory::So},    {0xbfa, GeneralCategory::Sc},
+    {0xbfb, GeneralCategory::So},    {0xc00, GeneralCategory::Cn},
+    {0xc01, GeneralCategory::Mn},    {0xc04, GeneralCategory::Mc},
+    {0xc05, GeneralCategory::Mn},    {0xc0d, GeneralCategory::Lo},
+    {0xc0e, GeneralCategory::Cn},    {0xc11, GeneralCategory::Lo},
+    {0xc12, GeneralCategory::Cn},    {0xc29, GeneralCategory::Lo},
+    {0xc2a, GeneralCategory::Cn},    {0xc3a, GeneralCategory::Lo},
+    {0xc3d, GeneralCategory::Cn},    {0xc3e, GeneralCategory::Lo},
+    {0xc41, GeneralCategory::Mn},    {0xc45, GeneralCategory::Mc},
+    {0xc46, GeneralCategory::Cn},    {0xc49, GeneralCategory::Mn},
+    {0xc4a, GeneralCategory::Cn},    {0xc4e, GeneralCategory::Mn},
+    {0xc55, GeneralCategory::Cn},    {0xc57, GeneralCategory::Mn},
+    {0xc58, GeneralCategory::Cn},    {0xc5b, GeneralCategory::Lo},
+    {0xc60, GeneralCategory::Cn},    {0xc62, GeneralCategory::Lo},
+    {0xc64, GeneralCategory::Mn},    {0xc66, GeneralCategory::Cn},
+    {0xc70, GeneralCategory::Nd},    {0xc77, GeneralCategory::Cn},
+    {0xc78, GeneralCategory::Po},    {0xc7f, GeneralCategory::No},
+    {0xc80, GeneralCategory::So},    {0xc81, GeneralCategory::Lo},
+    {0xc82, GeneralCategory::Mn},    {0xc84, GeneralCategory::Mc},
+    {0xc85, GeneralCategory::Po},    {0xc8d, GeneralCategory::Lo},
+    {0xc8e, GeneralCategory::Cn},    {0xc91, GeneralCategory::Lo},
+    {0xc92, GeneralCategory::Cn},    {0xca9, GeneralCategory::Lo},
+    {0xcaa, GeneralCategory::Cn},    {0xcb4, GeneralCategory::Lo},
+    {0xcb5, GeneralCategory::Cn},    {0xcba, GeneralCategory::Lo},
+    {0xcbc, GeneralCategory::Cn},    {0xcbd, GeneralCategory::Mn},
+    {0xcbe, GeneralCategory::Lo},    {0xcbf, GeneralCategory::Mc},
+    {0xcc0, GeneralCategory::Mn},    {0xcc5, GeneralCategory::Mc},
+    {0xcc6, GeneralCategory::Cn},    {0xcc7, GeneralCategory::Mn},
+    {0xcc9, GeneralCategory::Mc},    {0xcca, GeneralCategory::Cn},
+    {0xccc, GeneralCategory::Mc},    {0xcce, GeneralCategory::Mn},
+    {0xcd5, GeneralCategory::Cn},    {0xcd7, GeneralCategory::Mc},
+    {0xcde, GeneralCategory::Cn},    {0xcdf, GeneralCategory::Lo},
+    {0xce0, GeneralCategory::Cn},    {0xce2, GeneralCategory::Lo},
+    {0xce4, GeneralCategory::Mn},    {0xce6, GeneralCategory::Cn},
+    {0xcf0, GeneralCategory::Nd},    {0xcf1, GeneralCategory::Cn},
+    {0xcf3, GeneralCategory::Lo},    {0xd00, GeneralCategory::Cn},
+    {0xd02, GeneralCategory::Mn},    {0xd04, GeneralCategory::Mc},
+    {0xd0d, GeneralCategory::Lo},    {0xd0e, GeneralCategory::Cn},
+    {0xd11, GeneralCategory::Lo},    {0xd12, GeneralCategory::Cn},
+    {0xd3b, GeneralCategory::Lo},    {0xd3d, GeneralCategory::Mn},
+    {0xd3e, GeneralCategory::Lo},    {0xd41, GeneralCategory::Mc},
+    {0xd45, GeneralCategory::Mn},    {0xd46, GeneralCategory::Cn},
+    {0xd49, GeneralCategory::Mc},    {0xd4a, GeneralCategory::Cn},
+    {0xd4d, GeneralCategory::Mc},    {0xd4e, GeneralCategory::Mn},
+    {0xd4f, GeneralCategory::Lo},    {0xd50, GeneralCategory::So},
+    {0xd54, GeneralCategory::Cn},    {0xd57, GeneralCategory::Lo},
+    {0xd58, GeneralCategory::Mc},    {0xd5f, GeneralCategory::No},
+    {0xd62, GeneralCategory::Lo},    {0xd64, GeneralCategory::Mn},
+    {0xd66, GeneralCategory::Cn},    {0xd70, GeneralCategory::Nd},
+    {0xd79, GeneralCategory::No},    {0xd7a, GeneralCategory::So},
+    {0xd80, GeneralCategory::Lo},    {0xd81, GeneralCategory::Cn},
+    {0xd82, GeneralCategory::Mn},    {0xd84, GeneralCategory::Mc},
+    {0xd85, GeneralCategory::Cn},    {0xd97, GeneralCategory::Lo},
+    {0xd9a, GeneralCategory::Cn},    {0xdb2, GeneralCategory::Lo},
+    {0xdb3, GeneralCategory::Cn},    {0xdbc, GeneralCategory::Lo},
+    {0xdbd, GeneralCategory::Cn},    {0xdbe, GeneralCategory::Lo},
+    {0xdc0, GeneralCategory::Cn},    {0xdc7, GeneralCategory::Lo},
+    {0xdca, GeneralCategory::Cn},    {0xdcb, GeneralCategory::Mn},
+    {0xdcf, GeneralCategory::Cn},    {0xdd2, GeneralCategory::Mc},
+    {0xdd5, GeneralCategory::Mn},    {0xdd6, GeneralCategory::Cn},
+    {0xdd7, GeneralCategory::Mn},    {0xdd8, GeneralCategory::Cn},
+    {0xde0, GeneralCategory::Mc},    {0xde6, GeneralCategory::Cn},
+    {0xdf0, GeneralCategory::Nd},    {0xdf2, GeneralCategory::Cn},
+    {0xdf4, GeneralCategory::Mc},    {0xdf5, GeneralCategory::Po},
+    {0xe01, GeneralCategory::Cn},    {0xe31, GeneralCategory::Lo},
+    {0xe32, GeneralCategory::Mn},    {0xe34, GeneralCategory::Lo},
+    {0xe3b, GeneralCategory::Mn},    {0xe3f, GeneralCategory::Cn},
+    {0xe40, GeneralCategory::Sc},    {0xe46, GeneralCategory::Lo},
+    {0xe47, GeneralCategory::Lm},    {0xe4f, GeneralCategory::Mn},
+    {0xe50, GeneralCategory::Po},    {0xe5a, GeneralCategory::Nd},
+    {0xe5c, GeneralCategory::Po},    {0xe81, GeneralCategory::Cn},
+    {0xe83, GeneralCategory::Lo},    {0xe84, GeneralCategory::Cn},
+    {0xe85, GeneralCategory::Lo},    {0xe86, GeneralCategory::Cn},
+    {0xe8b, GeneralCategory::Lo},    {0xe8c, GeneralCategory::Cn},
+    {0xea4, GeneralCategory::Lo},    {0xea5, GeneralCategory::Cn},
+    {0xea6, GeneralCategory::Lo},    {0xea7, GeneralCategory::Cn},
+    {0xeb1, GeneralCategory::Lo},    {0xeb2, GeneralCategory::Mn},
+    {0xeb4, GeneralCategory::Lo},    {0xebd, GeneralCategory::Mn},
+    {0xebe, GeneralCategory::Lo},    {0xec0, GeneralCategory::Cn},
+    {0xec5, GeneralCategory::Lo},    {0xec6, GeneralCategory::Cn},
+    {0xec7, GeneralCategory::Lm},    {0xec8, GeneralCategory::Cn},
+    {0xece, GeneralCategory::Mn},    {0xed0, GeneralCategory::Cn},
+    {0xeda, GeneralCategory::Nd},    {0xedc, GeneralCategory::Cn},
+    {0xee0, GeneralCategory::Lo},    {0xf00, GeneralCategory::Cn},
+    {0xf01, GeneralCategory::Lo},    {0xf04, GeneralCategory::So},
+    {0xf13, GeneralCategory::Po},    {0xf14, GeneralCategory::So},
+    {0xf15, GeneralCategory::Po},    {0xf18, GeneralCategory::So},
+    {0xf1a, GeneralCategory::Mn},    {0xf20, GeneralCategory::So},
+    {0xf2a, GeneralCategory::Nd},    {0xf34, GeneralCategory::No},
+    {0xf35, GeneralCategory::So},    {0xf36, GeneralCategory::Mn},
+    {0xf37, GeneralCategory::So},    {0xf38, GeneralCategory::Mn},
+    {0xf39, GeneralCategory::So},    {0xf3a, GeneralCategory::Mn},
+    {0xf3b, GeneralCategory::Ps},    {0xf3c, GeneralCategory::Pe},
+    {0xf3d, GeneralCategory::Ps},    {0xf3e, GeneralCategory::Pe},
+    {0xf40, GeneralCategory::Mc},    {0xf48, GeneralCategory::Lo},
+    {0xf49, GeneralCategory::Cn},    {0xf6d, GeneralCategory::Lo},
+    {0xf71, GeneralCategory::Cn},    {0xf7f, GeneralCategory::Mn},
+    {0xf80, GeneralCategory::Mc},    {0xf85, GeneralCategory::Mn},
+    {0xf86, GeneralCategory::Po},    {0xf88, GeneralCategory::Mn},
+    {0xf8d, GeneralCategory::Lo},    {0xf98, GeneralCategory::Mn},
+    {0xf99, GeneralCategory::Cn},    {0xfbd, GeneralCategory::Mn},
+    {0xfbe, GeneralCategory::Cn},    {0xfc6, GeneralCategory::So},
+    {0xfc7, GeneralCategory::Mn},    {0xfcd, GeneralCategory::So},
+    {0xfce, GeneralCategory::Cn},    {0xfd0, GeneralCategory::So},
+    {0xfd5, GeneralCategory::Po},    {0xfd9, GeneralCategory::So},
+    {0xfdb, GeneralCategory::Po},    {0x1000, GeneralCategory::Cn},
+    {0x102b, GeneralCategory::Lo},   {0x102d, GeneralCategory::Mc},
+    {0x1031, GeneralCategory::Mn},   {0x1032, GeneralCategory::Mc},
+    {0x1038, GeneralCategory::Mn},   {0x1039, GeneralCategory::Mc},
+    {0x103b, GeneralCategory::Mn},   {0x103d, GeneralCategory::Mc},
+    {0x103f, GeneralCategory::Mn},   {0x1040, GeneralCategory::Lo},
+    {0x104a, GeneralCategory::Nd},   {0x1050, GeneralCategory::Po},
+    {0x1056, GeneralCategory::Lo},   {0x1058, GeneralCategory::Mc},
+    {0x105a, GeneralCategory::Mn},   {0x105e, GeneralCategory::Lo},
+    {0x1061, GeneralCategory::Mn},   {0x1062, GeneralCategory::Lo},
+    {0x1065, GeneralCategory::Mc},   {0x1067, GeneralCategory::Lo},
+    {0x106e, GeneralCategory::Mc},   {0x1071, GeneralCategory::Lo},
+    {0x1075, GeneralCategory::Mn},   {0x1082, GeneralCategory::Lo},
+    {0x1083, GeneralCategory::Mn},   {0x1085, GeneralCategory::Mc},
+    {0x1087, GeneralCategory::Mn},   {0x108d, GeneralCategory::Mc},
+    {0x108e, GeneralCategory::Mn},   {0x108f, GeneralCategory::Lo},
+    {0x1090, GeneralCategory::Mc},   {0x109a, GeneralCategory::Nd},
+    {0x109d, GeneralCategory::Mc},   {0x109e, GeneralCategory::Mn},
+    {0x10a0, GeneralCategory::So},   {0x10c6, GeneralCategory::Lu},
+    {0x10c7, GeneralCategory::Cn},   {0x10c8, GeneralCategory::Lu},
+    {0x10cd, GeneralCategory::Cn},   {0x10ce, GeneralCategory::Lu},
+    {0x10d0, GeneralCategory::Cn},   {0x10fb, GeneralCategory::Ll},
+    {0x10fc, GeneralCategory::Po},   {0x10fd, GeneralCategory::Lm},
+    {0x1100, GeneralCategory::Ll},   {0x1249, GeneralCategory::Lo},
+    {0x124a, GeneralCategory::Cn},   {0x124e, GeneralCategory::Lo},
+    {0x1250, GeneralCategory::Cn},   {0x1257, GeneralCategory::Lo},
+    {0x1258, GeneralCategory::Cn},   {0x1259, GeneralCategory::Lo},
+    {0x125a, GeneralCategory::Cn},   {0x125e, GeneralCategory::Lo},
+    {0x1260, GeneralCategory::Cn},   {0x1289, GeneralCategory::Lo},
+    {0x128a, GeneralCategory::Cn},   {0x128e, GeneralCategory::Lo},
+    {0x1290, GeneralCategory::Cn},   {0x12b1, GeneralCategory::Lo},
+    {0x12b2, GeneralCategory::Cn},   {0x12b6, GeneralCategory::Lo},
+    {0x12b8, GeneralCategory::Cn},   {0x12bf, GeneralCategory::Lo},
+    {0x12c0, GeneralCategory::Cn},   {0x12c1, GeneralCategory::Lo},
+    {0x12c2, GeneralCategory::Cn},   {0x12c6, GeneralCategory::Lo},
+    {0x12c8, GeneralCategory::Cn},   {0x12d7, GeneralCategory::Lo},
+    {0x12d8, GeneralCategory::Cn},   {0x1311, GeneralCategory::Lo},
+    {0x1312, GeneralCategory::Cn},   {0x1316, GeneralCategory::Lo},
+    {0x1318, GeneralCategory::Cn},   {0x135b, GeneralCategory::Lo},
+    {0x135d, GeneralCategory::Cn},   {0x1360, GeneralCategory::Mn},
+    {0x1369, GeneralCategory::Po},   {0x137d, GeneralCategory::No},
+    {0x1380, GeneralCategory::Cn},   {0x1390, GeneralCategory::Lo},
+    {0x139a, GeneralCategory::So},   {0x13a0, GeneralCategory::Cn},
+    {0x13f6, GeneralCategory::Lu},   {0x13f8, GeneralCategory::Cn},
+    {0x13fe, GeneralCategory::Ll},   {0x1400, GeneralCategory::Cn},
+    {0x1401, GeneralCategory::Pd},   {0x166d, GeneralCategory::Lo},
+    {0x166e, GeneralCategory::So},   {0x166f, GeneralCategory::Po},
+    {0x1680, GeneralCategory::Lo},   {0x1681, GeneralCategory::Zs},
+    {0x169b, GeneralCategory::Lo},   {0x169c, GeneralCategory::Ps},
+    {0x169d, GeneralCategory::Pe},   {0x16a0, GeneralCategory::Cn},
+    {0x16eb, GeneralCategory::Lo},   {0x16ee, GeneralCategory::Po},
+    {0x16f1, GeneralCategory::Nl},   {0x16f9, GeneralCategory::Lo},
+    {0x1700, GeneralCategory::Cn},   {0x170d, GeneralCategory::Lo},
+    {0x170e, GeneralCategory::Cn},   {0x1712, GeneralCategory::Lo},
+    {0x1715, GeneralCategory::Mn},   {0x1720, GeneralCategory::Cn},
+    {0x1732, GeneralCategory::Lo},   {0x1735, GeneralCategory::Mn},
+    {0x1737, GeneralCategory::Po},   {0x1740, GeneralCategory::Cn},
+    {0x1752, GeneralCategory::Lo},   {0x1754, GeneralCategory::Mn},
+    {0x1760, GeneralCategory::Cn},   {0x176d, GeneralCategory::Lo},
+    {0x176e, GeneralCategory::Cn},   {0x1771, GeneralCategory::Lo},
+    {0x1772, GeneralCategory::Cn},   {0x1774, GeneralCategory::Mn},
+    {0x1780, GeneralCategory::Cn},   {0x17b4, GeneralCategory::Lo},
+    {0x17b6, GeneralCategory::Mn},   {0x17b7, GeneralCategory::Mc},
+    {0x17be, GeneralCategory::Mn},   {0x17c6, GeneralCategory::Mc},
+    {0x17c7, GeneralCategory::Mn},   {0x17c9, GeneralCategory::Mc},
+    {0x17d4, GeneralCategory::Mn},   {0x17d7, GeneralCategory::Po},
+    {0x17d8, GeneralCategory::Lm},   {0x17db, GeneralCategory::Po},
+    {0x17dc, GeneralCategory::Sc},   {0x17dd, GeneralCategory::Lo},
+    {0x17de, GeneralCategory::Mn},   {0x17e0, GeneralCategory::Cn},
+    {0x17ea, GeneralCategory::Nd},   {0x17f0, GeneralCategory::Cn},
+    {0x17fa, GeneralCategory::No},   {0x1800, GeneralCategory::Cn},
+    {0x1806, GeneralCategory::Po},   {0x1807, GeneralCategory::Pd},
+    {0x180b, GeneralCategory::Po},   {0x180e, GeneralCategory::Mn},
+    {0x180f, GeneralCategory::Cf},   {0x1810, GeneralCategory::Cn},
+    {0x181a, GeneralCategory::Nd},   {0x1820, GeneralCategory::Cn},
+    {0x1843, GeneralCategory::Lo},   {0x1844, GeneralCategory::Lm},
+    {0x1879, GeneralCategory::Lo},   {0x1880, GeneralCategory::Cn},
+    {0x1885, GeneralCategory::Lo},   {0x1887, GeneralCategory::Mn},
+    {0x18a9, GeneralCategory::Lo},   {0x18aa, GeneralCategory::Mn},
+    {0x18ab, GeneralCategory::Lo},   {0x18b0, GeneralCategory::Cn},
+    {0x18f6, GeneralCategory::Lo},   {0x1900, GeneralCategory::Cn},
+    {0x191f, GeneralCategory::Lo},   {0x1920, GeneralCategory::Cn},
+    {0x1923, GeneralCategory::Mn},   {0x1927, GeneralCategory::Mc},
+    {0x1929, GeneralCategory::Mn},   {0x192c, GeneralCategory::Mc},
+    {0x1930, GeneralCategory::Cn},   {0x1932, GeneralCategory::Mc},
+    {0x1933, GeneralCategory::Mn},   {0x1939, GeneralCategory::Mc},
+    {0x193c, GeneralCategory::Mn},   {0x1940, GeneralCategory::Cn},
+    {0x1941, GeneralCategory::So},   {0x1944, GeneralCategory::Cn},
+    {0x1946, GeneralCategory::Po},   {0x1950, GeneralCategory::Nd},
+    {0x196e, GeneralCategory::Lo},   {0x1970, GeneralCategory::Cn},
+    {0x1975, GeneralCategory::Lo},   {0x1980, GeneralCategory::Cn},
+    {0x19ac, GeneralCategory::Lo},   {0x19b0, GeneralCategory::Cn},
+    {0x19ca, GeneralCategory::Lo},   {0x19d0, GeneralCategory::Cn},
+    {0x19da, GeneralCategory::Nd},   {0x19db, GeneralCategory::No},
+    {0x19de, GeneralCategory::Cn},   {0x1a00, GeneralCategory::So},
+    {0x1a17, GeneralCategory::Lo},   {0x1a19, GeneralCategory::Mn},
+    {0x1a1b, GeneralCategory::Mc},   {0x1a1c, GeneralCategory::Mn},
+    {0x1a1e, GeneralCategory::Cn},   {0x1a20, GeneralCategory::Po},
+    {0x1a55, GeneralCategory::Lo},   {0x1a56, GeneralCategory::Mc},
+    {0x1a57, GeneralCategory::Mn},   {0x1a58, GeneralCategory::Mc},
+    {0x1a5f, GeneralCategory::Mn},   {0x1a60, GeneralCategory::Cn},
+    {0x1a61, GeneralCategory::Mn},   {0x1a62, GeneralCategory::Mc},
+    {0x1a63, GeneralCategory::Mn},   {0x1a65, GeneralCategory::Mc},
+    {0x1a6d, GeneralCategory::Mn},   {0x1a73, GeneralCategory::Mc},
+    {0x1a7d, GeneralCategory::Mn},   {0x1a7f, GeneralCategory::Cn},
+    {0x1a80, GeneralCategory::Mn},   {0x1a8a, GeneralCategory::Nd},
+    {0x1a90, GeneralCategory::Cn},   {0x1a9a, GeneralCategory::Nd},
+    {0x1aa0, GeneralCategory::Cn},   {0x1aa7, GeneralCategory::Po},
+    {0x1aa8, GeneralCategory::Lm},   {0x1aae, GeneralCategory::Po},
+    {0x1ab0, GeneralCategory::Cn},   {0x1abe, GeneralCategory::Mn},
+    {0x1abf, GeneralCategory::Me},   {0x1ac1, GeneralCategory::Mn},
+    {0x1b00, GeneralCategory::Cn},   {0x1b04, GeneralCategory::Mn},
+    {0x1b05, GeneralCategory::Mc},   {0x1b34, GeneralCategory::Lo},
+    {0x1b35, GeneralCategory::Mn},   {0x1b36, GeneralCategory::Mc},
+    {0x1b3b, GeneralCategory::Mn},   {0x1b3c, GeneralCategory::Mc},
+    {0x1b3d, GeneralCategory::Mn},   {0x1b42, GeneralCategory::Mc},
+    {0x1b43, GeneralCategory::Mn},   {0x1b45, GeneralCategory::Mc},
+    {0x1b4c, GeneralCategory::Lo},   {0x1b50, GeneralCategory::Cn},
+    {0x1b5a, GeneralCategory::Nd},   {0x1b61, GeneralCategory::Po},
+    {0x1b6b, GeneralCategory::So},   {0x1b74, GeneralCategory::Mn},
+    {0x1b7d, GeneralCategory::So},   {0x1b80, GeneralCategory::Cn},
+    {0x1b82, GeneralCategory::Mn},   {0x1b83, GeneralCategory::Mc},
+    {0x1ba1, GeneralCategory::Lo},   {0x1ba2, GeneralCategory::Mc},
+    {0x1ba6, GeneralCategory::Mn},   {0x1ba8, GeneralCategory::Mc},
+    {0x1baa, GeneralCategory::Mn},   {0x1bab, GeneralCategory::Mc},
+    {0x1bae, GeneralCategory::Mn},   {0x1bb0, GeneralCategory::Lo},
+    {0x1bba, GeneralCategory::Nd},   {0x1be6, GeneralCategory::Lo},
+    {0x1be7, GeneralCategory::Mn},   {0x1be8, GeneralCategory::Mc},
+    {0x1bea, GeneralCategory::Mn},   {0x1bed, GeneralCategory::Mc},
+    {0x1bee, GeneralCategory::Mn},   {0x1bef, GeneralCategory::Mc},
+    {0x1bf2, GeneralCategory::Mn},   {0x1bf4, GeneralCategory::Mc},
+    {0x1bfc, GeneralCategory::Cn},   {0x1c00, GeneralCategory::Po},
+    {0x1c24, GeneralCategory::Lo},   {0x1c2c, GeneralCategory::Mc},
+    {0x1c34, GeneralCategory::Mn},   {0x1c36, GeneralCategory::Mc},
+    {0x1c38, GeneralCategory::Mn},   {0x1c3b, GeneralCategory::Cn},
+    {0x1c40, GeneralCategory::Po},   {0x1c4a, GeneralCategory::Nd},
+    {0x1c4d, GeneralCategory::Cn},   {0x1c50, GeneralCategory::Lo},
+    {0x1c5a, GeneralCategory::Nd},   {0x1c78, GeneralCategory::Lo},
+    {0x1c7e, GeneralCategory::Lm},   {0x1c80, GeneralCategory::Po},
+    {0x1c89, GeneralCategory::Ll},   {0x1c90, GeneralCategory::Cn},
+    {0x1cbb, GeneralCategory::Lu},   {0x1cbd, GeneralCategory::Cn},
+    {0x1cc0, GeneralCategory::Lu},   {0x1cc8, GeneralCategory::Po},
+    {0x1cd0, GeneralCategory::Cn},   {0x1cd3, GeneralCategory::Mn},
+    {0x1cd4, GeneralCategory::Po},   {0x1ce1, GeneralCategory::Mn},
+    {0x1ce2, GeneralCategory::Mc},   {0x1ce9, GeneralCategory::Mn},
+    {0x1ced, GeneralCategory::Lo},   {0x1cee, GeneralCategory::Mn},
+    {0x1cf4, GeneralCategory::Lo},   {0x1cf5, GeneralCategory::Mn},
+    {0x1cf7, GeneralCategory::Lo},   {0x1cf8, GeneralCategory::Mc},
+    {0x1cfa, GeneralCategory::Mn},   {0x1cfb, GeneralCategory::Lo},
+    {0x1d00, GeneralCategory::Cn},   {0x1d2c, GeneralCategory::Ll},
+    {0x1d6b, GeneralCategory::Lm},   {0x1d78, GeneralCategory::Ll},
+    {0x1d79, GeneralCategory::Lm},   {0x1d9b, GeneralCategory::Ll},
+    {0x1dc0, GeneralCategory::Lm},   {0x1dfa, GeneralCategory::Mn},
+    {0x1dfb, GeneralCategory::Cn},   {0x1e00, GeneralCategory::Mn},
+    {0x1e01, GeneralCategory::Lu},   {0x1e02, GeneralCategory::Ll},
+    {0x1e03, GeneralCategory::Lu},   {0x1e04, GeneralCategory::Ll},
+    {0x1e05, GeneralCategory::Lu},   {0x1e06, GeneralCategory::Ll},
+    {0x1e07, GeneralCategory::Lu},   {0x1e08, GeneralCategory::Ll},
+    {0x1e09, GeneralCategory::Lu},   {0x1e0a, GeneralCategory::Ll},
+    {0x1e0b, GeneralCategory::Lu},   {0x1e0c, GeneralCategory::Ll},
+    {0x1e0d, GeneralCategory::Lu},   {0x1e0e, GeneralCategory::Ll},
+    {0x1e0f, GeneralCategory::Lu},   {0x1e10, GeneralCategory::Ll},
+    {0x1e11, GeneralCategory::Lu},   {0x1e12, GeneralCategory::Ll},
+    {0x1e13, GeneralCategory::Lu},   {0x1e14, GeneralCategory::Ll},
+    {0x1e15, GeneralCategory::Lu},   {0x1e16, GeneralCategory::Ll},
+    {0x1e17, GeneralCategory::Lu},   {0x1e18, GeneralCategory::Ll},
+    {0x1e19, GeneralCategory::Lu},   {0x1e1a, GeneralCategory::Ll},
+    {0x1e1b, GeneralCategory::Lu},   {0x1e1c, GeneralCategory::Ll},
+    {0x1e1d, GeneralCategory::Lu},   {0x1e1e, GeneralCategory::Ll},
+    {0x1e1f, GeneralCategory::Lu},   {0x1e20, GeneralCategory::Ll},
+    {0x1e21, GeneralCategory::Lu},   {0x1e22, GeneralCategory::Ll},
+    {0x1e23, GeneralCategory::Lu},   {0x1e24, GeneralCategory::Ll},
+    {0x1e25, GeneralCategory::Lu},   {0x1e26, GeneralCategory::Ll},
+    {0x1e27, GeneralCategory::Lu},   {0x1e28, GeneralCategory::Ll},
+    {0x1e29, GeneralCategory::Lu},   {0x1e2a, GeneralCategory::Ll},
+    {0x1e2b, GeneralCategory::Lu},   {0x1e2c, GeneralCategory::Ll},
+    {0x1e2d, GeneralCategory::Lu},   {0x1e2e, GeneralCategory::Ll},
+    {0x1e2f, GeneralCategory::Lu},   {0x1e30, GeneralCategory::Ll},
+    {0x1e31, GeneralCategory::Lu},   {0x1e32, GeneralCategory::Ll},
+    {0x1e33, GeneralCategory::Lu},   {0x1e34, GeneralCategory::Ll},
+    {0x1e35, GeneralCategory::Lu},   {0x1e36, GeneralCategory::Ll},
+    {0x1e37, GeneralCategory::Lu},   {0x1e38, GeneralCategory::Ll},
+    {0x1e39, GeneralCategory::Lu},   {0x1e3a, GeneralCategory::Ll},
+    {0x1e3b, GeneralCategory::Lu},   {0x1e3c, GeneralCategory::Ll},
+    {0x1e3d, GeneralCategory::Lu},   {0x1e3e, GeneralCategory::Ll},
+    {0x1e3f, GeneralCategory::Lu},   {0x1e40, GeneralCategory::Ll},
+    {0x1e41, GeneralCategory::Lu},   {0x1e42, GeneralCategory::Ll},
+    {0x1e43, GeneralCategory::Lu},   {0x1e44, GeneralCategory::Ll},
+    {0x1e45, GeneralCategory::Lu},   {0x1e46, GeneralCategory::Ll},
+    {0x1e47, GeneralCategory::Lu},   {0x1e48, GeneralCategory::Ll},
+    {0x1e49, GeneralCategory::Lu},   {0x1e4a, GeneralCategory::Ll},
+    {0x1e4b, GeneralCategory::Lu},   {0x1e4c, GeneralCategory::Ll},
+    {0x1e4d, GeneralCategory::Lu},   {0x1e4e, GeneralCategory::Ll},
+    {0x1e4f, GeneralCategory::Lu},   {0x1e50, GeneralCategory::Ll},
+    {0x1e51, GeneralCategory::Lu},   {0x1e52, GeneralCategory::Ll},
+    {0x1e53, GeneralCategory::Lu},   {0x1e54, GeneralCategory::Ll},
+    {0x1e55, GeneralCategory::Lu},   {0x1e56, GeneralCategory::Ll},
+    {0x1e57, GeneralCategory::Lu},   {0x1e58, GeneralCategory::Ll},
+    {0x1e59, GeneralCategory::Lu},   {0x1e5a, GeneralCategory::Ll},
+    {0x1e5b, GeneralCategory::Lu},   {0x1e5c, GeneralCategory::Ll},
+    {0x1e5d, GeneralCategory::Lu},   {0x1e5e, GeneralCategory::Ll},
+    {0x1e5f, GeneralCategory::Lu},   {0x1e60, GeneralCategory::Ll},
+    {0x1e61, GeneralCategory::Lu},   {0x1e62, GeneralCategory::Ll},
+    {0x1e63, GeneralCategory::Lu},   {0x1e64, GeneralCategory::Ll},
+    {0x1e65, GeneralCategory::Lu},   {0x1e66, GeneralCategory::Ll},
+    {0x1e67, GeneralCategory::Lu},   {0x1e68, GeneralCategory::Ll},
+    {0x1e69, GeneralCategory::Lu},   {0x1e6a, GeneralCategory::Ll},
+    {0x1e6b, GeneralCategory::Lu},   {0x1e6c, GeneralCategory::Ll},
+    {0x1e6d, GeneralCategory::Lu},   {0x1e6e, GeneralCategory::Ll},
+    {0x1e6f, GeneralCategory::Lu},   {0x1e70, GeneralCategory::Ll},
+    {0x1e71, GeneralCategory::Lu},   {0x1e72, GeneralCategory::Ll},
+    {0x1e73, GeneralCategory::Lu},   {0x1e74, GeneralCategory::Ll},
+    {0x1e75, GeneralCategory::Lu},   {0x1e76, GeneralCategory::Ll},
+    {0x1e77, GeneralCategory::Lu},   {0x1e78, GeneralCategory::Ll},
+    {0x1e79, GeneralCategory::Lu},   {0x1e7a, GeneralCategory::Ll},
+    {0x1e7b, GeneralCategory::Lu},   {0x1e7c, GeneralCategory::Ll},
+    {0x1e7d, GeneralCategory::Lu},   {0x1e7e, GeneralCategory::Ll},
+    {0x1e7f, GeneralCategory::Lu},   {0x1e80, GeneralCategory::Ll},
+    {0x1e81, GeneralCategory::Lu},   {0x1e82, GeneralCategory::Ll},
+    {0x1e83, GeneralCategory::Lu},   {0x1e84, GeneralCategory::Ll},
+    {0x1e85, GeneralCategory::Lu},   {0x1e86, GeneralCategory::Ll},
+    {0x1e87, GeneralCategory::Lu},   {0x1e88, GeneralCategory::Ll},
+    {0x1e89, GeneralCategory::Lu},   {0x1e8a, GeneralCategory::Ll},
+    {0x1e8b, GeneralCategory::Lu},   {0x1e8c, GeneralCategory::Ll},
+    {0x1e8d, GeneralCategory::Lu},   {0x1e8e, GeneralCategory::Ll},
+    {0x1e8f, GeneralCategory::Lu},   {0x1e90, GeneralCategory::Ll},
+    {0x1e91, GeneralCategory::Lu},   {0x1e92, GeneralCategory::Ll},
+    {0x1e93, GeneralCategory::Lu},   {0x1e94, GeneralCategory::Ll},
+    {0x1e95, GeneralCategory::Lu},   {0x1e9e, GeneralCategory::Ll},
+    {0x1e9f, GeneralCategory::Lu},   {0x1ea0, GeneralCategory::Ll},
+    {0x1ea1, GeneralCategory::Lu},   {0x1ea2, GeneralCategory::Ll},
+    {0x1ea3, GeneralCategory::Lu},   {0x1ea4, GeneralCategory::Ll},
+    {0x1ea5, GeneralCategory::Lu},   {0x1ea6, GeneralCategory::Ll},
+    {0x1ea7, GeneralCategory::Lu},   {0x1ea8, GeneralCategory::Ll},
+    {0x1ea9, GeneralCategory::Lu},   {0x1eaa, GeneralCategory::Ll},
+    {0x1eab, GeneralCategory::Lu},   {0x1eac, GeneralCategory::Ll},
+    {0x1ead, GeneralCategory::Lu},   {0x1eae, GeneralCategory::Ll},
+    {0x1eaf, GeneralCategory::Lu},   {0x1eb0, GeneralCategory::Ll},
+    {0x1eb1, GeneralCategory::Lu},   {0x1eb2, GeneralCategory::Ll},
+    {0x1eb3, GeneralCategory::Lu},   {0x1eb4, GeneralCategory::Ll},
+    {0x1eb5, GeneralCategory::Lu},   {0x1eb6, GeneralCategory::Ll},
+    {0x1eb7, GeneralCategory::Lu},   {0x1eb8, GeneralCategory::Ll},
+    {0x1eb9, GeneralCategory::Lu},   {0x1eba, GeneralCategory::Ll},
+    {0x1ebb, GeneralCategory::Lu},   {0x1ebc, GeneralCategory::Ll},
+    {0x1ebd, GeneralCategory::Lu},   {0x1ebe, GeneralCategory::Ll},
+    {0x1ebf, GeneralCategory::Lu},   {0x1ec0, GeneralCategory::Ll},
+    {0x1ec1, GeneralCategory::Lu},   {0x1ec2, GeneralCategory::Ll},
+    {0x1ec3, GeneralCategory::Lu},   {0x1ec4, GeneralCategory::Ll},
+    {0x1ec5, GeneralCategory::Lu},   {0x1ec6, GeneralCategory::Ll},
+    {0x1ec7, GeneralCategory::Lu},   {0x1ec8, GeneralCategory::Ll},
+    {0x1ec9, GeneralCategory::Lu},   {0x1eca, GeneralCategory::Ll},
+    {0x1ecb, GeneralCategory::Lu},   {0x1ecc, GeneralCategory::Ll},
+    {0x1ecd, GeneralCategory::Lu},   {0x1ece, GeneralCategory::Ll},
+    {0x1ecf, GeneralCategory::Lu},   {0x1ed0, GeneralCategory::Ll},
+    {0x1ed1, GeneralCategory::Lu},   {0x1ed2, GeneralCategory::Ll},
+    {0x1ed3, GeneralCategory::Lu},   {0x1ed4, GeneralCategory::Ll},
+    {0x1ed5, GeneralCategory::Lu},   {0x1ed6, GeneralCategory::Ll},
+    {0x1ed7, GeneralCategory::Lu},   {0x1ed8, GeneralCategory::Ll},
+    {0x1ed9, GeneralCategory::Lu},   {0x1eda, GeneralCategory::Ll},
+    {0x1edb, GeneralCategory::Lu},   {0x1edc, GeneralCategory::Ll},
+    {0x1edd, GeneralCategory::Lu},   {0x1ede, GeneralCategory::Ll},
+    {0x1edf, GeneralCategory::Lu},   {0x1ee0, GeneralCategory::Ll},
+    {0x1ee1, GeneralCategory::Lu},   {0x1ee2, GeneralCategory::Ll},
+    {0x1ee3, GeneralCategory::Lu},   {0x1ee4, GeneralCategory::Ll},
+    {0x1ee5, GeneralCategory::Lu},   {0x1ee6, GeneralCategory::Ll},
+    {0x1ee7, GeneralCategory::Lu},   {0x1ee8, GeneralCategory::Ll},
+    {0x1ee9, GeneralCategory::Lu},   {0x1eea, GeneralCategory::Ll},
+    {0x1eeb, GeneralCategory::Lu},   {0x1eec, GeneralCategory::Ll},
+    {0x1eed, GeneralCategory::Lu},   {0x1eee, GeneralCategory::Ll},
+    {0x1eef, GeneralCategory::Lu},   {0x1ef0, GeneralCategory::Ll},
+    {0x1ef1, GeneralCategory::Lu},   {0x1ef2, GeneralCategory::Ll},
+    {0x1ef3, GeneralCategory::Lu},   {0x1ef4, GeneralCategory::Ll},
+    {0x1ef5, GeneralCategory::Lu},   {0x1ef6, GeneralCategory::Ll},
+    {0x1ef7, GeneralCategory::Lu},   {0x1ef8, GeneralCategory::Ll},
+    {0x1ef9, GeneralCategory::Lu},   {0x1efa, GeneralCategory::Ll},
+    {0x1efb, GeneralCategory::Lu},   {0x1efc, GeneralCategory::Ll},
+    {0x1efd, GeneralCategory::Lu},   {0x1efe, GeneralCategory::Ll},
+    {0x1eff, GeneralCategory::Lu},   {0x1f08, GeneralCategory::Ll},
+    {0x1f10, GeneralCategory::Lu},   {0x1f16, GeneralCategory::Ll},
+    {0x1f18, GeneralCategory::Cn},   {0x1f1e, GeneralCategory::Lu},
+    {0x1f20, GeneralCategory::Cn},   {0x1f28, GeneralCategory::Ll},
+    {0x1f30, GeneralCategory::Lu},   {0x1f38, GeneralCategory::Ll},
+    {0x1f40, GeneralCategory::Lu},   {0x1f46, GeneralCategory::Ll},
+    {0x1f48, GeneralCategory::Cn},   {0x1f4e, GeneralCategory::Lu},
+    {0x1f50, GeneralCategory::Cn},   {0x1f58, GeneralCategory::Ll},
+    {0x1f59, GeneralCategory::Cn},   {0x1f5a, GeneralCategory::Lu},
+    {0x1f5b, GeneralCategory::Cn},   {0x1f5c, GeneralCategory::Lu},
+    {0x1f5d, GeneralCategory::Cn},   {0x1f5e, GeneralCategory::Lu},
+    {0x1f5f, GeneralCategory::Cn},   {0x1f60, GeneralCategory::Lu},
+    {0x1f68, GeneralCategory::Ll},   {0x1f70, GeneralCategory::Lu},
+    {0x1f7e, GeneralCategory::Ll},   {0x1f80, GeneralCategory::Cn},
+    {0x1f88, GeneralCategory::Ll},   {0x1f90, GeneralCategory::Lt},
+    {0x1f98, GeneralCategory::Ll},   {0x1fa0, GeneralCategory::Lt},
+    {0x1fa8, GeneralCategory::Ll},   {0x1fb0, GeneralCategory::Lt},
+    {0x1fb5, GeneralCategory::Ll},   {0x1fb6, GeneralCategory::Cn},
+    {0x1fb8, GeneralCategory::Ll},   {0x1fbc, GeneralCategory::Lu},
+    {0x1fbd, GeneralCategory::Lt},   {0x1fbe, GeneralCategory::Sk},
+    {0x1fbf, GeneralCategory::Ll},   {0x1fc2, GeneralCategory::Sk},
+    {0x1fc5, GeneralCategory::Ll},   {0x1fc6, GeneralCategory::Cn},
+    {0x1fc8, GeneralCategory::Ll},   {0x1fcc, GeneralCategory::Lu},
+    {0x1fcd, GeneralCategory::Lt},   {0x1fd0, GeneralCategory::Sk},
+    {0x1fd4, GeneralCategory::Ll},   {0x1fd6, GeneralCategory::Cn},
+    {0x1fd8, GeneralCategory::Ll},   {0x1fdc, GeneralCategory::Lu},
+    {0x1fdd, GeneralCategory::Cn},   {0x1fe0, GeneralCategory::Sk},
+    {0x1fe8, GeneralCategory::Ll},   {0x1fed, GeneralCategory::Lu},
+    {0x1ff0, GeneralCategory::Sk},   {0x1ff2, GeneralCategory::Cn},
+    {0x1ff5, GeneralCategory::Ll},   {0x1ff6, GeneralCategory::Cn},
+    {0x1ff8, GeneralCategory::Ll},   {0x1ffc, GeneralCategory::Lu},
+    {0x1ffd, GeneralCategory::Lt},   {0x1fff, GeneralCategory::Sk},
+    {0x2000, GeneralCategory::Cn},   {0x200b, GeneralCategory::Zs},
+    {0x2010, GeneralCategory::Cf},   {0x2016, GeneralCategory::Pd},
+    {0x2018, GeneralCategory::Po},   {0x2019, GeneralCategory::Pi},
+    {0x201a, GeneralCategory::Pf},   {0x201b, GeneralCategory::Ps},
+    {0x201d, GeneralCategory::Pi},   {0x201e, GeneralCategory::Pf},
+    {0x201f, GeneralCategory::Ps},   {0x2020, GeneralCategory::Pi},
+    {0x2028, GeneralCategory::Po},   {0x2029, GeneralCategory::Zl},
+    {0x202a, GeneralCategory::Zp},   {0x202f, GeneralCategory::Cf},
+    {0x2030, GeneralCategory::Zs},   {0x2039, GeneralCategory::Po},
+    {0x203a, GeneralCategory::Pi},   {0x203b, GeneralCategory::Pf},
+    {0x203f, GeneralCategory::Po},   {0x2041, GeneralCategory::Pc},
+    {0x2044, GeneralCategory::Po},   {0x2045, GeneralCategory::Sm},
+    {0x2046, GeneralCategory::Ps},   {0x2047, GeneralCategory::Pe},
+    {0x2052, GeneralCategory::Po},   {0x2053, GeneralCategory::Sm},
+    {0x2054, GeneralCategory::Po},   {0x2055, GeneralCategory::Pc},
+    {0x205f, GeneralCategory::Po},   {0x2060, GeneralCategory::Zs},
+    {0x2065, GeneralCategory::Cf},   {0x2066, GeneralCategory::Cn},
+    {0x2070, GeneralCategory::Cf},   {0x2071, GeneralCategory::No},
+    {0x2072, GeneralCategory::Lm},   {0x2074, GeneralCategory::Cn},
+    {0x207a, GeneralCategory::No},   {0x207d, GeneralCategory::Sm},
+    {0x207e, GeneralCategory::Ps},   {0x207f, GeneralCategory::Pe},
+    {0x2080, GeneralCategory::Lm},   {0x208a, GeneralCategory::No},
+    {0x208d, GeneralCategory::Sm},   {0x208e, GeneralCategory::Ps},
+    {0x208f, GeneralCategory::Pe},   {0x2090, GeneralCategory::Cn},
+    {0x209d, GeneralCategory::Lm},   {0x20a0, GeneralCategory::Cn},
+    {0x20c0, GeneralCategory::Sc},   {0x20d0, GeneralCategory::Cn},
+    {0x20dd, GeneralCategory::Mn},   {0x20e1, GeneralCategory::Me},
+    {0x20e2, GeneralCategory::Mn},   {0x20e5, GeneralCategory::Me},
+    {0x20f1, GeneralCategory::Mn},   {0x2100, GeneralCategory::Cn},
+    {0x2102, GeneralCategory::So},   {0x2103, GeneralCategory::Lu},
+    {0x2107, GeneralCategory::So},   {0x2108, GeneralCategory::Lu},
+    {0x210a, GeneralCategory::So},   {0x210b, GeneralCategory::Ll},
+    {0x210e, GeneralCategory::Lu},   {0x2110, GeneralCategory::Ll},
+    {0x2113, GeneralCategory::Lu},   {0x2114, GeneralCategory::Ll},
+    {0x2115, GeneralCategory::So},   {0x2116, GeneralCategory::Lu},
+    {0x2118, GeneralCategory::So},   {0x2119, GeneralCategory::Sm},
+    {0x211e, GeneralCategory::Lu},   {0x2124, GeneralCategory::So},
+    {0x2125, GeneralCategory::Lu},   {0x2126, GeneralCategory::So},
+    {0x2127, GeneralCategory::Lu},   {0x2128, GeneralCategory::So},
+    {0x2129, GeneralCategory::Lu},   {0x212a, GeneralCategory::So},
+    {0x212e, GeneralCategory::Lu},   {0x212f, GeneralCategory::So},
+    {0x2130, GeneralCategory::Ll},   {0x2134, GeneralCategory::Lu},
+    {0x2135, GeneralCategory::Ll},   {0x2139, GeneralCategory::Lo},
+    {0x213a, GeneralCategory::Ll},   {0x213c, GeneralCategory::So},
+    {0x213e, GeneralCategory::Ll},   {0x2140, GeneralCategory::Lu},
+    {0x2145, GeneralCategory::Sm},   {0x2146, GeneralCategory::Lu},
+    {0x214a, GeneralCategory::Ll},   {0x214b, GeneralCategory::So},
+    {0x214c, GeneralCategory::Sm},   {0x214e, GeneralCategory::So},
+    {0x214f, GeneralCategory::Ll},   {0x2150, GeneralCategory::So},
+    {0x2160, GeneralCategory::No},   {0x2183, GeneralCategory::Nl},
+    {0x2184, GeneralCategory::Lu},   {0x2185, GeneralCategory::Ll},
+    {0x2189, GeneralCategory::Nl},   {0x218a, GeneralCategory::No},
+    {0x218c, GeneralCategory::So},   {0x2190, GeneralCategory::Cn},
+    {0x2195, GeneralCategory::Sm},   {0x219a, GeneralCategory::So},
+    {0x219c, GeneralCategory::Sm},   {0x21a0, GeneralCategory::So},
+    {0x21a1, GeneralCategory::Sm},   {0x21a3, GeneralCategory::So},
+    {0x21a4, GeneralCategory::Sm},   {0x21a6, GeneralCategory::So},
+    {0x21a7, GeneralCategory::Sm},   {0x21ae, GeneralCategory::So},
+    {0x21af, GeneralCategory::Sm},   {0x21ce, GeneralCategory::So},
+    {0x21d0, GeneralCategory::Sm},   {0x21d2, GeneralCategory::So},
+    {0x21d3, GeneralCategory::Sm},   {0x21d4, GeneralCategory::So},
+    {0x21d5, GeneralCategory::Sm},   {0x21f4, GeneralCategory::So},
+    {0x2300, GeneralCategory::Sm},   {0x2308, GeneralCategory::So},
+    {0x2309, GeneralCategory::Ps},   {0x230a, GeneralCategory::Pe},
+    {0x230b, GeneralCategory::Ps},   {0x230c, GeneralCategory::Pe},
+    {0x2320, GeneralCategory::So},   {0x2322, GeneralCategory::Sm},
+    {0x2329, GeneralCategory::So},   {0x232a, GeneralCategory::Ps},
+    {0x232b, GeneralCategory::Pe},   {0x237c, GeneralCategory::So},
+    {0x237d, GeneralCategory::Sm},   {0x239b, GeneralCategory::So},
+    {0x23b4, GeneralCategory::Sm},   {0x23dc, GeneralCategory::So},
+    {0x23e2, GeneralCategory::Sm},   {0x2427, GeneralCategory::So},
+    {0x2440, GeneralCategory::Cn},   {0x244b, GeneralCategory::So},
+    {0x2460, GeneralCategory::Cn},   {0x249c, GeneralCategory::No},
+    {0x24ea, GeneralCategory::So},   {0x2500, GeneralCategory::No},
+    {0x25b7, GeneralCategory::So},   {0x25b8, GeneralCategory::Sm},
+    {0x25c1, GeneralCategory::So},   {0x25c2, GeneralCategory::Sm},
+    {0x25f8, GeneralCategory::So},   {0x2600, GeneralCategory::Sm},
+    {0x266f, GeneralCategory::So},   {0x2670, GeneralCategory::Sm},
+    {0x2768, GeneralCategory::So},   {0x2769, GeneralCategory::Ps},
+    {0x276a, GeneralCategory::Pe},   {0x276b, GeneralCategory::Ps},
+    {0x276c, GeneralCategory::Pe},   {0x276d, GeneralCategory::Ps},
+    {0x276e, GeneralCategory::Pe},   {0x276f, GeneralCategory::Ps},
+    {0x2770, GeneralCategory::Pe},   {0x2771, GeneralCategory::Ps},
+    {0x2772, GeneralCategory::Pe},   {0x2773, GeneralCategory::Ps},
+    {0x2774, GeneralCategory::Pe},   {0x2775, GeneralCategory::Ps},
+    {0x2776, GeneralCategory::Pe},   {0x2794, GeneralCategory::No},
+    {0x27c0, GeneralCategory::So},   {0x27c5, GeneralCategory::Sm},
+    {0x27c6, GeneralCategory::Ps},   {0x27c7, GeneralCategory::Pe},
+    {0x27e6, GeneralCategory::Sm},   {0x27e7, GeneralCategory::Ps},
+    {0x27e8, GeneralCategory::Pe},   {0x27e9, GeneralCategory::Ps},
+    {0x27ea, GeneralCategory::Pe},   {0x27eb, GeneralCategory::Ps},
+    {0x27ec, GeneralCategory::Pe},   {0x27ed, GeneralCategory::Ps},
+    {0x27ee, GeneralCategory::Pe},   {0x27ef, GeneralCategory::Ps},
+    {0x27f0, GeneralCategory::Pe},   {0x2800, GeneralCategory::Sm},
+    {0x2900, GeneralCategory::So},   {0x2983, GeneralCategory::Sm},
+    {0x2984, GeneralCategory::Ps},   {0x2985, GeneralCategory::Pe},
+    {0x2986, GeneralCategory::Ps},   {0x2987, GeneralCategory::Pe},
+    {0x2988, GeneralCategory::Ps},   {0x2989, GeneralCategory::Pe},
+    {0x298a, GeneralCategory::Ps},   {0x298b, GeneralCategory::Pe},
+    {0x298c, GeneralCategory::Ps},   {0x298d, GeneralCategory::Pe},
+    {0x298e, GeneralCategory::Ps},   {0x298f, GeneralCategory::Pe},
+    {0x2990, GeneralCategory::Ps},   {0x2991, GeneralCategory::Pe},
+    {0x2992, GeneralCategory::Ps},   {0x2993, GeneralCategory::Pe},
+    {0x2994, GeneralCategory::Ps},   {0x2995, GeneralCategory::Pe},
+    {0x2996, GeneralCategory::Ps},   {0x2997, GeneralCategory::Pe},
+    {0x2998, GeneralCategory::Ps},   {0x2999, GeneralCategory::Pe},
+    {0x29d8, GeneralCategory::Sm},   {0x29d9, GeneralCategory::Ps},
+    {0x29da, GeneralCategory::Pe},   {0x29db, GeneralCategory::Ps},
+    {0x29dc, GeneralCategory::Pe},   {0x29fc, GeneralCategory::Sm},
+    {0x29fd, GeneralCategory::Ps},   {0x29fe, GeneralCategory::Pe},
+    {0x2b00, GeneralCategory::Sm},   {0x2b30, GeneralCategory::So},
+    {0x2b45, GeneralCategory::Sm},   {0x2b47, GeneralCategory::So},
+    {0x2b4d, GeneralCategory::Sm},   {0x2b74, GeneralCategory::So},
+    {0x2b76, GeneralCategory::Cn},   {0x2b96, GeneralCategory::So},
+    {0x2b97, GeneralCategory::Cn},   {0x2c00, GeneralCategory::So},
+    {0x2c2f, GeneralCategory::Lu},   {0x2c30, GeneralCategory::Cn},
+    {0x2c5f, GeneralCategory::Ll},   {0x2c60, GeneralCategory::Cn},
+    {0x2c61, GeneralCategory::Lu},   {0x2c62, GeneralCategory::Ll},
+    {0x2c65, GeneralCategory::Lu},   {0x2c67, GeneralCategory::Ll},
+    {0x2c68, GeneralCategory::Lu},   {0x2c69, GeneralCategory::Ll},
+    {0x2c6a, GeneralCategory::Lu},   {0x2c6b, GeneralCategory::Ll},
+    {0x2c6c, GeneralCategory::Lu},   {0x2c6d, GeneralCategory::Ll},
+    {0x2c71, GeneralCategory::Lu},   {0x2c72, GeneralCategory::Ll},
+    {0x2c73, GeneralCategory::Lu},   {0x2c75, GeneralCategory::Ll},
+    {0x2c76, GeneralCategory::Lu},   {0x2c7c, GeneralCategory::Ll},
+    {0x2c7e, GeneralCategory::Lm},   {0x2c81, GeneralCategory::Lu},
+    {0x2c82, GeneralCategory::Ll},   {0x2c83, GeneralCategory::Lu},
+    {0x2c84, GeneralCategory::Ll},   {0x2c85, GeneralCategory::Lu},
+    {0x2c86, GeneralCategory::Ll},   {0x2c87, GeneralCategory::Lu},
+    {0x2c88, GeneralCategory::Ll},   {0x2c89, GeneralCategory::Lu},
+    {0x2c8a, GeneralCategory::Ll},   {0x2c8b, GeneralCategory::Lu},
+    {0x2c8c, GeneralCategory::Ll},   {0x2c8d, GeneralCategory::Lu},
+    {0x2c8e, GeneralCategory::Ll},   {0x2c8f, GeneralCategory::Lu},
+    {0x2c90, GeneralCategory::Ll},   {0x2c91, GeneralCategory::Lu},
+    {0x2c92, GeneralCategory::Ll},   {0x2c93, GeneralCategory::Lu},
+    {0x2c94, GeneralCategory::Ll},   {0x2c95, GeneralCategory::Lu},
+    {0x2c96, GeneralCategory::Ll},   {0x2c97, GeneralCategory::Lu},
+    {0x2c98, GeneralCategory::Ll},   {0x2c99, GeneralCategory::Lu},
+    {0x2c9a, GeneralCategory::Ll},   {0x2c9b, GeneralCategory::Lu},
+    {0x2c9c, GeneralCategory::Ll},   {0x2c9d, GeneralCategory::Lu},
+    {0x2c9e, GeneralCategory::Ll},   {0x2c9f, GeneralCategory::Lu},
+    {0x2ca0, GeneralCategory::Ll},   {0x2ca1, GeneralCategory::Lu},
+    {0x2ca2, GeneralCategory::Ll},   {0x2ca3, GeneralCategory::Lu},
+    {0x2ca4, GeneralCategory::Ll},   {0x2ca5, GeneralCategory::Lu},
+    {0x2ca6, GeneralCategory::Ll},   {0x2ca7, GeneralCategory::Lu},
+    {0x2ca8, GeneralCategory::Ll},   {0x2ca9, GeneralCategory::Lu},
+    {0x2caa, GeneralCategory::Ll},   {0x2cab, GeneralCategory::Lu},
+    {0x2cac, GeneralCategory::Ll},   {0x2cad, GeneralCategory::Lu},
+    {0x2cae, GeneralCategory::Ll},   {0x2caf, GeneralCategory::Lu},
+    {0x2cb0, GeneralCategory::Ll},   {0x2cb1, GeneralCategory::Lu},
+    {0x2cb2, GeneralCategory::Ll},   {0x2cb3, GeneralCategory::Lu},
+    {0x2cb4, GeneralCategory::Ll},   {0x2cb5, GeneralCategory::Lu},
+    {0x2cb6, GeneralCategory::Ll},   {0x2cb7, GeneralCategory::Lu},
+    {0x2cb8, GeneralCategory::Ll},   {0x2cb9, GeneralCategory::Lu},
+    {0x2cba, GeneralCategory::Ll},   {0x2cbb, GeneralCategory::Lu},
+    {0x2cbc, GeneralCategory::Ll},   {0x2cbd, GeneralCategory::Lu},
+    {0x2cbe, GeneralCategory::Ll},   {0x2cbf, GeneralCategory::Lu},
+    {0x2cc0, GeneralCategory::Ll},   {0x2cc1, GeneralCategory::Lu},
+    {0x2cc2, GeneralCategory::Ll},   {0x2cc3, GeneralCategory::Lu},
+    {0x2cc4, GeneralCategory::Ll},   {0x2cc5, GeneralCategory::Lu},
+    {0x2cc6, GeneralCategory::Ll},   {0x2cc7, GeneralCategory::Lu},
+    {0x2cc8, GeneralCategory::Ll},   {0x2cc9, GeneralCategory::Lu},
+    {0x2cca, GeneralCategory::Ll},   {0x2ccb, GeneralCategory::Lu},
+    {0x2ccc, GeneralCategory::Ll},   {0x2ccd, GeneralCategory::Lu},
+    {0x2cce, GeneralCategory::Ll},   {0x2ccf, GeneralCategory::Lu},
+    {0x2cd0, GeneralCategory::Ll},   {0x2cd1, GeneralCategory::Lu},
+    {0x2cd2, GeneralCategory::Ll},   {0x2cd3, GeneralCategory::Lu},
+    {0x2cd4, GeneralCategory::Ll},   {0x2cd5, GeneralCategory::Lu},
+    {0x2cd6, GeneralCategory::Ll},   {0x2cd7, GeneralCategory::Lu},
+    {0x2cd8, GeneralCategory::Ll},   {0x2cd9, GeneralCategory::Lu},
+    {0x2cda, GeneralCategory::Ll},   {0x2cdb, GeneralCategory::Lu},
+    {0x2cdc, GeneralCategory::Ll},   {0x2cdd, GeneralCategory::Lu},
+    {0x2cde, GeneralCategory::Ll},   {0x2cdf, GeneralCategory::Lu},
+    {0x2ce0, GeneralCategory::Ll},   {0x2ce1, GeneralCategory::Lu},
+    {0x2ce2, GeneralCategory::Ll},   {0x2ce3, GeneralCategory::Lu},
+    {0x2ce5, GeneralCategory::Ll},   {0x2ceb, GeneralCategory::So},
+    {0x2cec, GeneralCategory::Lu},   {0x2ced, GeneralCategory::Ll},
+    {0x2cee, GeneralCategory::Lu},   {0x2cef, GeneralCategory::Ll},
+    {0x2cf2, GeneralCategory::Mn},   {0x2cf3, GeneralCategory::Lu},
+    {0x2cf4, GeneralCategory::Ll},   {0x2cf9, GeneralCategory::Cn},
+    {0x2cfd, GeneralCategory::Po},   {0x2cfe, GeneralCategory::No},
+    {0x2d00, GeneralCategory::Po},   {0x2d26, GeneralCategory::Ll},
+    {0x2d27, GeneralCategory::Cn},   {0x2d28, GeneralCategory::Ll},
+    {0x2d2d, GeneralCategory::Cn},   {0x2d2e, GeneralCategory::Ll},
+    {0x2d30, GeneralCategory::Cn},   {0x2d68, GeneralCategory::Lo},
+    {0x2d6f, GeneralCategory::Cn},   {0x2d70, GeneralCategory::Lm},
+    {0x2d71, GeneralCategory::Po},   {0x2d7f, GeneralCategory::Cn},
+    {0x2d80, GeneralCategory::Mn},   {0x2d97, GeneralCategory::Lo},
+    {0x2da0, GeneralCategory::Cn},   {0x2da7, GeneralCategory::Lo},
+    {0x2da8, GeneralCategory::Cn},   {0x2daf, GeneralCategory::Lo},
+    {0x2db0, GeneralCategory::Cn},   {0x2db7, GeneralCategory::Lo},
+    {0x2db8, GeneralCategory::Cn},   {0x2dbf, GeneralCategory::Lo},
+    {0x2dc0, GeneralCategory::Cn},   {0x2dc7, GeneralCategory::Lo},
+    {0x2dc8, GeneralCategory::Cn},   {0x2dcf, GeneralCategory::Lo},
+    {0x2dd0, GeneralCategory::Cn},   {0x2dd7, GeneralCategory::Lo},
+    {0x2dd8, GeneralCategory::Cn},   {0x2ddf, GeneralCategory::Lo},
+    {0x2de0, GeneralCategory::Cn},   {0x2e00, GeneralCategory::Mn},
+    {0x2e02, GeneralCategory::Po},   {0x2e03, GeneralCategory::Pi},
+    {0x2e04, GeneralCategory::Pf},   {0x2e05, GeneralCategory::Pi},
+    {0x2e06, GeneralCategory::Pf},   {0x2e09, GeneralCategory::Po},
+    {0x2e0a, GeneralCategory::Pi},   {0x2e0b, GeneralCategory::Pf},
+    {0x2e0c, GeneralCategory::Po},   {0x2e0d, GeneralCategory::Pi},
+    {0x2e0e, GeneralCategory::Pf},   {0x2e17, GeneralCategory::Po},
+    {0x2e18, GeneralCategory::Pd},   {0x2e1a, GeneralCategory::Po},
+    {0x2e1b, GeneralCategory::Pd},   {0x2e1c, GeneralCategory::Po},
+    {0x2e1d, GeneralCategory::Pi},   {0x2e1e, GeneralCategory::Pf},
+    {0x2e20, GeneralCategory::Po},   {0x2e21, GeneralCategory::Pi},
+    {0x2e22, GeneralCategory::Pf},   {0x2e23, GeneralCategory::Ps},
+    {0x2e24, GeneralCategory::Pe},   {0x2e25, GeneralCategory::Ps},
+    {0x2e26, GeneralCategory::Pe},   {0x2e27, GeneralCategory::Ps},
+    {0x2e28, GeneralCategory::Pe},   {0x2e29, GeneralCategory::Ps},
+    {0x2e2a, GeneralCategory::Pe},   {0x2e2f, GeneralCategory::Po},
+    {0x2e30, GeneralCategory::Lm},   {0x2e3a, GeneralCategory::Po},
+    {0x2e3c, GeneralCategory::Pd},   {0x2e40, GeneralCategory::Po},
+    {0x2e41, GeneralCategory::Pd},   {0x2e42, GeneralCategory::Po},
+    {0x2e43, GeneralCategory::Ps},   {0x2e50, GeneralCategory::Po},
+    {0x2e52, GeneralCategory::So},   {0x2e53, GeneralCategory::Po},
+    {0x2e80, GeneralCategory::Cn},   {0x2e9a, GeneralCategory::So},
+    {0x2e9b, GeneralCategory::Cn},   {0x2ef4, GeneralCategory::So},
+    {0x2f00, GeneralCategory::Cn},   {0x2fd6, GeneralCategory::So},
+    {0x2ff0, GeneralCategory::Cn},   {0x2ffc, GeneralCategory::So},
+    {0x3000, GeneralCategory::Cn},   {0x3001, GeneralCategory::Zs},
+    {0x3004, GeneralCategory::Po},   {0x3005, GeneralCategory::So},
+    {0x3006, GeneralCategory::Lm},   {0x3007, GeneralCategory::Lo},
+    {0x3008, GeneralCategory::Nl},   {0x3009, GeneralCategory::Ps},
+    {0x300a, GeneralCategory::Pe},   {0x300b, GeneralCategory::Ps},
+    {0x300c, GeneralCategory::Pe},   {0x300d, GeneralCategory::Ps},
+    {0x300e, GeneralCategory::Pe},   {0x300f, GeneralCategory::Ps},
+    {0x3010, GeneralCategory::Pe},   {0x3011, GeneralCategory::Ps},
+    {0x3012, GeneralCategory::Pe},   {0x3014, GeneralCategory::So},
+    {0x3015, GeneralCategory::Ps},   {0x3016, GeneralCategory::Pe},
+    {0x3017, GeneralCategory::Ps},   {0x3018, GeneralCategory::Pe},
+    {0x3019, GeneralCategory::Ps},   {0x301a, GeneralCategory::Pe},
+    {0x301b, GeneralCategory::Ps},   {0x301c, GeneralCategory::Pe},
+    {0x301d, GeneralCategory::Pd},   {0x301e, GeneralCategory::Ps},
+    {0x3020, GeneralCategory::Pe},   {0x3021, GeneralCategory::So},
+    {0x302a, GeneralCategory::Nl},   {0x302e, GeneralCategory::Mn},
+    {0x3030, GeneralCategory::Mc},   {0x3031, GeneralCategory::Pd},
+    {0x3036, GeneralCategory::Lm},   {0x3038, GeneralCategory::So},
+    {0x303b, GeneralCategory::Nl},   {0x303c, GeneralCategory::Lm},
+    {0x303d, GeneralCategory::Lo},   {0x303e, GeneralCategory::Po},
+    {0x3040, GeneralCategory::So},   {0x3041, GeneralCategory::Cn},
+    {0x3097, GeneralCategory::Lo},   {0x3099, GeneralCategory::Cn},
+    {0x309b, GeneralCategory::Mn},   {0x309d, GeneralCategory::Sk},
+    {0x309f, GeneralCategory::Lm},   {0x30a0, GeneralCategory::Lo},
+    {0x30a1, GeneralCategory::Pd},   {0x30fb, GeneralCategory::Lo},
+    {0x30fc, GeneralCategory::Po},   {0x30ff, GeneralCategory::Lm},
+    {0x3100, GeneralCategory::Lo},   {0x3105, GeneralCategory::Cn},
+    {0x3130, GeneralCategory::Lo},   {0x3131, GeneralCategory::Cn},
+    {0x318f, GeneralCategory::Lo},   {0x3190, GeneralCategory::Cn},
+    {0x3192, GeneralCategory::So},   {0x3196, GeneralCategory::No},
+    {0x31a0, GeneralCategory::So},   {0x31c0, GeneralCategory::Lo},
+    {0x31e4, GeneralCategory::So},   {0x31f0, GeneralCategory::Cn},
+    {0x3200, GeneralCategory::Lo},   {0x321f, GeneralCategory::So},
+    {0x3220, GeneralCategory::Cn},   {0x322a, GeneralCategory::No},
+    {0x3248, GeneralCategory::So},   {0x3250, GeneralCategory::No},
+    {0x3251, GeneralCategory::So},   {0x3260, GeneralCategory::No},
+    {0x3280, GeneralCategory::So},   {0x328a, GeneralCategory::No},
+    {0x32b1, GeneralCategory::So},   {0x32c0, GeneralCategory::No},
+    {0x3400, GeneralCategory::So},   {0x4dc0, GeneralCategory::Lo},
+    {0x4e00, GeneralCategory::So},   {0x9ffd, GeneralCategory::Lo},
+    {0xa000, GeneralCategory::Cn},   {0xa015, GeneralCategory::Lo},
+    {0xa016, GeneralCategory::Lm},   {0xa48d, GeneralCategory::Lo},
+    {0xa490, GeneralCategory::Cn},   {0xa4c7, GeneralCategory::So},
+    {0xa4d0, GeneralCategory::Cn},   {0xa4f8, GeneralCategory::Lo},
+    {0xa4fe, GeneralCategory::Lm},   {0xa500, GeneralCategory::Po},
+    {0xa60c, GeneralCategory::Lo},   {0xa60d, GeneralCategory::Lm},
+    {0xa610, GeneralCategory::Po},   {0xa620, GeneralCategory::Lo},
+    {0xa62a, GeneralCategory::Nd},   {0xa62c, GeneralCategory::Lo},
+    {0xa640, GeneralCategory::Cn},   {0xa641, GeneralCategory::Lu},
+    {0xa642, GeneralCategory::Ll},   {0xa643, GeneralCategory::Lu},
+    {0xa644, GeneralCategory::Ll},   {0xa645, GeneralCategory::Lu},
+    {0xa646, GeneralCategory::Ll},   {0xa647, GeneralCategory::Lu},
+    {0xa648, GeneralCategory::Ll},   {0xa649, GeneralCategory::Lu},
+    {0xa64a, GeneralCategory::Ll},   {0xa64b, GeneralCategory::Lu},
+    {0xa64c, GeneralCategory::Ll},   {0xa64d, GeneralCategory::Lu},
+    {0xa64e, GeneralCategory::Ll},   {0xa64f, GeneralCategory::Lu},
+    {0xa650, GeneralCategory::Ll},   {0xa651, GeneralCategory::Lu},
+    {0xa652, GeneralCategory::Ll},   {0xa653, GeneralCategory::Lu},
+    {0xa654, GeneralCategory::Ll},   {0xa655, GeneralCategory::Lu},
+    {0xa656, GeneralCategory::Ll},   {0xa657, GeneralCategory::Lu},
+    {0xa658, GeneralCategory::Ll},   {0xa659, GeneralCategory::Lu},
+    {0xa65a, GeneralCategory::Ll},   {0xa65b, GeneralCategory::Lu},
+    {0xa65c, GeneralCategory::Ll},   {0xa65d, GeneralCategory::Lu},
+    {0xa65e, GeneralCategory::Ll},   {0xa65f, GeneralCategory::Lu},
+    {0xa660, GeneralCategory::Ll},   {0xa661, GeneralCategory::Lu},
+    {0xa662, GeneralCategory::Ll},   {0xa663, GeneralCategory::Lu},
+    {0xa664, GeneralCategory::Ll},   {0xa665, GeneralCategory::Lu},
+    {0xa666, GeneralCategory::Ll},   {0xa667, GeneralCategory::Lu},
+    {0xa668, GeneralCategory::Ll},   {0xa669, GeneralCategory::Lu},
+    {0xa66a, GeneralCategory::Ll},   {0xa66b, GeneralCategory::Lu},
+    {0xa66c, GeneralCategory::Ll},   {0xa66d, GeneralCategory::Lu},
+    {0xa66e, GeneralCategory::Ll},   {0xa66f, GeneralCategory::Lo},
+    {0xa670, GeneralCategory::Mn},   {0xa673, GeneralCategory::Me},
+    {0xa674, GeneralCategory::Po},   {0xa67e, GeneralCategory::Mn},
+    {0xa67f, GeneralCategory::Po},   {0xa680, GeneralCategory::Lm},
+    {0xa681, GeneralCategory::Lu},   {0xa682, GeneralCategory::Ll},
+    {0xa683, GeneralCategory::Lu},   {0xa684, GeneralCategory::Ll},
+    {0xa685, GeneralCategory::Lu},   {0xa686, GeneralCategory::Ll},
+    {0xa687, GeneralCategory::Lu},   {0xa688, GeneralCategory::Ll},
+    {0xa689, GeneralCategory::Lu},   {0xa68a, GeneralCategory::Ll},
+    {0xa68b, GeneralCategory::Lu},   {0xa68c, GeneralCategory::Ll},
+    {0xa68d, GeneralCategory::Lu},   {0xa68e, GeneralCategory::Ll},
+    {0xa68f, GeneralCategory::Lu},   {0xa690, GeneralCategory::Ll},
+    {0xa691, GeneralCategory::Lu},   {0xa692, GeneralCategory::Ll},
+    {0xa693, GeneralCategory::Lu},   {0xa694, GeneralCategory::Ll},
+    {0xa695, GeneralCategory::Lu},   {0xa696, GeneralCategory::Ll},
+    {0xa697, GeneralCategory::Lu},   {0xa698, GeneralCategory::Ll},
+    {0xa699, GeneralCategory::Lu},   {0xa69a, GeneralCategory::Ll},
+    {0xa69b, GeneralCategory::Lu},   {0xa69c, GeneralCategory::Ll},
+    {0xa69e, GeneralCategory::Lm},   {0xa6a0, GeneralCategory::Mn},
+    {0xa6e6, GeneralCategory::Lo},   {0xa6f0, GeneralCategory::Nl},
+    {0xa6f2, GeneralCategory::Mn},   {0xa6f8, GeneralCategory::Po},
+    {0xa700, GeneralCategory::Cn},   {0xa717, GeneralCategory::Sk},
+    {0xa720, GeneralCategory::Lm},   {0xa722, GeneralCategory::Sk},
+    {0xa723, GeneralCategory::Lu},   {0xa724, GeneralCategory::Ll},
+    {0xa725, GeneralCategory::Lu},   {0xa726, GeneralCategory::Ll},
+    {0xa727, GeneralCategory::Lu},   {0xa728, GeneralCategory::Ll},
+    {0xa729, GeneralCategory::Lu},   {0xa72a, GeneralCategory::Ll},
+    {0xa72b, GeneralCategory::Lu},   {0xa72c, GeneralCategory::Ll},
+    {0xa72d, GeneralCategory::Lu},   {0xa72e, GeneralCategory::Ll},
+    {0xa72f, GeneralCategory::Lu},   {0xa732, GeneralCategory::Ll},
+    {0xa733, GeneralCategory::Lu},   {0xa734, GeneralCategory::Ll},
+    {0xa735, GeneralCategory::Lu},   {0xa736, GeneralCategory::Ll},
+    {0xa737, GeneralCategory::Lu},   {0xa738, GeneralCategory::Ll},
+    {0xa739, GeneralCategory::Lu},   {0xa73a, GeneralCategory::Ll},
+    {0xa73b, GeneralCategory::Lu},   {0xa73c, GeneralCategory::Ll},
+    {0xa73d, GeneralCategory::Lu},   {0xa73e, GeneralCategory::Ll},
+    {0xa73f, GeneralCategory::Lu},   {0xa740, GeneralCategory::Ll},
+    {0xa741, GeneralCategory::Lu},   {0xa742, GeneralCategory::Ll},
+    {0xa743, GeneralCategory::Lu},   {0xa744, GeneralCategory::Ll},
+    {0xa745, GeneralCategory::Lu},   {0xa746, GeneralCategory::Ll},
+    {0xa747, GeneralCategory::Lu},   {0xa748, GeneralCategory::Ll},
+    {0xa749, GeneralCategory::Lu},   {0xa74a, GeneralCategory::Ll},
+    {0xa74b, GeneralCategory::Lu},   {0xa74c, GeneralCategory::Ll},
+    {0xa74d, GeneralCategory::Lu},   {0xa74e, GeneralCategory::Ll},
+    {0xa74f, GeneralCategory::Lu},   {0xa750, GeneralCategory::Ll},
+    {0xa751, GeneralCategory::Lu},   {0xa752, GeneralCategory::Ll},
+    {0xa753, GeneralCategory::Lu},   {0xa754, GeneralCategory::Ll},
+    {0xa755, GeneralCategory::Lu},   {0xa756, GeneralCategory::Ll},
+    {0xa757, GeneralCategory::Lu},   {0xa758, GeneralCategory::Ll},
+    {0xa759, GeneralCategory::Lu},   {0xa75a, GeneralCategory::Ll},
+    {0xa75b, GeneralCategory::Lu},   {0xa75c, GeneralCategory::Ll},
+    {0xa75d, GeneralCategory::Lu},   {0xa75e, GeneralCategory::Ll},
+    {0xa75f, GeneralCategory::Lu},   {0xa760, GeneralCategory::Ll},
+    {0xa761, GeneralCategory::Lu},   {0xa762, GeneralCategory::Ll},
+    {0xa763, GeneralCategory::Lu},   {0xa764, GeneralCategory::Ll},
+    {0xa765, GeneralCategory::Lu},   {0xa766, GeneralCategory::Ll},
+    {0xa767, GeneralCategory::Lu},   {0xa768, GeneralCategory::Ll},
+    {0xa769, GeneralCategory::Lu},   {0xa76a, GeneralCategory::Ll},
+    {0xa76b, GeneralCategory::Lu},   {0xa76c, GeneralCategory::Ll},
+    {0xa76d, GeneralCategory::Lu},   {0xa76e, GeneralCategory::Ll},
+    {0xa76f, GeneralCategory::Lu},   {0xa770, GeneralCategory::Ll},
+    {0xa771, GeneralCategory::Lm},   {0xa779, GeneralCategory::Ll},
+    {0xa77a, GeneralCategory::Lu},   {0xa77b, GeneralCategory::Ll},
+    {0xa77c, GeneralCategory::Lu},   {0xa77d, GeneralCategory::Ll},
+    {0xa77f, GeneralCategory::Lu},   {0xa780, GeneralCategory::Ll},
+    {0xa781, GeneralCategory::Lu},   {0xa782, GeneralCategory::Ll},
+    {0xa783, GeneralCategory::Lu},   {0xa784, GeneralCategory::Ll},
+    {0xa785, GeneralCategory::Lu},   {0xa786, GeneralCategory::Ll},
+    {0xa787, GeneralCategory::Lu},   {0xa788, GeneralCategory::Ll},
+    {0xa789, GeneralCategory::Lm},   {0xa78b, GeneralCategory::Sk},
+    {0xa78c, GeneralCategory::Lu},   {0xa78d, GeneralCategory::Ll},
+    {0xa78e, GeneralCategory::Lu},   {0xa78f, GeneralCategory::Ll},
+    {0xa790, GeneralCategory::Lo},   {0xa791, GeneralCategory::Lu},
+    {0xa792, GeneralCategory::Ll},   {0xa793, GeneralCategory::Lu},
+    {0xa796, GeneralCategory::Ll},   {0xa797, GeneralCategory::Lu},
+    {0xa798, GeneralCategory::Ll},   {0xa799, GeneralCategory::Lu},
+    {0xa79a, GeneralCategory::Ll},   {0xa79b, GeneralCategory::Lu},
+    {0xa79c, GeneralCategory::Ll},   {0xa79d, GeneralCategory::Lu},
+    {0xa79e, GeneralCategory::Ll},   {0xa79f, GeneralCategory::Lu},
+    {0xa7a0, GeneralCategory::Ll},   {0xa7a1, GeneralCategory::Lu},
+    {0xa7a2, GeneralCategory::Ll},   {0xa7a3, GeneralCategory::Lu},
+    {0xa7a4, GeneralCategory::Ll},   {0xa7a5, GeneralCategory::Lu},
+    {0xa7a6, GeneralCategory::Ll},   {0xa7a7, GeneralCategory::Lu},
+    {0xa7a8, GeneralCategory::Ll},   {0xa7a9, GeneralCategory::Lu},
+    {0xa7aa, GeneralCategory::Ll},   {0xa7af, GeneralCategory::Lu},
+    {0xa7b0, GeneralCategory::Ll},   {0xa7b5, GeneralCategory::Lu},
+    {0xa7b6, GeneralCategory::Ll},   {0xa7b7, GeneralCategory::Lu},
+    {0xa7b8, GeneralCategory::Ll},   {0xa7b9, GeneralCategory::Lu},
+    {0xa7ba, GeneralCategory::Ll},   {0xa7bb, GeneralCategory::Lu},
+    {0xa7bc, GeneralCategory::Ll},   {0xa7bd, GeneralCategory::Lu},
+    {0xa7be, GeneralCategory::Ll},   {0xa7bf, GeneralCategory::Lu},
+    {0xa7c0, GeneralCategory::Ll},   {0xa7c2, GeneralCategory::Cn},
+    {0xa7c3, GeneralCategory::Lu},   {0xa7c4, GeneralCategory::Ll},
+    {0xa7c8, GeneralCategory::Lu},   {0xa7c9, GeneralCategory::Ll},
+    {0xa7ca, GeneralCategory::Lu},   {0xa7cb, GeneralCategory::Ll},
+    {0xa7f5, GeneralCategory::Cn},   {0xa7f6, GeneralCategory::Lu},
+    {0xa7f7, GeneralCategory::Ll},   {0xa7f8, GeneralCategory::Lo},
+    {0xa7fa, GeneralCategory::Lm},   {0xa7fb, GeneralCategory::Ll},
+    {0xa802, GeneralCategory::Lo},   {0xa803, GeneralCategory::Mn},
+    {0xa806, GeneralCategory::Lo},   {0xa807, GeneralCategory::Mn},
+    {0xa80b, GeneralCategory::Lo},   {0xa80c, GeneralCategory::Mn},
+    {0xa823, GeneralCategory::Lo},   {0xa825, GeneralCategory::Mc},
+    {0xa827, GeneralCategory::Mn},   {0xa828, GeneralCategory::Mc},
+    {0xa82c, GeneralCategory::So},   {0xa82d, GeneralCategory::Mn},
+    {0xa830, GeneralCategory::Cn},   {0xa836, GeneralCategory::No},
+    {0xa838, GeneralCategory::So},   {0xa839, GeneralCategory::Sc},
+    {0xa83a, GeneralCategory::So},   {0xa840, GeneralCategory::Cn},
+    {0xa874, GeneralCategory::Lo},   {0xa878, GeneralCategory::Po},
+    {0xa880, GeneralCategory::Cn},   {0xa882, GeneralCategory::Mc},
+    {0xa8b4, GeneralCategory::Lo},   {0xa8c4, GeneralCategory::Mc},
+    {0xa8c6, GeneralCategory::Mn},   {0xa8ce, GeneralCategory::Cn},
+    {0xa8d0, GeneralCategory::Po},   {0xa8da, GeneralCategory::Nd},
+    {0xa8e0, GeneralCategory::Cn},   {0xa8f2, GeneralCategory::Mn},
+    {0xa8f8, GeneralCategory::Lo},   {0xa8fb, GeneralCategory::Po},
+    {0xa8fc, GeneralCategory::Lo},   {0xa8fd, GeneralCategory::Po},
+    {0xa8ff, GeneralCategory::Lo},   {0xa900, GeneralCategory::Mn},
+    {0xa90a, GeneralCategory::Nd},   {0xa926, GeneralCategory::Lo},
+    {0xa92e, GeneralCategory::Mn},   {0xa930, GeneralCategory::Po},
+    {0xa947, GeneralCategory::Lo},   {0xa952, GeneralCategory::Mn},
+    {0xa954, GeneralCategory::Mc},   {0xa95f, GeneralCategory::Cn},
+    {0xa960, GeneralCategory::Po},   {0xa97d, GeneralCategory::Lo},
+    {0xa980, GeneralCategory::Cn},   {0xa983, GeneralCategory::Mn},
+    {0xa984, GeneralCategory::Mc},   {0xa9b3, GeneralCategory::Lo},
+    {0xa9b4, GeneralCategory::Mn},   {0xa9b6, GeneralCategory::Mc},
+    {0xa9ba, GeneralCategory::Mn},   {0xa9bc, GeneralCategory::Mc},
+    {0xa9be, GeneralCategory::Mn},   {0xa9c1, GeneralCategory::Mc},
+    {0xa9ce, GeneralCategory::Po},   {0xa9cf, GeneralCategory::Cn},
+    {0xa9d0, GeneralCategory::Lm},   {0xa9da, GeneralCategory::Nd},
+    {0xa9de, GeneralCategory::Cn},   {0xa9e0, GeneralCategory::Po},
+    {0xa9e5, GeneralCategory::Lo},   {0xa9e6, GeneralCategory::Mn},
+    {0xa9e7, GeneralCategory::Lm},   {0xa9f0, GeneralCategory::Lo},
+    {0xa9fa, GeneralCategory::Nd},   {0xa9ff, GeneralCategory::Lo},
+    {0xaa00, GeneralCategory::Cn},   {0xaa29, GeneralCategory::Lo},
+    {0xaa2f, GeneralCategory::Mn},   {0xaa31, GeneralCategory::Mc},
+    {0xaa33, GeneralCategory::Mn},   {0xaa35, GeneralCategory::Mc},
+    {0xaa37, GeneralCategory::Mn},   {0xaa40, GeneralCategory::Cn},
+    {0xaa43, GeneralCategory::Lo},   {0xaa44, GeneralCategory::Mn},
+    {0xaa4c, GeneralCategory::Lo},   {0xaa4d, GeneralCategory::Mn},
+    {0xaa4e, GeneralCategory::Mc},   {0xaa50, GeneralCategory::Cn},
+    {0xaa5a, GeneralCategory::Nd},   {0xaa5c, GeneralCategory::Cn},
+    {0xaa60, GeneralCategory::Po},   {0xaa70, GeneralCategory::Lo},
+    {0xaa71, GeneralCategory::Lm},   {0xaa77, GeneralCategory::Lo},
+    {0xaa7a, GeneralCategory::So},   {0xaa7b, GeneralCategory::Lo},
+    {0xaa7c, GeneralCategory::Mc},   {0xaa7d, GeneralCategory::Mn},
+    {0xaa7e, GeneralCategory::Mc},   {0xaab0, GeneralCategory::Lo},
+    {0xaab1, GeneralCategory::Mn},   {0xaab2, GeneralCategory::Lo},
+    {0xaab5, GeneralCategory::Mn},   {0xaab7, GeneralCategory::Lo},
+    {0xaab9, GeneralCategory::Mn},   {0xaabe, GeneralCategory::Lo},
+    {0xaac0, GeneralCategory::Mn},   {0xaac1, GeneralCategory::Lo},
+    {0xaac2, GeneralCategory::Mn},   {0xaac3, GeneralCategory::Lo},
+    {0xaadb, GeneralCategory::Cn},   {0xaadd, GeneralCategory::Lo},
+    {0xaade, GeneralCategory::Lm},   {0xaae0, GeneralCategory::Po},
+    {0xaaeb, GeneralCategory::Lo},   {0xaaec, GeneralCategory::Mc},
+    {0xaaee, GeneralCategory::Mn},   {0xaaf0, GeneralCategory::Mc},
+    {0xaaf2, GeneralCategory::Po},   {0xaaf3, GeneralCategory::Lo},
+    {0xaaf5, GeneralCategory::Lm},   {0xaaf6, GeneralCategory::Mc},
+    {0xaaf7, GeneralCategory::Mn},   {0xab01, GeneralCategory::Cn},
+    {0xab07, GeneralCategory::Lo},   {0xab09, GeneralCategory::Cn},
+    {0xab0f, GeneralCategory::Lo},   {0xab11, GeneralCategory::Cn},
+    {0xab17, GeneralCategory::Lo},   {0xab20, GeneralCategory::Cn},
+    {0xab27, GeneralCategory::Lo},   {0xab28, GeneralCategory::Cn},
+    {0xab2f, GeneralCategory::Lo},   {0xab30, GeneralCategory::Cn},
+    {0xab5b, GeneralCategory::Ll},   {0xab5c, GeneralCategory::Sk},
+    {0xab60, GeneralCategory::Lm},   {0xab69, GeneralCategory::Ll},
+    {0xab6a, GeneralCategory::Lm},   {0xab6c, GeneralCategory::Sk},
+    {0xab70, GeneralCategory::Cn},   {0xabc0, GeneralCategory::Ll},
+    {0xabe3, GeneralCategory::Lo},   {0xabe5, GeneralCategory::Mc},
+    {0xabe6, GeneralCategory::Mn},   {0xabe8, GeneralCategory::Mc},
+    {0xabe9, GeneralCategory::Mn},   {0xabeb, GeneralCategory::Mc},
+    {0xabec, GeneralCategory::Po},   {0xabed, GeneralCategory::Mc},
+    {0xabee, GeneralCategory::Mn},   {0xabf0, GeneralCategory::Cn},
+    {0xabfa, GeneralCategory::Nd},   {0xac00, GeneralCategory::Cn},
+    {0xd7a4, GeneralCategory::Lo},   {0xd7b0, GeneralCategory::Cn},
+    {0xd7c7, GeneralCategory::Lo},   {0xd7cb, GeneralCategory::Cn},
+    {0xd7fc, GeneralCategory::Lo},   {0xd800, GeneralCategory::Cn},
+    {0xe000, GeneralCategory::Cs},   {0xf900, GeneralCategory::Co},
+    {0xfa6e, GeneralCategory::Lo},   {0xfa70, GeneralCategory::Cn},
+    {0xfada, GeneralCategory::Lo},   {0xfb00, GeneralCategory::Cn},
+    {0xfb07, GeneralCategory::Ll},   {0xfb13, GeneralCategory::Cn},
+    {0xfb18, GeneralCategory::Ll},   {0xfb1d, GeneralCategory::Cn},
+    {0xfb1e, GeneralCategory::Lo},   {0xfb1f, GeneralCategory::Mn},
+    {0xfb29, GeneralCategory::Lo},   {0xfb2a, GeneralCategory::Sm},
+    {0xfb37, GeneralCategory::Lo},   {0xfb38, GeneralCategory::Cn},
+    {0xfb3d, GeneralCategory::Lo},   {0xfb3e, GeneralCategory::Cn},
+    {0xfb3f, GeneralCategory::Lo},   {0xfb40, GeneralCategory::Cn},
+    {0xfb42, GeneralCategory::Lo},   {0xfb43, GeneralCategory::Cn},
+    {0xfb45, GeneralCategory::Lo},   {0xfb46, GeneralCategory::Cn},
+    {0xfbb2, GeneralCategory::Lo},   {0xfbc2, GeneralCategory::Sk},
+    {0xfbd3, GeneralCategory::Cn},   {0xfd3e, GeneralCategory::Lo},
+    {0xfd3f, GeneralCategory::Pe},   {0xfd40, GeneralCategory::Ps},
+    {0xfd50, GeneralCategory::Cn},   {0xfd90, GeneralCategory::Lo},
+    {0xfd92, GeneralCategory::Cn},   {0xfdc8, GeneralCategory::Lo},
+    {0xfdf0, GeneralCategory::Cn},   {0xfdfc, GeneralCategory::Lo},
+    {0xfdfd, GeneralCategory::Sc},   {0xfdfe, GeneralCategory::So},
+    {0xfe00, GeneralCategory::Cn},   {0xfe10, GeneralCategory::Mn},
+    {0xfe17, GeneralCategory::Po},   {0xfe18, GeneralCategory::Ps},
+    {0xfe19, GeneralCategory::Pe},   {0xfe1a, GeneralCategory::Po},
+    {0xfe20, GeneralCategory::Cn},   {0xfe30, GeneralCategory::Mn},
+    {0xfe31, GeneralCategory::Po},   {0xfe33, GeneralCategory::Pd},
+    {0xfe35, GeneralCategory::Pc},   {0xfe36, GeneralCategory::Ps},
+    {0xfe37, GeneralCategory::Pe},   {0xfe38, GeneralCategory::Ps},
+    {0xfe39, GeneralCategory::Pe},   {0xfe3a, GeneralCategory::Ps},
+    {0xfe3b, GeneralCategory::Pe},   {0xfe3c, GeneralCategory::Ps},
+    {0xfe3d, GeneralCategory::Pe},   {0xfe3e, GeneralCategory::Ps},
+    {0xfe3f, GeneralCategory::Pe},   {0xfe40, GeneralCategory::Ps},
+    {0xfe41, GeneralCategory::Pe},   {0xfe42, GeneralCategory::Ps},
+    {0xfe43, GeneralCategory::Pe},   {0xfe44, GeneralCategory::Ps},
+    {0xfe45, GeneralCategory::Pe},   {0xfe47, GeneralCategory::Po},
+    {0xfe48, GeneralCategory::Ps},   {0xfe49, GeneralCategory::Pe},
+    {0xfe4d, GeneralCategory::Po},   {0xfe50, GeneralCategory::Pc},
+    {0xfe53, GeneralCategory::Po},   {0xfe54, GeneralCategory::Cn},
+    {0xfe58, GeneralCategory::Po},   {0xfe59, GeneralCategory::Pd},
+    {0xfe5a, GeneralCategory::Ps},   {0xfe5b, GeneralCategory::Pe},
+    {0xfe5c, GeneralCategory::Ps},   {0xfe5d, GeneralCategory::Pe},
+    {0xfe5e, GeneralCategory::Ps},   {0xfe5f, GeneralCategory::Pe},
+    {0xfe62, GeneralCategory::Po},   {0xfe63, GeneralCategory::Sm},
+    {0xfe64, GeneralCategory::Pd},   {0xfe67, GeneralCategory::Sm},
+    {0xfe68, GeneralCategory::Cn},   {0xfe69, GeneralCategory::Po},
+    {0xfe6a, GeneralCategory::Sc},   {0xfe6c, GeneralCategory::Po},
+    {0xfe70, GeneralCategory::Cn},   {0xfe75, GeneralCategory::Lo},
+    {0xfe76, GeneralCategory::Cn},   {0xfefd, GeneralCategory::Lo},
+    {0xfeff, GeneralCategory::Cn},   {0xff00, GeneralCategory::Cf},
+    {0xff01, GeneralCategory::Cn},   {0xff04, GeneralCategory::Po},
+    {0xff05, GeneralCategory::Sc},   {0xff08, GeneralCategory::Po},
+    {0xff09, GeneralCategory::Ps},   {0xff0a, GeneralCategory::Pe},
+    {0xff0b, GeneralCategory::Po},   {0xff0c, GeneralCategory::Sm},
+    {0xff0d, GeneralCategory::Po},   {0xff0e, GeneralCategory::Pd},
+    {0xff10, GeneralCategory::Po},   {0xff1a, GeneralCategory::Nd},
+    {0xff1c, GeneralCategory::Po},   {0xff1f, GeneralCategory::Sm},
+    {0xff21, GeneralCategory::Po},   {0xff3b, GeneralCategory::Lu},
+    {0xff3c, GeneralCategory::Ps},   {0xff3d, GeneralCategory::Po},
+    {0xff3e, GeneralCategory::Pe},   {0xff3f, GeneralCategory::Sk},
+    {0xff40, GeneralCategory::Pc},   {0xff41, GeneralCategory::Sk},
+    {0xff5b, GeneralCategory::Ll},   {0xff5c, GeneralCategory::Ps},
+    {0xff5d, GeneralCategory::Sm},   {0xff5e, GeneralCategory::Pe},
+    {0xff5f, GeneralCategory::Sm},   {0xff60, GeneralCategory::Ps},
+    {0xff61, GeneralCategory::Pe},   {0xff62, GeneralCategory::Po},
+    {0xff63, GeneralCategory::Ps},   {0xff64, GeneralCategory::Pe},
+    {0xff66, GeneralCategory::Po},   {0xff70, GeneralCategory::Lo},
+    {0xff71, GeneralCategory::Lm},   {0xff9e, GeneralCategory::Lo},
+    {0xffa0, GeneralCategory::Lm},   {0xffbf, GeneralCategory::Lo},
+    {0xffc2, GeneralCategory::Cn},   {0xffc8, GeneralCategory::Lo},
+    {0xffca, GeneralCategory::Cn},   {0xffd0, GeneralCategory::Lo},
+    {0xffd2, GeneralCategory::Cn},   {0xffd8, GeneralCategory::Lo},
+    {0xffda, GeneralCategory::Cn},   {0xffdd, GeneralCategory::Lo},
+    {0xffe0, GeneralCategory::Cn},   {0xffe2, GeneralCategory::Sc},
+    {0xffe3, GeneralCategory::Sm},   {0xffe4, GeneralCategory::Sk},
+    {0xffe5, GeneralCategory::So},   {0xffe7, GeneralCategory::Sc},
+    {0xffe8, GeneralCategory::Cn},   {0xffe9, GeneralCategory::So},
+    {0xffed, GeneralCategory::Sm},   {0xffef, GeneralCategory::So},
+    {0xfff9, GeneralCategory::Cn},   {0xfffc, GeneralCategory::Cf},
+    {0xfffe, GeneralCategory::So},   {0x10000, GeneralCategory::Cn},
+    {0x1000c, GeneralCategory::Lo},  {0x1000d, GeneralCategory::Cn},
+    {0x10027, GeneralCategory::Lo},  {0x10028, GeneralCategory::Cn},
+    {0x1003b, GeneralCategory::Lo},  {0x1003c, GeneralCategory::Cn},
+    {0x1003e, GeneralCategory::Lo},  {0x1003f, GeneralCategory::Cn},
+    {0x1004e, GeneralCategory::Lo},  {0x10050, GeneralCategory::Cn},
+    {0x1005e, GeneralCategory::Lo},  {0x10080, GeneralCategory::Cn},
+    {0x100fb, GeneralCategory::Lo},  {0x10100, GeneralCategory::Cn},
+    {0x10103, GeneralCategory::Po},  {0x10107, GeneralCategory::Cn},
+    {0x10134, GeneralCategory::No},  {0x10137, GeneralCategory::Cn},
+    {0x10140, GeneralCategory::So},  {0x10175, GeneralCategory::Nl},
+    {0x10179, GeneralCategory::No},  {0x1018a, GeneralCategory::So},
+    {0x1018c, GeneralCategory::No},  {0x1018f, GeneralCategory::So},
+    {0x10190, GeneralCategory::Cn},  {0x1019d, GeneralCategory::So},
+    {0x101a0, GeneralCategory::Cn},  {0x101a1, GeneralCategory::So},
+    {0x101d0, GeneralCategory::Cn},  {0x101fd, GeneralCategory::So},
+    {0x101fe, GeneralCategory::Mn},  {0x10280, GeneralCategory::Cn},
+    {0x1029d, GeneralCategory::Lo},  {0x102a0, GeneralCategory::Cn},
+    {0x102d1, GeneralCategory::Lo},  {0x102e0, GeneralCategory::Cn},
+    {0x102e1, GeneralCategory::Mn},  {0x102fc, GeneralCategory::No},
+    {0x10300, GeneralCategory::Cn},  {0x10320, GeneralCategory::Lo},
+    {0x10324, GeneralCategory::No},  {0x1032d, GeneralCategory::Cn},
+    {0x10341, GeneralCategory::Lo},  {0x10342, GeneralCategory::Nl},
+    {0x1034a, GeneralCategory::Lo},  {0x1034b, GeneralCategory::Nl},
+    {0x10350, GeneralCategory::Cn},  {0x10376, GeneralCategory::Lo},
+    {0x1037b, GeneralCategory::Mn},  {0x10380, GeneralCategory::Cn},
+    {0x1039e, GeneralCategory::Lo},  {0x1039f, GeneralCategory::Cn},
+    {0x103a0, GeneralCategory::Po},  {0x103c4, GeneralCategory::Lo},
+    {0x103c8, GeneralCategory::Cn},  {0x103d0, GeneralCategory::Lo},
+    {0x103d1, GeneralCategory::Po},  {0x103d6, GeneralCategory::Nl},
+    {0x10400, GeneralCategory::Cn},  {0x10428, GeneralCategory::Lu},
+    {0x10450, GeneralCategory::Ll},  {0x1049e, GeneralCategory::Lo},
+    {0x104a0, GeneralCategory::Cn},  {0x104aa, GeneralCategory::Nd},
+    {0x104b0, GeneralCategory::Cn},  {0x104d4, GeneralCategory::Lu},
+    {0x104d8, GeneralCategory::Cn},  {0x104fc, GeneralCategory::Ll},
+    {0x10500, GeneralCategory::Cn},  {0x10528, GeneralCategory::Lo},
+    {0x10530, GeneralCategory::Cn},  {0x10564, GeneralCategory::Lo},
+    {0x1056f, GeneralCategory::Cn},  {0x10570, GeneralCategory::Po},
+    {0x10600, GeneralCategory::Cn},  {0x10737, GeneralCategory::Lo},
+    {0x10740, GeneralCategory::Cn},  {0x10756, GeneralCategory::Lo},
+    {0x10760, GeneralCategory::Cn},  {0x10768, GeneralCategory::Lo},
+    {0x10800, GeneralCategory::Cn},  {0x10806, GeneralCategory::Lo},
+    {0x10808, GeneralCategory::Cn},  {0x10809, GeneralCategory::Lo},
+    {0x1080a, GeneralCategory::Cn},  {0x10836, GeneralCategory::Lo},
+    {0x10837, GeneralCategory::Cn},  {0x10839, GeneralCategory::Lo},
+    {0x1083c, GeneralCategory::Cn},  {0x1083d, GeneralCategory::Lo},
+    {0x1083f, GeneralCategory::Cn},  {0x10856, GeneralCategory::Lo},
+    {0x10857, GeneralCategory::Cn},  {0x10858, GeneralCategory::Po},
+    {0x10860, GeneralCategory::No},  {0x10877, GeneralCategory::Lo},
+    {0x10879, GeneralCategory::So},  {0x10880, GeneralCategory::No},
+    {0x1089f, GeneralCategory::Lo},  {0x108a7, GeneralCategory::Cn},
+    {0x108b0, GeneralCategory::No},  {0x108e0, GeneralCategory::Cn},
+    {0x108f3, GeneralCategory::Lo},  {0x108f4, GeneralCategory::Cn},
+    {0x108f6, GeneralCategory::Lo},  {0x108fb, GeneralCategory::Cn},
+    {0x10900, GeneralCategory::No},  {0x10916, GeneralCategory::Lo},
+    {0x1091c, GeneralCategory::No},  {0x1091f, GeneralCategory::Cn},
+    {0x10920, GeneralCategory::Po},  {0x1093a, GeneralCategory::Lo},
+    {0x1093f, GeneralCategory::Cn},  {0x10940, GeneralCategory::Po},
+    {0x10980, GeneralCategory::Cn},  {0x109b8, GeneralCategory::Lo},
+    {0x109bc, GeneralCategory::Cn},  {0x109be, GeneralCategory::No},
+    {0x109c0, GeneralCategory::Lo},  {0x109d0, GeneralCategory::No},
+    {0x109d2, GeneralCategory::Cn},  {0x10a00, GeneralCategory::No},
+    {0x10a01, GeneralCategory::Lo},  {0x10a04, GeneralCategory::Mn},
+    {0x10a05, GeneralCategory::Cn},  {0x10a07, GeneralCategory::Mn},
+    {0x10a0c, GeneralCategory::Cn},  {0x10a10, GeneralCategory::Mn},
+    {0x10a14, GeneralCategory::Lo},  {0x10a15, GeneralCategory::Cn},
+    {0x10a18, GeneralCategory::Lo},  {0x10a19, GeneralCategory::Cn},
+    {0x10a36, GeneralCategory::Lo},  {0x10a38, GeneralCategory::Cn},
+    {0x10a3b, GeneralCategory::Mn},  {0x10a3f, GeneralCategory::Cn},
+    {0x10a40, GeneralCategory::Mn},  {0x10a49, GeneralCategory::No},
+    {0x10a50, GeneralCategory::Cn},  {0x10a59, GeneralCategory::Po},
+    {0x10a60, GeneralCategory::Cn},  {0x10a7d, GeneralCategory::Lo},
+    {0x10a7f, GeneralCategory::No},  {0x10a80, GeneralCategory::Po},
+    {0x10a9d, GeneralCategory::Lo},  {0x10aa0, GeneralCategory::No},
+    {0x10ac0, GeneralCategory::Cn},  {0x10ac8, GeneralCategory::Lo},
+    {0x10ac9, GeneralCategory::So},  {0x10ae5, GeneralCategory::Lo},
+    {0x10ae7, GeneralCategory::Mn},  {0x10aeb, GeneralCategory::Cn},
+    {0x10af0, GeneralCategory::No},  {0x10af7, GeneralCategory::Po},
+    {0x10b00, GeneralCategory::Cn},  {0x10b36, GeneralCategory::Lo},
+    {0x10b39, GeneralCategory::Cn},  {0x10b40, GeneralCategory::Po},
+    {0x10b56, GeneralCategory::Lo},  {0x10b58, GeneralCategory::Cn},
+    {0x10b60, GeneralCategory::No},  {0x10b73, GeneralCategory::Lo},
+    {0x10b78, GeneralCategory::Cn},  {0x10b80, GeneralCategory::No},
+    {0x10b92, GeneralCategory::Lo},  {0x10b99, GeneralCategory::Cn},
+    {0x10b9d, GeneralCategory::Po},  {0x10ba9, GeneralCategory::Cn},
+    {0x10bb0, GeneralCategory::No},  {0x10c00, GeneralCategory::Cn},
+    {0x10c49, GeneralCategory::Lo},  {0x10c80, GeneralCategory::Cn},
+    {0x10cb3, GeneralCategory::Lu},  {0x10cc0, GeneralCategory::Cn},
+    {0x10cf3, GeneralCategory::Ll},  {0x10cfa, GeneralCategory::Cn},
+    {0x10d00, GeneralCategory::No},  {0x10d24, GeneralCategory::Lo},
+    {0x10d28, GeneralCategory::Mn},  {0x10d30, GeneralCategory::Cn},
+    {0x10d3a, GeneralCategory::Nd},  {0x10e60, GeneralCategory::Cn},
+    {0x10e7f, GeneralCategory::No},  {0x10e80, GeneralCategory::Cn},
+    {0x10eaa, GeneralCategory::Lo},  {0x10eab, GeneralCategory::Cn},
+    {0x10ead, GeneralCategory::Mn},  {0x10eae, GeneralCategory::Pd},
+    {0x10eb0, GeneralCategory::Cn},  {0x10eb2, GeneralCategory::Lo},
+    {0x10f00, GeneralCategory::Cn},  {0x10f1d, GeneralCategory::Lo},
+    {0x10f27, GeneralCategory::No},  {0x10f28, GeneralCategory::Lo},
+    {0x10f30, GeneralCategory::Cn},  {0x10f46, GeneralCategory::Lo},
+    {0x10f51, GeneralCategory::Mn},  {0x10f55, GeneralCategory::No},
+    {0x10f5a, GeneralCategory::Po},  {0x10fb0, GeneralCategory::Cn},
+    {0x10fc5, GeneralCategory::Lo},  {0x10fcc, GeneralCategory::No},
+    {0x10fe0, GeneralCategory::Cn},  {0x10ff7, GeneralCategory::Lo},
+    {0x11000, GeneralCategory::Cn},  {0x11001, GeneralCategory::Mc},
+    {0x11002, GeneralCategory::Mn},  {0x11003, GeneralCategory::Mc},
+    {0x11038, GeneralCategory::Lo},  {0x11047, GeneralCategory::Mn},
+    {0x1104e, GeneralCategory::Po},  {0x11052, GeneralCategory::Cn},
+    {0x11066, GeneralCategory::No},  {0x11070, GeneralCategory::Nd},
+    {0x1107f, GeneralCategory::Cn},  {0x11082, GeneralCategory::Mn},
+    {0x11083, GeneralCategory::Mc},  {0x110b0, GeneralCategory::Lo},
+    {0x110b3, GeneralCategory::Mc},  {0x110b7, GeneralCategory::Mn},
+    {0x110b9, GeneralCategory::Mc},  {0x110bb, GeneralCategory::Mn},
+    {0x110bd, GeneralCategory::Po},  {0x110be, GeneralCategory::Cf},
+    {0x110c2, GeneralCategory::Po},  {0x110cd, GeneralCategory::Cn},
+    {0x110ce, GeneralCategory::Cf},  {0x110d0, GeneralCategory::Cn},
+    {0x110e9, GeneralCategory::Lo},  {0x110f0, GeneralCategory::Cn},
+    {0x110fa, GeneralCategory::Nd},  {0x11100, GeneralCategory::Cn},
+    {0x11103, GeneralCategory::Mn},  {0x11127, GeneralCategory::Lo},
+    {0x1112c, GeneralCategory::Mn},  {0x1112d, GeneralCategory::Mc},
+    {0x11135, GeneralCategory::Mn},  {0x11136, GeneralCategory::Cn},
+    {0x11140, GeneralCategory::Nd},  {0x11144, GeneralCategory::Po},
+    {0x11145, GeneralCategory::Lo},  {0x11147, GeneralCategory::Mc},
+    {0x11148, GeneralCategory::Lo},  {0x11150, GeneralCategory::Cn},
+    {0x11173, GeneralCategory::Lo},  {0x11174, GeneralCategory::Mn},
+    {0x11176, GeneralCategory::Po},  {0x11177, GeneralCategory::Lo},
+    {0x11180, GeneralCategory::Cn},  {0x11182, GeneralCategory::Mn},
+    {0x11183, GeneralCategory::Mc},  {0x111b3, GeneralCategory::Lo},
+    {0x111b6, GeneralCategory::Mc},  {0x111bf, GeneralCategory::Mn},
+    {0x111c1, GeneralCategory::Mc},  {0x111c5, GeneralCategory::Lo},
+    {0x111c9, GeneralCategory::Po},  {0x111cd, GeneralCategory::Mn},
+    {0x111ce, GeneralCategory::Po},  {0x111cf, GeneralCategory::Mc},
+    {0x111d0, GeneralCategory::Mn},  {0x111da, GeneralCategory::Nd},
+    {0x111db, GeneralCategory::Lo},  {0x111dc, GeneralCategory::Po},
+    {0x111dd, GeneralCategory::Lo},  {0x111e0, GeneralCategory::Po},
+    {0x111e1, GeneralCategory::Cn},  {0x111f5, GeneralCategory::No},
+    {0x11200, GeneralCategory::Cn},  {0x11212, GeneralCategory::Lo},
+    {0x11213, GeneralCategory::Cn},  {0x1122c, GeneralCategory::Lo},
+    {0x1122f, GeneralCategory::Mc},  {0x11232, GeneralCategory::Mn},
+    {0x11234, GeneralCategory::Mc},  {0x11235, GeneralCategory::Mn},
+    {0x11236, GeneralCategory::Mc},  {0x11238, GeneralCategory::Mn},
+    {0x1123e, GeneralCategory::Po},  {0x1123f, GeneralCategory::Mn},
+    {0x11280, GeneralCategory::Cn},  {0x11287, GeneralCategory::Lo},
+    {0x11288, GeneralCategory::Cn},  {0x11289, GeneralCategory::Lo},
+    {0x1128a, GeneralCategory::Cn},  {0x1128e, GeneralCategory::Lo},
+    {0x1128f, GeneralCategory::Cn},  {0x1129e, GeneralCategory::Lo},
+    {0x1129f, GeneralCategory::Cn},  {0x112a9, GeneralCategory::Lo},
+    {0x112aa, GeneralCategory::Po},  {0x112b0, GeneralCategory::Cn},
+    {0x112df, GeneralCategory::Lo},  {0x112e0, GeneralCategory::Mn},
+    {0x112e3, GeneralCategory::Mc},  {0x112eb, GeneralCategory::Mn},
+    {0x112f0, GeneralCategory::Cn},  {0x112fa, GeneralCategory::Nd},
+    {0x11300, GeneralCategory::Cn},  {0x11302, GeneralCategory::Mn},
+    {0x11304, GeneralCategory::Mc},  {0x11305, GeneralCategory::Cn},
+    {0x1130d, GeneralCategory::Lo},  {0x1130f, GeneralCategory::Cn},
+    {0x11311, GeneralCategory::Lo},  {0x11313, GeneralCategory::Cn},
+    {0x11329, GeneralCategory::Lo},  {0x1132a, GeneralCategory::Cn},
+    {0x11331, GeneralCategory::Lo},  {0x11332, GeneralCategory::Cn},
+    {0x11334, GeneralCategory::Lo},  {0x11335, GeneralCategory::Cn},
+    {0x1133a, GeneralCategory::Lo},  {0x1133b, GeneralCategory::Cn},
+    {0x1133d, GeneralCategory::Mn},  {0x1133e, GeneralCategory::Lo},
+    {0x11340, GeneralCategory::Mc},  {0x11341, GeneralCategory::Mn},
+    {0x11345, GeneralCategory::Mc},  {0x11347, GeneralCategory::Cn},
+    {0x11349, GeneralCategory::Mc},  {0x1134b, GeneralCategory::Cn},
+    {0x1134e, GeneralCategory::Mc},  {0x11350, GeneralCategory::Cn},
+    {0x11351, GeneralCategory::Lo},  {0x11357, GeneralCategory::Cn},
+    {0x11358, GeneralCategory::Mc},  {0x1135d, GeneralCategory::Cn},
+    {0x11362, GeneralCategory::Lo},  {0x11364, GeneralCategory::Mc},
+    {0x11366, GeneralCategory::Cn},  {0x1136d, GeneralCategory::Mn},
+    {0x11370, GeneralCategory::Cn},  {0x11375, GeneralCategory::Mn},
+    {0x11400, GeneralCategory::Cn},  {0x11435, GeneralCategory::Lo},
+    {0x11438, GeneralCategory::Mc},  {0x11440, GeneralCategory::Mn},
+    {0x11442, GeneralCategory::Mc},  {0x11445, GeneralCategory::Mn},
+    {0x11446, GeneralCategory::Mc},  {0x11447, GeneralCategory::Mn},
+    {0x1144b, GeneralCategory::Lo},  {0x11450, GeneralCategory::Po},
+    {0x1145a, GeneralCategory::Nd},  {0x1145c, GeneralCategory::Po},
+    {0x1145d, GeneralCategory::Cn},  {0x1145e, GeneralCategory::Po},
+    {0x1145f, GeneralCategory::Mn},  {0x11462, GeneralCategory::Lo},
+    {0x11480, GeneralCategory::Cn},  {0x114b0, GeneralCategory::Lo},
+    {0x114b3, GeneralCategory::Mc},  {0x114b9, GeneralCategory::Mn},
+    {0x114ba, GeneralCategory::Mc},  {0x114bb, GeneralCategory::Mn},
+    {0x114bf, GeneralCategory::Mc},  {0x114c1, GeneralCategory::Mn},
+    {0x114c2, GeneralCategory::Mc},  {0x114c4, GeneralCategory::Mn},
+    {0x114c6, GeneralCategory::Lo},  {0x114c7, GeneralCategory::Po},
+    {0x114c8, GeneralCategory::Lo},  {0x114d0, GeneralCategory::Cn},
+    {0x114da, GeneralCategory::Nd},  {0x11580, GeneralCategory::Cn},
+    {0x115af, GeneralCategory::Lo},  {0x115b2, GeneralCategory::Mc},
+    {0x115b6, GeneralCategory::Mn},  {0x115b8, GeneralCategory::Cn},
+    {0x115bc, GeneralCategory::Mc},  {0x115be, GeneralCategory::Mn},
+    {0x115bf, GeneralCategory::Mc},  {0x115c1, GeneralCategory::Mn},
+    {0x115d8, GeneralCategory::Po},  {0x115dc, GeneralCategory::Lo},
+    {0x115de, GeneralCategory::Mn},  {0x11600, GeneralCategory::Cn},
+    {0x11630, GeneralCategory::Lo},  {0x11633, GeneralCategory::Mc},
+    {0x1163b, GeneralCategory::Mn},  {0x1163d, GeneralCategory::Mc},
+    {0x1163e, GeneralCategory::Mn},  {0x1163f, GeneralCategory::Mc},
+    {0x11641, GeneralCategory::Mn},  {0x11644, GeneralCategory::Po},
+    {0x11645, GeneralCategory::Lo},  {0x11650, GeneralCategory::Cn},
+    {0x1165a, GeneralCategory::Nd},  {0x11660, GeneralCategory::Cn},
+    {0x1166d, GeneralCategory::Po},  {0x11680, GeneralCategory::Cn},
+    {0x116ab, GeneralCategory::Lo},  {0x116ac, GeneralCategory::Mn},
+    {0x116ad, GeneralCategory::Mc},  {0x116ae, GeneralCategory::Mn},
+    {0x116b0, GeneralCategory::Mc},  {0x116b6, GeneralCategory::Mn},
+    {0x116b7, GeneralCategory::Mc},  {0x116b8, GeneralCategory::Mn},
+    {0x116b9, GeneralCategory::Lo},  {0x116c0, GeneralCategory::Cn},
+    {0x116ca, GeneralCategory::Nd},  {0x11700, GeneralCategory::Cn},
+    {0x1171b, GeneralCategory::Lo},  {0x1171d, GeneralCategory::Cn},
+    {0x11720, GeneralCategory::Mn},  {0x11722, GeneralCategory::Mc},
+    {0x11726, GeneralCategory::Mn},  {0x11727, GeneralCategory::Mc},
+    {0x1172c, GeneralCategory::Mn},  {0x11730, GeneralCategory::Cn},
+    {0x1173a, GeneralCategory::Nd},  {0x1173c, GeneralCategory::No},
+    {0x1173f, GeneralCategory::Po},  {0x11740, GeneralCategory::So},
+    {0x11800, GeneralCategory::Cn},  {0x1182c, GeneralCategory::Lo},
+    {0x1182f, GeneralCategory::Mc},  {0x11838, GeneralCategory::Mn},
+    {0x11839, GeneralCategory::Mc},  {0x1183b, GeneralCategory::Mn},
+    {0x1183c, GeneralCategory::Po},  {0x118a0, GeneralCategory::Cn},
+    {0x118c0, GeneralCategory::Lu},  {0x118e0, GeneralCategory::Ll},
+    {0x118ea, GeneralCategory::Nd},  {0x118f3, GeneralCategory::No},
+    {0x118ff, GeneralCategory::Cn},  {0x11907, GeneralCategory::Lo},
+    {0x11909, GeneralCategory::Cn},  {0x1190a, GeneralCategory::Lo},
+    {0x1190c, GeneralCategory::Cn},  {0x11914, GeneralCategory::Lo},
+    {0x11915, GeneralCategory::Cn},  {0x11917, GeneralCategory::Lo},
+    {0x11918, GeneralCategory::Cn},  {0x11930, GeneralCategory::Lo},
+    {0x11936, GeneralCategory::Mc},  {0x11937, GeneralCategory::Cn},
+    {0x11939, GeneralCategory::Mc},  {0x1193b, GeneralCategory::Cn},
+    {0x1193d, GeneralCategory::Mn},  {0x1193e, GeneralCategory::Mc},
+    {0x1193f, GeneralCategory::Mn},  {0x11940, GeneralCategory::Lo},
+    {0x11941, GeneralCategory::Mc},  {0x11942, GeneralCategory::Lo},
+    {0x11943, GeneralCategory::Mc},  {0x11944, GeneralCategory::Mn},
+    {0x11947, GeneralCategory::Po},  {0x11950, GeneralCategory::Cn},
+    {0x1195a, GeneralCategory::Nd},  {0x119a0, GeneralCategory::Cn},
+    {0x119a8, GeneralCategory::Lo},  {0x119aa, GeneralCategory::Cn},
+    {0x119d1, GeneralCategory::Lo},  {0x119d4, GeneralCategory::Mc},
+    {0x119d8, GeneralCategory::Mn},  {0x119da, GeneralCategory::Cn},
+    {0x119dc, GeneralCategory::Mn},  {0x119e0, GeneralCategory::Mc},
+    {0x119e1, GeneralCategory::Mn},  {0x119e2, GeneralCategory::Lo},
+    {0x119e3, GeneralCategory::Po},  {0x119e4, GeneralCategory::Lo},
+    {0x119e5, GeneralCategory::Mc},  {0x11a00, GeneralCategory::Cn},
+    {0x11a01, GeneralCategory::Lo},  {0x11a0b, GeneralCategory::Mn},
+    {0x11a33, GeneralCategory::Lo},  {0x11a39, GeneralCategory::Mn},
+    {0x11a3a, GeneralCategory::Mc},  {0x11a3b, GeneralCategory::Lo},
+    {0x11a3f, GeneralCategory::Mn},  {0x11a47, GeneralCategory::Po},
+    {0x11a48, GeneralCategory::Mn},  {0x11a50, GeneralCategory::Cn},
+    {0x11a51, GeneralCategory::Lo},  {0x11a57, GeneralCategory::Mn},
+    {0x11a59, GeneralCategory::Mc},  {0x11a5c, GeneralCategory::Mn},
+    {0x11a8a, GeneralCategory::Lo},  {0x11a97, GeneralCategory::Mn},
+    {0x11a98, GeneralCategory::Mc},  {0x11a9a, GeneralCategory::Mn},
+    {0x11a9d, GeneralCategory::Po},  {0x11a9e, GeneralCategory::Lo},
+    {0x11aa3, GeneralCategory::Po},  {0x11ac0, GeneralCategory::Cn},
+    {0x11af9, GeneralCategory::Lo},  {0x11c00, GeneralCategory::Cn},
+    {0x11c09, GeneralCategory::Lo},  {0x11c0a, GeneralCategory::Cn},
+    {0x11c2f, GeneralCategory::Lo},  {0x11c30, GeneralCategory::Mc},
+    {0x11c37, GeneralCategory::Mn},  {0x11c38, GeneralCategory::Cn},
+    {0x11c3e, GeneralCategory::Mn},  {0x11c3f, GeneralCategory::Mc},
+    {0x11c40, GeneralCategory::Mn},  {0x11c41, GeneralCategory::Lo},
+    {0x11c46, GeneralCategory::Po},  {0x11c50, GeneralCategory::Cn},
+    {0x11c5a, GeneralCategory::Nd},  {0x11c6d, GeneralCategory::No},
+    {0x11c70, GeneralCategory::Cn},  {0x11c72, GeneralCategory::Po},
+    {0x11c90, GeneralCategory::Lo},  {0x11c92, GeneralCategory::Cn},
+    {0x11ca8, GeneralCategory::Mn},  {0x11ca9, GeneralCategory::Cn},
+    {0x11caa, GeneralCategory::Mc},  {0x11cb1, GeneralCategory::Mn},
+    {0x11cb2, GeneralCategory::Mc},  {0x11cb4, GeneralCategory::Mn},
+    {0x11cb5, GeneralCategory::Mc},  {0x11cb7, GeneralCategory::Mn},
+    {0x11d00, GeneralCategory::Cn},  {0x11d07, GeneralCategory::Lo},
+    {0x11d08, GeneralCategory::Cn},  {0x11d0a, GeneralCategory::Lo},
+    {0x11d0b, GeneralCategory::Cn},  {0x11d31, GeneralCategory::Lo},
+    {0x11d37, GeneralCategory::Mn},  {0x11d3a, GeneralCategory::Cn},
+    {0x11d3b, GeneralCategory::Mn},  {0x11d3c, GeneralCategory::Cn},
+    {0x11d3e, GeneralCategory::Mn},  {0x11d3f, GeneralCategory::Cn},
+    {0x11d46, GeneralCategory::Mn},  {0x11d47, GeneralCategory::Lo},
+    {0x11d48, GeneralCategory::Mn},  {0x11d50, GeneralCategory::Cn},
+    {0x11d5a, GeneralCategory::Nd},  {0x11d60, GeneralCategory::Cn},
+    {0x11d66, GeneralCategory::Lo},  {0x11d67, GeneralCategory::Cn},
+    {0x11d69, GeneralCategory::Lo},  {0x11d6a, GeneralCategory::Cn},
+    {0x11d8a, GeneralCategory::Lo},  {0x11d8f, GeneralCategory::Mc},
+    {0x11d90, GeneralCategory::Cn},  {0x11d92, GeneralCategory::Mn},
+    {0x11d93, GeneralCategory::Cn},  {0x11d95, GeneralCategory::Mc},
+    {0x11d96, GeneralCategory::Mn},  {0x11d97, GeneralCategory::Mc},
+    {0x11d98, GeneralCategory::Mn},  {0x11d99, GeneralCategory::Lo},
+    {0x11da0, GeneralCategory::Cn},  {0x11daa, GeneralCategory::Nd},
+    {0x11ee0, GeneralCategory::Cn},  {0x11ef3, GeneralCategory::Lo},
+    {0x11ef5, GeneralCategory::Mn},  {0x11ef7, GeneralCategory::Mc},
+    {0x11ef9, GeneralCategory::Po},  {0x11fb0, GeneralCategory::Cn},
+    {0x11fb1, GeneralCategory::Lo},  {0x11fc0, GeneralCategory::Cn},
+    {0x11fd5, GeneralCategory::No},  {0x11fdd, GeneralCategory::So},
+    {0x11fe1, GeneralCategory::Sc},  {0x11ff2, GeneralCategory::So},
+    {0x11fff, GeneralCategory::Cn},  {0x12000, GeneralCategory::Po},
+    {0x1239a, GeneralCategory::Lo},  {0x12400, GeneralCategory::Cn},
+    {0x1246f, GeneralCategory::Nl},  {0x12470, GeneralCategory::Cn},
+    {0x12475, GeneralCategory::Po},  {0x12480, GeneralCategory::Cn},
+    {0x12544, GeneralCategory::Lo},  {0x13000, GeneralCategory::Cn},
+    {0x1342f, GeneralCategory::Lo},  {0x13430, GeneralCategory::Cn},
+    {0x13439, GeneralCategory::Cf},  {0x14400, GeneralCategory::Cn},
+    {0x14647, GeneralCategory::Lo},  {0x16800, GeneralCategory::Cn},
+    {0x16a39, GeneralCategory::Lo},  {0x16a40, GeneralCategory::Cn},
+    {0x16a5f, GeneralCategory::Lo},  {0x16a60, GeneralCategory::Cn},
+    {0x16a6a, GeneralCategory::Nd},  {0x16a6e, GeneralCategory::Cn},
+    {0x16a70, GeneralCategory::Po},  {0x16ad0, GeneralCategory::Cn},
+    {0x16aee, GeneralCategory::Lo},  {0x16af0, GeneralCategory::Cn},
+    {0x16af5, GeneralCategory::Mn},  {0x16af6, GeneralCategory::Po},
+    {0x16b00, GeneralCategory::Cn},  {0x16b30, GeneralCategory::Lo},
+    {0x16b37, GeneralCategory::Mn},  {0x16b3c, GeneralCategory::Po},
+    {0x16b40, GeneralCategory::So},  {0x16b44, GeneralCategory::Lm},
+    {0x16b45, GeneralCategory::Po},  {0x16b46, GeneralCategory::So},
+    {0x16b50, GeneralCategory::Cn},  {0x16b5a, GeneralCategory::Nd},
+    {0x16b5b, GeneralCategory::Cn},  {0x16b62, GeneralCategory::No},
+    {0x16b63, GeneralCategory::Cn},  {0x16b78, GeneralCategory::Lo},
+    {0x16b7d, GeneralCategory::Cn},  {0x16b90, GeneralCategory::Lo},
+    {0x16e40, GeneralCategory::Cn},  {0x16e60, GeneralCategory::Lu},
+    {0x16e80, GeneralCategory::Ll},  {0x16e97, GeneralCategory::No},
+    {0x16e9b, GeneralCategory::Po},  {0x16f00, GeneralCategory::Cn},
+    {0x16f4b, GeneralCategory::Lo},  {0x16f4f, GeneralCategory::Cn},
+    {0x16f50, GeneralCategory::Mn},  {0x16f51, GeneralCategory::Lo},
+    {0x16f88, GeneralCategory::Mc},  {0x16f8f, GeneralCategory::Cn},
+    {0x16f93, GeneralCategory::Mn},  {0x16fa0, GeneralCategory::Lm},
+    {0x16fe0, GeneralCategory::Cn},  {0x16fe2, GeneralCategory::Lm},
+    {0x16fe3, GeneralCategory::Po},  {0x16fe4, GeneralCategory::Lm},
+    {0x16fe5, GeneralCategory::Mn},  {0x16ff0, GeneralCategory::Cn},
+    {0x16ff2, GeneralCategory::Mc},  {0x17000, GeneralCategory::Cn},
+    {0x187f8, GeneralCategory::Lo},  {0x18800, GeneralCategory::Cn},
+    {0x18cd6, GeneralCategory::Lo},  {0x18d00, GeneralCategory::Cn},
+    {0x18d09, GeneralCategory::Lo},  {0x1b000, GeneralCategory::Cn},
+    {0x1b11f, GeneralCategory::Lo},  {0x1b150, GeneralCategory::Cn},
+    {0x1b153, GeneralCategory::Lo},  {0x1b164, GeneralCategory::Cn},
+    {0x1b168, GeneralCategory::Lo},  {0x1b170, GeneralCategory::Cn},
+    {0x1b2fc, GeneralCategory::Lo},  {0x1bc00, GeneralCategory::Cn},
+    {0x1bc6b, GeneralCategory::Lo},  {0x1bc70, GeneralCategory::Cn},
+    {0x1bc7d, GeneralCategory::Lo},  {0x1bc80, GeneralCategory::Cn},
+    {0x1bc89, GeneralCategory::Lo},  {0x1bc90, GeneralCategory::Cn},
+    {0x1bc9a, GeneralCategory::Lo},  {0x1bc9c, GeneralCategory::Cn},
+    {0x1bc9d, GeneralCategory::So},  {0x1bc9f, GeneralCategory::Mn},
+    {0x1bca0, GeneralCategory::Po},  {0x1bca4, GeneralCategory::Cf},
+    {0x1d000, GeneralCategory::Cn},  {0x1d0f6, GeneralCategory::So},
+    {0x1d100, GeneralCategory::Cn},  {0x1d127, GeneralCategory::So},
+    {0x1d129, GeneralCategory::Cn},  {0x1d165, GeneralCategory::So},
+    {0x1d167, GeneralCategory::Mc},  {0x1d16a, GeneralCategory::Mn},
+    {0x1d16d, GeneralCategory::So},  {0x1d173, GeneralCategory::Mc},
+    {0x1d17b, GeneralCategory::Cf},  {0x1d183, GeneralCategory::Mn},
+    {0x1d185, GeneralCategory::So},  {0x1d18c, GeneralCategory::Mn},
+    {0x1d1aa, GeneralCategory::So},  {0x1d1ae, GeneralCategory::Mn},
+    {0x1d1e9, GeneralCategory::So},  {0x1d200, GeneralCategory::Cn},
+    {0x1d242, GeneralCategory::So},  {0x1d245, GeneralCategory::Mn},
+    {0x1d246, GeneralCategory::So},  {0x1d2e0, GeneralCategory::Cn},
+    {0x1d2f4, GeneralCategory::No},  {0x1d300, GeneralCategory::Cn},
+    {0x1d357, GeneralCategory::So},  {0x1d360, GeneralCategory::Cn},
+    {0x1d379, GeneralCategory::No},  {0x1d400, GeneralCategory::Cn},
+    {0x1d41a, GeneralCategory::Lu},  {0x1d434, GeneralCategory::Ll},
+    {0x1d44e, GeneralCategory::Lu},  {0x1d455, GeneralCategory::Ll},
+    {0x1d456, GeneralCategory::Cn},  {0x1d468, GeneralCategory::Ll},
+    {0x1d482, GeneralCategory::Lu},  {0x1d49c, GeneralCategory::Ll},
+    {0x1d49d, GeneralCategory::Lu},  {0x1d49e, GeneralCategory::Cn},
+    {0x1d4a0, GeneralCategory::Lu},  {0x1d4a2, GeneralCategory::Cn},
+    {0x1d4a3, GeneralCategory::Lu},  {0x1d4a5, GeneralCategory::Cn},
+    {0x1d4a7, GeneralCategory::Lu},  {0x1d4a9, GeneralCategory::Cn},
+    {0x1d4ad, GeneralCategory::Lu},  {0x1d4ae, GeneralCategory::Cn},
+    {0x1d4b6, GeneralCategory::Lu},  {0x1d4ba, GeneralCategory::Ll},
+    {0x1d4bb, GeneralCategory::Cn},  {0x1d4bc, GeneralCategory::Ll},
+    {0x1d4bd, GeneralCategory::Cn},  {0x1d4c4, GeneralCategory::Ll},
+    {0x1d4c5, GeneralCategory::Cn},  {0x1d4d0, GeneralCategory::Ll},
+    {0x1d4ea, GeneralCategory::Lu},  {0x1d504, GeneralCategory::Ll},
+    {0x1d506, GeneralCategory::Lu},  {0x1d507, GeneralCategory::Cn},
+    {0x1d50b, GeneralCategory::Lu},  {0x1d50d, GeneralCategory::Cn},
+    {0x1d515, GeneralCategory::Lu},  {0x1d516, GeneralCategory::Cn},
+    {0x1d51d, GeneralCategory::Lu},  {0x1d51e, GeneralCategory::Cn},
+    {0x1d538, GeneralCategory::Ll},  {0x1d53a, GeneralCategory::Lu},
+    {0x1d53b, GeneralCategory::Cn},  {0x1d53f, GeneralCategory::Lu},
+    {0x1d540, GeneralCategory::Cn},  {0x1d545, GeneralCategory::Lu},
+    {0x1d546, GeneralCategory::Cn},  {0x1d547, GeneralCategory::Lu},
+    {0x1d54a, GeneralCategory::Cn},  {0x1d551, GeneralCategory::Lu},
+    {0x1d552, GeneralCategory::Cn},  {0x1d56c, GeneralCategory::Ll},
+    {0x1d586, GeneralCategory::Lu},  {0x1d5a0, GeneralCategory::Ll},
+    {0x1d5ba, GeneralCategory::Lu},  {0x1d5d4, GeneralCategory::Ll},
+    {0x1d5ee, GeneralCategory::Lu},  {0x1d608, GeneralCategory::Ll},
+    {0x1d622, GeneralCategory::Lu},  {0x1d63c, GeneralCategory::Ll},
+    {0x1d656, GeneralCategory::Lu},  {0x1d670, GeneralCategory::Ll},
+    {0x1d68a, GeneralCategory::Lu},  {0x1d6a6, GeneralCategory::Ll},
+    {0x1d6a8, GeneralCategory::Cn},  {0x1d6c1, GeneralCategory::Lu},
+    {0x1d6c2, GeneralCategory::Sm},  {0x1d6db, GeneralCategory::Ll},
+    {0x1d6dc, GeneralCategory::Sm},  {0x1d6e2, GeneralCategory::Ll},
+    {0x1d6fb, GeneralCategory::Lu},  {0x1d6fc, GeneralCategory::Sm},
+    {0x1d715, GeneralCategory::Ll},  {0x1d716, GeneralCategory::Sm},
+    {0x1d71c, GeneralCategory::Ll},  {0x1d735, GeneralCategory::Lu},
+    {0x1d736, GeneralCategory::Sm},  {0x1d74f, GeneralCategory::Ll},
+    {0x1d750, GeneralCategory::Sm},  {0x1d756, GeneralCategory::Ll},
+    {0x1d76f, GeneralCategory::Lu},  {0x1d770, GeneralCategory::Sm},
+    {0x1d789, GeneralCategory::Ll},  {0x1d78a, GeneralCategory::Sm},
+    {0x1d790, GeneralCategory::Ll},  {0x1d7a9, GeneralCategory::Lu},
+    {0x1d7aa, GeneralCategory::Sm},  {0x1d7c3, GeneralCategory::Ll},
+    {0x1d7c4, GeneralCategory::Sm},  {0x1d7ca, GeneralCategory::Ll},
+    {0x1d7cb, GeneralCategory::Lu},  {0x1d7cc, GeneralCategory::Ll},
+    {0x1d7ce, GeneralCategory::Cn},  {0x1d800, GeneralCategory::Nd},
+    {0x1da00, GeneralCategory::So},  {0x1da37, GeneralCategory::Mn},
+    {0x1da3b, GeneralCategory::So},  {0x1da6d, GeneralCategory::Mn},
+    {0x1da75, GeneralCategory::So},  {0x1da76, GeneralCategory::Mn},
+    {0x1da84, GeneralCategory::So},  {0x1da85, GeneralCategory::Mn},
+    {0x1da87, GeneralCategory::So},  {0x1da8c, GeneralCategory::Po},
+    {0x1da9b, GeneralCategory::Cn},  {0x1daa0, GeneralCategory::Mn},
+    {0x1daa1, GeneralCategory::Cn},  {0x1dab0, GeneralCategory::Mn},
+    {0x1e000, GeneralCategory::Cn},  {0x1e007, GeneralCategory::Mn},
+    {0x1e008, GeneralCategory::Cn},  {0x1e019, GeneralCategory::Mn},
+    {0x1e01b, GeneralCategory::Cn},  {0x1e022, GeneralCategory::Mn},
+    {0x1e023, GeneralCategory::Cn},  {0x1e025, GeneralCategory::Mn},
+    {0x1e026, GeneralCategory::Cn},  {0x1e02b, GeneralCategory::Mn},
+    {0x1e100, GeneralCategory::Cn},  {0x1e12d, GeneralCategory::Lo},
+    {0x1e130, GeneralCategory::Cn},  {0x1e137, GeneralCategory::Mn},
+    {0x1e13e, GeneralCategory::Lm},  {0x1e140, GeneralCategory::Cn},
+    {0x1e14a, GeneralCategory::Nd},  {0x1e14e, GeneralCategory::Cn},
+    {0x1e14f, GeneralCategory::Lo},  {0x1e150, GeneralCategory::So},
+    {0x1e2c0, GeneralCategory::Cn},  {0x1e2ec, GeneralCategory::Lo},
+    {0x1e2f0, GeneralCategory::Mn},  {0x1e2fa, GeneralCategory::Nd},
+    {0x1e2ff, GeneralCategory::Cn},  {0x1e300, GeneralCategory::Sc},
+    {0x1e800, GeneralCategory::Cn},  {0x1e8c5, GeneralCategory::Lo},
+    {0x1e8c7, GeneralCategory::Cn},  {0x1e8d0, GeneralCategory::No},
+    {0x1e8d7, GeneralCategory::Mn},  {0x1e900, GeneralCategory::Cn},
+    {0x1e922, GeneralCategory::Lu},  {0x1e944, GeneralCategory::Ll},
+    {0x1e94b, GeneralCategory::Mn},  {0x1e94c, GeneralCategory::Lm},
+    {0x1e950, GeneralCategory::Cn},  {0x1e95a, GeneralCategory::Nd},
+    {0x1e95e, GeneralCategory::Cn},  {0x1e960, GeneralCategory::Po},
+    {0x1ec71, GeneralCategory::Cn},  {0x1ecac, GeneralCategory::No},
+    {0x1ecad, GeneralCategory::So},  {0x1ecb0, GeneralCategory::No},
+    {0x1ecb1, GeneralCategory::Sc},  {0x1ecb5, GeneralCategory::No},
+    {0x1ed01, GeneralCategory::Cn},  {0x1ed2e, GeneralCategory::No},
+    {0x1ed2f, GeneralCategory::So},  {0x1ed3e, GeneralCategory::No},
+    {0x1ee00, GeneralCategory::Cn},  {0x1ee04, GeneralCategory::Lo},
+    {0x1ee05, GeneralCategory::Cn},  {0x1ee20, GeneralCategory::Lo},
+    {0x1ee21, GeneralCategory::Cn},  {0x1ee23, GeneralCategory::Lo},
+    {0x1ee24, GeneralCategory::Cn},  {0x1ee25, GeneralCategory::Lo},
+    {0x1ee27, GeneralCategory::Cn},  {0x1ee28, GeneralCategory::Lo},
+    {0x1ee29, GeneralCategory::Cn},  {0x1ee33, GeneralCategory::Lo},
+    {0x1ee34, GeneralCategory::Cn},  {0x1ee38, GeneralCategory::Lo},
+    {0x1ee39, GeneralCategory::Cn},  {0x1ee3a, GeneralCategory::Lo},
+    {0x1ee3b, GeneralCategory::Cn},  {0x1ee3c, GeneralCategory::Lo},
+    {0x1ee42, GeneralCategory::Cn},  {0x1ee43, GeneralCategory::Lo},
+    {0x1ee47, GeneralCategory::Cn},  {0x1ee48, GeneralCategory::Lo},
+    {0x1ee49, GeneralCategory::Cn},  {0x1ee4a, GeneralCategory::Lo},
+    {0x1ee4b, GeneralCategory::Cn},  {0x1ee4c, GeneralCategory::Lo},
+    {0x1ee4d, GeneralCategory::Cn},  {0x1ee50, GeneralCategory::Lo},
+    {0x1ee51, GeneralCategory::Cn},  {0x1ee53, GeneralCategory::Lo},
+    {0x1ee54, GeneralCategory::Cn},  {0x1ee55, GeneralCategory::Lo},
+    {0x1ee57, GeneralCategory::Cn},  {0x1ee58, GeneralCategory::Lo},
+    {0x1ee59, GeneralCategory::Cn},  {0x1ee5a, GeneralCategory::Lo},
+    {0x1ee5b, GeneralCategory::Cn},  {0x1ee5c, GeneralCategory::Lo},
+    {0x1ee5d, GeneralCategory::Cn},  {0x1ee5e, GeneralCategory::Lo},
+    {0x1ee5f, GeneralCategory::Cn},  {0x1ee60, GeneralCategory::Lo},
+    {0x1ee61, GeneralCategory::Cn},  {0x1ee63, GeneralCategory::Lo},
+    {0x1ee64, GeneralCategory::Cn},  {0x1ee65, GeneralCategory::Lo},
+    {0x1ee67, GeneralCategory::Cn},  {0x1ee6b, GeneralCategory::Lo},
+    {0x1ee6c, GeneralCategory::Cn},  {0x1ee73, GeneralCategory::Lo},
+    {0x1ee74, GeneralCategory::Cn},  {0x1ee78, GeneralCategory::Lo},
+    {0x1ee79, GeneralCategory::Cn},  {0x1ee7d, GeneralCategory::Lo},
+    {0x1ee7e, GeneralCategory::Cn},  {0x1ee7f, GeneralCategory::Lo},
+    {0x1ee80, GeneralCategory::Cn},  {0x1ee8a, GeneralCategory::Lo},
+    {0x1ee8b, GeneralCategory::Cn},  {0x1ee9c, GeneralCategory::Lo},
+    {0x1eea1, GeneralCategory::Cn},  {0x1eea4, GeneralCategory::Lo},
+    {0x1eea5, GeneralCategory::Cn},  {0x1eeaa, GeneralCategory::Lo},
+    {0x1eeab, GeneralCategory::Cn},  {0x1eebc, GeneralCategory::Lo},
+    {0x1eef0, GeneralCategory::Cn},  {0x1eef2, GeneralCategory::Sm},
+    {0x1f000, GeneralCategory::Cn},  {0x1f02c, GeneralCategory::So},
+    {0x1f030, GeneralCategory::Cn},  {0x1f094, GeneralCategory::So},
+    {0x1f0a0, GeneralCategory::Cn},  {0x1f0af, GeneralCategory::So},
+    {0x1f0b1, GeneralCategory::Cn},  {0x1f0c0, GeneralCategory::So},
+    {0x1f0c1, GeneralCategory::Cn},  {0x1f0d0, GeneralCategory::So},
+    {0x1f0d1, GeneralCategory::Cn},  {0x1f0f6, GeneralCategory::So},
+    {0x1f100, GeneralCategory::Cn},  {0x1f10d, GeneralCategory::No},
+    {0x1f1ae, GeneralCategory::So},  {0x1f1e6, GeneralCategory::Cn},
+    {0x1f203, GeneralCategory::So},  {0x1f210, GeneralCategory::Cn},
+    {0x1f23c, GeneralCategory::So},  {0x1f240, GeneralCategory::Cn},
+    {0x1f249, GeneralCategory::So},  {0x1f250, GeneralCategory::Cn},
+    {0x1f252, GeneralCategory::So},  {0x1f260, GeneralCategory::Cn},
+    {0x1f266, GeneralCategory::So},  {0x1f300, GeneralCategory::Cn},
+    {0x1f3fb, GeneralCategory::So},  {0x1f400, GeneralCategory::Sk},
+    {0x1f6d8, GeneralCategory::So},  {0x1f6e0, GeneralCategory::Cn},
+    {0x1f6ed, GeneralCategory::So},  {0x1f6f0, GeneralCategory::Cn},
+    {0x1f6fd, GeneralCategory::So},  {0x1f700, GeneralCategory::Cn},
+    {0x1f774, GeneralCategory::So},  {0x1f780, GeneralCategory::Cn},
+    {0x1f7d9, GeneralCategory::So},  {0x1f7e0, GeneralCategory::Cn},
+    {0x1f7ec, GeneralCategory::So},  {0x1f800, GeneralCategory::Cn},
+    {0x1f80c, GeneralCategory::So},  {0x1f810, GeneralCategory::Cn},
+    {0x1f848, GeneralCategory::So},  {0x1f850, GeneralCategory::Cn},
+    {0x1f85a, GeneralCategory::So},  {0x1f860, GeneralCategory::Cn},
+    {0x1f888, GeneralCategory::So},  {0x1f890, GeneralCategory::Cn},
+    {0x1f8ae, GeneralCategory::So},  {0x1f8b0, GeneralCategory::Cn},
+    {0x1f8b2, GeneralCategory::So},  {0x1f900, GeneralCategory::Cn},
+    {0x1f979, GeneralCategory::So},  {0x1f97a, GeneralCategory::Cn},
+    {0x1f9cc, GeneralCategory::So},  {0x1f9cd, GeneralCategory::Cn},
+    {0x1fa54, GeneralCategory::So},  {0x1fa60, GeneralCategory::Cn},
+    {0x1fa6e, GeneralCategory::So},  {0x1fa70, GeneralCategory::Cn},
+    {0x1fa75, GeneralCategory::So},  {0x1fa78, GeneralCategory::Cn},
+    {0x1fa7b, GeneralCategory::So},  {0x1fa80, GeneralCategory::Cn},
+    {0x1fa87, GeneralCategory::So},  {0x1fa90, GeneralCategory::Cn},
+    {0x1faa9, GeneralCategory::So},  {0x1fab0, GeneralCategory::Cn},
+    {0x1fab7, GeneralCategory::So},  {0x1fac0, GeneralCategory::Cn},
+    {0x1fac3, GeneralCategory::So},  {0x1fad0, GeneralCategory::Cn},
+    {0x1fad7, GeneralCategory::So},  {0x1fb00, GeneralCategory::Cn},
+    {0x1fb93, GeneralCategory::So},  {0x1fb94, GeneralCategory::Cn},
+    {0x1fbcb, GeneralCategory::So},  {0x1fbf0, GeneralCategory::Cn},
+    {0x1fbfa, GeneralCategory::Nd},  {0x20000, GeneralCategory::Cn},
+    {0x2a6de, GeneralCategory::Lo},  {0x2a700, GeneralCategory::Cn},
+    {0x2b735, GeneralCategory::Lo},  {0x2b740, GeneralCategory::Cn},
+    {0x2b81e, GeneralCategory::Lo},  {0x2b820, GeneralCategory::Cn},
+    {0x2cea2, GeneralCategory::Lo},  {0x2ceb0, GeneralCategory::Cn},
+    {0x2ebe1, GeneralCategory::Lo},  {0x2f800, GeneralCategory::Cn},
+    {0x2fa1e, GeneralCategory::Lo},  {0x30000, GeneralCategory::Cn},
+    {0x3134b, GeneralCategory::Lo},  {0xe0001, GeneralCategory::Cn},
+    {0xe0002, GeneralCategory::Cf},  {0xe0020, GeneralCategory::Cn},
+    {0xe0080, GeneralCategory::Cf},  {0xe0100, GeneralCategory::Cn},
+    {0xe01f0, GeneralCategory::Mn},  {0xf0000, GeneralCategory::Cn},
+    {0xffffe, GeneralCategory::Co},  {0x100000, GeneralCategory::Cn},
+    {0x10fffe, GeneralCategory::Co}, {0x110000, GeneralCategory::Cn},
+};
+
+inline constexpr std::pair<char32_t, BidiClass> kBidiClassRanges[] = {
+    {0x9, BidiClass::BN},       {0xa, BidiClass::S},
+    {0xb, BidiClass::B},        {0xc, BidiClass::S},
+    {0xd, BidiClass::WS},       {0xe, BidiClass::B},
+    {0x1c, BidiClass::BN},      {0x1f, BidiClass::B},
+    {0x20, BidiClass::S},       {0x21, BidiClass::WS},
+    {0x23, BidiClass::ON},      {0x26, BidiClass::ET},
+    {0x2b, BidiClass::ON},      {0x2c, BidiClass::ES},
+    {0x2d, BidiClass::CS},      {0x2e, BidiClass::ES},
+    {0x30, BidiClass::CS},      {0x3a, BidiClass::EN},
+    {0x3b, BidiClass::CS},      {0x41, BidiClass::ON},
+    {0x5b, BidiClass::L},       {0x61, BidiClass::ON},
+    {0x7b, BidiClass::L},       {0x7f, BidiClass::ON},
+    {0x85, BidiClass::BN},      {0x86, BidiClass::B},
+    {0xa0, BidiClass::BN},      {0xa1, BidiClass::CS},
+    {0xa2, BidiClass::ON},      {0xa6, BidiClass::ET},
+    {0xaa, BidiClass::ON},      {0xab, BidiClass::L},
+    {0xad, BidiClass::ON},      {0xae, BidiClass::BN},
+    {0xb0, BidiClass::ON},      {0xb2, BidiClass::ET},
+    {0xb4, BidiClass::EN},      {0xb5, BidiClass::ON},
+    {0xb6, BidiClass::L},       {0xb9, BidiClass::ON},
+    {0xba, BidiClass::EN},      {0xbb, BidiClass::L},
+    {0xc0, BidiClass::ON},      {0xd7, BidiClass::L},
+    {0xd8, BidiClass::ON},      {0xf7, BidiClass::L},
+    {0xf8, BidiClass::ON},      {0x2b9, BidiClass::L},
+    {0x2bb, BidiClass::ON},     {0x2c2, BidiClass::L},
+    {0x2d0, BidiClass::ON},     {0x2d2, BidiClass::L},
+    {0x2e0, BidiClass::ON},     {0x2e5, BidiClass::L},
+    {0x2ee, BidiClass::ON},     {0x2ef, BidiClass::L},
+    {0x300, BidiClass::ON},     {0x370, BidiClass::NSM},
+    {0x374, BidiClass::L},      {0x376, BidiClass::ON},
+    {0x378, BidiClass::L},      {0x37a, BidiClass::None},
+    {0x37e, BidiClass::L},      {0x37f, BidiClass::ON},
+    {0x380, BidiClass::L},      {0x384, BidiClass::None},
+    {0x386, BidiClass::ON},     {0x387, BidiClass::L},
+    {0x388, BidiClass::ON},     {0x38b, BidiClass::L},
+    {0x38c, BidiClass::None},   {0x38d, BidiClass::L},
+    {0x38e, BidiClass::None},   {0x3a2, BidiClass::L},
+    {0x3a3, BidiClass::None},   {0x3f6, BidiClass::L},
+    {0x3f7, BidiClass::ON},     {0x483, BidiClass::L},
+    {0x48a, BidiClass::NSM},    {0x530, BidiClass::L},
+    {0x531, BidiClass::None},   {0x557, BidiClass::L},
+    {0x559, BidiClass::None},   {0x58a, BidiClass::L},
+    {0x58b, BidiClass::ON},     {0x58d, BidiClass::None},
+    {0x58f, BidiClass::ON},     {0x590, BidiClass::ET},
+    {0x591, BidiClass::R},      {0x5be, BidiClass::NSM},
+    {0x5bf, BidiClass::R},      {0x5c0, BidiClass::NSM},
+    {0x5c1, BidiClass::R},      {0x5c3, BidiClass::NSM},
+    {0x5c4, BidiClass::R},      {0x5c6, BidiClass::NSM},
+    {0x5c7, BidiClass::R},      {0x5c8, BidiClass::NSM},
+    {0x600, BidiClass::R},      {0x606, BidiClass::AN},
+    {0x608, BidiClass::ON},     {0x609, BidiClass::AL},
+    {0x60b, BidiClass::ET},     {0x60c, BidiClass::AL},
+    {0x60d, BidiClass::CS},     {0x60e, BidiClass::AL},
+    {0x610, BidiClass::ON},     {0x61b, BidiClass::NSM},
+    {0x64b, BidiClass::AL},     {0x660, BidiClass::NSM},
+    {0x66a, BidiClass::AN},     {0x66b, BidiClass::ET},
+    {0x66d, BidiClass::AN},     {0x670, BidiClass::AL},
+    {0x671, BidiClass::NSM},    {0x6d6, BidiClass::AL},
+    {0x6dd, BidiClass::NSM},    {0x6de, BidiClass::AN},
+    {0x6df, BidiClass::ON},     {0x6e5, BidiClass::NSM},
+    {0x6e7, BidiClass::AL},     {0x6e9, BidiClass::NSM},
+    {0x6ea, BidiClass::ON},     {0x6ee, BidiClass::NSM},
+    {0x6f0, BidiClass::AL},     {0x6fa, BidiClass::EN},
+    {0x711, BidiClass::AL},     {0x712, BidiClass::NSM},
+    {0x730, BidiClass::AL},     {0x74b, BidiClass::NSM},
+    {0x7a6, BidiClass::AL},     {0x7b1, BidiClass::NSM},
+    {0x7c0, BidiClass::AL},     {0x7eb, BidiClass::R},
+    {0x7f4, BidiClass::NSM},    {0x7f6, BidiClass::R},
+    {0x7fa, BidiClass::ON},     {0x7fd, BidiClass::R},
+    {0x7fe, BidiClass::NSM},    {0x816, BidiClass::R},
+    {0x81a, BidiClass::NSM},    {0x81b, BidiClass::R},
+    {0x824, BidiClass::NSM},    {0x825, BidiClass::R},
+    {0x828, BidiClass::NSM},    {0x829, BidiClass::R},
+    {0x82e, BidiClass::NSM},    {0x859, BidiClass::R},
+    {0x85c, BidiClass::NSM},    {0x860, BidiClass::R},
+    {0x870, BidiClass::AL},     {0x8a0, BidiClass::R},
+    {0x8d3, BidiClass::AL},     {0x8e2, BidiClass::NSM},
+    {0x8e3, BidiClass::AN},     {0x903, BidiClass::NSM},
+    {0x93a, BidiClass::L},      {0x93b, BidiClass::NSM},
+    {0x93c, BidiClass::L},      {0x93d, BidiClass::NSM},
+    {0x941, BidiClass::L},      {0x949, BidiClass::NSM},
+    {0x94d, BidiClass::L},      {0x94e, BidiClass::NSM},
+    {0x951, BidiClass::L},      {0x958, BidiClass::NSM},
+    {0x962, BidiClass::L},      {0x964, BidiClass::NSM},
+    {0x981, BidiClass::L},      {0x982, BidiClass::NSM},
+    {0x984, BidiClass::L},      {0x985, BidiClass::None},
+    {0x98d, BidiClass::L},      {0x98f, BidiClass::None},
+    {0x991, BidiClass::L},      {0x993, BidiClass::None},
+    {0x9a9, BidiClass::L},      {0x9aa, BidiClass::None},
+    {0x9b1, BidiClass::L},      {0x9b2, BidiClass::None},
+    {0x9b3, BidiClass::L},      {0x9b6, BidiClass::None},
+    {0x9ba, BidiClass::L},      {0x9bc, BidiClass::None},
+    {0x9bd, BidiClass::NSM},    {0x9c1, BidiClass::L},
+    {0x9c5, BidiClass::NSM},    {0x9c7, BidiClass::None},
+    {0x9c9, BidiClass::L},      {0x9cb, BidiClass::None},
+    {0x9cd, BidiClass::L},      {0x9ce, BidiClass::NSM},
+    {0x9cf, BidiClass::L},      {0x9d7, BidiClass::None},
+    {0x9d8, BidiClass::L},      {0x9dc, BidiClass::None},
+    {0x9de, BidiClass::L},      {0x9df, BidiClass::None},
+    {0x9e2, BidiClass::L},      {0x9e4, BidiClass::NSM},
+    {0x9e6, BidiClass::None},   {0x9f2, BidiClass::L},
+    {0x9f4, BidiClass::ET},     {0x9fb, BidiClass::L},
+    {0x9fc, BidiClass::ET},     {0x9fe, BidiClass::L},
+    {0x9ff, BidiClass::NSM},    {0xa01, BidiClass::None},
+    {0xa03, BidiClass::NSM},    {0xa04, BidiClass::L},
+    {0xa05, BidiClass::None},   {0xa0b, BidiClass::L},
+    {0xa0f, BidiClass::None},   {0xa11, BidiClass::L},
+    {0xa13, BidiClass::None},   {0xa29, BidiClass::L},
+    {0xa2a, BidiClass::None},   {0xa31, BidiClass::L},
+    {0xa32, BidiClass::None},   {0xa34, BidiClass::L},
+    {0xa35, BidiClass::None},   {0xa37, BidiClass::L},
+    {0xa38, BidiClass::None},   {0xa3a, BidiClass::L},
+    {0xa3c, BidiClass::None},   {0xa3d, BidiClass::NSM},
+    {0xa3e, BidiClass::None},   {0xa41, BidiClass::L},
+    {0xa43, BidiClass::NSM},    {0xa47, BidiClass::None},
+    {0xa49, BidiClass::NSM},    {0xa4b, BidiClass::None},
+    {0xa4e, BidiClass::NSM},    {0xa51, BidiClass::None},
+    {0xa52, BidiClass::NSM},    {0xa59, BidiClass::None},
+    {0xa5d, BidiClass::L},      {0xa5e, BidiClass::None},
+    {0xa5f, BidiClass::L},      {0xa66, BidiClass::None},
+    {0xa70, BidiClass::L},      {0xa72, BidiClass::NSM},
+    {0xa75, BidiClass::L},      {0xa76, BidiClass::NSM},
+    {0xa77, BidiClass::L},      {0xa81, BidiClass::None},
+    {0xa83, BidiClass::NSM},    {0xa84, BidiClass::L},
+    {0xa85, BidiClass::None},   {0xa8e, BidiClass::L},
+    {0xa8f, BidiClass::None},   {0xa92, BidiClass::L},
+    {0xa93, BidiClass::None},   {0xaa9, BidiClass::L},
+    {0xaaa, BidiClass::None},   {0xab1, BidiClass::L},
+    {0xab2, BidiClass::None},   {0xab4, BidiClass::L},
+    {0xab5, BidiClass::None},   {0xaba, BidiClass::L},
+    {0xabc, BidiClass::None},   {0xabd, BidiClass::NSM},
+    {0xac1, BidiClass::L},      {0xac6, BidiClass::NSM},
+    {0xac7, BidiClass::None},   {0xac9, BidiClass::NSM},
+    {0xaca, BidiClass::L},      {0xacb, BidiClass::None},
+    {0xacd, BidiClass::L},      {0xace, BidiClass::NSM},
+    {0xad0, BidiClass::None},   {0xad1, BidiClass::L},
+    {0xae0, BidiClass::None},   {0xae2, BidiClass::L},
+    {0xae4, BidiClass::NSM},    {0xae6, BidiClass::None},
+    {0xaf1, BidiClass::L},      {0xaf2, BidiClass::ET},
+    {0xaf9, BidiClass::None},   {0xafa, BidiClass::L},
+    {0xb00, BidiClass::NSM},    {0xb01, BidiClass::None},
+    {0xb02, BidiClass::NSM},    {0xb04, BidiClass::L},
+    {0xb05, BidiClass::None},   {0xb0d, BidiClass::L},
+    {0xb0f, BidiClass::None},   {0xb11, BidiClass::L},
+    {0xb13, BidiClass::None},   {0xb29, BidiClass::L},
+    {0xb2a, BidiClass::None},   {0xb31, BidiClass::L},
+    {0xb32, BidiClass::None},   {0xb34, BidiClass::L},
+    {0xb35, BidiClass::None},   {0xb3a, BidiClass::L},
+    {0xb3c, BidiClass::None},   {0xb3d, BidiClass::NSM},
+    {0xb3f, BidiClass::L},      {0xb40, BidiClass::NSM},
+    {0xb41, BidiClass::L},      {0xb45, BidiClass::NSM},
+    {0xb47, BidiClass::None},   {0xb49, BidiClass::L},
+    {0xb4b, BidiClass::None},   {0xb4d, BidiClass::L},
+    {0xb4e, BidiClass::NSM},    {0xb55, BidiClass::None},
+    {0xb57, BidiClass::NSM},    {0xb58, BidiClass::L},
+    {0xb5c, BidiClass::None},   {0xb5e, BidiClass::L},
+    {0xb5f, BidiClass::None},   {0xb62, BidiClass::L},
+    {0xb64, BidiClass::NSM},    {0xb66, BidiClass::None},
+    {0xb78, BidiClass::L},      {0xb82, BidiClass::None},
+    {0xb83, BidiClass::NSM},    {0xb84, BidiClass::L},
+    {0xb85, BidiClass::None},   {0xb8b, BidiClass::L},
+    {0xb8e, BidiClass::None},   {0xb91, BidiClass::L},
+    {0xb92, BidiClass::None},   {0xb96, BidiClass::L},
+    {0xb99, BidiClass::None},   {0xb9b, BidiClass::L},
+    {0xb9c, BidiClass::None},   {0xb9d, BidiClass::L},
+    {0xb9e, BidiClass::None},   {0xba0, BidiClass::L},
+    {0xba3, BidiClass::None},   {0xba5, BidiClass::L},
+    {0xba8, BidiClass::None},   {0xbab, BidiClass::L},
+    {0xbae, BidiClass::None},   {0xbba, BidiClass::L},
+    {0xbbe, BidiClass::None},   {0xbc0, BidiClass::L},
+    {0xbc1, BidiClass::NSM},    {0xbc3, BidiClass::L},
+    {0xbc6, BidiClass::None},   {0xbc9, BidiClass::L},
+    {0xbca, BidiClass::None},   {0xbcd, BidiClass::L},
+    {0xbce, BidiClass::NSM},    {0xbd0, BidiClass::None},
+    {0xbd1, BidiClass::L},      {0xbd7, BidiClass::None},
+    {0xbd8, BidiClass::L},      {0xbe6, BidiClass::None},
+    {0xbf3, BidiClass::L},      {0xbf9, BidiClass::ON},
+    {0xbfa, BidiClass::ET},     {0xbfb, BidiClass::ON},
+    {0xc00, BidiClass::None},   {0xc01, BidiClass::NSM},
+    {0xc04, BidiClass::L},      {0xc05, BidiClass::NSM},
+    {0xc0d, BidiClass::L},      {0xc0e, BidiClass::None},
+    {0xc11, BidiClass::L},      {0xc12, BidiClass::None},
+    {0xc29, BidiClass::L},      {0xc2a, BidiClass::None},
+    {0xc3a, BidiClass::L},      {0xc3d, BidiClass::None},
+    {0xc3e, BidiClass::L},      {0xc41, BidiClass::NSM},
+    {0xc45, BidiClass::L},      {0xc46, BidiClass::None},
+    {0xc49, BidiClass::NSM},    {0xc4a, BidiClass::None},
+    {0xc4e, BidiClass::NSM},    {0xc55, BidiClass::None},
+    {0xc57, BidiClass::NSM},    {0xc58, BidiClass::None},
+    {0xc5b, BidiClass::L},      {0xc60, BidiClass::None},
+    {0xc62, BidiClass::L},      {0xc64, BidiClass::NSM},
+    {0xc66, BidiClass::None},   {0xc70, BidiClass::L},
+    {0xc77, BidiClass::None},   {0xc78, BidiClass::L},
+    {0xc7f, BidiClass::ON},     {0xc81, BidiClass::L},
+    {0xc82, BidiClass::NSM},    {0xc8d, BidiClass::L},
+    {0xc8e, BidiClass::None},   {0xc91, BidiClass::L},
+    {0xc92, BidiClass::None},   {0xca9, BidiClass::L},
+    {0xcaa, BidiClass::None},   {0xcb4, BidiClass::L},
+    {0xcb5, BidiClass::None},   {0xcba, BidiClass::L},
+    {0xcbc, BidiClass::None},   {0xcbd, BidiClass::NSM},
+    {0xcc5, BidiClass::L},      {0xcc6, BidiClass::None},
+    {0xcc9, BidiClass::L},      {0xcca, BidiClass::None},
+    {0xccc, BidiClass::L},      {0xcce, BidiClass::NSM},
+    {0xcd5, BidiClass::None},   {0xcd7, BidiClass::L},
+    {0xcde, BidiClass::None},   {0xcdf, BidiClass::L},
+    {0xce0, BidiClass::None},   {0xce2, BidiClass::L},
+    {0xce4, BidiClass::NSM},    {0xce6, BidiClass::None},
+    {0xcf0, BidiClass::L},      {0xcf1, BidiClass::None},
+    {0xcf3, BidiClass::L},      {0xd00, BidiClass::None},
+    {0xd02, BidiClass::NSM},    {0xd0d, BidiClass::L},
+    {0xd0e, BidiClass::None},   {0xd11, BidiClass::L},
+    {0xd12, BidiClass::None},   {0xd3b, BidiClass::L},
+    {0xd3d, BidiClass::NSM},    {0xd41, BidiClass::L},
+    {0xd45, BidiClass::NSM},    {0xd46, BidiClass::None},
+    {0xd49, BidiClass::L},      {0xd4a, BidiClass::None},
+    {0xd4d, BidiClass::L},      {0xd4e, BidiClass::NSM},
+    {0xd50, BidiClass::L},      {0xd54, BidiClass::None},
+    {0xd62, BidiClass::L},      {0xd64, BidiClass::NSM},
+    {0xd66, BidiClass::None},   {0xd80, BidiClass::L},
+    {0xd81, BidiClass::None},   {0xd82, BidiClass::NSM},
+    {0xd84, BidiClass::L},      {0xd85, BidiClass::None},
+    {0xd97, BidiClass::L},      {0xd9a, BidiClass::None},
+    {0xdb2, BidiClass::L},      {0xdb3, BidiClass::None},
+    {0xdbc, BidiClass::L},      {0xdbd, BidiClass::None},
+    {0xdbe, BidiClass::L},      {0xdc0, BidiClass::None},
+    {0xdc7, BidiClass::L},      {0xdca, BidiClass::None},
+    {0xdcb, BidiClass::NSM},    {0xdcf, BidiClass::None},
+    {0xdd2, BidiClass::L},      {0xdd5, BidiClass::NSM},
+    {0xdd6, BidiClass::None},   {0xdd7, BidiClass::NSM},
+    {0xdd8, BidiClass::None},   {0xde0, BidiClass::L},
+    {0xde6, BidiClass::None},   {0xdf0, BidiClass::L},
+    {0xdf2, BidiClass::None},   {0xdf5, BidiClass::L},
+    {0xe01, BidiClass::None},   {0xe31, BidiClass::L},
+    {0xe32, BidiClass::NSM},    {0xe34, BidiClass::L},
+    {0xe3b, BidiClass::NSM},    {0xe3f, BidiClass::None},
+    {0xe40, BidiClass::ET},     {0xe47, BidiClass::L},
+    {0xe4f, BidiClass::NSM},    {0xe5c, BidiClass::L},
+    {0xe81, BidiClass::None},   {0xe83, BidiClass::L},
+    {0xe84, BidiClass::None},   {0xe85, BidiClass::L},
+    {0xe86, BidiClass::None},   {0xe8b, BidiClass::L},
+    {0xe8c, BidiClass::None},   {0xea4, BidiClass::L},
+    {0xea5, BidiClass::None},   {0xea6, BidiClass::L},
+    {0xea7, BidiClass::None},   {0xeb1, BidiClass::L},
+    {0xeb2, BidiClass::NSM},    {0xeb4, BidiClass::L},
+    {0xebd, BidiClass::NSM},    {0xebe, BidiClass::L},
+    {0xec0, BidiClass::None},   {0xec5, BidiClass::L},
+    {0xec6, BidiClass::None},   {0xec7, BidiClass::L},
+    {0xec8, BidiClass::None},   {0xece, BidiClass::NSM},
+    {0xed0, BidiClass::None},   {0xeda, BidiClass::L},
+    {0xedc, BidiClass::None},   {0xee0, BidiClass::L},
+    {0xf00, BidiClass::None},   {0xf18, BidiClass::L},
+    {0xf1a, BidiClass::NSM},    {0xf35, BidiClass::L},
+    {0xf36, BidiClass::NSM},    {0xf37, BidiClass::L},
+    {0xf38, BidiClass::NSM},    {0xf39, BidiClass::L},
+    {0xf3a, BidiClass::NSM},    {0xf3e, BidiClass::ON},
+    {0xf48, BidiClass::L},      {0xf49, BidiClass::None},
+    {0xf6d, BidiClass::L},      {0xf71, BidiClass::None},
+    {0xf7f, BidiClass::NSM},    {0xf80, BidiClass::L},
+    {0xf85, BidiClass::NSM},    {0xf86, BidiClass::L},
+    {0xf88, BidiClass::NSM},    {0xf8d, BidiClass::L},
+    {0xf98, BidiClass::NSM},    {0xf99, BidiClass::None},
+    {0xfbd, BidiClass::NSM},    {0xfbe, BidiClass::None},
+    {0xfc6, BidiClass::L},      {0xfc7, BidiClass::NSM},
+    {0xfcd, BidiClass::L},      {0xfce, BidiClass::None},
+    {0xfdb, BidiClass::L},      {0x1000, BidiClass::None},
+    {0x102d, BidiClass::L},     {0x1031, BidiClass::NSM},
+    {0x1032, BidiClass::L},     {0x1038, BidiClass::NSM},
+    {0x1039, BidiClass::L},     {0x103b, BidiClass::NSM},
+    {0x103d, BidiClass::L},     {0x103f, BidiClass::NSM},
+    {0x1058, BidiClass::L},     {0x105a, BidiClass::NSM},
+    {0x105e, BidiClass::L},     {0x1061, BidiClass::NSM},
+    {0x1071, BidiClass::L},     {0x1075, BidiClass::NSM},
+    {0x1082, BidiClass::L},     {0x1083, BidiClass::NSM},
+    {0x1085, BidiClass::L},     {0x1087, BidiClass::NSM},
+    {0x108d, BidiClass::L},     {0x108e, BidiClass::NSM},
+    {0x109d, BidiClass::L},     {0x109e, BidiClass::NSM},
+    {0x10c6, BidiClass::L},     {0x10c7, BidiClass::None},
+    {0x10c8, BidiClass::L},     {0x10cd, BidiClass::None},
+    {0x10ce, BidiClass::L},     {0x10d0, BidiClass::None},
+    {0x1249, BidiClass::L},     {0x124a, BidiClass::None},
+    {0x124e, BidiClass::L},     {0x1250, BidiClass::None},
+    {0x1257, BidiClass::L},     {0x1258, BidiClass::None},
+    {0x1259, BidiClass::L},     {0x125a, BidiClass::None},
+    {0x125e, BidiClass::L},     {0x1260, BidiClass::None},
+    {0x1289, BidiClass::L},     {0x128a, BidiClass::None},
+    {0x128e, BidiClass::L},     {0x1290, BidiClass::None},
+    {0x12b1, BidiClass::L},     {0x12b2, BidiClass::None},
+    {0x12b6, BidiClass::L},     {0x12b8, BidiClass::None},
+    {0x12bf, BidiClass::L},     {0x12c0, BidiClass::None},
+    {0x12c1, BidiClass::L},     {0x12c2, BidiClass::None},
+    {0x12c6, BidiClass::L},     {0x12c8, BidiClass::None},
+    {0x12d7, BidiClass::L},     {0x12d8, BidiClass::None},
+    {0x1311, BidiClass::L},     {0x1312, BidiClass::None},
+    {0x1316, BidiClass::L},     {0x1318, BidiClass::None},
+    {0x135b, BidiClass::L},     {0x135d, BidiClass::None},
+    {0x1360, BidiClass::NSM},   {0x137d, BidiClass::L},
+    {0x1380, BidiClass::None},  {0x1390, BidiClass::L},
+    {0x139a, BidiClass::ON},    {0x13a0, BidiClass::None},
+    {0x13f6, BidiClass::L},     {0x13f8, BidiClass::None},
+    {0x13fe, BidiClass::L},     {0x1400, BidiClass::None},
+    {0x1401, BidiClass::ON},    {0x1680, BidiClass::L},
+    {0x1681, BidiClass::WS},    {0x169b, BidiClass::L},
+    {0x169d, BidiClass::ON},    {0x16a0, BidiClass::None},
+    {0x16f9, BidiClass::L},     {0x1700, BidiClass::None},
+    {0x170d, BidiClass::L},     {0x170e, BidiClass::None},
+    {0x1712, BidiClass::L},     {0x1715, BidiClass::NSM},
+    {0x1720, BidiClass::None},  {0x1732, BidiClass::L},
+    {0x1735, BidiClass::NSM},   {0x1737, BidiClass::L},
+    {0x1740, BidiClass::None},  {0x1752, BidiClass::L},
+    {0x1754, BidiClass::NSM},   {0x1760, BidiClass::None},
+    {0x176d, BidiClass::L},     {0x176e, BidiClass::None},
+    {0x1771, BidiClass::L},     {0x1772, BidiClass::None},
+    {0x1774, BidiClass::NSM},   {0x1780, BidiClass::None},
+    {0x17b4, BidiClass::L},     {0x17b6, BidiClass::NSM},
+    {0x17b7, BidiClass::L},     {0x17be, BidiClass::NSM},
+    {0x17c6, BidiClass::L},     {0x17c7, BidiClass::NSM},
+    {0x17c9, BidiClass::L},     {0x17d4, BidiClass::NSM},
+    {0x17db, BidiClass::L},     {0x17dc, BidiClass::ET},
+    {0x17dd, BidiClass::L},     {0x17de, BidiClass::NSM},
+    {0x17e0, BidiClass::None},  {0x17ea, BidiClass::L},
+    {0x17f0, BidiClass::None},  {0x17fa, BidiClass::ON},
+    {0x1800, BidiClass::None},  {0x180b, BidiClass::ON},
+    {0x180e, BidiClass::NSM},   {0x180f, BidiClass::BN},
+    {0x1810, BidiClass::None},  {0x181a, BidiClass::L},
+    {0x1820, BidiClass::None},  {0x1879, BidiClass::L},
+    {0x1880, BidiClass::None},  {0x1885, BidiClass::L},
+    {0x1887, BidiClass::NSM},   {0x18a9, BidiClass::L},
+    {0x18aa, BidiClass::NSM},   {0x18ab, BidiClass::L},
+    {0x18b0, BidiClass::None},  {0x18f6, BidiClass::L},
+    {0x1900, BidiClass::None},  {0x191f, BidiClass::L},
+    {0x1920, BidiClass::None},  {0x1923, BidiClass::NSM},
+    {0x1927, BidiClass::L},     {0x1929, BidiClass::NSM},
+    {0x192c, BidiClass::L},     {0x1930, BidiClass::None},
+    {0x1932, BidiClass::L},     {0x1933, BidiClass::NSM},
+    {0x1939, BidiClass::L},     {0x193c, BidiClass::NSM},
+    {0x1940, BidiClass::None},  {0x1941, BidiClass::ON},
+    {0x1944, BidiClass::None},  {0x1946, BidiClass::ON},
+    {0x196e, BidiClass::L},     {0x1970, BidiClass::None},
+    {0x1975, BidiClass::L},     {0x1980, BidiClass::None},
+    {0x19ac, BidiClass::L},     {0x19b0, BidiClass::None},
+    {0x19ca, BidiClass::L},     {0x19d0, BidiClass::None},
+    {0x19db, BidiClass::L},     {0x19de, BidiClass::None},
+    {0x1a00, BidiClass::ON},    {0x1a17, BidiClass::L},
+    {0x1a19, BidiClass::NSM},   {0x1a1b, BidiClass::L},
+    {0x1a1c, BidiClass::NSM},   {0x1a1e, BidiClass::None},
+    {0x1a56, BidiClass::L},     {0x1a57, BidiClass::NSM},
+    {0x1a58, BidiClass::L},     {0x1a5f, BidiClass::NSM},
+    {0x1a60, BidiClass::None},  {0x1a61, BidiClass::NSM},
+    {0x1a62, BidiClass::L},     {0x1a63, BidiClass::NSM},
+    {0x1a65, BidiClass::L},     {0x1a6d, BidiClass::NSM},
+    {0x1a73, BidiClass::L},     {0x1a7d, BidiClass::NSM},
+    {0x1a7f, BidiClass::None},  {0x1a80, BidiClass::NSM},
+    {0x1a8a, BidiClass::L},     {0x1a90, BidiClass::None},
+    {0x1a9a, BidiClass::L},     {0x1aa0, BidiClass::None},
+    {0x1aae, BidiClass::L},     {0x1ab0, BidiClass::None},
+    {0x1ac1, BidiClass::NSM},   {0x1b00, BidiClass::None},
+    {0x1b04, BidiClass::NSM},   {0x1b34, BidiClass::L},
+    {0x1b35, BidiClass::NSM},   {0x1b36, BidiClass::L},
+    {0x1b3b, BidiClass::NSM},   {0x1b3c, BidiClass::L},
+    {0x1b3d, BidiClass::NSM},   {0x1b42, BidiClass::L},
+    {0x1b43, BidiClass::NSM},   {0x1b4c, BidiClass::L},
+    {0x1b50, BidiClass::None},  {0x1b6b, BidiClass::L},
+    {0x1b74, BidiClass::NSM},   {0x1b7d, BidiClass::L},
+    {0x1b80, BidiClass::None},  {0x1b82, BidiClass::NSM},
+    {0x1ba2, BidiClass::L},     {0x1ba6, BidiClass::NSM},
+    {0x1ba8, BidiClass::L},     {0x1baa, BidiClass::NSM},
+    {0x1bab, BidiClass::L},     {0x1bae, BidiClass::NSM},
+    {0x1be6, BidiClass::L},     {0x1be7, BidiClass::NSM},
+    {0x1be8, BidiClass::L},     {0x1bea, BidiClass::NSM},
+    {0x1bed, BidiClass::L},     {0x1bee, BidiClass::NSM},
+    {0x1bef, BidiClass::L},     {0x1bf2, BidiClass::NSM},
+    {0x1bf4, BidiClass::L},     {0x1bfc, BidiClass::None},
+    {0x1c2c, BidiClass::L},     {0x1c34, BidiClass::NSM},
+    {0x1c36, BidiClass::L},     {0x1c38, BidiClass::NSM},
+    {0x1c3b, BidiClass::None},  {0x1c4a, BidiClass::L},
+    {0x1c4d, BidiClass::None},  {0x1c89, BidiClass::L},
+    {0x1c90, BidiClass::None},  {0x1cbb, BidiClass::L},
+    {0x1cbd, BidiClass::None},  {0x1cc8, BidiClass::L},
+    {0x1cd0, BidiClass::None},  {0x1cd3, BidiClass::NSM},
+    {0x1cd4, BidiClass::L},     {0x1ce1, BidiClass::NSM},
+    {0x1ce2, BidiClass::L},     {0x1ce9, BidiClass::NSM},
+    {0x1ced, BidiClass::L},     {0x1cee, BidiClass::NSM},
+    {0x1cf4, BidiClass::L},     {0x1cf5, BidiClass::NSM},
+    {0x1cf8, BidiClass::L},     {0x1cfa, BidiClass::NSM},
+    {0x1cfb, BidiClass::L},     {0x1d00, BidiClass::None},
+    {0x1dc0, BidiClass::L},     {0x1dfa, BidiClass::NSM},
+    {0x1dfb, BidiClass::None},  {0x1e00, BidiClass::NSM},
+    {0x1f16, BidiClass::L},     {0x1f18, BidiClass::None},
+    {0x1f1e, BidiClass::L},     {0x1f20, BidiClass::None},
+    {0x1f46, BidiClass::L},     {0x1f48, BidiClass::None},
+    {0x1f4e, BidiClass::L},     {0x1f50, BidiClass::None},
+    {0x1f58, BidiClass::L},     {0x1f59, BidiClass::None},
+    {0x1f5a, BidiClass::L},     {0x1f5b, BidiClass::None},
+    {0x1f5c, BidiClass::L},     {0x1f5d, BidiClass::None},
+    {0x1f5e, BidiClass::L},     {0x1f5f, BidiClass::None},
+    {0x1f7e, BidiClass::L},     {0x1f80, BidiClass::None},
+    {0x1fb5, BidiClass::L},     {0x1fb6, BidiClass::None},
+    {0x1fbd, BidiClass::L},     {0x1fbe, BidiClass::ON},
+    {0x1fbf, BidiClass::L},     {0x1fc2, BidiClass::ON},
+    {0x1fc5, BidiClass::L},     {0x1fc6, BidiClass::None},
+    {0x1fcd, BidiClass::L},     {0x1fd0, BidiClass::ON},
+    {0x1fd4, BidiClass::L},     {0x1fd6, BidiClass::None},
+    {0x1fdc, BidiClass::L},     {0x1fdd, BidiClass::None},
+    {0x1fe0, BidiClass::ON},    {0x1fed, BidiClass::L},
+    {0x1ff0, BidiClass::ON},    {0x1ff2, BidiClass::None},
+    {0x1ff5, BidiClass::L},     {0x1ff6, BidiClass::None},
+    {0x1ffd, BidiClass::L},     {0x1fff, BidiClass::ON},
+    {0x2000, BidiClass::None},  {0x200b, BidiClass::WS},
+    {0x200e, BidiClass::BN},    {0x200f, BidiClass::L},
+    {0x2010, BidiClass::R},     {0x2028, BidiClass::ON},
+    {0x2029, BidiClass::WS},    {0x202a, BidiClass::B},
+    {0x202b, BidiClass::LRE},   {0x202c, BidiClass::RLE},
+    {0x202d, BidiClass::PDF},   {0x202e, BidiClass::LRO},
+    {0x202f, BidiClass::RLO},   {0x2030, BidiClass::CS},
+    {0x2035, BidiClass::ET},    {0x2044, BidiClass::ON},
+    {0x2045, BidiClass::CS},    {0x205f, BidiClass::ON},
+    {0x2060, BidiClass::WS},    {0x2066, BidiClass::BN},
+    {0x2067, BidiClass::LRI},   {0x2068, BidiClass::RLI},
+    {0x2069, BidiClass::FSI},   {0x206a, BidiClass::PDI},
+    {0x2070, BidiClass::BN},    {0x2071, BidiClass::EN},
+    {0x2072, BidiClass::L},     {0x2074, BidiClass::None},
+    {0x207a, BidiClass::EN},    {0x207c, BidiClass::ES},
+    {0x207f, BidiClass::ON},    {0x2080, BidiClass::L},
+    {0x208a, BidiClass::EN},    {0x208c, BidiClass::ES},
+    {0x208f, BidiClass::ON},    {0x2090, BidiClass::None},
+    {0x209d, BidiClass::L},     {0x20a0, BidiClass::None},
+    {0x20d0, BidiClass::ET},    {0x20f1, BidiClass::NSM},
+    {0x2100, BidiClass::None},  {0x2102, BidiClass::ON},
+    {0x2103, BidiClass::L},     {0x2107, BidiClass::ON},
+    {0x2108, BidiClass::L},     {0x210a, BidiClass::ON},
+    {0x2114, BidiClass::L},     {0x2115, BidiClass::ON},
+    {0x2116, BidiClass::L},     {0x2119, BidiClass::ON},
+    {0x211e, BidiClass::L},     {0x2124, BidiClass::ON},
+    {0x2125, BidiClass::L},     {0x2126, BidiClass::ON},
+    {0x2127, BidiClass::L},     {0x2128, BidiClass::ON},
+    {0x2129, BidiClass::L},     {0x212a, BidiClass::ON},
+    {0x212e, BidiClass::L},     {0x212f, BidiClass::ET},
+    {0x213a, BidiClass::L},     {0x213c, BidiClass::ON},
+    {0x2140, BidiClass::L},     {0x2145, BidiClass::ON},
+    {0x214a, BidiClass::L},     {0x214e, BidiClass::ON},
+    {0x2150, BidiClass::L},     {0x2160, BidiClass::ON},
+    {0x2189, BidiClass::L},     {0x218c, BidiClass::ON},
+    {0x2190, BidiClass::None},  {0x2212, BidiClass::ON},
+    {0x2213, BidiClass::ES},    {0x2214, BidiClass::ET},
+    {0x2336, BidiClass::ON},    {0x237b, BidiClass::L},
+    {0x2395, BidiClass::ON},    {0x2396, BidiClass::L},
+    {0x2427, BidiClass::ON},    {0x2440, BidiClass::None},
+    {0x244b, BidiClass::ON},    {0x2460, BidiClass::None},
+    {0x2488, BidiClass::ON},    {0x249c, BidiClass::EN},
+    {0x24ea, BidiClass::L},     {0x26ac, BidiClass::ON},
+    {0x26ad, BidiClass::L},     {0x2800, BidiClass::ON},
+    {0x2900, BidiClass::L},     {0x2b74, BidiClass::ON},
+    {0x2b76, BidiClass::None},  {0x2b96, BidiClass::ON},
+    {0x2b97, BidiClass::None},  {0x2c00, BidiClass::ON},
+    {0x2c2f, BidiClass::L},     {0x2c30, BidiClass::None},
+    {0x2c5f, BidiClass::L},     {0x2c60, BidiClass::None},
+    {0x2ce5, BidiClass::L},     {0x2ceb, BidiClass::ON},
+    {0x2cef, BidiClass::L},     {0x2cf2, BidiClass::NSM},
+    {0x2cf4, BidiClass::L},     {0x2cf9, BidiClass::None},
+    {0x2d00, BidiClass::ON},    {0x2d26, BidiClass::L},
+    {0x2d27, BidiClass::None},  {0x2d28, BidiClass::L},
+    {0x2d2d, BidiClass::None},  {0x2d2e, BidiClass::L},
+    {0x2d30, BidiClass::None},  {0x2d68, BidiClass::L},
+    {0x2d6f, BidiClass::None},  {0x2d71, BidiClass::L},
+    {0x2d7f, BidiClass::None},  {0x2d80, BidiClass::NSM},
+    {0x2d97, BidiClass::L},     {0x2da0, BidiClass::None},
+    {0x2da7, BidiClass::L},     {0x2da8, BidiClass::None},
+    {0x2daf, BidiClass::L},     {0x2db0, BidiClass::None},
+    {0x2db7, BidiClass::L},     {0x2db8, BidiClass::None},
+    {0x2dbf, BidiClass::L},     {0x2dc0, BidiClass::None},
+    {0x2dc7, BidiClass::L},     {0x2dc8, BidiClass::None},
+    {0x2dcf, BidiClass::L},     {0x2dd0, BidiClass::None},
+    {0x2dd7, BidiClass::L},     {0x2dd8, BidiClass::None},
+    {0x2ddf, BidiClass::L},     {0x2de0, BidiClass::None},
+    {0x2e00, BidiClass::NSM},   {0x2e53, BidiClass::ON},
+    {0x2e80, BidiClass::None},  {0x2e9a, BidiClass::ON},
+    {0x2e9b, BidiClass::None},  {0x2ef4, BidiClass::ON},
+    {0x2f00, BidiClass::None},  {0x2fd6, BidiClass::ON},
+    {0x2ff0, BidiClass::None},  {0x2ffc, BidiClass::ON},
+    {0x3000, BidiClass::None},  {0x3001, BidiClass::WS},
+    {0x3005, BidiClass::ON},    {0x3008, BidiClass::L},
+    {0x3021, BidiClass::ON},    {0x302a, BidiClass::L},
+    {0x302e, BidiClass::NSM},   {0x3030, BidiClass::L},
+    {0x3031, BidiClass::ON},    {0x3036, BidiClass::L},
+    {0x3038, BidiClass::ON},    {0x303d, BidiClass::L},
+    {0x3040, BidiClass::ON},    {0x3041, BidiClass::None},
+    {0x3097, BidiClass::L},     {0x3099, BidiClass::None},
+    {0x309b, BidiClass::NSM},   {0x309d, BidiClass::ON},
+    {0x30a0, BidiClass::L},     {0x30a1, BidiClass::ON},
+    {0x30fb, BidiClass::L},     {0x30fc, BidiClass::ON},
+    {0x3100, BidiClass::L},     {0x3105, BidiClass::None},
+    {0x3130, BidiClass::L},     {0x3131, BidiClass::None},
+    {0x318f, BidiClass::L},     {0x3190, BidiClass::None},
+    {0x31c0, BidiClass::L},     {0x31e4, BidiClass::ON},
+    {0x31f0, BidiClass::None},  {0x321d, BidiClass::L},
+    {0x321f, BidiClass::ON},    {0x3220, BidiClass::None},
+    {0x3250, BidiClass::L},     {0x3260, BidiClass::ON},
+    {0x327c, BidiClass::L},     {0x327f, BidiClass::ON},
+    {0x32b1, BidiClass::L},     {0x32c0, BidiClass::ON},
+    {0x32cc, BidiClass::L},     {0x32d0, BidiClass::ON},
+    {0x3377, BidiClass::L},     {0x337b, BidiClass::ON},
+    {0x33de, BidiClass::L},     {0x33e0, BidiClass::ON},
+    {0x33ff, BidiClass::L},     {0x3400, BidiClass::ON},
+    {0x4dc0, BidiClass::L},     {0x4e00, BidiClass::ON},
+    {0x9ffd, BidiClass::L},     {0xa000, BidiClass::None},
+    {0xa48d, BidiClass::L},     {0xa490, BidiClass::None},
+    {0xa4c7, BidiClass::ON},    {0xa4d0, BidiClass::None},
+    {0xa60d, BidiClass::L},     {0xa610, BidiClass::ON},
+    {0xa62c, BidiClass::L},     {0xa640, BidiClass::None},
+    {0xa66f, BidiClass::L},     {0xa673, BidiClass::NSM},
+    {0xa674, BidiClass::ON},    {0xa67e, BidiClass::NSM},
+    {0xa680, BidiClass::ON},    {0xa69e, BidiClass::L},
+    {0xa6a0, BidiClass::NSM},   {0xa6f0, BidiClass::L},
+    {0xa6f2, BidiClass::NSM},   {0xa6f8, BidiClass::L},
+    {0xa700, BidiClass::None},  {0xa722, BidiClass::ON},
+    {0xa788, BidiClass::L},     {0xa789, BidiClass::ON},
+    {0xa7c0, BidiClass::L},     {0xa7c2, BidiClass::None},
+    {0xa7cb, BidiClass::L},     {0xa7f5, BidiClass::None},
+    {0xa802, BidiClass::L},     {0xa803, BidiClass::NSM},
+    {0xa806, BidiClass::L},     {0xa807, BidiClass::NSM},
+    {0xa80b, BidiClass::L},     {0xa80c, BidiClass::NSM},
+    {0xa825, BidiClass::L},     {0xa827, BidiClass::NSM},
+    {0xa828, BidiClass::L},     {0xa82c, BidiClass::ON},
+    {0xa82d, BidiClass::NSM},   {0xa830, BidiClass::None},
+    {0xa838, BidiClass::L},     {0xa83a, BidiClass::ET},
+    {0xa840, BidiClass::None},  {0xa874, BidiClass::L},
+    {0xa878, BidiClass::ON},    {0xa880, BidiClass::None},
+    {0xa8c4, BidiClass::L},     {0xa8c6, BidiClass::NSM},
+    {0xa8ce, BidiClass::None},  {0xa8da, BidiClass::L},
+    {0xa8e0, BidiClass::None},  {0xa8f2, BidiClass::NSM},
+    {0xa8ff, BidiClass::L},     {0xa900, BidiClass::NSM},
+    {0xa926, BidiClass::L},     {0xa92e, BidiClass::NSM},
+    {0xa947, BidiClass::L},     {0xa952, BidiClass::NSM},
+    {0xa954, BidiClass::L},     {0xa95f, BidiClass::None},
+    {0xa97d, BidiClass::L},     {0xa980, BidiClass::None},
+    {0xa983, BidiClass::NSM},   {0xa9b3, BidiClass::L},
+    {0xa9b4, BidiClass::NSM},   {0xa9b6, BidiClass::L},
+    {0xa9ba, BidiClass::NSM},   {0xa9bc, BidiClass::L},
+    {0xa9be, BidiClass::NSM},   {0xa9ce, BidiClass::L},
+    {0xa9cf, BidiClass::None},  {0xa9da, BidiClass::L},
+    {0xa9de, BidiClass::None},  {0xa9e5, BidiClass::L},
+    {0xa9e6, BidiClass::NSM},   {0xa9ff, BidiClass::L},
+    {0xaa00, BidiClass::None},  {0xaa29, BidiClass::L},
+    {0xaa2f, BidiClass::NSM},   {0xaa31, BidiClass::L},
+    {0xaa33, BidiClass::NSM},   {0xaa35, BidiClass::L},
+    {0xaa37, BidiClass::NSM},   {0xaa40, BidiClass::None},
+    {0xaa43, BidiClass::L},     {0xaa44, BidiClass::NSM},
+    {0xaa4c, BidiClass::L},     {0xaa4d, BidiClass::NSM},
+    {0xaa4e, BidiClass::L},     {0xaa50, BidiClass::None},
+    {0xaa5a, BidiClass::L},     {0xaa5c, BidiClass::None},
+    {0xaa7c, BidiClass::L},     {0xaa7d, BidiClass::NSM},
+    {0xaab0, BidiClass::L},     {0xaab1, BidiClass::NSM},
+    {0xaab2, BidiClass::L},     {0xaab5, BidiClass::NSM},
+    {0xaab7, BidiClass::L},     {0xaab9, BidiClass::NSM},
+    {0xaabe, BidiClass::L},     {0xaac0, BidiClass::NSM},
+    {0xaac1, BidiClass::L},     {0xaac2, BidiClass::NSM},
+    {0xaac3, BidiClass::L},     {0xaadb, BidiClass::None},
+    {0xaaec, BidiClass::L},     {0xaaee, BidiClass::NSM},
+    {0xaaf6, BidiClass::L},     {0xaaf7, BidiClass::NSM},
+    {0xab01, BidiClass::None},  {0xab07, BidiClass::L},
+    {0xab09, BidiClass::None},  {0xab0f, BidiClass::L},
+    {0xab11, BidiClass::None},  {0xab17, BidiClass::L},
+    {0xab20, BidiClass::None},  {0xab27, BidiClass::L},
+    {0xab28, BidiClass::None},  {0xab2f, BidiClass::L},
+    {0xab30, BidiClass::None},  {0xab6a, BidiClass::L},
+    {0xab6c, BidiClass::ON},    {0xab70, BidiClass::None},
+    {0xabe5, BidiClass::L},     {0xabe6, BidiClass::NSM},
+    {0xabe8, BidiClass::L},     {0xabe9, BidiClass::NSM},
+    {0xabed, BidiClass::L},     {0xabee, BidiClass::NSM},
+    {0xabf0, BidiClass::None},  {0xabfa, BidiClass::L},
+    {0xac00, BidiClass::None},  {0xd7a4, BidiClass::L},
+    {0xd7b0, BidiClass::None},  {0xd7c7, BidiClass::L},
+    {0xd7cb, BidiClass::None},  {0xd7fc, BidiClass::L},
+    {0xe000, BidiClass::None},  {0xfa6e, BidiClass::L},
+    {0xfa70, BidiClass::None},  {0xfada, BidiClass::L},
+    {0xfb00, BidiClass::None},  {0xfb07, BidiClass::L},
+    {0xfb13, BidiClass::None},  {0xfb18, BidiClass::L},
+    {0xfb1d, BidiClass::None},  {0xfb1e, BidiClass::R},
+    {0xfb1f, BidiClass::NSM},   {0xfb29, BidiClass::R},
+    {0xfb2a, BidiClass::ES},    {0xfb50, BidiClass::R},
+    {0xfd3e, BidiClass::AL},    {0xfd40, BidiClass::ON},
+    {0xfdd0, BidiClass::AL},    {0xfdf0, BidiClass::BN},
+    {0xfdfd, BidiClass::AL},    {0xfdfe, BidiClass::ON},
+    {0xfe00, BidiClass::AL},    {0xfe10, BidiClass::NSM},
+    {0xfe1a, BidiClass::ON},    {0xfe20, BidiClass::None},
+    {0xfe30, BidiClass::NSM},   {0xfe50, BidiClass::ON},
+    {0xfe51, BidiClass::CS},    {0xfe52, BidiClass::ON},
+    {0xfe53, BidiClass::CS},    {0xfe54, BidiClass::None},
+    {0xfe55, BidiClass::ON},    {0xfe56, BidiClass::CS},
+    {0xfe5f, BidiClass::ON},    {0xfe60, BidiClass::ET},
+    {0xfe62, BidiClass::ON},    {0xfe64, BidiClass::ES},
+    {0xfe67, BidiClass::ON},    {0xfe68, BidiClass::None},
+    {0xfe69, BidiClass::ON},    {0xfe6b, BidiClass::ET},
+    {0xfe6c, BidiClass::ON},    {0xfe70, BidiClass::None},
+    {0xfeff, BidiClass::AL},    {0xff00, BidiClass::BN},
+    {0xff01, BidiClass::None},  {0xff03, BidiClass::ON},
+    {0xff06, BidiClass::ET},    {0xff0b, BidiClass::ON},
+    {0xff0c, BidiClass::ES},    {0xff0d, BidiClass::CS},
+    {0xff0e, BidiClass::ES},    {0xff10, BidiClass::CS},
+    {0xff1a, BidiClass::EN},    {0xff1b, BidiClass::CS},
+    {0xff21, BidiClass::ON},    {0xff3b, BidiClass::L},
+    {0xff41, BidiClass::ON},    {0xff5b, BidiClass::L},
+    {0xff66, BidiClass::ON},    {0xffbf, BidiClass::L},
+    {0xffc2, BidiClass::None},  {0xffc8, BidiClass::L},
+    {0xffca, BidiClass::None},  {0xffd0, BidiClass::L},
+    {0xffd2, BidiClass::None},  {0xffd8, BidiClass::L},
+    {0xffda, BidiClass::None},  {0xffdd, BidiClass::L},
+    {0xffe0, BidiClass::None},  {0xffe2, BidiClass::ET},
+    {0xffe5, BidiClass::ON},    {0xffe7, BidiClass::ET},
+    {0xffe8, BidiClass::None},  {0xffef, BidiClass::ON},
+    {0xfff0, BidiClass::None},  {0xfff9, BidiClass::BN},
+    {0xfffe, BidiClass::ON},    {0x10000, BidiClass::BN},
+    {0x1000c, BidiClass::L},    {0x1000d, BidiClass::None},
+    {0x10027, BidiClass::L},    {0x10028, BidiClass::None},
+    {0x1003b, BidiClass::L},    {0x1003c, BidiClass::None},
+    {0x1003e, BidiClass::L},    {0x1003f, BidiClass::None},
+    {0x1004e, BidiClass::L},    {0x10050, BidiClass::None},
+    {0x1005e, BidiClass::L},    {0x10080, BidiClass::None},
+    {0x100fb, BidiClass::L},    {0x10100, BidiClass::None},
+    {0x10101, BidiClass::L},    {0x10102, BidiClass::ON},
+    {0x10103, BidiClass::L},    {0x10107, BidiClass::None},
+    {0x10134, BidiClass::L},    {0x10137, BidiClass::None},
+    {0x10140, BidiClass::L},    {0x1018d, BidiClass::ON},
+    {0x1018f, BidiClass::L},    {0x10190, BidiClass::None},
+    {0x1019d, BidiClass::ON},   {0x101a0, BidiClass::None},
+    {0x101a1, BidiClass::ON},   {0x101d0, BidiClass::None},
+    {0x101fd, BidiClass::L},    {0x101fe, BidiClass::NSM},
+    {0x10280, BidiClass::None}, {0x1029d, BidiClass::L},
+    {0x102a0, BidiClass::None}, {0x102d1, BidiClass::L},
+    {0x102e0, BidiClass::None}, {0x102e1, BidiClass::NSM},
+    {0x102fc, BidiClass::EN},   {0x10300, BidiClass::None},
+    {0x10324, BidiClass::L},    {0x1032d, BidiClass::None},
+    {0x1034b, BidiClass::L},    {0x10350, BidiClass::None},
+    {0x10376, BidiClass::L},    {0x1037b, BidiClass::NSM},
+    {0x10380, BidiClass::None}, {0x1039e, BidiClass::L},
+    {0x1039f, BidiClass::None}, {0x103c4, BidiClass::L},
+    {0x103c8, BidiClass::None}, {0x103d6, BidiClass::L},
+    {0x10400, BidiClass::None}, {0x1049e, BidiClass::L},
+    {0x104a0, BidiClass::None}, {0x104aa, BidiClass::L},
+    {0x104b0, BidiClass::None}, {0x104d4, BidiClass::L},
+    {0x104d8, BidiClass::None}, {0x104fc, BidiClass::L},
+    {0x10500, BidiClass::None}, {0x10528, BidiClass::L},
+    {0x10530, BidiClass::None}, {0x10564, BidiClass::L},
+    {0x1056f, BidiClass::None}, {0x10570, BidiClass::L},
+    {0x10600, BidiClass::None}, {0x10737, BidiClass::L},
+    {0x10740, BidiClass::None}, {0x10756, BidiClass::L},
+    {0x10760, BidiClass::None}, {0x10768, BidiClass::L},
+    {0x10800, BidiClass::None}, {0x1091f, BidiClass::R},
+    {0x10920, BidiClass::ON},   {0x10a01, BidiClass::R},
+    {0x10a04, BidiClass::NSM},  {0x10a05, BidiClass::R},
+    {0x10a07, BidiClass::NSM},  {0x10a0c, BidiClass::R},
+    {0x10a10, BidiClass::NSM},  {0x10a38, BidiClass::R},
+    {0x10a3b, BidiClass::NSM},  {0x10a3f, BidiClass::R},
+    {0x10a40, BidiClass::NSM},  {0x10ae5, BidiClass::R},
+    {0x10ae7, BidiClass::NSM},  {0x10b39, BidiClass::R},
+    {0x10b40, BidiClass::ON},   {0x10d00, BidiClass::R},
+    {0x10d24, BidiClass::AL},   {0x10d28, BidiClass::NSM},
+    {0x10d30, BidiClass::AL},   {0x10d3a, BidiClass::AN},
+    {0x10d40, BidiClass::AL},   {0x10e60, BidiClass::R},
+    {0x10e7f, BidiClass::AN},   {0x10eab, BidiClass::R},
+    {0x10ead, BidiClass::NSM},  {0x10f30, BidiClass::R},
+    {0x10f46, BidiClass::AL},   {0x10f51, BidiClass::NSM},
+    {0x10f70, BidiClass::AL},   {0x11000, BidiClass::R},
+    {0x11001, BidiClass::L},    {0x11002, BidiClass::NSM},
+    {0x11038, BidiClass::L},    {0x11047, BidiClass::NSM},
+    {0x1104e, BidiClass::L},    {0x11052, BidiClass::None},
+    {0x11066, BidiClass::ON},   {0x11070, BidiClass::L},
+    {0x1107f, BidiClass::None}, {0x11082, BidiClass::NSM},
+    {0x110b3, BidiClass::L},    {0x110b7, BidiClass::NSM},
+    {0x110b9, BidiClass::L},    {0x110bb, BidiClass::NSM},
+    {0x110c2, BidiClass::L},    {0x110cd, BidiClass::None},
+    {0x110ce, BidiClass::L},    {0x110d0, BidiClass::None},
+    {0x110e9, BidiClass::L},    {0x110f0, BidiClass::None},
+    {0x110fa, BidiClass::L},    {0x11100, BidiClass::None},
+    {0x11103, BidiClass::NSM},  {0x11127, BidiClass::L},
+    {0x1112c, BidiClass::NSM},  {0x1112d, BidiClass::L},
+    {0x11135, BidiClass::NSM},  {0x11136, BidiClass::None},
+    {0x11148, BidiClass::L},    {0x11150, BidiClass::None},
+    {0x11173, BidiClass::L},    {0x11174, BidiClass::NSM},
+    {0x11177, BidiClass::L},    {0x11180, BidiClass::None},
+    {0x11182, BidiClass::NSM},  {0x111b6, BidiClass::L},
+    {0x111bf, BidiClass::NSM},  {0x111c9, BidiClass::L},
+    {0x111cd, BidiClass::NSM},  {0x111cf, BidiClass::L},
+    {0x111d0, BidiClass::NSM},  {0x111e0, BidiClass::L},
+    {0x111e1, BidiClass::None}, {0x111f5, BidiClass::L},
+    {0x11200, BidiClass::None}, {0x11212, BidiClass::L},
+    {0x11213, BidiClass::None}, {0x1122f, BidiClass::L},
+    {0x11232, BidiClass::NSM},  {0x11234, BidiClass::L},
+    {0x11235, BidiClass::NSM},  {0x11236, BidiClass::L},
+    {0x11238, BidiClass::NSM},  {0x1123e, BidiClass::L},
+    {0x1123f, BidiClass::NSM},  {0x11280, BidiClass::None},
+    {0x11287, BidiClass::L},    {0x11288, BidiClass::None},
+    {0x11289, BidiClass::L},    {0x1128a, BidiClass::None},
+    {0x1128e, BidiClass::L},    {0x1128f, BidiClass::None},
+    {0x1129e, BidiClass::L},    {0x1129f, BidiClass::None},
+    {0x112aa, BidiClass::L},    {0x112b0, BidiClass::None},
+    {0x112df, BidiClass::L},    {0x112e0, BidiClass::NSM},
+    {0x112e3, BidiClass::L},    {0x112eb, BidiClass::NSM},
+    {0x112f0, BidiClass::None}, {0x112fa, BidiClass::L},
+    {0x11300, BidiClass::None}, {0x11302, BidiClass::NSM},
+    {0x11304, BidiClass::L},    {0x11305, BidiClass::None},
+    {0x1130d, BidiClass::L},    {0x1130f, BidiClass::None},
+    {0x11311, BidiClass::L},    {0x11313, BidiClass::None},
+    {0x11329, BidiClass::L},    {0x1132a, BidiClass::None},
+    {0x11331, BidiClass::L},    {0x11332, BidiClass::None},
+    {0x11334, BidiClass::L},    {0x11335, BidiClass::None},
+    {0x1133a, BidiClass::L},    {0x1133b, BidiClass::None},
+    {0x1133d, BidiClass::NSM},  {0x11340, BidiClass::L},
+    {0x11341, BidiClass::NSM},  {0x11345, BidiClass::L},
+    {0x11347, BidiClass::None}, {0x11349, BidiClass::L},
+    {0x1134b, BidiClass::None}, {0x1134e, BidiClass::L},
+    {0x11350, BidiClass::None}, {0x11351, BidiClass::L},
+    {0x11357, BidiClass::None}, {0x11358, BidiClass::L},
+    {0x1135d, BidiClass::None}, {0x11364, BidiClass::L},
+    {0x11366, BidiClass::None}, {0x1136d, BidiClass::NSM},
+    {0x11370, BidiClass::None}, {0x11375, BidiClass::NSM},
+    {0x11400, BidiClass::None}, {0x11438, BidiClass::L},
+    {0x11440, BidiClass::NSM},  {0x11442, BidiClass::L},
+    {0x11445, BidiClass::NSM},  {0x11446, BidiClass::L},
+    {0x11447, BidiClass::NSM},  {0x1145c, BidiClass::L},
+    {0x1145d, BidiClass::None}, {0x1145e, BidiClass::L},
+    {0x1145f, BidiClass::NSM},  {0x11462, BidiClass::L},
+    {0x11480, BidiClass::None}, {0x114b3, BidiClass::L},
+    {0x114b9, BidiClass::NSM},  {0x114ba, BidiClass::L},
+    {0x114bb, BidiClass::NSM},  {0x114bf, BidiClass::L},
+    {0x114c1, BidiClass::NSM},  {0x114c2, BidiClass::L},
+    {0x114c4, BidiClass::NSM},  {0x114c8, BidiClass::L},
+    {0x114d0, BidiClass::None}, {0x114da, BidiClass::L},
+    {0x11580, BidiClass::None}, {0x115b2, BidiClass::L},
+    {0x115b6, BidiClass::NSM},  {0x115b8, BidiClass::None},
+    {0x115bc, BidiClass::L},    {0x115be, BidiClass::NSM},
+    {0x115bf, BidiClass::L},    {0x115c1, BidiClass::NSM},
+    {0x115dc, BidiClass::L},    {0x115de, BidiClass::NSM},
+    {0x11600, BidiClass::None}, {0x11633, BidiClass::L},
+    {0x1163b, BidiClass::NSM},  {0x1163d, BidiClass::L},
+    {0x1163e, BidiClass::NSM},  {0x1163f, BidiClass::L},
+    {0x11641, BidiClass::NSM},  {0x11645, BidiClass::L},
+    {0x11650, BidiClass::None}, {0x1165a, BidiClass::L},
+    {0x11660, BidiClass::None}, {0x1166d, BidiClass::ON},
+    {0x11680, BidiClass::None}, {0x116ab, BidiClass::L},
+    {0x116ac, BidiClass::NSM},  {0x116ad, BidiClass::L},
+    {0x116ae, BidiClass::NSM},  {0x116b0, BidiClass::L},
+    {0x116b6, BidiClass::NSM},  {0x116b7, BidiClass::L},
+    {0x116b8, BidiClass::NSM},  {0x116b9, BidiClass::L},
+    {0x116c0, BidiClass::None}, {0x116ca, BidiClass::L},
+    {0x11700, BidiClass::None}, {0x1171b, BidiClass::L},
+    {0x1171d, BidiClass::None}, {0x11720, BidiClass::NSM},
+    {0x11722, BidiClass::L},    {0x11726, BidiClass::NSM},
+    {0x11727, BidiClass::L},    {0x1172c, BidiClass::NSM},
+    {0x11730, BidiClass::None}, {0x11740, BidiClass::L},
+    {0x11800, BidiClass::None}, {0x1182f, BidiClass::L},
+    {0x11838, BidiClass::NSM},  {0x11839, BidiClass::L},
+    {0x1183b, BidiClass::NSM},  {0x1183c, BidiClass::L},
+    {0x118a0, BidiClass::None}, {0x118f3, BidiClass::L},
+    {0x118ff, BidiClass::None}, {0x11907, BidiClass::L},
+    {0x11909, BidiClass::None}, {0x1190a, BidiClass::L},
+    {0x1190c, BidiClass::None}, {0x11914, BidiClass::L},
+    {0x11915, BidiClass::None}, {0x11917, BidiClass::L},
+    {0x11918, BidiClass::None}, {0x11936, BidiClass::L},
+    {0x11937, BidiClass::None}, {0x11939, BidiClass::L},
+    {0x1193b, BidiClass::None}, {0x1193d, BidiClass::NSM},
+    {0x1193e, BidiClass::L},    {0x1193f, BidiClass::NSM},
+    {0x11943, BidiClass::L},    {0x11944, BidiClass::NSM},
+    {0x11947, BidiClass::L},    {0x11950, BidiClass::None},
+    {0x1195a, BidiClass::L},    {0x119a0, BidiClass::None},
+    {0x119a8, BidiClass::L},    {0x119aa, BidiClass::None},
+    {0x119d4, BidiClass::L},    {0x119d8, BidiClass::NSM},
+    {0x119da, BidiClass::None}, {0x119dc, BidiClass::NSM},
+    {0x119e0, BidiClass::L},    {0x119e1, BidiClass::NSM},
+    {0x119e5, BidiClass::L},    {0x11a00, BidiClass::None},
+    {0x11a01, BidiClass::L},    {0x11a07, BidiClass::NSM},
+    {0x11a09, BidiClass::L},    {0x11a0b, BidiClass::NSM},
+    {0x11a33, BidiClass::L},    {0x11a39, BidiClass::NSM},
+    {0x11a3b, BidiClass::L},    {0x11a3f, BidiClass::NSM},
+    {0x11a47, BidiClass::L},    {0x11a48, BidiClass::NSM},
+    {0x11a50, BidiClass::None}, {0x11a51, BidiClass::L},
+    {0x11a57, BidiClass::NSM},  {0x11a59, BidiClass::L},
+    {0x11a5c, BidiClass::NSM},  {0x11a8a, BidiClass::L},
+    {0x11a97, BidiClass::NSM},  {0x11a98, BidiClass::L},
+    {0x11a9a, BidiClass::NSM},  {0x11aa3, BidiClass::L},
+    {0x11ac0, BidiClass::None}, {0x11af9, BidiClass::L},
+    {0x11c00, BidiClass::None}, {0x11c09, BidiClass::L},
+    {0x11c0a, BidiClass::None}, {0x11c30, BidiClass::L},
+    {0x11c37, BidiClass::NSM},  {0x11c38, BidiClass::None},
+    {0x11c3e, BidiClass::NSM},  {0x11c46, BidiClass::L},
+    {0x11c50, BidiClass::None}, {0x11c6d, BidiClass::L},
+    {0x11c70, BidiClass::None}, {0x11c90, BidiClass::L},
+    {0x11c92, BidiClass::None}, {0x11ca8, BidiClass::NSM},
+    {0x11ca9, BidiClass::None}, {0x11caa, BidiClass::L},
+    {0x11cb1, BidiClass::NSM},  {0x11cb2, BidiClass::L},
+    {0x11cb4, BidiClass::NSM},  {0x11cb5, BidiClass::L},
+    {0x11cb7, BidiClass::NSM},  {0x11d00, BidiClass::None},
+    {0x11d07, BidiClass::L},    {0x11d08, BidiClass::None},
+    {0x11d0a, BidiClass::L},    {0x11d0b, BidiClass::None},
+    {0x11d31, BidiClass::L},    {0x11d37, BidiClass::NSM},
+    {0x11d3a, BidiClass::None}, {0x11d3b, BidiClass::NSM},
+    {0x11d3c, BidiClass::None}, {0x11d3e, BidiClass::NSM},
+    {0x11d3f, BidiClass::None}, {0x11d46, BidiClass::NSM},
+    {0x11d47, BidiClass::L},    {0x11d48, BidiClass::NSM},
+    {0x11d50, BidiClass::None}, {0x11d5a, BidiClass::L},
+    {0x11d60, BidiClass::None}, {0x11d66, BidiClass::L},
+    {0x11d67, BidiClass::None}, {0x11d69, BidiClass::L},
+    {0x11d6a, BidiClass::None}, {0x11d8f, BidiClass::L},
+    {0x11d90, BidiClass::None}, {0x11d92, BidiClass::NSM},
+    {0x11d93, BidiClass::None}, {0x11d95, BidiClass::L},
+    {0x11d96, BidiClass::NSM},  {0x11d97, BidiClass::L},
+    {0x11d98, BidiClass::NSM},  {0x11d99, BidiClass::L},
+    {0x11da0, BidiClass::None}, {0x11daa, BidiClass::L},
+    {0x11ee0, BidiClass::None}, {0x11ef3, BidiClass::L},
+    {0x11ef5, BidiClass::NSM},  {0x11ef9, BidiClass::L},
+    {0x11fb0, BidiClass::None}, {0x11fb1, BidiClass::L},
+    {0x11fc0, BidiClass::None}, {0x11fd5, BidiClass::L},
+    {0x11fdd, BidiClass::ON},   {0x11fe1, BidiClass::ET},
+    {0x11ff2, BidiClass::ON},   {0x11fff, BidiClass::None},
+    {0x1239a, BidiClass::L},    {0x12400, BidiClass::None},
+    {0x1246f, BidiClass::L},    {0x12470, BidiClass::None},
+    {0x12475, BidiClass::L},    {0x12480, BidiClass::None},
+    {0x12544, BidiClass::L},    {0x13000, BidiClass::None},
+    {0x1342f, BidiClass::L},    {0x13430, BidiClass::None},
+    {0x13439, BidiClass::L},    {0x14400, BidiClass::None},
+    {0x14647, BidiClass::L},    {0x16800, BidiClass::None},
+    {0x16a39, BidiClass::L},    {0x16a40, BidiClass::None},
+    {0x16a5f, BidiClass::L},    {0x16a60, BidiClass::None},
+    {0x16a6a, BidiClass::L},    {0x16a6e, BidiClass::None},
+    {0x16a70, BidiClass::L},    {0x16ad0, BidiClass::None},
+    {0x16aee, BidiClass::L},    {0x16af0, BidiClass::None},
+    {0x16af5, BidiClass::NSM},  {0x16af6, BidiClass::L},
+    {0x16b00, BidiClass::None}, {0x16b30, BidiClass::L},
+    {0x16b37, BidiClass::NSM},  {0x16b46, BidiClass::L},
+    {0x16b50, BidiClass::None}, {0x16b5a, BidiClass::L},
+    {0x16b5b, BidiClass::None}, {0x16b62, BidiClass::L},
+    {0x16b63, BidiClass::None}, {0x16b78, BidiClass::L},
+    {0x16b7d, BidiClass::None}, {0x16b90, BidiClass::L},
+    {0x16e40, BidiClass::None}, {0x16e9b, BidiClass::L},
+    {0x16f00, BidiClass::None}, {0x16f4b, BidiClass::L},
+    {0x16f4f, BidiClass::None}, {0x16f50, BidiClass::NSM},
+    {0x16f88, BidiClass::L},    {0x16f8f, BidiClass::None},
+    {0x16f93, BidiClass::NSM},  {0x16fa0, BidiClass::L},
+    {0x16fe0, BidiClass::None}, {0x16fe2, BidiClass::L},
+    {0x16fe3, BidiClass::ON},   {0x16fe4, BidiClass::L},
+    {0x16fe5, BidiClass::NSM},  {0x16ff0, BidiClass::None},
+    {0x16ff2, BidiClass::L},    {0x17000, BidiClass::None},
+    {0x187f8, BidiClass::L},    {0x18800, BidiClass::None},
+    {0x18cd6, BidiClass::L},    {0x18d00, BidiClass::None},
+    {0x18d09, BidiClass::L},    {0x1b000, BidiClass::None},
+    {0x1b11f, BidiClass::L},    {0x1b150, BidiClass::None},
+    {0x1b153, BidiClass::L},    {0x1b164, BidiClass::None},
+    {0x1b168, BidiClass::L},    {0x1b170, BidiClass::None},
+    {0x1b2fc, BidiClass::L},    {0x1bc00, BidiClass::None},
+    {0x1bc6b, BidiClass::L},    {0x1bc70, BidiClass::None},
+    {0x1bc7d, BidiClass::L},    {0x1bc80, BidiClass::None},
+    {0x1bc89, BidiClass::L},    {0x1bc90, BidiClass::None},
+    {0x1bc9a, BidiClass::L},    {0x1bc9c, BidiClass::None},
+    {0x1bc9d, BidiClass::L},    {0x1bc9f, BidiClass::NSM},
+    {0x1bca0, BidiClass::L},    {0x1bca4, BidiClass::BN},
+    {0x1d000, BidiClass::None}, {0x1d0f6, BidiClass::L},
+    {0x1d100, BidiClass::None}, {0x1d127, BidiClass::L},
+    {0x1d129, BidiClass::None}, {0x1d167, BidiClass::L},
+    {0x1d16a, BidiClass::NSM},  {0x1d173, BidiClass::L},
+    {0x1d17b, BidiClass::BN},   {0x1d183, BidiClass::NSM},
+    {0x1d185, BidiClass::L},    {0x1d18c, BidiClass::NSM},
+    {0x1d1aa, BidiClass::L},    {0x1d1ae, BidiClass::NSM},
+    {0x1d1e9, BidiClass::L},    {0x1d200, BidiClass::None},
+    {0x1d242, BidiClass::ON},   {0x1d245, BidiClass::NSM},
+    {0x1d246, BidiClass::ON},   {0x1d2e0, BidiClass::None},
+    {0x1d2f4, BidiClass::L},    {0x1d300, BidiClass::None},
+    {0x1d357, BidiClass::ON},   {0x1d360, BidiClass::None},
+    {0x1d379, BidiClass::L},    {0x1d400, BidiClass::None},
+    {0x1d455, BidiClass::L},    {0x1d456, BidiClass::None},
+    {0x1d49d, BidiClass::L},    {0x1d49e, BidiClass::None},
+    {0x1d4a0, BidiClass::L},    {0x1d4a2, BidiClass::None},
+    {0x1d4a3, BidiClass::L},    {0x1d4a5, BidiClass::None},
+    {0x1d4a7, BidiClass::L},    {0x1d4a9, BidiClass::None},
+    {0x1d4ad, BidiClass::L},    {0x1d4ae, BidiClass::None},
+    {0x1d4ba, BidiClass::L},    {0x1d4bb, BidiClass::None},
+    {0x1d4bc, BidiClass::L},    {0x1d4bd, BidiClass::None},
+    {0x1d4c4, BidiClass::L},    {0x1d4c5, BidiClass::None},
+    {0x1d506, BidiClass::L},    {0x1d507, BidiClass::None},
+    {0x1d50b, BidiClass::L},    {0x1d50d, BidiClass::None},
+    {0x1d515, BidiClass::L},    {0x1d516, BidiClass::None},
+    {0x1d51d, BidiClass::L},    {0x1d51e, BidiClass::None},
+    {0x1d53a, BidiClass::L},    {0x1d53b, BidiClass::None},
+    {0x1d53f, BidiClass::L},    {0x1d540, BidiClass::None},
+    {0x1d545, BidiClass::L},    {0x1d546, BidiClass::None},
+    {0x1d547, BidiClass::L},    {0x1d54a, BidiClass::None},
+    {0x1d551, BidiClass::L},    {0x1d552, BidiClass::None},
+    {0x1d6a6, BidiClass::L},    {0x1d6a8, BidiClass::None},
+    {0x1d6db, BidiClass::L},    {0x1d6dc, BidiClass::ON},
+    {0x1d715, BidiClass::L},    {0x1d716, BidiClass::ON},
+    {0x1d74f, BidiClass::L},    {0x1d750, BidiClass::ON},
+    {0x1d789, BidiClass::L},    {0x1d78a, BidiClass::ON},
+    {0x1d7c3, BidiClass::L},    {0x1d7c4, BidiClass::ON},
+    {0x1d7cc, BidiClass::L},    {0x1d7ce, BidiClass::None},
+    {0x1d800, BidiClass::EN},   {0x1da00, BidiClass::L},
+    {0x1da37, BidiClass::NSM},  {0x1da3b, BidiClass::L},
+    {0x1da6d, BidiClass::NSM},  {0x1da75, BidiClass::L},
+    {0x1da76, BidiClass::NSM},  {0x1da84, BidiClass::L},
+    {0x1da85, BidiClass::NSM},  {0x1da8c, BidiClass::L},
+    {0x1da9b, BidiClass::None}, {0x1daa0, BidiClass::NSM},
+    {0x1daa1, BidiClass::None}, {0x1dab0, BidiClass::NSM},
+    {0x1e000, BidiClass::None}, {0x1e007, BidiClass::NSM},
+    {0x1e008, BidiClass::None}, {0x1e019, BidiClass::NSM},
+    {0x1e01b, BidiClass::None}, {0x1e022, BidiClass::NSM},
+    {0x1e023, BidiClass::None}, {0x1e025, BidiClass::NSM},
+    {0x1e026, BidiClass::None}, {0x1e02b, BidiClass::NSM},
+    {0x1e100, BidiClass::None}, {0x1e12d, BidiClass::L},
+    {0x1e130, BidiClass::None}, {0x1e137, BidiClass::NSM},
+    {0x1e13e, BidiClass::L},    {0x1e140, BidiClass::None},
+    {0x1e14a, BidiClass::L},    {0x1e14e, BidiClass::None},
+    {0x1e150, BidiClass::L},    {0x1e2c0, BidiClass::None},
+    {0x1e2ec, BidiClass::L},    {0x1e2f0, BidiClass::NSM},
+    {0x1e2fa, BidiClass::L},    {0x1e2ff, BidiClass::None},
+    {0x1e300, BidiClass::ET},   {0x1e800, BidiClass::None},
+    {0x1e8d0, BidiClass::R},    {0x1e8d7, BidiClass::NSM},
+    {0x1e944, BidiClass::R},    {0x1e94b, BidiClass::NSM},
+    {0x1ec70, BidiClass::R},    {0x1ecc0, BidiClass::AL},
+    {0x1ed00, BidiClass::R},    {0x1ed50, BidiClass::AL},
+    {0x1ee00, BidiClass::R},    {0x1eef0, BidiClass::AL},
+    {0x1eef2, BidiClass::ON},   {0x1ef00, BidiClass::AL},
+    {0x1f000, BidiClass::R},    {0x1f02c, BidiClass::ON},
+    {0x1f030, BidiClass::None}, {0x1f094, BidiClass::ON},
+    {0x1f0a0, BidiClass::None}, {0x1f0af, BidiClass::ON},
+    {0x1f0b1, BidiClass::None}, {0x1f0c0, BidiClass::ON},
+    {0x1f0c1, BidiClass::None}, {0x1f0d0, BidiClass::ON},
+    {0x1f0d1, BidiClass::None}, {0x1f0f6, BidiClass::ON},
+    {0x1f100, BidiClass::None}, {0x1f10b, BidiClass::EN},
+    {0x1f110, BidiClass::ON},   {0x1f12f, BidiClass::L},
+    {0x1f130, BidiClass::ON},   {0x1f16a, BidiClass::L},
+    {0x1f170, BidiClass::ON},   {0x1f1ad, BidiClass::L},
+    {0x1f1ae, BidiClass::ON},   {0x1f1e6, BidiClass::None},
+    {0x1f203, BidiClass::L},    {0x1f210, BidiClass::None},
+    {0x1f23c, BidiClass::L},    {0x1f240, BidiClass::None},
+    {0x1f249, BidiClass::L},    {0x1f250, BidiClass::None},
+    {0x1f252, BidiClass::L},    {0x1f260, BidiClass::None},
+    {0x1f266, BidiClass::ON},   {0x1f300, BidiClass::None},
+    {0x1f6d8, BidiClass::ON},   {0x1f6e0, BidiClass::None},
+    {0x1f6ed, BidiClass::ON},   {0x1f6f0, BidiClass::None},
+    {0x1f6fd, BidiClass::ON},   {0x1f700, BidiClass::None},
+    {0x1f774, BidiClass::ON},   {0x1f780, BidiClass::None},
+    {0x1f7d9, BidiClass::ON},   {0x1f7e0, BidiClass::None},
+    {0x1f7ec, BidiClass::ON},   {0x1f800, BidiClass::None},
+    {0x1f80c, BidiClass::ON},   {0x1f810, BidiClass::None},
+    {0x1f848, BidiClass::ON},   {0x1f850, BidiClass::None},
+    {0x1f85a, BidiClass::ON},   {0x1f860, BidiClass::None},
+    {0x1f888, BidiClass::ON},   {0x1f890, BidiClass::None},
+    {0x1f8ae, BidiClass::ON},   {0x1f8b0, BidiClass::None},
+    {0x1f8b2, BidiClass::ON},   {0x1f900, BidiClass::None},
+    {0x1f979, BidiClass::ON},   {0x1f97a, BidiClass::None},
+    {0x1f9cc, BidiClass::ON},   {0x1f9cd, BidiClass::None},
+    {0x1fa54, BidiClass::ON},   {0x1fa60, BidiClass::None},
+    {0x1fa6e, BidiClass::ON},   {0x1fa70, BidiClass::None},
+    {0x1fa75, BidiClass::ON},   {0x1fa78, BidiClass::None},
+    {0x1fa7b, BidiClass::ON},   {0x1fa80, BidiClass::None},
+    {0x1fa87, BidiClass::ON},   {0x1fa90, BidiClass::None},
+    {0x1faa9, BidiClass::ON},   {0x1fab0, BidiClass::None},
+    {0x1fab7, BidiClass::ON},   {0x1fac0, BidiClass::None},
+    {0x1fac3, BidiClass::ON},   {0x1fad0, BidiClass::None},
+    {0x1fad7, BidiClass::ON},   {0x1fb00, BidiClass::None},
+    {0x1fb93, BidiClass::ON},   {0x1fb94, BidiClass::None},
+    {0x1fbcb, BidiClass::ON},   {0x1fbf0, BidiClass::None},
+    {0x1fbfa, BidiClass::EN},   {0x1fffe, BidiClass::None},
+    {0x20000, BidiClass::BN},   {0x2a6de, BidiClass::L},
+    {0x2a700, BidiClass::None}, {0x2b735, BidiClass::L},
+    {0x2b740, BidiClass::None}, {0x2b81e, BidiClass::L},
+    {0x2b820, BidiClass::None}, {0x2cea2, BidiClass::L},
+    {0x2ceb0, BidiClass::None}, {0x2ebe1, BidiClass::L},
+    {0x2f800, BidiClass::None}, {0x2fa1e, BidiClass::L},
+    {0x2fffe, BidiClass::None}, {0x30000, BidiClass::BN},
+    {0x3134b, BidiClass::L},    {0x3fffe, BidiClass::None},
+    {0x40000, BidiClass::BN},   {0x4fffe, BidiClass::None},
+    {0x50000, BidiClass::BN},   {0x5fffe, BidiClass::None},
+    {0x60000, BidiClass::BN},   {0x6fffe, BidiClass::None},
+    {0x70000, BidiClass::BN},   {0x7fffe, BidiClass::None},
+    {0x80000, BidiClass::BN},   {0x8fffe, BidiClass::None},
+    {0x90000, BidiClass::BN},   {0x9fffe, BidiClass::None},
+    {0xa0000, BidiClass::BN},   {0xafffe, BidiClass::None},
+    {0xb0000, BidiClass::BN},   {0xbfffe, BidiClass::None},
+    {0xc0000, BidiClass::BN},   {0xcfffe, BidiClass::None},
+    {0xd0000, BidiClass::BN},   {0xdfffe, BidiClass::None},
+    {0xe0100, BidiClass::BN},   {0xe01f0, BidiClass::NSM},
+    {0xe1000, BidiClass::BN},   {0xefffe, BidiClass::None},
+    {0xf0000, BidiClass::BN},   {0xffffe, BidiClass::L},
+    {0x100000, BidiClass::BN},  {0x10fffe, BidiClass::L},
+    {0x110000, BidiClass::BN},
+};
+
+// Numeric types of characters sorted by the character.
+inline constexpr std::pair<char32_t, NumericType> kNumericTypeTable[] = {
+    {0x30, NumericType::Decimal},    {0x31, NumericType::Decimal},
+    {0x32, NumericType::Decimal},    {0x33, NumericType::Decimal},
+    {0x34, NumericType::Decimal},    {0x35, NumericType::Decimal},
+    {0x36, NumericType::Decimal},    {0x37, NumericType::Decimal},
+    {0x38, NumericType::Decimal},    {0x39, NumericType::Decimal},
+    {0xb2, NumericType::Digit},      {0xb3, NumericType::Digit},
+    {0xb9, NumericType::Digit},      {0xbc, NumericType::Numeric},
+    {0xbd, NumericType::Numeric},    {0xbe, NumericType::Numeric},
+    {0x660, NumericType::Decimal},   {0x661, NumericType::Decimal},
+    {0x662, NumericType::Decimal},   {0x663, NumericType::Decimal},
+    {0x664, NumericType::Decimal},   {0x665, NumericType::Decimal},
+    {0x666, NumericType::Decimal},   {0x667, NumericType::Decimal},
+    {0x668, NumericType::Decimal},   {0x669, NumericType::Decimal},
+    {0x6f0, NumericType::Decimal},   {0x6f1, NumericType::Decimal},
+    {0x6f2, NumericType::Decimal},   {0x6f3, NumericType::Decimal},
+    {0x6f4, NumericType::Decimal},   {0x6f5, NumericType::Decimal},
+    {0x6f6, NumericType::Decimal},   {0x6f7, NumericType::Decimal},
+    {0x6f8, NumericType::Decimal},   {0x6f9, NumericType::Decimal},
+    {0x7c0, NumericType::Decimal},   {0x7c1, NumericType::Decimal},
+    {0x7c2, NumericType::Decimal},   {0x7c3, NumericType::Decimal},
+    {0x7c4, NumericType::Decimal},   {0x7c5, NumericType::Decimal},
+    {0x7c6, NumericType::Decimal},   {0x7c7, NumericType::Decimal},
+    {0x7c8, NumericType::Decimal},   {0x7c9, NumericType::Decimal},
+    {0x966, NumericType::Decimal},   {0x967, NumericType::Decimal},
+    {0x968, NumericType::Decimal},   {0x969, NumericType::Decimal},
+    {0x96a, NumericType::Decimal},   {0x96b, NumericType::Decimal},
+    {0x96c, NumericType::Decimal},   {0x96d, NumericType::Decimal},
+    {0x96e, NumericType::Decimal},   {0x96f, NumericType::Decimal},
+    {0x9e6, NumericType::Decimal},   {0x9e7, NumericType::Decimal},
+    {0x9e8, NumericType::Decimal},   {0x9e9, NumericType::Decimal},
+    {0x9ea, NumericType::Decimal},   {0x9eb, NumericType::Decimal},
+    {0x9ec, NumericType::Decimal},   {0x9ed, NumericType::Decimal},
+    {0x9ee, NumericType::Decimal},   {0x9ef, NumericType::Decimal},
+    {0x9f4, NumericType::Numeric},   {0x9f5, NumericType::Numeric},
+    {0x9f6, NumericType::Numeric},   {0x9f7, NumericType::Numeric},
+    {0x9f8, NumericType::Numeric},   {0x9f9, NumericType::Numeric},
+    {0xa66, NumericType::Decimal},   {0xa67, NumericType::Decimal},
+    {0xa68, NumericType::Decimal},   {0xa69, NumericType::Decimal},
+    {0xa6a, NumericType::Decimal},   {0xa6b, NumericType::Decimal},
+    {0xa6c, NumericType::Decimal},   {0xa6d, NumericType::Decimal},
+    {0xa6e, NumericType::Decimal},   {0xa6f, NumericType::Decimal},
+    {0xae6, NumericType::Decimal},   {0xae7, NumericType::Decimal},
+    {0xae8, NumericType::Decimal},   {0xae9, NumericType::Decimal},
+    {0xaea, NumericType::Decimal},   {0xaeb, NumericType::Decimal},
+    {0xaec, NumericType::Decimal},   {0xaed, NumericType::Decimal},
+    {0xaee, NumericType::Decimal},   {0xaef, NumericType::Decimal},
+    {0xb66, NumericType::Decimal},   {0xb67, NumericType::Decimal},
+    {0xb68, NumericType::Decimal},   {0xb69, NumericType::Decimal},
+    {0xb6a, NumericType::Decimal},   {0xb6b, NumericType::Decimal},
+    {0xb6c, NumericType::Decimal},   {0xb6d, NumericType::Decimal},
+    {0xb6e, NumericType::Decimal},   {0xb6f, NumericType::Decimal},
+    {0xb72, NumericType::Numeric},   {0xb73, NumericType::Numeric},
+    {0xb74, NumericType::Numeric},   {0xb75, NumericType::Numeric},
+    {0xb76, NumericType::Numeric},   {0xb77, NumericType::Numeric},
+    {0xbe6, NumericType::Decimal},   {0xbe7, NumericType::Decimal},
+    {0xbe8, NumericType::Decimal},   {0xbe9, NumericType::Decimal},
+    {0xbea, NumericType::Decimal},   {0xbeb, NumericType::Decimal},
+    {0xbec, NumericType::Decimal},   {0xbed, NumericType::Decimal},
+    {0xbee, NumericType::Decimal},   {0xbef, NumericType::Decimal},
+    {0xbf0, NumericType::Numeric},   {0xbf1, NumericType::Numeric},
+    {0xbf2, NumericType::Numeric},   {0xc66, NumericType::Decimal},
+    {0xc67, NumericType::Decimal},   {0xc68, NumericType::Decimal},
+    {0xc69, NumericType::Decimal},   {0xc6a, NumericType::Decimal},
+    {0xc6b, NumericType::Decimal},   {0xc6c, NumericType::Decimal},
+    {0xc6d, NumericType::Decimal},   {0xc6e, NumericType::Decimal},
+    {0xc6f, NumericType::Decimal},   {0xc78, NumericType::Numeric},
+    {0xc79, NumericType::Numeric},   {0xc7a, NumericType::Numeric},
+    {0xc7b, NumericType::Numeric},   {0xc7c, NumericType::Numeric},
+    {0xc7d, NumericType::Numeric},   {0xc7e, NumericType::Numeric},
+    {0xce6, NumericType::Decimal},   {0xce7, NumericType::Decimal},
+    {0xce8, NumericType::Decimal},   {0xce9, NumericType::Decimal},
+    {0xcea, NumericType::Decimal},   {0xceb, NumericType::Decimal},
+    {0xcec, NumericType::Decimal},   {0xced, NumericType::Decimal},
+    {0xcee, NumericType::Decimal},   {0xcef, NumericType::Decimal},
+    {0xd58, NumericType::Numeric},   {0xd59, NumericType::Numeric},
+    {0xd5a, NumericType::Numeric},   {0xd5b, NumericType::Numeric},
+    {0xd5c, NumericType::Numeric},   {0xd5d, NumericType::Numeric},
+    {0xd5e, NumericType::Numeric},   {0xd66, NumericType::Decimal},
+    {0xd67, NumericType::Decimal},   {0xd68, NumericType::Decimal},
+    {0xd69, NumericType::Decimal},   {0xd6a, NumericType::Decimal},
+    {0xd6b, NumericType::Decimal},   {0xd6c, NumericType::Decimal},
+    {0xd6d, NumericType::Decimal},   {0xd6e, NumericType::Decimal},
+    {0xd6f, NumericType::Decimal},   {0xd70, NumericType::Numeric},
+    {0xd71, NumericType::Numeric},   {0xd72, NumericType::Numeric},
+    {0xd73, NumericType::Numeric},   {0xd74, NumericType::Numeric},
+    {0xd75, NumericType::Numeric},   {0xd76, NumericType::Numeric},
+    {0xd77, NumericType::Numeric},   {0xd78, NumericType::Numeric},
+    {0xde6, NumericType::Decimal},   {0xde7, NumericType::Decimal},
+    {0xde8, NumericType::Decimal},   {0xde9, NumericType::Decimal},
+    {0xdea, NumericType::Decimal},   {0xdeb, NumericType::Decimal},
+    {0xdec, NumericType::Decimal},   {0xded, NumericType::Decimal},
+    {0xdee, NumericType::Decimal},   {0xdef, NumericType::Decimal},
+    {0xe50, NumericType::Decimal},   {0xe51, NumericType::Decimal},
+    {0xe52, NumericType::Decimal},   {0xe53, NumericType::Decimal},
+    {0xe54, NumericType::Decimal},   {0xe55, NumericType::Decimal},
+    {0xe56, NumericType::Decimal},   {0xe57, NumericType::Decimal},
+    {0xe58, NumericType::Decimal},   {0xe59, NumericType::Decimal},
+    {0xed0, NumericType::Decimal},   {0xed1, NumericType::Decimal},
+    {0xed2, NumericType::Decimal},   {0xed3, NumericType::Decimal},
+    {0xed4, NumericType::Decimal},   {0xed5, NumericType::Decimal},
+    {0xed6, NumericType::Decimal},   {0xed7, NumericType::Decimal},
+    {0xed8, NumericType::Decimal},   {0xed9, NumericType::Decimal},
+    {0xf20, NumericType::Decimal},   {0xf21, NumericType::Decimal},
+    {0xf22, NumericType::Decimal},   {0xf23, NumericType::Decimal},
+    {0xf24, NumericType::Decimal},   {0xf25, NumericType::Decimal},
+    {0xf26, NumericType::Decimal},   {0xf27, NumericType::Decimal},
+    {0xf28, NumericType::Decimal},   {0xf29, NumericType::Decimal},
+    {0xf2a, NumericType::Numeric},   {0xf2b, NumericType::Numeric},
+    {0xf2c, NumericType::Numeric},   {0xf2d, NumericType::Numeric},
+    {0xf2e, NumericType::Numeric},   {0xf2f, NumericType::Numeric},
+    {0xf30, NumericType::Numeric},   {0xf31, NumericType::Numeric},
+    {0xf32, NumericType::Numeric},   {0xf33, NumericType::Numeric},
+    {0x1040, NumericType::Decimal},  {0x1041, NumericType::Decimal},
+    {0x1042, NumericType::Decimal},  {0x1043, NumericType::Decimal},
+    {0x1044, NumericType::Decimal},  {0x1045, NumericType::Decimal},
+    {0x1046, NumericType::Decimal},  {0x1047, NumericType::Decimal},
+    {0x1048, NumericType::Decimal},  {0x1049, NumericType::Decimal},
+    {0x1090, NumericType::Decimal},  {0x1091, NumericType::Decimal},
+    {0x1092, NumericType::Decimal},  {0x1093, NumericType::Decimal},
+    {0x1094, NumericType::Decimal},  {0x1095, NumericType::Decimal},
+    {0x1096, NumericType::Decimal},  {0x1097, NumericType::Decimal},
+    {0x1098, NumericType::Decimal},  {0x1099, NumericType::Decimal},
+    {0x1369, NumericType::Digit},    {0x136a, NumericType::Digit},
+    {0x136b, NumericType::Digit},    {0x136c, NumericType::Digit},
+    {0x136d, NumericType::Digit},    {0x136e, NumericType::Digit},
+    {0x136f, NumericType::Digit},    {0x1370, NumericType::Digit},
+    {0x1371, NumericType::Digit},    {0x1372, NumericType::Numeric},
+    {0x1373, NumericType::Numeric},  {0x1374, NumericType::Numeric},
+    {0x1375, NumericType::Numeric},  {0x1376, NumericType::Numeric},
+    {0x1377, NumericType::Numeric},  {0x1378, NumericType::Numeric},
+    {0x1379, NumericType::Numeric},  {0x137a, NumericType::Numeric},
+    {0x137b, NumericType::Numeric},  {0x137c, NumericType::Numeric},
+    {0x16ee, NumericType::Numeric},  {0x16ef, NumericType::Numeric},
+    {0x16f0, NumericType::Numeric},  {0x17e0, NumericType::Decimal},
+    {0x17e1, NumericType::Decimal},  {0x17e2, NumericType::Decimal},
+    {0x17e3, NumericType::Decimal},  {0x17e4, NumericType::Decimal},
+    {0x17e5, NumericType::Decimal},  {0x17e6, NumericType::Decimal},
+    {0x17e7, NumericType::Decimal},  {0x17e8, NumericType::Decimal},
+    {0x17e9, NumericType::Decimal},  {0x17f0, NumericType::Numeric},
+    {0x17f1, NumericType::Numeric},  {0x17f2, NumericType::Numeric},
+    {0x17f3, NumericType::Numeric},  {0x17f4, NumericType::Numeric},
+    {0x17f5, NumericType::Numeric},  {0x17f6, NumericType::Numeric},
+    {0x17f7, NumericType::Numeric},  {0x17f8, NumericType::Numeric},
+    {0x17f9, NumericType::Numeric},  {0x1810, NumericType::Decimal},
+    {0x1811, NumericType::Decimal},  {0x1812, NumericType::Decimal},
+    {0x1813, NumericType::Decimal},  {0x1814, NumericType::Decimal},
+    {0x1815, NumericType::Decimal},  {0x1816, NumericType::Decimal},
+    {0x1817, NumericType::Decimal},  {0x1818, NumericType::Decimal},
+    {0x1819, NumericType::Decimal},  {0x1946, NumericType::Decimal},
+    {0x1947, NumericType::Decimal},  {0x1948, NumericType::Decimal},
+    {0x1949, NumericType::Decimal},  {0x194a, NumericType::Decimal},
+    {0x194b, NumericType::Decimal},  {0x194c, NumericType::Decimal},
+    {0x194d, NumericType::Decimal},  {0x194e, NumericType::Decimal},
+    {0x194f, NumericType::Decimal},  {0x19d0, NumericType::Decimal},
+    {0x19d1, NumericType::Decimal},  {0x19d2, NumericType::Decimal},
+    {0x19d3, NumericType::Decimal},  {0x19d4, NumericType::Decimal},
+    {0x19d5, NumericType::Decimal},  {0x19d6, NumericType::Decimal},
+    {0x19d7, NumericType::Decimal},  {0x19d8, NumericType::Decimal},
+    {0x19d9, NumericType::Decimal},  {0x19da, NumericType::Digit},
+    {0x1a80, NumericType::Decimal},  {0x1a81, NumericType::Decimal},
+    {0x1a82, NumericType::Decimal},  {0x1a83, NumericType::Decimal},
+    {0x1a84, NumericType::Decimal},  {0x1a85, NumericType::Decimal},
+    {0x1a86, NumericType::Decimal},  {0x1a87, NumericType::Decimal},
+    {0x1a88, NumericType::Decimal},  {0x1a89, NumericType::Decimal},
+    {0x1a90, NumericType::Decimal},  {0x1a91, NumericType::Decimal},
+    {0x1a92, NumericType::Decimal},  {0x1a93, NumericType::Decimal},
+    {0x1a94, NumericType::Decimal},  {0x1a95, NumericType::Decimal},
+    {0x1a96, NumericType::Decimal},  {0x1a97, NumericType::Decimal},
+    {0x1a98, NumericType::Decimal},  {0x1a99, NumericType::Decimal},
+    {0x1b50, NumericType::Decimal},  {0x1b51, NumericType::Decimal},
+    {0x1b52, NumericType::Decimal},  {0x1b53, NumericType::Decimal},
+    {0x1b54, NumericType::Decimal},  {0x1b55, NumericType::Decimal},
+    {0x1b56, NumericType::Decimal},  {0x1b57, NumericType::Decimal},
+    {0x1b58, NumericType::Decimal},  {0x1b59, NumericType::Decimal},
+    {0x1bb0, NumericType::Decimal},  {0x1bb1, NumericType::Decimal},
+    {0x1bb2, NumericType::Decimal},  {0x1bb3, NumericType::Decimal},
+    {0x1bb4, NumericType::Decimal},  {0x1bb5, NumericType::Decimal},
+    {0x1bb6, NumericType::Decimal},  {0x1bb7, NumericType::Decimal},
+    {0x1bb8, NumericType::Decimal},  {0x1bb9, NumericType::Decimal},
+    {0x1c40, NumericType::Decimal},  {0x1c41, NumericType::Decimal},
+    {0x1c42, NumericType::Decimal},  {0x1c43, NumericType::Decimal},
+    {0x1c44, NumericType::Decimal},  {0x1c45, NumericType::Decimal},
+    {0x1c46, NumericType::Decimal},  {0x1c47, NumericType::Decimal},
+    {0x1c48, NumericType::Decimal},  {0x1c49, NumericType::Decimal},
+    {0x1c50, NumericType::Decimal},  {0x1c51, NumericType::Decimal},
+    {0x1c52, NumericType::Decimal},  {0x1c53, NumericType::Decimal},
+    {0x1c54, NumericType::Decimal},  {0x1c55, NumericType::Decimal},
+    {0x1c56, NumericType::Decimal},  {0x1c57, NumericType::Decimal},
+    {0x1c58, NumericType::Decimal},  {0x1c59, NumericType::Decimal},
+    {0x2070, NumericType::Digit},    {0x2074, NumericType::Digit},
+    {0x2075, NumericType::Digit},    {0x2076, NumericType::Digit},
+    {0x2077, NumericType::Digit},    {0x2078, NumericType::Digit},
+    {0x2079, NumericType::Digit},    {0x2080, NumericType::Digit},
+    {0x2081, NumericType::Digit},    {0x2082, NumericType::Digit},
+    {0x2083, NumericType::Digit},    {0x2084, NumericType::Digit},
+    {0x2085, NumericType::Digit},    {0x2086, NumericType::Digit},
+    {0x2087, NumericType::Digit},    {0x2088, NumericType::Digit},
+    {0x2089, NumericType::Digit},    {0x2150, NumericType::Numeric},
+    {0x2151, NumericType::Numeric},  {0x2152, NumericType::Numeric},
+    {0x2153, NumericType::Numeric},  {0x2154, NumericType::Numeric},
+    {0x2155, NumericType::Numeric},  {0x2156, NumericType::Numeric},
+    {0x2157, NumericType::Numeric},  {0x2158, NumericType::Numeric},
+    {0x2159, NumericType::Numeric},  {0x215a, NumericType::Numeric},
+    {0x215b, NumericType::Numeric},  {0x215c, NumericType::Numeric},
+    {0x215d, NumericType::Numeric},  {0x215e, NumericType::Numeric},
+    {0x215f, NumericType::Numeric},  {0x2160, NumericType::Numeric},
+    {0x2161, NumericType::Numeric},  {0x2162, NumericType::Numeric},
+    {0x2163, NumericType::Numeric},  {0x2164, NumericType::Numeric},
+    {0x2165, NumericType::Numeric},  {0x2166, NumericType::Numeric},
+    {0x2167, NumericType::Numeric},  {0x2168, NumericType::Numeric},
+    {0x2169, NumericType::Numeric},  {0x216a, NumericType::Numeric},
+    {0x216b, NumericType::Numeric},  {0x216c, NumericType::Numeric},
+    {0x216d, NumericType::Numeric},  {0x216e, NumericType::Numeric},
+    {0x216f, NumericType::Numeric},  {0x2170, NumericType::Numeric},
+    {0x2171, NumericType::Numeric},  {0x2172, NumericType::Numeric},
+    {0x2173, NumericType::Numeric},  {0x2174, NumericType::Numeric},
+    {0x2175, NumericType::Numeric},  {0x2176, NumericType::Numeric},
+    {0x2177, NumericType::Numeric},  {0x2178, NumericType::Numeric},
+    {0x2179, NumericType::Numeric},  {0x217a, NumericType::Numeric},
+    {0x217b, NumericType::Numeric},  {0x217c, NumericType::Numeric},
+    {0x217d, NumericType::Numeric},  {0x217e, NumericType::Numeric},
+    {0x217f, NumericType::Numeric},  {0x2180, NumericType::Numeric},
+    {0x2181, NumericType::Numeric},  {0x2182, NumericType::Numeric},
+    {0x2185, NumericType::Numeric},  {0x2186, NumericType::Numeric},
+    {0x2187, NumericType::Numeric},  {0x2188, NumericType::Numeric},
+    {0x2189, NumericType::Numeric},  {0x2460, NumericType::Digit},
+    {0x2461, NumericType::Digit},    {0x2462, NumericType::Digit},
+    {0x2463, NumericType::Digit},    {0x2464, NumericType::Digit},
+    {0x2465, NumericType::Digit},    {0x2466, NumericType::Digit},
+    {0x2467, NumericType::Digit},    {0x2468, NumericType::Digit},
+    {0x2469, NumericType::Numeric},  {0x246a, NumericType::Numeric},
+    {0x246b, NumericType::Numeric},  {0x246c, NumericType::Numeric},
+    {0x246d, NumericType::Numeric},  {0x246e, NumericType::Numeric},
+    {0x246f, NumericType::Numeric},  {0x2470, NumericType::Numeric},
+    {0x2471, NumericType::Numeric},  {0x2472, NumericType::Numeric},
+    {0x2473, NumericType::Numeric},  {0x2474, NumericType::Digit},
+    {0x2475, NumericType::Digit},    {0x2476, NumericType::Digit},
+    {0x2477, NumericType::Digit},    {0x2478, NumericType::Digit},
+    {0x2479, NumericType::Digit},    {0x247a, NumericType::Digit},
+    {0x247b, NumericType::Digit},    {0x247c, NumericType::Digit},
+    {0x247d, NumericType::Numeric},  {0x247e, NumericType::Numeric},
+    {0x247f, NumericType::Numeric},  {0x2480, NumericType::Numeric},
+    {0x2481, NumericType::Numeric},  {0x2482, NumericType::Numeric},
+    {0x2483, NumericType::Numeric},  {0x2484, NumericType::Numeric},
+    {0x2485, NumericType::Numeric},  {0x2486, NumericType::Numeric},
+    {0x2487, NumericType::Numeric},  {0x2488, NumericType::Digit},
+    {0x2489, NumericType::Digit},    {0x248a, NumericType::Digit},
+    {0x248b, NumericType::Digit},    {0x248c, NumericType::Digit},
+    {0x248d, NumericType::Digit},    {0x248e, NumericType::Digit},
+    {0x248f, NumericType::Digit},    {0x2490, NumericType::Digit},
+    {0x2491, NumericType::Numeric},  {0x2492, NumericType::Numeric},
+    {0x2493, NumericType::Numeric},  {0x2494, NumericType::Numeric},
+    {0x2495, NumericType::Numeric},  {0x2496, NumericType::Numeric},
+    {0x2497, NumericType::Numeric},  {0x2498, NumericType::Numeric},
+    {0x2499, NumericType::Numeric},  {0x249a, NumericType::Numeric},
+    {0x249b, NumericType::Numeric},  {0x24ea, NumericType::Digit},
+    {0x24eb, NumericType::Numeric},  {0x24ec, NumericType::Numeric},
+    {0x24ed, NumericType::Numeric},  {0x24ee, NumericType::Numeric},
+    {0x24ef, NumericType::Numeric},  {0x24f0, NumericType::Numeric},
+    {0x24f1, NumericType::Numeric},  {0x24f2, NumericType::Numeric},
+    {0x24f3, NumericType::Numeric},  {0x24f4, NumericType::Numeric},
+    {0x24f5, NumericType::Digit},    {0x24f6, NumericType::Digit},
+    {0x24f7, NumericType::Digit},    {0x24f8, NumericType::Digit},
+    {0x24f9, NumericType::Digit},    {0x24fa, NumericType::Digit},
+    {0x24fb, NumericType::Digit},    {0x24fc, NumericType::Digit},
+    {0x24fd, NumericType::Digit},    {0x24fe, NumericType::Numeric},
+    {0x24ff, NumericType::Digit},    {0x2776, NumericType::Digit},
+    {0x2777, NumericType::Digit},    {0x2778, NumericType::Digit},
+    {0x2779, NumericType::Digit},    {0x277a, NumericType::Digit},
+    {0x277b, NumericType::Digit},    {0x277c, NumericType::Digit},
+    {0x277d, NumericType::Digit},    {0x277e, NumericType::Digit},
+    {0x277f, NumericType::Numeric},  {0x2780, NumericType::Digit},
+    {0x2781, NumericType::Digit},    {0x2782, NumericType::Digit},
+    {0x2783, NumericType::Digit},    {0x2784, NumericType::Digit},
+    {0x2785, NumericType::Digit},    {0x2786, NumericType::Digit},
+    {0x2787, NumericType::Digit},    {0x2788, NumericType::Digit},
+    {0x2789, NumericType::Numeric},  {0x278a, NumericType::Digit},
+    {0x278b, NumericType::Digit},    {0x278c, NumericType::Digit},
+    {0x278d, NumericType::Digit},    {0x278e, NumericType::Digit},
+    {0x278f, NumericType::Digit},    {0x2790, NumericType::Digit},
+    {0x2791, NumericType::Digit},    {0x2792, NumericType::Digit},
+    {0x2793, NumericType::Numeric},  {0x2cfd, NumericType::Numeric},
+    {0x3007, NumericType::Numeric},  {0x3021, NumericType::Numeric},
+    {0x3022, NumericType::Numeric},  {0x3023, NumericType::Numeric},
+    {0x3024, NumericType::Numeric},  {0x3025, NumericType::Numeric},
+    {0x3026, NumericType::Numeric},  {0x3027, NumericType::Numeric},
+    {0x3028, NumericType::Numeric},  {0x3029, NumericType::Numeric},
+    {0x3038, NumericType::Numeric},  {0x3039, NumericType::Numeric},
+    {0x303a, NumericType::Numeric},  {0x3192, NumericType::Numeric},
+    {0x3193, NumericType::Numeric},  {0x3194, NumericType::Numeric},
+    {0x3195, NumericType::Numeric},  {0x3220, NumericType::Numeric},
+    {0x3221, NumericType::Numeric},  {0x3222, NumericType::Numeric},
+    {0x3223, NumericType::Numeric},  {0x3224, NumericType::Numeric},
+    {0x3225, NumericType::Numeric},  {0x3226, NumericType::Numeric},
+    {0x3227, NumericType::Numeric},  {0x3228, NumericType::Numeric},
+    {0x3229, NumericType::Numeric},  {0x3248, NumericType::Numeric},
+    {0x3249, NumericType::Numeric},  {0x324a, NumericType::Numeric},
+    {0x324b, NumericType::Numeric},  {0x324c, NumericType::Numeric},
+    {0x324d, NumericType::Numeric},  {0x324e, NumericType::Numeric},
+    {0x324f, NumericType::Numeric},  {0x3251, NumericType::Numeric},
+    {0x3252, NumericType::Numeric},  {0x3253, NumericType::Numeric},
+    {0x3254, NumericType::Numeric},  {0x3255, NumericType::Numeric},
+    {0x3256, NumericType::Numeric},  {0x3257, NumericType::Numeric},
+    {0x3258, NumericType::Numeric},  {0x3259, NumericType::Numeric},
+    {0x325a, NumericType::Numeric},  {0x325b, NumericType::Numeric},
+    {0x325c, NumericType::Numeric},  {0x325d, NumericType::Numeric},
+    {0x325e, NumericType::Numeric},  {0x325f, NumericType::Numeric},
+    {0x3280, NumericType::Numeric},  {0x3281, NumericType::Numeric},
+    {0x3282, NumericType::Numeric},  {0x3283, NumericType::Numeric},
+    {0x3284, NumericType::Numeric},  {0x3285, NumericType::Numeric},
+    {0x3286, NumericType::Numeric},  {0x3287, NumericType::Numeric},
+    {0x3288, NumericType::Numeric},  {0x3289, NumericType::Numeric},
+    {0x32b1, NumericType::Numeric},  {0x32b2, NumericType::Numeric},
+    {0x32b3, NumericType::Numeric},  {0x32b4, NumericType::Numeric},
+    {0x32b5, NumericType::Numeric},  {0x32b6, NumericType::Numeric},
+    {0x32b7, NumericType::Numeric},  {0x32b8, NumericType::Numeric},
+    {0x32b9, NumericType::Numeric},  {0x32ba, NumericType::Numeric},
+    {0x32bb, NumericType::Numeric},  {0x32bc, NumericType::Numeric},
+    {0x32bd, NumericType::Numeric},  {0x32be, NumericType::Numeric},
+    {0x32bf, NumericType::Numeric},  {0x3405, NumericType::Numeric},
+    {0x3483, NumericType::Numeric},  {0x382a, NumericType::Numeric},
+    {0x3b4d, NumericType::Numeric},  {0x4e00, NumericType::Numeric},
+    {0x4e03, NumericType::Numeric},  {0x4e07, NumericType::Numeric},
+    {0x4e09, NumericType::Numeric},  {0x4e5d, NumericType::Numeric},
+    {0x4e8c, NumericType::Numeric},  {0x4e94, NumericType::Numeric},
+    {0x4e96, NumericType::Numeric},  {0x4ebf, NumericType::Numeric},
+    {0x4ec0, NumericType::Numeric},  {0x4edf, NumericType::Numeric},
+    {0x4ee8, NumericType::Numeric},  {0x4f0d, NumericType::Numeric},
+    {0x4f70, NumericType::Numeric},  {0x5104, NumericType::Numeric},
+    {0x5146, NumericType::Numeric},  {0x5169, NumericType::Numeric},
+    {0x516b, NumericType::Numeric},  {0x516d, NumericType::Numeric},
+    {0x5341, NumericType::Numeric},  {0x5343, NumericType::Numeric},
+    {0x5344, NumericType::Numeric},  {0x5345, NumericType::Numeric},
+    {0x534c, NumericType::Numeric},  {0x53c1, NumericType::Numeric},
+    {0x53c2, NumericType::Numeric},  {0x53c3, NumericType::Numeric},
+    {0x53c4, NumericType::Numeric},  {0x56db, NumericType::Numeric},
+    {0x58f1, NumericType::Numeric},  {0x58f9, NumericType::Numeric},
+    {0x5e7a, NumericType::Numeric},  {0x5efe, NumericType::Numeric},
+    {0x5eff, NumericType::Numeric},  {0x5f0c, NumericType::Numeric},
+    {0x5f0d, NumericType::Numeric},  {0x5f0e, NumericType::Numeric},
+    {0x5f10, NumericType::Numeric},  {0x62fe, NumericType::Numeric},
+    {0x634c, NumericType::Numeric},  {0x67d2, NumericType::Numeric},
+    {0x6f06, NumericType::Numeric},  {0x7396, NumericType::Numeric},
+    {0x767e, NumericType::Numeric},  {0x8086, NumericType::Numeric},
+    {0x842c, NumericType::Numeric},  {0x8cae, NumericType::Numeric},
+    {0x8cb3, NumericType::Numeric},  {0x8d30, NumericType::Numeric},
+    {0x9621, NumericType::Numeric},  {0x9646, NumericType::Numeric},
+    {0x964c, NumericType::Numeric},  {0x9678, NumericType::Numeric},
+    {0x96f6, NumericType::Numeric},  {0xa620, NumericType::Decimal},
+    {0xa621, NumericType::Decimal},  {0xa622, NumericType::Decimal},
+    {0xa623, NumericType::Decimal},  {0xa624, NumericType::Decimal},
+    {0xa625, NumericType::Decimal},  {0xa626, NumericType::Decimal},
+    {0xa627, NumericType::Decimal},  {0xa628, NumericType::Decimal},
+    {0xa629, NumericType::Decimal},  {0xa6e6, NumericType::Numeric},
+    {0xa6e7, NumericType::Numeric},  {0xa6e8, NumericType::Numeric},
+    {0xa6e9, NumericType::Numeric},  {0xa6ea, NumericType::Numeric},
+    {0xa6eb, NumericType::Numeric},  {0xa6ec, NumericType::Numeric},
+    {0xa6ed, NumericType::Numeric},  {0xa6ee, NumericType::Numeric},
+    {0xa6ef, NumericType::Numeric},  {0xa830, NumericType::Numeric},
+    {0xa831, NumericType::Numeric},  {0xa832, NumericType::Numeric},
+    {0xa833, NumericType::Numeric},  {0xa834, NumericType::Numeric},
+    {0xa835, NumericType::Numeric},  {0xa8d0, NumericType::Decimal},
+    {0xa8d1, NumericType::Decimal},  {0xa8d2, NumericType::Decimal},
+    {0xa8d3, NumericType::Decimal},  {0xa8d4, NumericType::Decimal},
+    {0xa8d5, NumericType::Decimal},  {0xa8d6, NumericType::Decimal},
+    {0xa8d7, NumericType::Decimal},  {0xa8d8, NumericType::Decimal},
+    {0xa8d9, NumericType::Decimal},  {0xa900, NumericType::Decimal},
+    {0xa901, NumericType::Decimal},  {0xa902, NumericType::Decimal},
+    {0xa903, NumericType::Decimal},  {0xa904, NumericType::Decimal},
+    {0xa905, NumericType::Decimal},  {0xa906, NumericType::Decimal},
+    {0xa907, NumericType::Decimal},  {0xa908, NumericType::Decimal},
+    {0xa909, NumericType::Decimal},  {0xa9d0, NumericType::Decimal},
+    {0xa9d1, NumericType::Decimal},  {0xa9d2, NumericType::Decimal},
+    {0xa9d3, NumericType::Decimal},  {0xa9d4, NumericType::Decimal},
+    {0xa9d5, NumericType::Decimal},  {0xa9d6, NumericType::Decimal},
+    {0xa9d7, NumericType::Decimal},  {0xa9d8, NumericType::Decimal},
+    {0xa9d9, NumericType::Decimal},  {0xa9f0, NumericType::Decimal},
+    {0xa9f1, NumericType::Decimal},  {0xa9f2, NumericType::Decimal},
+    {0xa9f3, NumericType::Decimal},  {0xa9f4, NumericType::Decimal},
+    {0xa9f5, NumericType::Decimal},  {0xa9f6, NumericType::Decimal},
+    {0xa9f7, NumericType::Decimal},  {0xa9f8, NumericType::Decimal},
+    {0xa9f9, NumericType::Decimal},  {0xaa50, NumericType::Decimal},
+    {0xaa51, NumericType::Decimal},  {0xaa52, NumericType::Decimal},
+    {0xaa53, NumericType::Decimal},  {0xaa54, NumericType::Decimal},
+    {0xaa55, NumericType::Decimal},  {0xaa56, NumericType::Decimal},
+    {0xaa57, NumericType::Decimal},  {0xaa58, NumericType::Decimal},
+    {0xaa59, NumericType::Decimal},  {0xabf0, NumericType::Decimal},
+    {0xabf1, NumericType::Decimal},  {0xabf2, NumericType::Decimal},
+    {0xabf3, NumericType::Decimal},  {0xabf4, NumericType::Decimal},
+    {0xabf5, NumericType::Decimal},  {0xabf6, NumericType::Decimal},
+    {0xabf7, NumericType::Decimal},  {0xabf8, NumericType::Decimal},
+    {0xabf9, NumericType::Decimal},  {0xf96b, NumericType::Numeric},
+    {0xf973, NumericType::Numeric},  {0xf978, NumericType::Numeric},
+    {0xf9b2, NumericType::Numeric},  {0xf9d1, NumericType::Numeric},
+    {0xf9d3, NumericType::Numeric},  {0xf9fd, NumericType::Numeric},
+    {0xff10, NumericType::Decimal},  {0xff11, NumericType::Decimal},
+    {0xff12, NumericType::Decimal},  {0xff13, NumericType::Decimal},
+    {0xff14, NumericType::Decimal},  {0xff15, NumericType::Decimal},
+    {0xff16, NumericType::Decimal},  {0xff17, NumericType::Decimal},
+    {0xff18, NumericType::Decimal},  {0xff19, NumericType::Decimal},
+    {0x10107, NumericType::Numeric}, {0x10108, NumericType::Numeric},
+    {0x10109, NumericType::Numeric}, {0x1010a, NumericType::Numeric},
+    {0x1010b, NumericType::Numeric}, {0x1010c, NumericType::Numeric},
+    {0x1010d, NumericType::Numeric}, {0x1010e, NumericType::Numeric},
+    {0x1010f, NumericType::Numeric}, {0x10110, NumericType::Numeric},
+    {0x10111, NumericType::Numeric}, {0x10112, NumericType::Numeric},
+    {0x10113, NumericType::Numeric}, {0x10114, NumericType::Numeric},
+    {0x10115, NumericType::Numeric}, {0x10116, NumericType::Numeric},
+    {0x10117, NumericType::Numeric}, {0x10118, NumericType::Numeric},
+    {0x10119, NumericType::Numeric}, {0x1011a, NumericType::Numeric},
+    {0x1011b, NumericType::Numeric}, {0x1011c, NumericType::Numeric},
+    {0x1011d, NumericType::Numeric}, {0x1011e, NumericType::Numeric},
+    {0x1011f, NumericType::Numeric}, {0x10120, NumericType::Numeric},
+    {0x10121, NumericType::Numeric}, {0x10122, NumericType::Numeric},
+    {0x10123, NumericType::Numeric}, {0x10124, NumericType::Numeric},
+    {0x10125, NumericType::Numeric}, {0x10126, NumericType::Numeric},
+    {0x10127, NumericType::Numeric}, {0x10128, NumericType::Numeric},
+    {0x10129, NumericType::Numeric}, {0x1012a, NumericType::Numeric},
+    {0x1012b, NumericType::Numeric}, {0x1012c, NumericType::Numeric},
+    {0x1012d, NumericType::Numeric}, {0x1012e, NumericType::Numeric},
+    {0x1012f, NumericType::Numeric}, {0x10130, NumericType::Numeric},
+    {0x10131, NumericType::Numeric}, {0x10132, NumericType::Numeric},
+    {0x10133, NumericType::Numeric}, {0x10140, NumericType::Numeric},
+    {0x10141, NumericType::Numeric}, {0x10142, NumericType::Numeric},
+    {0x10143, NumericType::Numeric}, {0x10144, NumericType::Numeric},
+    {0x10145, NumericType::Numeric}, {0x10146, NumericType::Numeric},
+    {0x10147, NumericType::Numeric}, {0x10148, NumericType::Numeric},
+    {0x10149, NumericType::Numeric}, {0x1014a, NumericType::Numeric},
+    {0x1014b, NumericType::Numeric}, {0x1014c, NumericType::Numeric},
+    {0x1014d, NumericType::Numeric}, {0x1014e, NumericType::Numeric},
+    {0x1014f, NumericType::Numeric}, {0x10150, NumericType::Numeric},
+    {0x10151, NumericType::Numeric}, {0x10152, NumericType::Numeric},
+    {0x10153, NumericType::Numeric}, {0x10154, NumericType::Numeric},
+    {0x10155, NumericType::Numeric}, {0x10156, NumericType::Numeric},
+    {0x10157, NumericType::Numeric}, {0x10158, NumericType::Numeric},
+    {0x10159, NumericType::Numeric}, {0x1015a, NumericType::Numeric},
+    {0x1015b, NumericType::Numeric}, {0x1015c, NumericType::Numeric},
+    {0x1015d, NumericType::Numeric}, {0x1015e, NumericType::Numeric},
+    {0x1015f, NumericType::Numeric}, {0x10160, NumericType::Numeric},
+    {0x10161, NumericType::Numeric}, {0x10162, NumericType::Numeric},
+    {0x10163, NumericType::Numeric}, {0x10164, NumericType::Numeric},
+    {0x10165, NumericType::Numeric}, {0x10166, NumericType::Numeric},
+    {0x10167, NumericType::Numeric}, {0x10168, NumericType::Numeric},
+    {0x10169, NumericType::Numeric}, {0x1016a, NumericType::Numeric},
+    {0x1016b, NumericType::Numeric}, {0x1016c, NumericType::Numeric},
+    {0x1016d, NumericType::Numeric}, {0x1016e, NumericType::Numeric},
+    {0x1016f, NumericType::Numeric}, {0x10170, NumericType::Numeric},
+    {0x10171, NumericType::Numeric}, {0x10172, NumericType::Numeric},
+    {0x10173, NumericType::Numeric}, {0x10174, NumericType::Numeric},
+    {0x10175, NumericType::Numeric}, {0x10176, NumericType::Numeric},
+    {0x10177, NumericType::Numeric}, {0x10178, NumericType::Numeric},
+    {0x1018a, NumericType::Numeric}, {0x1018b, NumericType::Numeric},
+    {0x102e1, NumericType::Numeric}, {0x102e2, NumericType::Numeric},
+    {0x102e3, NumericType::Numeric}, {0x102e4, NumericType::Numeric},
+    {0x102e5, NumericType::Numeric}, {0x102e6, NumericType::Numeric},
+    {0x102e7, NumericType::Numeric}, {0x102e8, NumericType::Numeric},
+    {0x102e9, NumericType::Numeric}, {0x102ea, NumericType::Numeric},
+    {0x102eb, NumericType::Numeric}, {0x102ec, NumericType::Numeric},
+    {0x102ed, NumericType::Numeric}, {0x102ee, NumericType::Numeric},
+    {0x102ef, NumericType::Numeric}, {0x102f0, NumericType::Numeric},
+    {0x102f1, NumericType::Numeric}, {0x102f2, NumericType::Numeric},
+    {0x102f3, NumericType::Numeric}, {0x102f4, NumericType::Numeric},
+    {0x102f5, NumericType::Numeric}, {0x102f6, NumericType::Numeric},
+    {0x102f7, NumericType::Numeric}, {0x102f8, NumericType::Numeric},
+    {0x102f9, NumericType::Numeric}, {0x102fa, NumericType::Numeric},
+    {0x102fb, NumericType::Numeric}, {0x10320, NumericType::Numeric},
+    {0x10321, NumericType::Numeric}, {0x10322, NumericType::Numeric},
+    {0x10323, NumericType::Numeric}, {0x10341, NumericType::Numeric},
+    {0x1034a, NumericType::Numeric}, {0x103d1, NumericType::Numeric},
+    {0x103d2, NumericType::Numeric}, {0x103d3, NumericType::Numeric},
+    {0x103d4, NumericType::Numeric}, {0x103d5, NumericType::Numeric},
+    {0x104a0, NumericType::Decimal}, {0x104a1, NumericType::Decimal},
+    {0x104a2, NumericType::Decimal}, {0x104a3, NumericType::Decimal},
+    {0x104a4, NumericType::Decimal}, {0x104a5, NumericType::Decimal},
+    {0x104a6, NumericType::Decimal}, {0x104a7, NumericType::Decimal},
+    {0x104a8, NumericType::Decimal}, {0x104a9, NumericType::Decimal},
+    {0x10858, NumericType::Numeric}, {0x10859, NumericType::Numeric},
+    {0x1085a, NumericType::Numeric}, {0x1085b, NumericType::Numeric},
+    {0x1085c, NumericType::Numeric}, {0x1085d, NumericType::Numeric},
+    {0x1085e, NumericType::Numeric}, {0x1085f, NumericType::Numeric},
+    {0x10879, NumericType::Numeric}, {0x1087a, NumericType::Numeric},
+    {0x1087b, NumericType::Numeric}, {0x1087c, NumericType::Numeric},
+    {0x1087d, NumericType::Numeric}, {0x1087e, NumericType::Numeric},
+    {0x1087f, NumericType::Numeric}, {0x108a7, NumericType::Numeric},
+    {0x108a8, NumericType::Numeric}, {0x108a9, NumericType::Numeric},
+    {0x108aa, NumericType::Numeric}, {0x108ab, NumericType::Numeric},
+    {0x108ac, NumericType::Numeric}, {0x108ad, NumericType::Numeric},
+    {0x108ae, NumericType::Numeric}, {0x108af, NumericType::Numeric},
+    {0x108fb, NumericType::Numeric}, {0x108fc, NumericType::Numeric},
+    {0x108fd, NumericType::Numeric}, {0x108fe, NumericType::Numeric},
+    {0x108ff, NumericType::Numeric}, {0x10916, NumericType::Numeric},
+    {0x10917, NumericType::Numeric}, {0x10918, NumericType::Numeric},
+    {0x10919, NumericType::Numeric}, {0x1091a, NumericType::Numeric},
+    {0x1091b, NumericType::Numeric}, {0x109bc, NumericType::Numeric},
+    {0x109bd, NumericType::Numeric}, {0x109c0, NumericType::Numeric},
+    {0x109c1, NumericType::Numeric}, {0x109c2, NumericType::Numeric},
+    {0x109c3, NumericType::Numeric}, {0x109c4, NumericType::Numeric},
+    {0x109c5, NumericType::Numeric}, {0x109c6, NumericType::Numeric},
+    {0x109c7, NumericType::Numeric}, {0x109c8, NumericType::Numeric},
+    {0x109c9, NumericType::Numeric}, {0x109ca, NumericType::Numeric},
+    {0x109cb, NumericType::Numeric}, {0x109cc, NumericType::Numeric},
+    {0x109cd, NumericType::Numeric}, {0x109ce, NumericType::Numeric},
+    {0x109cf, NumericType::Numeric}, {0x109d2, NumericType::Numeric},
+    {0x109d3, NumericType::Numeric}, {0x109d4, NumericType::Numeric},
+    {0x109d5, NumericType::Numeric}, {0x109d6, NumericType::Numeric},
+    {0x109d7, NumericType::Numeric}, {0x109d8, NumericType::Numeric},
+    {0x109d9, NumericType::Numeric}, {0x109da, NumericType::Numeric},
+    {0x109db, NumericType::Numeric}, {0x109dc, NumericType::Numeric},
+    {0x109dd, NumericType::Numeric}, {0x109de, NumericType::Numeric},
+    {0x109df, NumericType::Numeric}, {0x109e0, NumericType::Numeric},
+    {0x109e1, NumericType::Numeric}, {0x109e2, NumericType::Numeric},
+    {0x109e3, NumericType::Numeric}, {0x109e4, NumericType::Numeric},
+    {0x109e5, NumericType::Numeric}, {0x109e6, NumericType::Numeric},
+    {0x109e7, NumericType::Numeric}, {0x109e8, NumericType::Numeric},
+    {0x109e9, NumericType::Numeric}, {0x109ea, NumericType::Numeric},
+    {0x109eb, NumericType::Numeric}, {0x109ec, NumericType::Numeric},
+    {0x109ed, NumericType::Numeric}, {0x109ee, NumericType::Numeric},
+    {0x109ef, NumericType::Numeric}, {0x109f0, NumericType::Numeric},
+    {0x109f1, NumericType::Numeric}, {0x109f2, NumericType::Numeric},
+    {0x109f3, NumericType::Numeric}, {0x109f4, NumericType::Numeric},
+    {0x109f5, NumericType::Numeric}, {0x109f6, NumericType::Numeric},
+    {0x109f7, NumericType::Numeric}, {0x109f8, NumericType::Numeric},
+    {0x109f9, NumericType::Numeric}, {0x109fa, NumericType::Numeric},
+    {0x109fb, NumericType::Numeric}, {0x109fc, NumericType::Numeric},
+    {0x109fd, NumericType::Numeric}, {0x109fe, NumericType::Numeric},
+    {0x109ff, NumericType::Numeric}, {0x10a40, NumericType::Digit},
+    {0x10a41, NumericType::Digit},   {0x10a42, NumericType::Digit},
+    {0x10a43, NumericType::Digit},   {0x10a44, NumericType::Numeric},
+    {0x10a45, NumericType::Numeric}, {0x10a46, NumericType::Numeric},
+    {0x10a47, NumericType::Numeric}, {0x10a48, NumericType::Numeric},
+    {0x10a7d, NumericType::Numeric}, {0x10a7e, NumericType::Numeric},
+    {0x10a9d, NumericType::Numeric}, {0x10a9e, NumericType::Numeric},
+    {0x10a9f, NumericType::Numeric}, {0x10aeb, NumericType::Numeric},
+    {0x10aec, NumericType::Numeric}, {0x10aed, NumericType::Numeric},
+    {0x10aee, NumericType::Numeric}, {0x10aef, NumericType::Numeric},
+    {0x10b58, NumericType::Numeric}, {0x10b59, NumericType::Numeric},
+    {0x10b5a, NumericType::Numeric}, {0x10b5b, NumericType::Numeric},
+    {0x10b5c, NumericType::Numeric}, {0x10b5d, NumericType::Numeric},
+    {0x10b5e, NumericType::Numeric}, {0x10b5f, NumericType::Numeric},
+    {0x10b78, NumericType::Numeric}, {0x10b79, NumericType::Numeric},
+    {0x10b7a, NumericType::Numeric}, {0x10b7b, NumericType::Numeric},
+    {0x10b7c, NumericType::Numeric}, {0x10b7d, NumericType::Numeric},
+    {0x10b7e, NumericType::Numeric}, {0x10b7f, NumericType::Numeric},
+    {0x10ba9, NumericType::Numeric}, {0x10baa, NumericType::Numeric},
+    {0x10bab, NumericType::Numeric}, {0x10bac, NumericType::Numeric},
+    {0x10bad, NumericType::Numeric}, {0x10bae, NumericType::Numeric},
+    {0x10baf, NumericType::Numeric}, {0x10cfa, NumericType::Numeric},
+    {0x10cfb, NumericType::Numeric}, {0x10cfc, NumericType::Numeric},
+    {0x10cfd, NumericType::Numeric}, {0x10cfe, NumericType::Numeric},
+    {0x10cff, NumericType::Numeric}, {0x10d30, NumericType::Decimal},
+    {0x10d31, NumericType::Decimal}, {0x10d32, NumericType::Decimal},
+    {0x10d33, NumericType::Decimal}, {0x10d34, NumericType::Decimal},
+    {0x10d35, NumericType::Decimal}, {0x10d36, NumericType::Decimal},
+    {0x10d37, NumericType::Decimal}, {0x10d38, NumericType::Decimal},
+    {0x10d39, NumericType::Decimal}, {0x10e60, NumericType::Digit},
+    {0x10e61, NumericType::Digit},   {0x10e62, NumericType::Digit},
+    {0x10e63, NumericType::Digit},   {0x10e64, NumericType::Digit},
+    {0x10e65, NumericType::Digit},   {0x10e66, NumericType::Digit},
+    {0x10e67, NumericType::Digit},   {0x10e68, NumericType::Digit},
+    {0x10e69, NumericType::Numeric}, {0x10e6a, NumericType::Numeric},
+    {0x10e6b, NumericType::Numeric}, {0x10e6c, NumericType::Numeric},
+    {0x10e6d, NumericType::Numeric}, {0x10e6e, NumericType::Numeric},
+    {0x10e6f, NumericType::Numeric}, {0x10e70, NumericType::Numeric},
+    {0x10e71, NumericType::Numeric}, {0x10e72, NumericType::Numeric},
+    {0x10e73, NumericType::Numeric}, {0x10e74, NumericType::Numeric},
+    {0x10e75, NumericType::Numeric}, {0x10e76, NumericType::Numeric},
+    {0x10e77, NumericType::Numeric}, {0x10e78, NumericType::Numeric},
+    {0x10e79, NumericType::Numeric}, {0x10e7a, NumericType::Numeric},
+    {0x10e7b, NumericType::Numeric}, {0x10e7c, NumericType::Numeric},
+    {0x10e7d, NumericType::Numeric}, {0x10e7e, NumericType::Numeric},
+    {0x10f1d, NumericType::Numeric}, {0x10f1e, NumericType::Numeric},
+    {0x10f1f, NumericType::Numeric}, {0x10f20, NumericType::Numeric},
+    {0x10f21, NumericType::Numeric}, {0x10f22, NumericType::Numeric},
+    {0x10f23, NumericType::Numeric}, {0x10f24, NumericType::Numeric},
+    {0x10f25, NumericType::Numeric}, {0x10f26, NumericType::Numeric},
+    {0x10f51, NumericType::Numeric}, {0x10f52, NumericType::Numeric},
+    {0x10f53, NumericType::Numeric}, {0x10f54, NumericType::Numeric},
+    {0x10fc5, NumericType::Numeric}, {0x10fc6, NumericType::Numeric},
+    {0x10fc7, NumericType::Numeric}, {0x10fc8, NumericType::Numeric},
+    {0x10fc9, NumericType::Numeric}, {0x10fca, NumericType::Numeric},
+    {0x10fcb, NumericType::Numeric}, {0x11052, NumericType::Digit},
+    {0x11053, NumericType::Digit},   {0x11054, NumericType::Digit},
+    {0x11055, NumericType::Digit},   {0x11056, NumericType::Digit},
+    {0x11057, NumericType::Digit},   {0x11058, NumericType::Digit},
+    {0x11059, NumericType::Digit},   {0x1105a, NumericType::Digit},
+    {0x1105b, NumericType::Numeric}, {0x1105c, NumericType::Numeric},
+    {0x1105d, NumericType::Numeric}, {0x1105e, NumericType::Numeric},
+    {0x1105f, NumericType::Numeric}, {0x11060, NumericType::Numeric},
+    {0x11061, NumericType::Numeric}, {0x11062, NumericType::Numeric},
+    {0x11063, NumericType::Numeric}, {0x11064, NumericType::Numeric},
+    {0x11065, NumericType::Numeric}, {0x11066, NumericType::Decimal},
+    {0x11067, NumericType::Decimal}, {0x11068, NumericType::Decimal},
+    {0x11069, NumericType::Decimal}, {0x1106a, NumericType::Decimal},
+    {0x1106b, NumericType::Decimal}, {0x1106c, NumericType::Decimal},
+    {0x1106d, NumericType::Decimal}, {0x1106e, NumericType::Decimal},
+    {0x1106f, NumericType::Decimal}, {0x110f0, NumericType::Decimal},
+    {0x110f1, NumericType::Decimal}, {0x110f2, NumericType::Decimal},
+    {0x110f3, NumericType::Decimal}, {0x110f4, NumericType::Decimal},
+    {0x110f5, NumericType::Decimal}, {0x110f6, NumericType::Decimal},
+    {0x110f7, NumericType::Decimal}, {0x110f8, NumericType::Decimal},
+    {0x110f9, NumericType::Decimal}, {0x11136, NumericType::Decimal},
+    {0x11137, NumericType::Decimal}, {0x11138, NumericType::Decimal},
+    {0x11139, NumericType::Decimal}, {0x1113a, NumericType::Decimal},
+    {0x1113b, NumericType::Decimal}, {0x1113c, NumericType::Decimal},
+    {0x1113d, NumericType::Decimal}, {0x1113e, NumericType::Decimal},
+    {0x1113f, NumericType::Decimal}, {0x111d0, NumericType::Decimal},
+    {0x111d1, NumericType::Decimal}, {0x111d2, NumericType::Decimal},
+    {0x111d3, NumericType::Decimal}, {0x111d4, NumericType::Decimal},
+    {0x111d5, NumericType::Decimal}, {0x111d6, NumericType::Decimal},
+    {0x111d7, NumericType::Decimal}, {0x111d8, NumericType::Decimal},
+    {0x111d9, NumericType::Decimal}, {0x111e1, NumericType::Numeric},
+    {0x111e2, NumericType::Numeric}, {0x111e3, NumericType::Numeric},
+    {0x111e4, NumericType::Numeric}, {0x111e5, NumericType::Numeric},
+    {0x111e6, NumericType::Numeric}, {0x111e7, NumericType::Numeric},
+    {0x111e8, NumericType::Numeric}, {0x111e9, NumericType::Numeric},
+    {0x111ea, NumericType::Numeric}, {0x111eb, NumericType::Numeric},
+    {0x111ec, NumericType::Numeric}, {0x111ed, NumericType::Numeric},
+    {0x111ee, NumericType::Numeric}, {0x111ef, NumericType::Numeric},
+    {0x111f0, NumericType::Numeric}, {0x111f1, NumericType::Numeric},
+    {0x111f2, NumericType::Numeric}, {0x111f3, NumericType::Numeric},
+    {0x111f4, NumericType::Numeric}, {0x112f0, NumericType::Decimal},
+    {0x112f1, NumericType::Decimal}, {0x112f2, NumericType::Decimal},
+    {0x112f3, NumericType::Decimal}, {0x112f4, NumericType::Decimal},
+    {0x112f5, NumericType::Decimal}, {0x112f6, NumericType::Decimal},
+    {0x112f7, NumericType::Decimal}, {0x112f8, NumericType::Decimal},
+    {0x112f9, NumericType::Decimal}, {0x11450, NumericType::Decimal},
+    {0x11451, NumericType::Decimal}, {0x11452, NumericType::Decimal},
+    {0x11453, NumericType::Decimal}, {0x11454, NumericType::Decimal},
+    {0x11455, NumericType::Decimal}, {0x11456, NumericType::Decimal},
+    {0x11457, NumericType::Decimal}, {0x11458, NumericType::Decimal},
+    {0x11459, NumericType::Decimal}, {0x114d0, NumericType::Decimal},
+    {0x114d1, NumericType::Decimal}, {0x114d2, NumericType::Decimal},
+    {0x114d3, NumericType::Decimal}, {0x114d4, NumericType::Decimal},
+    {0x114d5, NumericType::Decimal}, {0x114d6, NumericType::Decimal},
+    {0x114d7, NumericType::Decimal}, {0x114d8, NumericType::Decimal},
+    {0x114d9, NumericType::Decimal}, {0x11650, NumericType::Decimal},
+    {0x11651, NumericType::Decimal}, {0x11652, NumericType::Decimal},
+    {0x11653, NumericType::Decimal}, {0x11654, NumericType::Decimal},
+    {0x11655, NumericType::Decimal}, {0x11656, NumericType::Decimal},
+    {0x11657, NumericType::Decimal}, {0x11658, NumericType::Decimal},
+    {0x11659, NumericType::Decimal}, {0x116c0, NumericType::Decimal},
+    {0x116c1, NumericType::Decimal}, {0x116c2, NumericType::Decimal},
+    {0x116c3, NumericType::Decimal}, {0x116c4, NumericType::Decimal},
+    {0x116c5, NumericType::Decimal}, {0x116c6, NumericType::Decimal},
+    {0x116c7, NumericType::Decimal}, {0x116c8, NumericType::Decimal},
+    {0x116c9, NumericType::Decimal}, {0x11730, NumericType::Decimal},
+    {0x11731, NumericType::Decimal}, {0x11732, NumericType::Decimal},
+    {0x11733, NumericType::Decimal}, {0x11734, NumericType::Decimal},
+    {0x11735, NumericType::Decimal}, {0x11736, NumericType::Decimal},
+    {0x11737, NumericType::Decimal}, {0x11738, NumericType::Decimal},
+    {0x11739, NumericType::Decimal}, {0x1173a, NumericType::Numeric},
+    {0x1173b, NumericType::Numeric}, {0x118e0, NumericType::Decimal},
+    {0x118e1, NumericType::Decimal}, {0x118e2, NumericType::Decimal},
+    {0x118e3, NumericType::Decimal}, {0x118e4, NumericType::Decimal},
+    {0x118e5, NumericType::Decimal}, {0x118e6, NumericType::Decimal},
+    {0x118e7, NumericType::Decimal}, {0x118e8, NumericType::Decimal},
+    {0x118e9, NumericType::Decimal}, {0x118ea, NumericType::Numeric},
+    {0x118eb, NumericType::Numeric}, {0x118ec, NumericType::Numeric},
+    {0x118ed, NumericType::Numeric}, {0x118ee, NumericType::Numeric},
+    {0x118ef, NumericType::Numeric}, {0x118f0, NumericType::Numeric},
+    {0x118f1, NumericType::Numeric}, {0x118f2, NumericType::Numeric},
+    {0x11950, NumericType::Decimal}, {0x11951, NumericType::Decimal},
+    {0x11952, NumericType::Decimal}, {0x11953, NumericType::Decimal},
+    {0x11954, NumericType::Decimal}, {0x11955, NumericType::Decimal},
+    {0x11956, NumericType::Decimal}, {0x11957, NumericType::Decimal},
+    {0x11958, NumericType::Decimal}, {0x11959, NumericType::Decimal},
+    {0x11c50, NumericType::Decimal}, {0x11c51, NumericType::Decimal},
+    {0x11c52, NumericType::Decimal}, {0x11c53, NumericType::Decimal},
+    {0x11c54, NumericType::Decimal}, {0x11c55, NumericType::Decimal},
+    {0x11c56, NumericType::Decimal}, {0x11c57, NumericType::Decimal},
+    {0x11c58, NumericType::Decimal}, {0x11c59, NumericType::Decimal},
+    {0x11c5a, NumericType::Numeric}, {0x11c5b, NumericType::Numeric},
+    {0x11c5c, NumericType::Numeric}, {0x11c5d, NumericType::Numeric},
+    {0x11c5e, NumericType::Numeric}, {0x11c5f, NumericType::Numeric},
+    {0x11c60, NumericType::Numeric}, {0x11c61, NumericType::Numeric},
+    {0x11c62, NumericType::Numeric}, {0x11c63, NumericType::Numeric},
+    {0x11c64, NumericType::Numeric}, {0x11c65, NumericType::Numeric},
+    {0x11c66, NumericType::Numeric}, {0x11c67, NumericType::Numeric},
+    {0x11c68, NumericType::Numeric}, {0x11c69, NumericType::Numeric},
+    {0x11c6a, NumericType::Numeric}, {0x11c6b, NumericType::Numeric},
+    {0x11c6c, NumericType::Numeric}, {0x11d50, NumericType::Decimal},
+    {0x11d51, NumericType::Decimal}, {0x11d52, NumericType::Decimal},
+    {0x11d53, NumericType::Decimal}, {0x11d54, NumericType::Decimal},
+    {0x11d55, NumericType::Decimal}, {0x11d56, NumericType::Decimal},
+    {0x11d57, NumericType::Decimal}, {0x11d58, NumericType::Decimal},
+    {0x11d59, NumericType::Decimal}, {0x11da0, NumericType::Decimal},
+    {0x11da1, NumericType::Decimal}, {0x11da2, NumericType::Decimal},
+    {0x11da3, NumericType::Decimal}, {0x11da4, NumericType::Decimal},
+    {0x11da5, NumericType::Decimal}, {0x11da6, NumericType::Decimal},
+    {0x11da7, NumericType::Decimal}, {0x11da8, NumericType::Decimal},
+    {0x11da9, NumericType::Decimal}, {0x11fc0, NumericType::Numeric},
+    {0x11fc1, NumericType::Numeric}, {0x11fc2, NumericType::Numeric},
+    {0x11fc3, NumericType::Numeric}, {0x11fc4, NumericType::Numeric},
+    {0x11fc5, NumericType::Numeric}, {0x11fc6, NumericType::Numeric},
+    {0x11fc7, NumericType::Numeric}, {0x11fc8, NumericType::Numeric},
+    {0x11fc9, NumericType::Numeric}, {0x11fca, NumericType::Numeric},
+    {0x11fcb, NumericType::Numeric}, {0x11fcc, NumericType::Numeric},
+    {0x11fcd, NumericType::Numeric}, {0x11fce, NumericType::Numeric},
+    {0x11fcf, NumericType::Numeric}, {0x11fd0, NumericType::Numeric},
+    {0x11fd1, NumericType::Numeric}, {0x11fd2, NumericType::Numeric},
+    {0x11fd3, NumericType::Numeric}, {0x11fd4, NumericType::Numeric},
+    {0x12400, NumericType::Numeric}, {0x12401, NumericType::Numeric},
+    {0x12402, NumericType::Numeric}, {0x12403, NumericType::Numeric},
+    {0x12404, NumericType::Numeric}, {0x12405, NumericType::Numeric},
+    {0x12406, NumericType::Numeric}, {0x12407, NumericType::Numeric},
+    {0x12408, NumericType::Numeric}, {0x12409, NumericType::Numeric},
+    {0x1240a, NumericType::Numeric}, {0x1240b, NumericType::Numeric},
+    {0x1240c, NumericType::Numeric}, {0x1240d, NumericType::Numeric},
+    {0x1240e, NumericType::Numeric}, {0x1240f, NumericType::Numeric},
+    {0x12410, NumericType::Numeric}, {0x12411, NumericType::Numeric},
+    {0x12412, NumericType::Numeric}, {0x12413, NumericType::Numeric},
+    {0x12414, NumericType::Numeric}, {0x12415, NumericType::Numeric},
+    {0x12416, NumericType::Numeric}, {0x12417, NumericType::Numeric},
+    {0x12418, NumericType::Numeric}, {0x12419, NumericType::Numeric},
+    {0x1241a, NumericType::Numeric}, {0x1241b, NumericType::Numeric},
+    {0x1241c, NumericType::Numeric}, {0x1241d, NumericType::Numeric},
+    {0x1241e, NumericType::Numeric}, {0x1241f, NumericType::Numeric},
+    {0x12420, NumericType::Numeric}, {0x12421, NumericType::Numeric},
+    {0x12422, NumericType::Numeric}, {0x12423, NumericType::Numeric},
+    {0x12424, NumericType::Numeric}, {0x12425, NumericType::Numeric},
+    {0x12426, NumericType::Numeric}, {0x12427, NumericType::Numeric},
+    {0x12428, NumericType::Numeric}, {0x12429, NumericType::Numeric},
+    {0x1242a, NumericType::Numeric}, {0x1242b, NumericType::Numeric},
+    {0x1242c, NumericType::Numeric}, {0x1242d, NumericType::Numeric},
+    {0x1242e, NumericType::Numeric}, {0x1242f, NumericType::Numeric},
+    {0x12430, NumericType::Numeric}, {0x12431, NumericType::Numeric},
+    {0x12432, NumericType::Numeric}, {0x12433, NumericType::Numeric},
+    {0x12434, NumericType::Numeric}, {0x12435, NumericType::Numeric},
+    {0x12436, NumericType::Numeric}, {0x12437, NumericType::Numeric},
+    {0x12438, NumericType::Numeric}, {0x12439, NumericType::Numeric},
+    {0x1243a, NumericType::Numeric}, {0x1243b, NumericType::Numeric},
+    {0x1243c, NumericType::Numeric}, {0x1243d, NumericType::Numeric},
+    {0x1243e, NumericType::Numeric}, {0x1243f, NumericType::Numeric},
+    {0x12440, NumericType::Numeric}, {0x12441, NumericType::Numeric},
+    {0x12442, NumericType::Numeric}, {0x12443, NumericType::Numeric},
+    {0x12444, NumericType::Numeric}, {0x12445, NumericType::Numeric},
+    {0x12446, NumericType::Numeric}, {0x12447, NumericType::Numeric},
+    {0x12448, NumericType::Numeric}, {0x12449, NumericType::Numeric},
+    {0x1244a, NumericType::Numeric}, {0x1244b, NumericType::Numeric},
+    {0x1244c, NumericType::Numeric}, {0x1244d, NumericType::Numeric},
+    {0x1244e, NumericType::Numeric}, {0x1244f, NumericType::Numeric},
+    {0x12450, NumericType::Numeric}, {0x12451, NumericType::Numeric},
+    {0x12452, NumericType::Numeric}, {0x12453, NumericType::Numeric},
+    {0x12454, NumericType::Numeric}, {0x12455, NumericType::Numeric},
+    {0x12456, NumericType::Numeric}, {0x12457, NumericType::Numeric},
+    {0x12458, NumericType::Numeric}, {0x12459, NumericType::Numeric},
+    {0x1245a, NumericType::Numeric}, {0x1245b, NumericType::Numeric},
+    {0x1245c, NumericType::Numeric}, {0x1245d, NumericType::Numeric},
+    {0x1245e, NumericType::Numeric}, {0x1245f, NumericType::Numeric},
+    {0x12460, NumericType::Numeric}, {0x12461, NumericType::Numeric},
+    {0x12462, NumericType::Numeric}, {0x12463, NumericType::Numeric},
+    {0x12464, NumericType::Numeric}, {0x12465, NumericType::Numeric},
+    {0x12466, NumericType::Numeric}, {0x12467, NumericType::Numeric},
+    {0x12468, NumericType::Numeric}, {0x12469, NumericType::Numeric},
+    {0x1246a, NumericType::Numeric}, {0x1246b, NumericType::Numeric},
+    {0x1246c, NumericType::Numeric}, {0x1246d, NumericType::Numeric},
+    {0x1246e, NumericType::Numeric}, {0x16a60, NumericType::Decimal},
+    {0x16a61, NumericType::Decimal}, {0x16a62, NumericType::Decimal},
+    {0x16a63, NumericType::Decimal}, {0x16a64, NumericType::Decimal},
+    {0x16a65, NumericType::Decimal}, {0x16a66, NumericType::Decimal},
+    {0x16a67, NumericType::Decimal}, {0x16a68, NumericType::Decimal},
+    {0x16a69, NumericType::Decimal}, {0x16b50, NumericType::Decimal},
+    {0x16b51, NumericType::Decimal}, {0x16b52, NumericType::Decimal},
+    {0x16b53, NumericType::Decimal}, {0x16b54, NumericType::Decimal},
+    {0x16b55, NumericType::Decimal}, {0x16b56, NumericType::Decimal},
+    {0x16b57, NumericType::Decimal}, {0x16b58, NumericType::Decimal},
+    {0x16b59, NumericType::Decimal}, {0x16b5b, NumericType::Numeric},
+    {0x16b5c, NumericType::Numeric}, {0x16b5d, NumericType::Numeric},
+    {0x16b5e, NumericType::Numeric}, {0x16b5f, NumericType::Numeric},
+    {0x16b60, NumericType::Numeric}, {0x16b61, NumericType::Numeric},
+    {0x16e80, NumericType::Numeric}, {0x16e81, NumericType::Numeric},
+    {0x16e82, NumericType::Numeric}, {0x16e83, NumericType::Numeric},
+    {0x16e84, NumericType::Numeric}, {0x16e85, NumericType::Numeric},
+    {0x16e86, NumericType::Numeric}, {0x16e87, NumericType::Numeric},
+    {0x16e88, NumericType::Numeric}, {0x16e89, NumericType::Numeric},
+    {0x16e8a, NumericType::Numeric}, {0x16e8b, NumericType::Numeric},
+    {0x16e8c, NumericType::Numeric}, {0x16e8d, NumericType::Numeric},
+    {0x16e8e, NumericType::Numeric}, {0x16e8f, NumericType::Numeric},
+    {0x16e90, NumericType::Numeric}, {0x16e91, NumericType::Numeric},
+    {0x16e92, NumericType::Numeric}, {0x16e93, NumericType::Numeric},
+    {0x16e94, NumericType::Numeric}, {0x16e95, NumericType::Numeric},
+    {0x16e96, NumericType::Numeric}, {0x1d2e0, NumericType::Numeric},
+    {0x1d2e1, NumericType::Numeric}, {0x1d2e2, NumericType::Numeric},
+    {0x1d2e3, NumericType::Numeric}, {0x1d2e4, NumericType::Numeric},
+    {0x1d2e5, NumericType::Numeric}, {0x1d2e6, NumericType::Numeric},
+    {0x1d2e7, NumericType::Numeric}, {0x1d2e8, NumericType::Numeric},
+    {0x1d2e9, NumericType::Numeric}, {0x1d2ea, NumericType::Numeric},
+    {0x1d2eb, NumericType::Numeric}, {0x1d2ec, NumericType::Numeric},
+    {0x1d2ed, NumericType::Numeric}, {0x1d2ee, NumericType::Numeric},
+    {0x1d2ef, NumericType::Numeric}, {0x1d2f0, NumericType::Numeric},
+    {0x1d2f1, NumericType::Numeric}, {0x1d2f2, NumericType::Numeric},
+    {0x1d2f3, NumericType::Numeric}, {0x1d360, NumericType::Numeric},
+    {0x1d361, NumericType::Numeric}, {0x1d362, NumericType::Numeric},
+    {0x1d363, NumericType::Numeric}, {0x1d364, NumericType::Numeric},
+    {0x1d365, NumericType::Numeric}, {0x1d366, NumericType::Numeric},
+    {0x1d367, NumericType::Numeric}, {0x1d368, NumericType::Numeric},
+    {0x1d369, NumericType::Numeric}, {0x1d36a, NumericType::Numeric},
+    {0x1d36b, NumericType::Numeric}, {0x1d36c, NumericType::Numeric},
+    {0x1d36d, NumericType::Numeric}, {0x1d36e, NumericType::Numeric},
+    {0x1d36f, NumericType::Numeric}, {0x1d370, NumericType::Numeric},
+    {0x1d371, NumericType::Numeric}, {0x1d372, NumericType::Numeric},
+    {0x1d373, NumericType::Numeric}, {0x1d374, NumericType::Numeric},
+    {0x1d375, NumericType::Numeric}, {0x1d376, NumericType::Numeric},
+    {0x1d377, NumericType::Numeric}, {0x1d378, NumericType::Numeric},
+    {0x1d7ce, NumericType::Decimal}, {0x1d7cf, NumericType::Decimal},
+    {0x1d7d0, NumericType::Decimal}, {0x1d7d1, NumericType::Decimal},
+    {0x1d7d2, NumericType::Decimal}, {0x1d7d3, NumericType::Decimal},
+    {0x1d7d4, NumericType::Decimal}, {0x1d7d5, NumericType::Decimal},
+    {0x1d7d6, NumericType::Decimal}, {0x1d7d7, NumericType::Decimal},
+    {0x1d7d8, NumericType::Decimal}, {0x1d7d9, NumericType::Decimal},
+    {0x1d7da, NumericType::Decimal}, {0x1d7db, NumericType::Decimal},
+    {0x1d7dc, NumericType::Decimal}, {0x1d7dd, NumericType::Decimal},
+    {0x1d7de, NumericType::Decimal}, {0x1d7df, NumericType::Decimal},
+    {0x1d7e0, NumericType::Decimal}, {0x1d7e1, NumericType::Decimal},
+    {0x1d7e2, NumericType::Decimal}, {0x1d7e3, NumericType::Decimal},
+    {0x1d7e4, NumericType::Decimal}, {0x1d7e5, NumericType::Decimal},
+    {0x1d7e6, NumericType::Decimal}, {0x1d7e7, NumericType::Decimal},
+    {0x1d7e8, NumericType::Decimal}, {0x1d7e9, NumericType::Decimal},
+    {0x1d7ea, NumericType::Decimal}, {0x1d7eb, NumericType::Decimal},
+    {0x1d7ec, NumericType::Decimal}, {0x1d7ed, NumericType::Decimal},
+    {0x1d7ee, NumericType::Decimal}, {0x1d7ef, NumericType::Decimal},
+    {0x1d7f0, NumericType::Decimal}, {0x1d7f1, NumericType::Decimal},
+    {0x1d7f2, NumericType::Decimal}, {0x1d7f3, NumericType::Decimal},
+    {0x1d7f4, NumericType::Decimal}, {0x1d7f5, NumericType::Decimal},
+    {0x1d7f6, NumericType::Decimal}, {0x1d7f7, NumericType::Decimal},
+    {0x1d7f8, NumericType::Decimal}, {0x1d7f9, NumericType::Decimal},
+    {0x1d7fa, NumericType::Decimal}, {0x1d7fb, NumericType::Decimal},
+    {0x1d7fc, NumericType::Decimal}, {0x1d7fd, NumericType::Decimal},
+    {0x1d7fe, NumericType::Decimal}, {0x1d7ff, NumericType::Decimal},
+    {0x1e140, NumericType::Decimal}, {0x1e141, NumericType::Decimal},
+    {0x1e142, NumericType::Decimal}, {0x1e143, NumericType::Decimal},
+    {0x1e144, NumericType::Decimal}, {0x1e145, NumericType::Decimal},
+    {0x1e146, NumericType::Decimal}, {0x1e147, NumericType::Decimal},
+    {0x1e148, NumericType::Decimal}, {0x1e149, NumericType::Decimal},
+    {0x1e2f0, NumericType::Decimal}, {0x1e2f1, NumericType::Decimal},
+    {0x1e2f2, NumericType::Decimal}, {0x1e2f3, NumericType::Decimal},
+    {0x1e2f4, NumericType::Decimal}, {0x1e2f5, NumericType::Decimal},
+    {0x1e2f6, NumericType::Decimal}, {0x1e2f7, NumericType::Decimal},
+    {0x1e2f8, NumericType::Decimal}, {0x1e2f9, NumericType::Decimal},
+    {0x1e8c7, NumericType::Numeric}, {0x1e8c8, NumericType::Numeric},
+    {0x1e8c9, NumericType::Numeric}, {0x1e8ca, NumericType::Numeric},
+    {0x1e8cb, NumericType::Numeric}, {0x1e8cc, NumericType::Numeric},
+    {0x1e8cd, NumericType::Numeric}, {0x1e8ce, NumericType::Numeric},
+    {0x1e8cf, NumericType::Numeric}, {0x1e950, NumericType::Decimal},
+    {0x1e951, NumericType::Decimal}, {0x1e952, NumericType::Decimal},
+    {0x1e953, NumericType::Decimal}, {0x1e954, NumericType::Decimal},
+    {0x1e955, NumericType::Decimal}, {0x1e956, NumericType::Decimal},
+    {0x1e957, NumericType::Decimal}, {0x1e958, NumericType::Decimal},
+    {0x1e959, NumericType::Decimal}, {0x1ec71, NumericType::Numeric},
+    {0x1ec72, NumericType::Numeric}, {0x1ec73, NumericType::Numeric},
+    {0x1ec74, NumericType::Numeric}, {0x1ec75, NumericType::Numeric},
+    {0x1ec76, NumericType::Numeric}, {0x1ec77, NumericType::Numeric},
+    {0x1ec78, NumericType::Numeric}, {0x1ec79, NumericType::Numeric},
+    {0x1ec7a, NumericType::Numeric}, {0x1ec7b, NumericType::Numeric},
+    {0x1ec7c, NumericType::Numeric}, {0x1ec7d, NumericType::Numeric},
+    {0x1ec7e, NumericType::Numeric}, {0x1ec7f, NumericType::Numeric},
+    {0x1ec80, NumericType::Numeric}, {0x1ec81, NumericType::Numeric},
+    {0x1ec82, NumericType::Numeric}, {0x1ec83, NumericType::Numeric},
+    {0x1ec84, NumericType::Numeric}, {0x1ec85, NumericType::Numeric},
+    {0x1ec86, NumericType::Numeric}, {0x1ec87, NumericType::Numeric},
+    {0x1ec88, NumericType::Numeric}, {0x1ec89, NumericType::Numeric},
+    {0x1ec8a, NumericType::Numeric}, {0x1ec8b, NumericType::Numeric},
+    {0x1ec8c, NumericType::Numeric}, {0x1ec8d, NumericType::Numeric},
+    {0x1ec8e, NumericType::Numeric}, {0x1ec8f, NumericType::Numeric},
+    {0x1ec90, NumericType::Numeric}, {0x1ec91, NumericType::Numeric},
+    {0x1ec92, NumericType::Numeric}, {0x1ec93, NumericType::Numeric},
+    {0x1ec94, NumericType::Numeric}, {0x1ec95, NumericType::Numeric},
+    {0x1ec96, NumericType::Numeric}, {0x1ec97, NumericType::Numeric},
+    {0x1ec98, NumericType::Numeric}, {0x1ec99, NumericType::Numeric},
+    {0x1ec9a, NumericType::Numeric}, {0x1ec9b, NumericType::Numeric},
+    {0x1ec9c, NumericType::Numeric}, {0x1ec9d, NumericType::Numeric},
+    {0x1ec9e, NumericType::Numeric}, {0x1ec9f, NumericType::Numeric},
+    {0x1eca0, NumericType::Numeric}, {0x1eca1, NumericType::Numeric},
+    {0x1eca2, NumericType::Numeric}, {0x1eca3, NumericType::Numeric},
+    {0x1eca4, NumericType::Numeric}, {0x1eca5, NumericType::Numeric},
+    {0x1eca6, NumericType::Numeric}, {0x1eca7, NumericType::Numeric},
+    {0x1eca8, NumericType::Numeric}, {0x1eca9, NumericType::Numeric},
+    {0x1ecaa, NumericType::Numeric}, {0x1ecab, NumericType::Numeric},
+    {0x1ecad, NumericType::Numeric}, {0x1ecae, NumericType::Numeric},
+    {0x1ecaf, NumericType::Numeric}, {0x1ecb1, NumericType::Numeric},
+    {0x1ecb2, NumericType::Numeric}, {0x1ecb3, NumericType::Numeric},
+    {0x1ecb4, NumericType::Numeric}, {0x1ed01, NumericType::Numeric},
+    {0x1ed02, NumericType::Numeric}, {0x1ed03, NumericType::Numeric},
+    {0x1ed04, NumericType::Numeric}, {0x1ed05, NumericType::Numeric},
+    {0x1ed06, NumericType::Numeric}, {0x1ed07, NumericType::Numeric},
+    {0x1ed08, NumericType::Numeric}, {0x1ed09, NumericType::Numeric},
+    {0x1ed0a, NumericType::Numeric}, {0x1ed0b, NumericType::Numeric},
+    {0x1ed0c, NumericType::Numeric}, {0x1ed0d, NumericType::Numeric},
+    {0x1ed0e, NumericType::Numeric}, {0x1ed0f, NumericType::Numeric},
+    {0x1ed10, NumericType::Numeric}, {0x1ed11, NumericType::Numeric},
+    {0x1ed12, NumericType::Numeric}, {0x1ed13, NumericType::Numeric},
+    {0x1ed14, NumericType::Numeric}, {0x1ed15, NumericType::Numeric},
+    {0x1ed16, NumericType::Numeric}, {0x1ed17, NumericType::Numeric},
+    {0x1ed18, NumericType::Numeric}, {0x1ed19, NumericType::Numeric},
+    {0x1ed1a, NumericType::Numeric}, {0x1ed1b, NumericType::Numeric},
+    {0x1ed1c, NumericType::Numeric}, {0x1ed1d, NumericType::Numeric},
+    {0x1ed1e, NumericType::Numeric}, {0x1ed1f, NumericType::Numeric},
+    {0x1ed20, NumericType::Numeric}, {0x1ed21, NumericType::Numeric},
+    {0x1ed22, NumericType::Numeric}, {0x1ed23, NumericType::Numeric},
+    {0x1ed24, NumericType::Numeric}, {0x1ed25, NumericType::Numeric},
+    {0x1ed26, NumericType::Numeric}, {0x1ed27, NumericType::Numeric},
+    {0x1ed28, NumericType::Numeric}, {0x1ed29, NumericType::Numeric},
+    {0x1ed2a, NumericType::Numeric}, {0x1ed2b, NumericType::Numeric},
+    {0x1ed2c, NumericType::Numeric}, {0x1ed2d, NumericType::Numeric},
+    {0x1ed2f, NumericType::Numeric}, {0x1ed30, NumericType::Numeric},
+    {0x1ed31, NumericType::Numeric}, {0x1ed32, NumericType::Numeric},
+    {0x1ed33, NumericType::Numeric}, {0x1ed34, NumericType::Numeric},
+    {0x1ed35, NumericType::Numeric}, {0x1ed36, NumericType::Numeric},
+    {0x1ed37, NumericType::Numeric}, {0x1ed38, NumericType::Numeric},
+    {0x1ed39, NumericType::Numeric}, {0x1ed3a, NumericType::Numeric},
+    {0x1ed3b, NumericType::Numeric}, {0x1ed3c, NumericType::Numeric},
+    {0x1ed3d, NumericType::Numeric}, {0x1f100, NumericType::Digit},
+    {0x1f101, NumericType::Digit},   {0x1f102, NumericType::Digit},
+    {0x1f103, NumericType::Digit},   {0x1f104, NumericType::Digit},
+    {0x1f105, NumericType::Digit},   {0x1f106, NumericType::Digit},
+    {0x1f107, NumericType::Digit},   {0x1f108, NumericType::Digit},
+    {0x1f109, NumericType::Digit},   {0x1f10a, NumericType::Digit},
+    {0x1f10b, NumericType::Numeric}, {0x1f10c, NumericType::Numeric},
+    {0x1fbf0, NumericType::Decimal}, {0x1fbf1, NumericType::Decimal},
+    {0x1fbf2, NumericType::Decimal}, {0x1fbf3, NumericType::Decimal},
+    {0x1fbf4, NumericType::Decimal}, {0x1fbf5, NumericType::Decimal},
+    {0x1fbf6, NumericType::Decimal}, {0x1fbf7, NumericType::Decimal},
+    {0x1fbf8, NumericType::Decimal}, {0x1fbf9, NumericType::Decimal},
+    {0x20001, NumericType::Numeric}, {0x20064, NumericType::Numeric},
+    {0x200e2, NumericType::Numeric}, {0x20121, NumericType::Numeric},
+    {0x2092a, NumericType::Numeric}, {0x20983, NumericType::Numeric},
+    {0x2098c, NumericType::Numeric}, {0x2099c, NumericType::Numeric},
+    {0x20aea, NumericType::Numeric}, {0x20afd, NumericType::Numeric},
+    {0x20b19, NumericType::Numeric}, {0x22390, NumericType::Numeric},
+    {0x22998, NumericType::Numeric}, {0x23b1b, NumericType::Numeric},
+    {0x2626d, NumericType::Numeric}, {0x2f890, NumericType::Numeric},
+};
+
+}  // namespace unicpp
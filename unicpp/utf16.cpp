@@ -0,0 +1,221 @@
+#include "utf16.h"
+
+#include "simd.h"
+
+#include <algorithm>
+
+namespace unicpp {
+namespace {
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool kBigEndianHost = true;
+#else
+constexpr bool kBigEndianHost = false;
+#endif
+
+size_t Utf16DecodeContiguousImpl(const uint8_t* bytes, size_t size,
+                                 bool big_endian, char32_t* output,
+                                 ErrorPolicy policy, size_t* chars_written) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  char32_t* out = output;
+  size_t pos = 0;
+  while (pos < size) {
+    detail::BlocksResult blocks =
+        kernels.utf16_to_utf32_blocks(bytes + pos, size - pos, big_endian, out);
+    pos += blocks.read;
+    out += blocks.written;
+
+    size_t end =
+        pos + std::min(2 * detail::kScalarBlockSize, (size - pos) & ~size_t{1});
+    if (detail::Utf16ToUtf32Scalar(bytes, size, pos, end, big_endian, out) &&
+        size - pos != 1) {
+      continue;
+    }
+
+    // an unpaired surrogate, or a trailing odd byte
+    if (policy == ErrorPolicy::kStop) {
+      break;
+    } else if (policy == ErrorPolicy::kReplace) {
+      *out++ = kReplacementCharacter;
+    }
+    pos += std::min<size_t>(2, size - pos);
+  }
+
+  *chars_written = out - output;
+  return pos;
+}
+
+// Adds the number of characters of the valid prefix of `size` bytes to
+// `chars`, returns the length of the prefix.
+size_t Utf16CountValidPrefix(const uint8_t* bytes, size_t size,
+                             bool big_endian, size_t* chars) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  size_t pos = 0;
+  while (pos < size) {
+    detail::BlocksResult blocks =
+        kernels.utf32_length_from_utf16_blocks(bytes + pos, size - pos,
+                                               big_endian);
+    pos += blocks.read;
+    *chars += blocks.written;
+
+    size_t end =
+        pos + std::min(2 * detail::kScalarBlockSize, (size - pos) & ~size_t{1});
+    if (!detail::Utf32LengthFromUtf16Scalar(bytes, size, pos, end, big_endian,
+                                            *chars) ||
+        size - pos == 1) {
+      break;
+    }
+  }
+
+  return pos;
+}
+
+size_t Utf16NumCharsWithReplacementImpl(const uint8_t* bytes, size_t size,
+                                        bool big_endian) {
+  size_t chars = 0;
+  size_t pos = 0;
+  while (pos < size) {
+    pos += Utf16CountValidPrefix(bytes + pos, size - pos, big_endian, &chars);
+    if (pos < size) {
+      // the decoder replaces an unpaired surrogate, or a trailing odd byte
+      ++chars;
+      pos += std::min<size_t>(2, size - pos);
+    }
+  }
+
+  return chars;
+}
+
+}  // namespace
+
+size_t Utf16ValidPrefixLength(std::u16string_view utf16_string) {
+  size_t chars = 0;
+  return Utf16CountValidPrefix(
+             reinterpret_cast<const uint8_t*>(utf16_string.data()),
+             2 * utf16_string.size(), kBigEndianHost, &chars) /
+         2;
+}
+
+size_t Utf16LeValidPrefixLength(std::string_view utf16_bytes) {
+  size_t chars = 0;
+  return Utf16CountValidPrefix(
+      reinterpret_cast<const uint8_t*>(utf16_bytes.data()), utf16_bytes.size(),
+      /*big_endian = */ false, &chars);
+}
+
+size_t Utf16BeValidPrefixLength(std::string_view utf16_bytes) {
+  size_t chars = 0;
+  return Utf16CountValidPrefix(
+      reinterpret_cast<const uint8_t*>(utf16_bytes.data()), utf16_bytes.size(),
+      /*big_endian = */ true, &chars);
+}
+
+size_t Utf16NumValidChars(std::u16string_view utf16_string) {
+  size_t chars = 0;
+  Utf16CountValidPrefix(reinterpret_cast<const uint8_t*>(utf16_string.data()),
+                        2 * utf16_string.size(), kBigEndianHost, &chars);
+
+  return chars;
+}
+
+size_t Utf16LeNumValidChars(std::string_view utf16_bytes) {
+  size_t chars = 0;
+  Utf16CountValidPrefix(reinterpret_cast<const uint8_t*>(utf16_bytes.data()),
+                        utf16_bytes.size(), /*big_endian = */ false, &chars);
+
+  return chars;
+}
+
+size_t Utf16BeNumValidChars(std::string_view utf16_bytes) {
+  size_t chars = 0;
+  Utf16CountValidPrefix(reinterpret_cast<const uint8_t*>(utf16_bytes.data()),
+                        utf16_bytes.size(), /*big_endian = */ true, &chars);
+
+  return chars;
+}
+
+size_t Utf16NumCharsWithReplacement(std::u16string_view utf16_string) {
+  return Utf16NumCharsWithReplacementImpl(
+      reinterpret_cast<const uint8_t*>(utf16_string.data()),
+      2 * utf16_string.size(), kBigEndianHost);
+}
+
+size_t Utf16LeNumCharsWithReplacement(std::string_view utf16_bytes) {
+  return Utf16NumCharsWithReplacementImpl(
+      reinterpret_cast<const uint8_t*>(utf16_bytes.data()), utf16_bytes.size(),
+      /*big_endian = */ false);
+}
+
+size_t Utf16BeNumCharsWithReplacement(std::string_view utf16_bytes) {
+  return Utf16NumCharsWithReplacementImpl(
+      reinterpret_cast<const uint8_t*>(utf16_bytes.data()), utf16_bytes.size(),
+      /*big_endian = */ true);
+}
+
+size_t Utf16LengthFromUtf32(std::u32string_view chars) {
+  detail::BlocksResult blocks =
+      detail::ActiveKernels().utf16_length_from_utf32_blocks(chars.data(),
+                                                             chars.size());
+  size_t length = blocks.written;
+  for (char32_t ch : chars.substr(blocks.read)) {
+    length += detail::Utf16CharacterLength(ch);
+  }
+
+  return length;
+}
+
+namespace detail {
+
+size_t Utf16DecodeContiguous(const uint8_t* bytes, size_t size, Endian endian,
+                             char32_t* output, ErrorPolicy policy,
+                             size_t* chars_written) {
+  return Utf16DecodeContiguousImpl(bytes, size, endian == Endian::kBig, output,
+                                   policy, chars_written);
+}
+
+#if WCHAR_MAX > 0xFFFF
+size_t Utf16DecodeContiguous(const uint8_t* bytes, size_t size, Endian endian,
+                             wchar_t* output, ErrorPolicy policy,
+                             size_t* chars_written) {
+  return Utf16DecodeContiguousImpl(bytes, size, endian == Endian::kBig,
+                                   reinterpret_cast<char32_t*>(output), policy,
+                                   chars_written);
+}
+#endif
+
+size_t Utf16EncodeContiguous(const char32_t* chars, size_t size,
+                             uint8_t* output, Endian endian, ErrorPolicy policy,
+                             size_t* bytes_written) {
+  bool big_endian = endian == Endian::kBig;
+  uint8_t* out = output;
+  size_t pos = 0;
+  for (; pos < size; pos++) {
+    char32_t ch = chars[pos];
+    if (!IsValidCharacter(ch)) {
+      if (policy == ErrorPolicy::kSkip) {
+        continue;
+      } else if (policy == ErrorPolicy::kStop) {
+        break;
+      }
+      ch = kReplacementCharacter;
+    }
+
+    if (ch <= 0xFFFF) {
+      StoreUtf16Unit(static_cast<uint16_t>(ch), out, big_endian);
+      out += 2;
+    } else {
+      uint32_t sur = ch - 0x10000;
+      StoreUtf16Unit(static_cast<uint16_t>((sur >> 10) + 0xD800), out,
+                     big_endian);
+      StoreUtf16Unit(static_cast<uint16_t>((sur & 0x3FF) + 0xDC00), out + 2,
+                     big_endian);
+      out += 4;
+    }
+  }
+
+  *bytes_written = out - output;
+  return pos;
+}
+
+}  // namespace detail
+}  // namespace unicpp
@@ -1,10 +1,15 @@
 #pragma once
 
+#include "simd_level.h"
 #include "utf_common.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iterator>
 #include <string>
+#include <string_view>
+
+#include <stdint.h>
 
 namespace unicpp {
 
@@ -15,24 +20,36 @@ enum class Endian {
 
 namespace detail {
 
+// Input of 2-byte values is read as native code units, anything else is
+// read as bytes in the given byte order.
+template <class Iterator>
+constexpr size_t Utf16ValuesPerUnit() {
+  using Value = typename std::iterator_traits<Iterator>::value_type;
+  return sizeof(Value) == 2 ? 1 : 2;
+}
+
 template <Endian kEndian, class Iterator>
-uint16_t ReadWord(Iterator iter) {
-  uint8_t lo = *iter;
-  uint8_t hi = *++iter;
-  ++iter;
-  if constexpr (kEndian == Endian::kBig) {
-    std::swap(lo, hi);
-  }
+constexpr uint16_t ReadWord(Iterator iter) {
+  if constexpr (Utf16ValuesPerUnit<Iterator>() == 1) {
+    return static_cast<uint16_t>(*iter);
+  } else {
+    uint8_t first = *iter;
+    uint8_t second = *++iter;
+    if constexpr (kEndian == Endian::kBig) {
+      return static_cast<uint16_t>((first << 8) | second);
+    }
 
-  return static_cast<uint16_t>(lo | (hi << 8));
+    return static_cast<uint16_t>(first | (second << 8));
+  }
 }
 
 template <Endian kEndian, class Iterator>
-Iterator WriterWord(uint16_t word, Iterator iter) {
+constexpr Iterator WriterWord(uint16_t word, Iterator iter) {
   uint8_t first_byte = word & 0xFF;
   uint8_t second_byte = (word >> 8) & 0xFF;
   if constexpr (kEndian == Endian::kBig) {
-    std::swap(first_byte, second_byte);
+    first_byte = second_byte;
+    second_byte = word & 0xFF;
   }
 
   *iter = first_byte;
@@ -41,52 +58,218 @@ Iterator WriterWord(uint16_t word, Iterator iter) {
   return ++iter;
 }
 
+// Decodes the valid prefix of [iter, bytes_end) advancing `iter` and
+// `output`, returns the number of decoded values. Needs a forward iterator,
+// but looks at most 2 code units ahead.
 template <class BytesIterator, class OutputIterator, Endian kEndian,
           bool kCheckBoundaries>
-size_t Utf16DecodeImpl(BytesIterator bytes_beg, BytesIterator bytes_end,
-                       OutputIterator output, OutputIterator output_end) {
+constexpr size_t Utf16DecodePrefix(BytesIterator& iter,
+                                   BytesIterator bytes_end,
+                                   OutputIterator& output,
+                                   OutputIterator output_end) {
   if constexpr (!kCheckBoundaries) {
     // supress unused variable warning
     (void)output_end;
   }
 
-  BytesIterator iter = bytes_beg;
+  constexpr std::ptrdiff_t kStep = Utf16ValuesPerUnit<BytesIterator>();
+
+  size_t decoded = 0;
   while (iter != bytes_end) {
     if constexpr (kCheckBoundaries) {
       if (output == output_end) {
         break;
       }
     }
-    if (std::distance(iter, bytes_end) < 2) {
+    if (!HasAtLeast(iter, bytes_end, kStep)) {
       break;
     }
-    int word0 = detail::ReadWord<kEndian>(iter);
+    char32_t word0 = ReadWord<kEndian>(iter);
     if (!IsSurrogate(word0)) {
       *output = word0;
-      std::advance(iter, 2);
+      std::advance(iter, kStep);
+      decoded += kStep;
     } else {
-      if (std::distance(iter, bytes_end) < 4) {
+      if (word0 >= 0xDC00 || !HasAtLeast(iter, bytes_end, 2 * kStep)) {
         break;
       }
-      int word1 = detail::ReadWord<kEndian>(std::next(iter, 2));
+      char32_t word1 = ReadWord<kEndian>(std::next(iter, kStep));
       if (!IsSurrogate(word1) || word1 < 0xDC00) {
         break;
       }
-      std::advance(iter, 4);
-      *output = (((word0 - 0xD800) << 10) | (word1 - 0xDC00));
+      std::advance(iter, 2 * kStep);
+      decoded += 2 * kStep;
+      *output = 0x10000 + (((word0 - 0xD800) << 10) | (word1 - 0xDC00));
     }
     ++output;
   }
 
-  return std::distance(bytes_beg, iter);
+  return decoded;
+}
+
+// Reads a code unit from single-pass input. Returns the number of read values,
+// which is less than Utf16ValuesPerUnit() at the end of input.
+template <Endian kEndian, class Iterator>
+constexpr size_t ReadWordSinglePass(Iterator& iter, Iterator end,
+                                    uint16_t& word) {
+  if (iter == end) {
+    return 0;
+  }
+  if constexpr (Utf16ValuesPerUnit<Iterator>() == 1) {
+    word = static_cast<uint16_t>(*iter);
+    ++iter;
+    return 1;
+  } else {
+    uint8_t first = static_cast<uint8_t>(*iter);
+    if (++iter == end) {
+      return 1;
+    }
+    uint8_t second = static_cast<uint8_t>(*iter);
+    ++iter;
+    if constexpr (kEndian == Endian::kBig) {
+      word = static_cast<uint16_t>((first << 8) | second);
+    } else {
+      word = static_cast<uint16_t>(first | (second << 8));
+    }
+    return 2;
+  }
+}
+
+// Decodes single-pass input. The code unit following an unpaired high
+// surrogate is kept and decoded again.
+template <class BytesIterator, class OutputIterator, Endian kEndian,
+          bool kCheckBoundaries>
+constexpr size_t Utf16DecodeSinglePass(BytesIterator iter,
+                                       BytesIterator bytes_end,
+                                       OutputIterator& output,
+                                       OutputIterator output_end,
+                                       ErrorPolicy policy) {
+  if constexpr (!kCheckBoundaries) {
+    // supress unused variable warning
+    (void)output_end;
+  }
+
+  constexpr size_t kStep = Utf16ValuesPerUnit<BytesIterator>();
+
+  uint16_t pending = 0;
+  size_t pending_read = 0;
+  size_t decoded = 0;
+  while (true) {
+    if constexpr (kCheckBoundaries) {
+      if (output == output_end) {
+        break;
+      }
+    }
+    uint16_t word0 = pending;
+    size_t read = pending_read;
+    if (pending_read > 0) {
+      pending_read = 0;
+    } else {
+      read = ReadWordSinglePass<kEndian>(iter, bytes_end, word0);
+      if (read == 0) {
+        break;
+      }
+    }
+
+    if (read == kStep && !IsSurrogate(word0)) {
+      *output = word0;
+      ++output;
+      decoded += kStep;
+      continue;
+    }
+    if (read == kStep && word0 < 0xDC00) {
+      uint16_t word1 = 0;
+      size_t word1_read = ReadWordSinglePass<kEndian>(iter, bytes_end, word1);
+      if (word1_read == kStep && word1 >= 0xDC00 && word1 <= 0xDFFF) {
+        *output = 0x10000 + (((word0 - 0xD800) << 10) | (word1 - 0xDC00));
+        ++output;
+        decoded += 2 * kStep;
+        continue;
+      }
+      pending = word1;
+      pending_read = word1_read;
+    }
+
+    // a surrogate which isn't a part of a pair, or a trailing odd byte
+    if (policy == ErrorPolicy::kStop) {
+      break;
+    } else if (policy == ErrorPolicy::kReplace) {
+      *output = kReplacementCharacter;
+      ++output;
+    }
+    decoded += read;
+  }
+
+  return decoded;
+}
+
+template <class BytesIterator, class OutputIterator, Endian kEndian,
+          bool kCheckBoundaries>
+constexpr size_t Utf16DecodeImpl(BytesIterator bytes_beg,
+                                 BytesIterator bytes_end,
+                                 OutputIterator& output,
+                                 OutputIterator output_end) {
+  if constexpr (HasIteratorCategory<BytesIterator,
+                                    std::forward_iterator_tag>()) {
+    return Utf16DecodePrefix<BytesIterator, OutputIterator, kEndian,
+                             kCheckBoundaries>(bytes_beg, bytes_end, output,
+                                               output_end);
+  } else {
+    return Utf16DecodeSinglePass<BytesIterator, OutputIterator, kEndian,
+                                 kCheckBoundaries>(
+        bytes_beg, bytes_end, output, output_end, ErrorPolicy::kStop);
+  }
+}
+
+// Decodes UTF-16 bytes to `output`, which must have room for (size + 1) / 2
+// characters. Returns the number of decoded bytes.
+size_t Utf16DecodeContiguous(const uint8_t* bytes, size_t size, Endian endian,
+                             char32_t* output, ErrorPolicy policy,
+                             size_t* chars_written);
+#if WCHAR_MAX > 0xFFFF
+size_t Utf16DecodeContiguous(const uint8_t* bytes, size_t size, Endian endian,
+                             wchar_t* output, ErrorPolicy policy,
+                             size_t* chars_written);
+#endif
+
+// Decodes contiguous bytes piece by piece to a buffer using the vectorized
+// decoder, then copies the characters to `output`. Returns the number of
+// decoded bytes.
+template <class OutputIterator>
+size_t Utf16DecodeBuffered(const uint8_t* bytes, size_t size, Endian endian,
+                           OutputIterator& output, ErrorPolicy policy) {
+  constexpr size_t kBufferSize = 1024;
+
+  char32_t buffer[kBufferSize];
+  size_t pos = 0;
+  while (pos < size) {
+    size_t piece = std::min(2 * kBufferSize, size - pos);
+    if (piece < size - pos) {
+      // cut before a high surrogate, so no surrogate pair is split
+      uint8_t high_byte = bytes[pos + piece - (endian == Endian::kBig ? 2 : 1)];
+      if ((high_byte & 0xFC) == 0xD8) {
+        piece -= 2;
+      }
+    }
+    size_t written = 0;
+    size_t decoded = Utf16DecodeContiguous(bytes + pos, piece, endian, buffer,
+                                           policy, &written);
+    output = std::copy(buffer, buffer + written, output);
+    pos += decoded;
+    if (decoded < piece) {
+      break;
+    }
+  }
+
+  return pos;
 }
 
 }  // namespace detail
 
 template <class BytesIterator, class OutputIterator,
           Endian kEndian = Endian::kLittle>
-size_t Utf16Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
-                   OutputIterator output) {
+constexpr size_t Utf16Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
+                             OutputIterator output) {
   return detail::Utf16DecodeImpl<BytesIterator, OutputIterator, kEndian,
                                  /*kCheckBoundaries = */ false>(
       bytes_beg, bytes_end, output, output);
@@ -94,8 +277,9 @@ size_t Utf16Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
 
 template <class BytesIterator, class OutputIterator,
           Endian kEndian = Endian::kLittle>
-size_t Utf16Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
-                   OutputIterator output_beg, OutputIterator output_end) {
+constexpr size_t Utf16Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
+                             OutputIterator output_beg,
+                             OutputIterator output_end) {
   return detail::Utf16DecodeImpl<BytesIterator, OutputIterator, kEndian,
                                  /*kCheckBoundaries = */ true>(
       bytes_beg, bytes_end, output_beg, output_end);
@@ -103,48 +287,106 @@ size_t Utf16Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
 
 template <class BytesIterator, class OutputIterator,
           Endian kEndian = Endian::kLittle>
-size_t Utf16Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
-                   OutputIterator output, ErrorPolicy policy) {
-  BytesIterator iter = bytes_beg;
-  while (iter != bytes_end) {
-    size_t bytes_left = static_cast<size_t>(std::distance(iter, bytes_end));
-    size_t decoded = Utf16Decode<BytesIterator, OutputIterator, kEndian>(
-        iter, bytes_end, output);
-    if (decoded < bytes_left) {
-      if (policy == ErrorPolicy::kSkip) {
-        ++decoded;
-      } else if (policy == ErrorPolicy::kStop) {
-        std::advance(iter, decoded);
+constexpr size_t Utf16Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
+                             OutputIterator output, ErrorPolicy policy) {
+  if constexpr (!detail::HasIteratorCategory<BytesIterator,
+                                             std::forward_iterator_tag>()) {
+    return detail::Utf16DecodeSinglePass<BytesIterator, OutputIterator,
+                                         kEndian,
+                                         /*kCheckBoundaries = */ false>(
+        bytes_beg, bytes_end, output, output, policy);
+  } else {
+    constexpr size_t kStep = detail::Utf16ValuesPerUnit<BytesIterator>();
+
+    if constexpr (detail::IsContiguousIterator<BytesIterator>() &&
+                  kStep == 2) {
+      // without vectorized kernels copying through the buffer doesn't pay off
+      if (bytes_beg != bytes_end && !detail::IsConstantEvaluated() &&
+          ActiveSimdLevel() != SimdLevel::kScalar) {
+        return detail::Utf16DecodeBuffered(
+            reinterpret_cast<const uint8_t*>(
+                detail::IteratorAddress(bytes_beg)),
+            static_cast<size_t>(bytes_end - bytes_beg), kEndian, output,
+            policy);
+      }
+    }
+
+    BytesIterator iter = bytes_beg;
+    size_t decoded = 0;
+    while (iter != bytes_end) {
+      decoded += detail::Utf16DecodePrefix<BytesIterator, OutputIterator,
+                                           kEndian,
+                                           /*kCheckBoundaries = */ false>(
+          iter, bytes_end, output, output);
+      if (iter == bytes_end || policy == ErrorPolicy::kStop) {
         break;
-      } else if (policy == ErrorPolicy::kReplace) {
+      }
+      if (policy == ErrorPolicy::kReplace) {
         *output = kReplacementCharacter;
         ++output;
+      }
+      // skip a single code unit, or a trailing odd byte
+      for (size_t i = 0; i < kStep && iter != bytes_end; i++) {
+        ++iter;
         ++decoded;
       }
     }
-    std::advance(iter, decoded);
-  }
 
-  return std::distance(bytes_beg, iter);
+    return decoded;
+  }
 }
 
 template <class BytesIterator, class OutputIterator>
-size_t Utf16LeDecode(BytesIterator bytes_beg, BytesIterator bytes_end,
-                     OutputIterator output, ErrorPolicy policy) {
+constexpr size_t Utf16LeDecode(BytesIterator bytes_beg, BytesIterator bytes_end,
+                               OutputIterator output, ErrorPolicy policy) {
   return Utf16Decode<BytesIterator, OutputIterator, Endian::kLittle>(
       bytes_beg, bytes_end, output, policy);
 }
 
 template <class BytesIterator, class OutputIterator>
-size_t Utf16BeDecode(BytesIterator bytes_beg, BytesIterator bytes_end,
-                     OutputIterator output, ErrorPolicy policy) {
+constexpr size_t Utf16BeDecode(BytesIterator bytes_beg, BytesIterator bytes_end,
+                               OutputIterator output, ErrorPolicy policy) {
   return Utf16Decode<BytesIterator, OutputIterator, Endian::kBig>(
       bytes_beg, bytes_end, output, policy);
 }
 
+// Moves `iter` back to the beginning of the character preceding it, looking
+// at most two code units back. Forward decoding of the input starting at
+// `begin` must have a character boundary at `iter`, for input of bytes it is
+// an even number of bytes past `begin`. Returns the character, or
+// kInvalidCharacter if the preceding code unit is an unpaired surrogate.
+template <class BytesIterator, Endian kEndian = Endian::kLittle>
+constexpr char32_t Utf16PrevCodePoint(BytesIterator begin,
+                                      BytesIterator& iter) {
+  constexpr size_t kStep = detail::Utf16ValuesPerUnit<BytesIterator>();
+
+  for (size_t i = 0; i < kStep; i++) {
+    --iter;
+  }
+  char32_t word1 = detail::ReadWord<kEndian>(iter);
+  if (!IsSurrogate(word1)) {
+    return word1;
+  }
+  // A low surrogate after a high one is the second half of a pair. A high
+  // surrogate is never the second half, so it is a character boundary.
+  if (word1 < 0xDC00 || iter == begin) {
+    return kInvalidCharacter;
+  }
+  BytesIterator prev = iter;
+  for (size_t i = 0; i < kStep; i++) {
+    --prev;
+  }
+  char32_t word0 = detail::ReadWord<kEndian>(prev);
+  if (word0 < 0xD800 || word0 >= 0xDC00) {
+    return kInvalidCharacter;
+  }
+  iter = prev;
+  return 0x10000 + (((word0 - 0xD800) << 10) | (word1 - 0xDC00));
+}
+
 template <class OutputIterator, Endian kEndian = Endian::kLittle>
-OutputIterator Utf16EncodeValidCharacter(char32_t code,
-                                         OutputIterator iterator) {
+constexpr OutputIterator Utf16EncodeValidCharacter(char32_t code,
+                                                   OutputIterator iterator) {
   if (code <= 0xFFFF) {
     iterator =
         detail::WriterWord<kEndian>(static_cast<uint16_t>(code), iterator);
@@ -161,13 +403,14 @@ OutputIterator Utf16EncodeValidCharacter(char32_t code,
 
 template <class CharsIterator, class OutputIterator,
           Endian kEndian = Endian::kLittle>
-size_t Utf16Encode(CharsIterator input_beg, CharsIterator input_end,
-                   OutputIterator output, ErrorPolicy policy) {
-  CharsIterator iter = input_beg;
-  while (iter != input_end) {
+constexpr size_t Utf16Encode(CharsIterator input_beg, CharsIterator input_end,
+                             OutputIterator output, ErrorPolicy policy) {
+  size_t encoded = 0;
+  for (CharsIterator iter = input_beg; iter != input_end; ++iter) {
     char32_t ch = *iter;
     if (!IsValidCharacter(ch)) {
       if (policy == ErrorPolicy::kSkip) {
+        ++encoded;
         continue;
       } else if (policy == ErrorPolicy::kStop) {
         break;
@@ -177,33 +420,83 @@ size_t Utf16Encode(CharsIterator input_beg, CharsIterator input_end,
     }
 
     output = Utf16EncodeValidCharacter<OutputIterator, kEndian>(ch, output);
-    ++iter;
+    ++encoded;
   }
 
-  return std::distance(input_beg, iter);
+  return encoded;
 }
 
 template <class CharsIterator, class OutputIterator>
-size_t Utf16LeEncode(CharsIterator input_beg, CharsIterator input_end,
-                     OutputIterator output, ErrorPolicy policy) {
+constexpr size_t Utf16LeEncode(CharsIterator input_beg, CharsIterator input_end,
+                               OutputIterator output, ErrorPolicy policy) {
   return Utf16Encode<CharsIterator, OutputIterator, Endian::kLittle>(
       input_beg, input_end, output, policy);
 }
 
 template <class CharsIterator, class OutputIterator>
-size_t Utf16BeEncode(CharsIterator input_beg, CharsIterator input_end,
-                     OutputIterator output, ErrorPolicy policy) {
+constexpr size_t Utf16BeEncode(CharsIterator input_beg, CharsIterator input_end,
+                               OutputIterator output, ErrorPolicy policy) {
   return Utf16Encode<CharsIterator, OutputIterator, Endian::kBig>(
       input_beg, input_end, output, policy);
 }
 
-template <class Result, class Wstring>
-Result Utf16LeBytes(const Wstring& wstring,
-                    ErrorPolicy policy = ErrorPolicy::kReplace,
-                    size_t* chars_encoded = nullptr) {
+// Returns the number of UTF-16 code units encoding `chars` with invalid
+// characters replaced, which is the upper bound for the other error policies.
+size_t Utf16LengthFromUtf32(std::u32string_view chars);
+
+// Same as Utf8ValidPrefixLength() and the others for UTF-16 in the native byte
+// order, or for bytes in little or big endian order. The prefix length is in
+// code units for std::u16string_view and in bytes otherwise. Unpaired
+// surrogates and a trailing odd byte are invalid.
+size_t Utf16ValidPrefixLength(std::u16string_view utf16_string);
+size_t Utf16LeValidPrefixLength(std::string_view utf16_bytes);
+size_t Utf16BeValidPrefixLength(std::string_view utf16_bytes);
+size_t Utf16NumValidChars(std::u16string_view utf16_string);
+size_t Utf16LeNumValidChars(std::string_view utf16_bytes);
+size_t Utf16BeNumValidChars(std::string_view utf16_bytes);
+size_t Utf16NumCharsWithReplacement(std::u16string_view utf16_string);
+size_t Utf16LeNumCharsWithReplacement(std::string_view utf16_bytes);
+size_t Utf16BeNumCharsWithReplacement(std::string_view utf16_bytes);
+
+namespace detail {
+
+// Encodes `size` characters to `output`, which must have room for
+// 2 * Utf16LengthFromUtf32() bytes. Returns the number of encoded characters.
+size_t Utf16EncodeContiguous(const char32_t* chars, size_t size,
+                             uint8_t* output, Endian endian, ErrorPolicy policy,
+                             size_t* bytes_written);
+
+template <Endian kEndian, class Result, class Wstring>
+Result Utf16BytesFromWstring(const Wstring& wstring, ErrorPolicy policy,
+                             size_t* chars_encoded) {
+  using CharsIterator = decltype(wstring.begin());
+  using Char = typename std::iterator_traits<CharsIterator>::value_type;
+
   Result result;
-  size_t encoded = Utf16LeEncode(wstring.begin(), wstring.end(),
-                                 std::back_insert_iterator(result), policy);
+  size_t encoded = 0;
+  if constexpr (IsContiguousIterator<CharsIterator>() && sizeof(Char) == 4 &&
+                IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 1) {
+    size_t size =
+        static_cast<size_t>(std::distance(wstring.begin(), wstring.end()));
+    if (size > 0) {
+      const char32_t* chars =
+          reinterpret_cast<const char32_t*>(IteratorAddress(wstring.begin()));
+      ResizeAndOverwrite(
+          result, 2 * Utf16LengthFromUtf32(std::u32string_view(chars, size)),
+          [&](auto* data) {
+            size_t written = 0;
+            encoded = Utf16EncodeContiguous(chars, size,
+                                            reinterpret_cast<uint8_t*>(data),
+                                            kEndian, policy, &written);
+            return written;
+          });
+    }
+  } else {
+    encoded = Utf16Encode<CharsIterator, std::back_insert_iterator<Result>,
+                          kEndian>(wstring.begin(), wstring.end(),
+                                   std::back_inserter(result), policy);
+  }
 
   if (chars_encoded != nullptr) {
     *chars_encoded = encoded;
@@ -212,47 +505,72 @@ Result Utf16LeBytes(const Wstring& wstring,
   return result;
 }
 
-template <class Result, class Wstring>
-Result Utf16BeBytes(const Wstring& wstring,
-                    ErrorPolicy policy = ErrorPolicy::kReplace,
-                    size_t* chars_encoded = nullptr) {
-  Result result;
-  size_t encoded = Utf16BeEncode(wstring.begin(), wstring.end(),
-                                 std::back_insert_iterator(result), policy);
+template <Endian kEndian, class Wstring, class BytesContainer>
+Wstring Utf16WstringFromBytes(const BytesContainer& bytes, ErrorPolicy policy,
+                              size_t* bytes_decoded) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+  using Char = typename Wstring::value_type;
 
-  if (chars_encoded != nullptr) {
-    *chars_encoded = encoded;
+  Wstring result;
+  size_t decoded = 0;
+  if constexpr (IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1 &&
+                (std::is_same_v<Char, char32_t> ||
+                 (std::is_same_v<Char, wchar_t> && WCHAR_MAX > 0xFFFF))) {
+    size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+    if (size > 0) {
+      result.resize((size + 1) / 2);
+      size_t written = 0;
+      decoded = Utf16DecodeContiguous(
+          reinterpret_cast<const uint8_t*>(IteratorAddress(bytes.begin())),
+          size, kEndian, result.data(), policy, &written);
+      result.resize(written);
+    }
+  } else {
+    decoded = Utf16Decode<BytesIterator, CheckedBackInsertIterator<Wstring>,
+                          kEndian>(bytes.begin(), bytes.end(),
+                                   CheckedBackInserter(result), policy);
+  }
+  if (bytes_decoded != nullptr) {
+    *bytes_decoded = decoded;
   }
 
   return result;
 }
 
+}  // namespace detail
+
+template <class Result, class Wstring>
+Result Utf16LeBytes(const Wstring& wstring,
+                    ErrorPolicy policy = ErrorPolicy::kReplace,
+                    size_t* chars_encoded = nullptr) {
+  return detail::Utf16BytesFromWstring<Endian::kLittle, Result>(
+      wstring, policy, chars_encoded);
+}
+
+template <class Result, class Wstring>
+Result Utf16BeBytes(const Wstring& wstring,
+                    ErrorPolicy policy = ErrorPolicy::kReplace,
+                    size_t* chars_encoded = nullptr) {
+  return detail::Utf16BytesFromWstring<Endian::kBig, Result>(wstring, policy,
+                                                             chars_encoded);
+}
+
 template <class Wstring, class BytesContainer>
 Wstring Utf16LeWstring(const BytesContainer& bytes,
                        ErrorPolicy policy = ErrorPolicy::kReplace,
                        size_t* bytes_decoded = nullptr) {
-  Wstring result;
-  size_t decoded = Utf16LeDecode(bytes.begin(), bytes.end(),
-                                 CheckedBackInserter(result), policy);
-  if (bytes_decoded != nullptr) {
-    *bytes_decoded = decoded;
-  }
-
-  return result;
+  return detail::Utf16WstringFromBytes<Endian::kLittle, Wstring>(
+      bytes, policy, bytes_decoded);
 }
 
 template <class Wstring, class BytesContainer>
 Wstring Utf16BeWstring(const BytesContainer& bytes,
                        ErrorPolicy policy = ErrorPolicy::kReplace,
                        size_t* bytes_decoded = nullptr) {
-  Wstring result;
-  size_t decoded = Utf16BeDecode(bytes.begin(), bytes.end(),
-                                 CheckedBackInserter(result), policy);
-  if (bytes_decoded != nullptr) {
-    *bytes_decoded = decoded;
-  }
-
-  return result;
+  return detail::Utf16WstringFromBytes<Endian::kBig, Wstring>(bytes, policy,
+                                                              bytes_decoded);
 }
 
 }  // namespace unicpp
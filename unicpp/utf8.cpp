@@ -1,35 +1,11 @@
 #include "utf8.h"
 
-namespace unicpp {
-namespace {
+#include "simd.h"
 
-class AssignmentCouterOutputIterator {
-public:
-  AssignmentCouterOutputIterator()
-      : counter_(std::make_shared<size_t>(0)) {}
-  AssignmentCouterOutputIterator& operator=(char32_t) {
-    (*counter_)++;
-    return *this;
-  }
-  AssignmentCouterOutputIterator& operator*() {
-    return *this;
-  }
-  AssignmentCouterOutputIterator& operator++() {
-    return *this;
-  }
-  AssignmentCouterOutputIterator operator++(int) {
-    AssignmentCouterOutputIterator tmp(*this);
-    operator++();
-    return tmp;
-  }
+#include <algorithm>
 
-  size_t count() const {
-    return *counter_;
-  }
-
-private:
-  std::shared_ptr<size_t> counter_;
-};
+namespace unicpp {
+namespace {
 
 class NopOutputIterator {
 public:
@@ -49,27 +25,488 @@ public:
   }
 };
 
+// Returns the number of bytes the decoders with ErrorPolicy::kReplace turn
+// into the first character of `bytes`.
+size_t Utf8ReplacedSequenceLength(const uint8_t* bytes, size_t size) {
+  size_t length = detail::Utf8ValidSequenceLength(bytes, size);
+  return length == 0 ? 1 : length;
+}
+
+// Describes the invalid sequence at the start of `bytes`.
+Utf8Error Utf8ClassifyError(const uint8_t* bytes, size_t size) {
+  Utf8Error error = {0, 1, Utf8ErrorKind::kTruncated};
+  uint8_t lead = bytes[0];
+  if (IsContinuationByte(lead)) {
+    while (error.length < size && IsContinuationByte(bytes[error.length])) {
+      error.length++;
+    }
+    error.kind = Utf8ErrorKind::kUnexpectedContinuation;
+    return error;
+  }
+
+  size_t announced = lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+  while (error.length < std::min(announced, size) &&
+         IsContinuationByte(bytes[error.length])) {
+    error.length++;
+  }
+  if (lead < 0xC2) {
+    error.kind = Utf8ErrorKind::kOverlong;
+  } else if (lead > 0xF4) {
+    error.kind = Utf8ErrorKind::kOutOfRange;
+  } else if (error.length > 1) {
+    // the second byte is enough to tell these apart from truncation
+    uint8_t second = bytes[1];
+    if ((lead == 0xE0 && second < 0xA0) || (lead == 0xF0 && second < 0x90)) {
+      error.kind = Utf8ErrorKind::kOverlong;
+    } else if (lead == 0xF4 && second > 0x8F) {
+      error.kind = Utf8ErrorKind::kOutOfRange;
+    } else if (lead == 0xED && second > 0x9F) {
+      error.kind = Utf8ErrorKind::kSurrogate;
+    }
+  }
+  return error;
+}
+
+// Counts the characters of the valid prefix of `bytes` adding them to
+// `chars`, returns the length of the prefix.
+size_t Utf8CountValidPrefix(const uint8_t* bytes, size_t size, size_t* chars) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  size_t pos = 0;
+  while (pos < size) {
+    detail::BlocksResult blocks =
+        kernels.utf32_length_from_utf8_blocks(bytes + pos, size - pos);
+    pos += blocks.read;
+    *chars += blocks.written;
+
+    for (size_t i = 0; i < detail::kScalarBlockSize && pos < size; i++) {
+      size_t length = detail::Utf8ValidSequenceLength(bytes + pos, size - pos);
+      if (length == 0) {
+        return pos;
+      }
+      pos += length;
+      ++*chars;
+    }
+  }
+
+  return pos;
+}
+
+template <class Char>
+size_t Utf8DecodeContiguousImpl(const uint8_t* bytes, size_t size,
+                                Char* output, ErrorPolicy policy,
+                                size_t* chars_written) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  Char* out = output;
+  size_t pos = 0;
+  while (pos < size) {
+    detail::BlocksResult blocks = kernels.utf8_to_utf32_blocks(
+        bytes + pos, size - pos, reinterpret_cast<char32_t*>(out), policy);
+    pos += blocks.read;
+    out += blocks.written;
+
+    Char* out_limit = out + std::min(detail::kScalarBlockSize, size - pos);
+    pos += Utf8DecodeImpl<const uint8_t*, Char*, /*kCheckBoundaries = */ true>(
+        bytes + pos, bytes + size, out, out_limit);
+    if (pos == size || out == out_limit) {
+      continue;
+    }
+
+    if (policy == ErrorPolicy::kStop) {
+      break;
+    } else if (policy == ErrorPolicy::kReplace) {
+      *out++ = kReplacementCharacter;
+    }
+    ++pos;
+  }
+
+  *chars_written = out - output;
+  return pos;
+}
+
 }  // namespace
 
+namespace detail {
+
+size_t Utf8DecodeContiguous(const uint8_t* bytes, size_t size, char32_t* output,
+                            ErrorPolicy policy, size_t* chars_written) {
+  return Utf8DecodeContiguousImpl(bytes, size, output, policy, chars_written);
+}
+
+#if WCHAR_MAX > 0xFFFF
+size_t Utf8DecodeContiguous(const uint8_t* bytes, size_t size, wchar_t* output,
+                            ErrorPolicy policy, size_t* chars_written) {
+  return Utf8DecodeContiguousImpl(bytes, size, output, policy, chars_written);
+}
+#endif
+
+size_t Utf8EncodeContiguous(const char32_t* chars, size_t size,
+                            uint8_t* output, size_t output_size,
+                            ErrorPolicy policy, size_t* bytes_written) {
+  const Kernels& kernels = ActiveKernels();
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos < size) {
+    // the kernel writes past the end of its output, so it only gets as many
+    // characters as would fit if all of them took 4 bytes
+    size_t room = (output_size - (out - output)) / 4;
+    BlocksResult blocks =
+        kernels.utf32_to_utf8_blocks(chars + pos, std::min(size - pos, room),
+                                     out);
+    pos += blocks.read;
+    out += blocks.written;
+
+    size_t end = std::min(size, pos + kScalarBlockSize);
+    for (; pos < end; pos++) {
+      char32_t ch = chars[pos];
+      if (!IsValidCharacter(ch)) {
+        if (policy == ErrorPolicy::kSkip) {
+          continue;
+        } else if (policy == ErrorPolicy::kStop) {
+          *bytes_written = out - output;
+          return pos;
+        }
+        ch = kReplacementCharacter;
+      }
+      out += StoreUtf8Character(ch, out);
+    }
+  }
+
+  *bytes_written = out - output;
+  return pos;
+}
+
+}  // namespace detail
+
 size_t Utf8ValidPrefixLength(std::string_view utf8_string) {
-  return Utf8Decode(utf8_string.begin(), utf8_string.end(),
-                    NopOutputIterator());
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(utf8_string.data());
+  size_t size = utf8_string.size();
+  size_t valid = detail::ActiveKernels().utf8_valid_blocks_length(data, size);
+
+  return valid + Utf8Decode(data + valid, data + size, NopOutputIterator());
 }
 
 size_t Utf8NumValidChars(std::string_view utf8_string) {
-  AssignmentCouterOutputIterator counter;
-  Utf8Decode(utf8_string.begin(), utf8_string.end(), counter,
-             ErrorPolicy::kStop);
+  size_t chars = 0;
+  Utf8CountValidPrefix(reinterpret_cast<const uint8_t*>(utf8_string.data()),
+                       utf8_string.size(), &chars);
 
-  return counter.count();
+  return chars;
 }
 
 size_t Utf8NumCharsWithReplacement(std::string_view utf8_string) {
-  AssignmentCouterOutputIterator counter;
-  Utf8Decode(utf8_string.begin(), utf8_string.end(), counter,
-             ErrorPolicy::kReplace);
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(utf8_string.data());
+  size_t size = utf8_string.size();
+  size_t chars = 0;
+  size_t pos = 0;
+  while (pos < size) {
+    pos += Utf8CountValidPrefix(data + pos, size - pos, &chars);
+    if (pos < size) {
+      // the decoder replaces a single byte
+      ++chars;
+      ++pos;
+    }
+  }
+
+  return chars;
+}
+
+std::vector<Utf8Error> Utf8FindErrors(std::string_view utf8_string) {
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(utf8_string.data());
+  size_t size = utf8_string.size();
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  std::vector<Utf8Error> errors;
+  size_t pos = 0;
+  while (pos < size) {
+    pos += kernels.utf8_valid_blocks_length(data + pos, size - pos);
+
+    for (size_t i = 0; i < detail::kScalarBlockSize && pos < size; i++) {
+      size_t length = detail::Utf8ValidSequenceLength(data + pos, size - pos);
+      if (length != 0) {
+        pos += length;
+        continue;
+      }
+      Utf8Error error = Utf8ClassifyError(data + pos, size - pos);
+      error.offset = pos;
+      errors.push_back(error);
+      pos += error.length;
+    }
+  }
+
+  return errors;
+}
+
+size_t Utf8LengthFromUtf32(std::u32string_view chars) {
+  detail::BlocksResult blocks =
+      detail::ActiveKernels().utf8_length_from_utf32_blocks(chars.data(),
+                                                            chars.size());
+  size_t length = blocks.written;
+  for (char32_t ch : chars.substr(blocks.read)) {
+    length += detail::Utf8CharacterLength(ch);
+  }
+
+  return length;
+}
+
+Utf8CodePointIndex::Utf8CodePointIndex(std::string_view utf8_string)
+    : string_(utf8_string) {
+  static_assert(kBlockCheckpoints * kStride * 4 <= 0xFFFF + 1);
+
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(string_.data());
+  size_t size = string_.size();
+  checkpoint_offsets_.reserve(size / kStride + 1);
+  block_offsets_.reserve(size / (kBlockCheckpoints * kStride) + 1);
+
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  size_t pos = 0;
+  size_t chars = 0;
+  while (true) {
+    if (chars % kStride == 0) {
+      if (checkpoint_offsets_.size() % kBlockCheckpoints == 0) {
+        block_offsets_.push_back(pos);
+      }
+      checkpoint_offsets_.push_back(
+          static_cast<uint16_t>(pos - block_offsets_.back()));
+    }
+    if (pos == size) {
+      break;
+    }
+
+    // a character takes at least a byte, so the kernel doesn't count past
+    // the next checkpoint
+    size_t next = (chars / kStride + 1) * kStride;
+    detail::BlocksResult blocks = kernels.utf32_length_from_utf8_blocks(
+        bytes + pos, std::min(size - pos, next - chars));
+    pos += blocks.read;
+    chars += blocks.written;
+    if (blocks.read > 0) {
+      continue;
+    }
+    for (; chars < next && pos < size; chars++) {
+      pos += Utf8ReplacedSequenceLength(bytes + pos, size - pos);
+    }
+  }
+  size_ = chars;
+}
+
+size_t Utf8CodePointIndex::ByteOffset(size_t char_index) const {
+  if (char_index >= size_) {
+    return string_.size();
+  }
+  size_t checkpoint = char_index / kStride;
+  size_t count = char_index % kStride;
+  size_t pos = Checkpoint(checkpoint);
+  if (IsSingleByteBlock(checkpoint)) {
+    return pos + count;
+  }
+
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(string_.data());
+  for (size_t i = 0; i < count; i++) {
+    pos += Utf8ReplacedSequenceLength(bytes + pos, string_.size() - pos);
+  }
+  return pos;
+}
+
+size_t Utf8CodePointIndex::CharIndex(size_t byte_offset) const {
+  if (byte_offset >= string_.size()) {
+    return size_;
+  }
+  // the last checkpoint at or before the byte
+  size_t block = std::upper_bound(block_offsets_.begin(), block_offsets_.end(),
+                                  byte_offset) -
+                 block_offsets_.begin() - 1;
+  auto block_begin = checkpoint_offsets_.begin() + block * kBlockCheckpoints;
+  auto block_end = block + 1 < block_offsets_.size()
+                       ? block_begin + kBlockCheckpoints
+                       : checkpoint_offsets_.end();
+  size_t checkpoint = std::upper_bound(block_begin, block_end,
+                                       byte_offset - block_offsets_[block]) -
+                      checkpoint_offsets_.begin() - 1;
+
+  size_t char_index = checkpoint * kStride;
+  size_t pos = Checkpoint(checkpoint);
+  if (IsSingleByteBlock(checkpoint)) {
+    return char_index + (byte_offset - pos);
+  }
+
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(string_.data());
+  while (true) {
+    pos += Utf8ReplacedSequenceLength(bytes + pos, string_.size() - pos);
+    if (pos > byte_offset) {
+      return char_index;
+    }
+    char_index++;
+  }
+}
+
+std::string_view Utf8CodePointIndex::Substr(size_t char_index,
+                                            size_t char_count) const {
+  char_index = std::min(char_index, size_);
+  char_count = std::min(char_count, size_ - char_index);
+  size_t begin = ByteOffset(char_index);
+  size_t end = ByteOffset(char_index + char_count);
+  return string_.substr(begin, end - begin);
+}
+
+bool Utf8CodePointIndex::IsSingleByteBlock(size_t checkpoint) const {
+  size_t chars = std::min(kStride, size_ - checkpoint * kStride);
+  size_t end = checkpoint + 1 < checkpoint_offsets_.size()
+                   ? Checkpoint(checkpoint + 1)
+                   : string_.size();
+  return end - Checkpoint(checkpoint) == chars;
+}
+
+TranscodeResult Utf8StreamDecoder::Feed(std::string_view chunk,
+                                        char32_t* output,
+                                        size_t output_size) {
+  if (failed_) {
+    return {TranscodeStatus::kError, 0, 0};
+  }
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(chunk.data());
+  size_t size = chunk.size();
+  size_t pos = 0;
+  size_t out = 0;
+
+  if (pending_size_ > 0) {
+    uint8_t sequence[4];
+    std::copy(pending_, pending_ + pending_size_, sequence);
+    size_t available = pending_size_;
+    while (available < 4 && pos < size) {
+      sequence[available++] = bytes[pos++];
+    }
+
+    size_t length = detail::Utf8CheckSequence(sequence, available);
+    if (length > available) {
+      // still truncated, the whole chunk is pending
+      std::copy(sequence, sequence + available, pending_);
+      pending_size_ = available;
+      return {TranscodeStatus::kDone, size, 0};
+    }
+    if (length != 0) {
+      if (output_size == 0) {
+        return {TranscodeStatus::kOutputFull, 0, 0};
+      }
+      output[out++] = detail::DecodeUtf8Sequence(sequence, length);
+      pos = length - pending_size_;
+      bytes_decoded_ += length;
+    } else {
+      // The pending bytes are a lead byte and continuation bytes, each of
+      // them is invalid on its own. The chunk is decoded from the start.
+      if (policy_ == ErrorPolicy::kStop) {
+        failed_ = true;
+        pending_size_ = 0;
+        return {TranscodeStatus::kError, 0, 0};
+      }
+      size_t invalid = pending_size_;
+      if (policy_ == ErrorPolicy::kReplace) {
+        invalid = std::min(invalid, output_size);
+        std::fill_n(output, invalid, kReplacementCharacter);
+        out = invalid;
+      }
+      bytes_decoded_ += invalid;
+      if (invalid < pending_size_) {
+        // the rest are continuation bytes, as invalid in the next call
+        std::copy(pending_ + invalid, pending_ + pending_size_, pending_);
+        pending_size_ -= invalid;
+        return {TranscodeStatus::kOutputFull, 0, out};
+      }
+      pos = 0;
+    }
+    pending_size_ = 0;
+  }
+
+  // keep a sequence truncated at the end of the chunk
+  size_t end = size;
+  for (size_t i = 1; i <= kMaxPendingBytes && i <= size - pos; i++) {
+    if (!IsContinuationByte(bytes[size - i])) {
+      if (detail::Utf8CheckSequence(bytes + size - i, i) > i) {
+        end = size - i;
+      }
+      break;
+    }
+  }
+
+  while (pos < end) {
+    // A byte decodes to at most one character. If the rest doesn't surely
+    // fit in the output, a prefix that does is cut before a byte starting a
+    // sequence, see Utf8DecodeBuffered().
+    size_t piece = std::min(end - pos, output_size - out);
+    if (piece < end - pos && piece >= detail::kScalarBlockSize) {
+      size_t cut = piece;
+      while (cut > piece - 3 && IsContinuationByte(bytes[pos + cut])) {
+        --cut;
+      }
+      if (!IsContinuationByte(bytes[pos + cut])) {
+        piece = cut;
+      }
+    }
+    if (piece == end - pos || piece >= detail::kScalarBlockSize) {
+      size_t written = 0;
+      size_t decoded = detail::Utf8DecodeContiguous(
+          bytes + pos, piece, output + out, policy_, &written);
+      out += written;
+      pos += decoded;
+      bytes_decoded_ += decoded;
+      if (decoded < piece) {
+        failed_ = true;
+        return {TranscodeStatus::kError, pos, out};
+      }
+      continue;
+    }
+
+    // the output is nearly full, a character at a time
+    size_t length = detail::Utf8CheckSequence(bytes + pos, size - pos);
+    char32_t ch = kReplacementCharacter;
+    if (length != 0) {
+      ch = detail::DecodeUtf8Sequence(bytes + pos, length);
+    } else if (policy_ == ErrorPolicy::kStop) {
+      failed_ = true;
+      return {TranscodeStatus::kError, pos, out};
+    }
+    if (length != 0 || policy_ == ErrorPolicy::kReplace) {
+      if (out == output_size) {
+        return {TranscodeStatus::kOutputFull, pos, out};
+      }
+      output[out++] = ch;
+    }
+    if (length == 0) {
+      length = 1;
+    }
+    pos += length;
+    bytes_decoded_ += length;
+  }
+  std::copy(bytes + end, bytes + size, pending_);
+  pending_size_ = size - end;
+
+  return {TranscodeStatus::kDone, size, out};
+}
+
+TranscodeResult Utf8StreamDecoder::Finish(char32_t* output,
+                                          size_t output_size) {
+  if (failed_) {
+    return {TranscodeStatus::kError, 0, 0};
+  } else if (pending_size_ == 0) {
+    return {TranscodeStatus::kDone, 0, 0};
+  }
+  // same as the decoding of a truncated sequence at the end of the input
+  if (policy_ == ErrorPolicy::kStop) {
+    failed_ = true;
+    pending_size_ = 0;
+    return {TranscodeStatus::kError, 0, 0};
+  }
+  size_t invalid = pending_size_;
+  size_t written = 0;
+  if (policy_ == ErrorPolicy::kReplace) {
+    invalid = std::min(invalid, output_size);
+    written = invalid;
+    std::fill_n(output, written, kReplacementCharacter);
+  }
+  bytes_decoded_ += invalid;
+  std::copy(pending_ + invalid, pending_ + pending_size_, pending_);
+  pending_size_ -= invalid;
 
-  return counter.count();
+  return {pending_size_ == 0 ? TranscodeStatus::kDone
+                             : TranscodeStatus::kOutputFull,
+          invalid, written};
 }
 
 }  // namespace unicpp
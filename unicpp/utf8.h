@@ -1,7 +1,19 @@
 #pragma once
 
+#include "simd_level.h"
 #include "utf_common.h"
 
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <iterator>
@@ -11,22 +23,66 @@
 #include <vector>
 
 #include <stdint.h>
+#include <string.h>
 
 namespace unicpp {
 
-inline bool IsContinuationByte(uint8_t byte) {
+constexpr bool IsContinuationByte(uint8_t byte) {
   return (byte & 0xC0) == 0x80;
 }
 
-template <class BytesIterator, class OutputIterator, bool kCheckBoundaries>
-size_t Utf8DecodeImpl(BytesIterator bytes_beg, BytesIterator bytes_end,
-                      OutputIterator output, OutputIterator output_end) {
+namespace detail {
+
+// Copies ASCII bytes from the beginning of `bytes` to the output a word at a
+// time and stops at the first word containing a non-ASCII byte. Returns the
+// number of copied bytes, which is a multiple of the word size.
+template <class OutputIterator>
+size_t Utf8CopyAsciiWords(const uint8_t* bytes, size_t size,
+                          OutputIterator& output) {
+  constexpr size_t kWordSize = sizeof(uint64_t);
+  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+
+  size_t pos = 0;
+  for (; pos + kWordSize <= size; pos += kWordSize) {
+    uint64_t word;
+    memcpy(&word, bytes + pos, kWordSize);
+    if ((word & kHighBits) != 0) {
+      break;
+    }
+    for (size_t i = 0; i < kWordSize; i++) {
+      *output = bytes[pos + i];
+      ++output;
+    }
+  }
+
+  return pos;
+}
+
+// Decodes the valid prefix of [bytes, bytes_end) advancing `bytes` and
+// `output`, returns the number of decoded bytes. Needs a forward iterator, but
+// looks at most 3 bytes ahead, so decoding takes O(1) time per character.
+// With `kScalarOnly` ASCII isn't copied by words, so that compilers without
+// IsConstantEvaluated() can run it at compile time.
+template <class BytesIterator, class OutputIterator, bool kCheckBoundaries,
+          bool kScalarOnly = false>
+constexpr size_t Utf8DecodePrefix(BytesIterator& bytes,
+                                  BytesIterator bytes_end,
+                                  OutputIterator& output,
+                                  OutputIterator output_end) {
   if constexpr (!kCheckBoundaries) {
     // supress unused variable warning
     (void)output_end;
   }
 
-  BytesIterator bytes = bytes_beg;
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+  constexpr bool kCopyAsciiWords =
+      !kScalarOnly && IsContiguousIterator<BytesIterator>() &&
+      sizeof(ByteType) == 1 &&
+      (!kCheckBoundaries ||
+       HasIteratorCategory<OutputIterator,
+                                   std::random_access_iterator_tag>());
+
+  size_t decoded = 0;
   while (bytes != bytes_end) {
     if constexpr (kCheckBoundaries) {
       if (output == output_end) {
@@ -35,14 +91,32 @@ size_t Utf8DecodeImpl(BytesIterator bytes_beg, BytesIterator bytes_end,
     }
     uint8_t byte0 = static_cast<uint8_t>(*bytes);
     if (byte0 < 0x80) {
+      if constexpr (kCopyAsciiWords) {
+        if (!IsConstantEvaluated()) {
+          size_t limit = static_cast<size_t>(std::distance(bytes, bytes_end));
+          if constexpr (kCheckBoundaries) {
+            limit = std::min(
+                limit, static_cast<size_t>(std::distance(output, output_end)));
+          }
+          size_t copied = Utf8CopyAsciiWords(
+              reinterpret_cast<const uint8_t*>(IteratorAddress(bytes)),
+              limit, output);
+          if (copied > 0) {
+            std::advance(bytes, copied);
+            decoded += copied;
+            continue;
+          }
+        }
+      }
       *output = *bytes;
       ++bytes;
+      ++decoded;
     } else if (byte0 < 0xE0) {
       if (byte0 < 0xC2) {
         // should have used 1 byte
         break;
       }
-      if (std::distance(bytes, bytes_end) < 2) {
+      if (!HasAtLeast(bytes, bytes_end, 2)) {
         break;
       }
       uint8_t byte1 = static_cast<uint8_t>(*std::next(bytes, 1));
@@ -50,9 +124,10 @@ size_t Utf8DecodeImpl(BytesIterator bytes_beg, BytesIterator bytes_end,
         break;
       }
       std::advance(bytes, 2);
+      decoded += 2;
       *output = ((byte0 & 0x1F) << 6) | (byte1 & 0x3F);
     } else if (byte0 < 0xF0) {
-      if (std::distance(bytes, bytes_end) < 3) {
+      if (!HasAtLeast(bytes, bytes_end, 3)) {
         break;
       }
       uint8_t byte1 = static_cast<uint8_t>(*std::next(bytes, 1));
@@ -63,18 +138,23 @@ size_t Utf8DecodeImpl(BytesIterator bytes_beg, BytesIterator bytes_end,
         // should have used 2 bytes
         break;
       }
+      if (byte0 == 0xED && (byte1 & 0x20) != 0) {
+        // surrogates are not allowed
+        break;
+      }
       uint8_t byte2 = static_cast<uint8_t>(*std::next(bytes, 2));
       if (!IsContinuationByte(byte2)) {
         break;
       }
       std::advance(bytes, 3);
+      decoded += 3;
       *output = ((byte0 & 0xF) << 12) | ((byte1 & 0x3F) << 6) | (byte2 & 0x3F);
     } else if (byte0 < 0xF5) {
       if ((byte0 & 0x7) > 0x4) {
         // bigger than of U+10FFFF
         break;
       }
-      if (std::distance(bytes, bytes_end) < 4) {
+      if (!HasAtLeast(bytes, bytes_end, 4)) {
         break;
       }
       uint8_t byte1 = static_cast<uint8_t>(*std::next(bytes, 1));
@@ -99,6 +179,7 @@ size_t Utf8DecodeImpl(BytesIterator bytes_beg, BytesIterator bytes_end,
         break;
       }
       std::advance(bytes, 4);
+      decoded += 4;
       *output = ((byte0 & 0x7) << 18) | ((byte1 & 0x3F) << 12) |
                 ((byte2 & 0x3F) << 6) | (byte3 & 0x3F);
     } else {
@@ -107,53 +188,349 @@ size_t Utf8DecodeImpl(BytesIterator bytes_beg, BytesIterator bytes_end,
     ++output;
   }
 
-  return std::distance(bytes_beg, bytes);
+  return decoded;
+}
+
+// Length of the sequence started by `byte`, 1 if it can't start a sequence.
+constexpr size_t Utf8SequenceLength(uint8_t byte) {
+  if (byte < 0xC2) {
+    return 1;
+  } else if (byte < 0xE0) {
+    return 2;
+  } else if (byte < 0xF0) {
+    return 3;
+  } else if (byte < 0xF5) {
+    return 4;
+  }
+  return 1;
+}
+
+// Decodes the character at `iter` advancing `iter` past it. If the sequence
+// there is invalid, advances `iter` past its first byte only and returns
+// kInvalidCharacter, as the decoders replace or skip the invalid bytes one by
+// one.
+template <class BytesIterator, class Sentinel>
+constexpr char32_t Utf8DecodeCharacter(BytesIterator& iter,
+                                       const Sentinel& end) {
+  uint8_t lead = static_cast<uint8_t>(*iter);
+  ++iter;
+  if (lead <= 0x7F) {
+    return lead;
+  }
+  size_t length = Utf8SequenceLength(lead);
+  if (length == 1) {
+    return kInvalidCharacter;
+  }
+
+  // overlong sequences, surrogates and characters above U+10FFFF are
+  // rejected by the range of the second byte
+  uint8_t min_second = lead == 0xE0 ? 0xA0 : lead == 0xF0 ? 0x90 : 0x80;
+  uint8_t max_second = lead == 0xED ? 0x9F : lead == 0xF4 ? 0x8F : 0xBF;
+  char32_t ch = lead & (0x7F >> length);
+  BytesIterator pos = iter;
+  for (size_t i = 1; i < length; i++, ++pos) {
+    if (pos == end) {
+      return kInvalidCharacter;
+    }
+    uint8_t byte = static_cast<uint8_t>(*pos);
+    if (i == 1 ? byte < min_second || byte > max_second
+               : !IsContinuationByte(byte)) {
+      return kInvalidCharacter;
+    }
+    ch = (ch << 6) | (byte & 0x3F);
+  }
+  iter = pos;
+  return ch;
+}
+
+// Decodes single-pass input. Bytes are read one at a time and only as long as
+// they may belong to the current character, the ones following an invalid
+// sequence are kept in a buffer and decoded again.
+template <class BytesIterator, class OutputIterator, bool kCheckBoundaries>
+constexpr size_t Utf8DecodeSinglePass(BytesIterator bytes,
+                                      BytesIterator bytes_end,
+                                      OutputIterator& output,
+                                      OutputIterator output_end,
+                                      ErrorPolicy policy) {
+  if constexpr (!kCheckBoundaries) {
+    // supress unused variable warning
+    (void)output_end;
+  }
+
+  uint8_t buffer[4] = {};
+  size_t buffered = 0;
+  size_t decoded = 0;
+  while (true) {
+    if constexpr (kCheckBoundaries) {
+      if (output == output_end) {
+        break;
+      }
+    }
+    if (buffered == 0) {
+      if (bytes == bytes_end) {
+        break;
+      }
+      buffer[buffered++] = static_cast<uint8_t>(*bytes);
+      ++bytes;
+      if (buffer[0] < 0x80) {
+        *output = buffer[0];
+        ++output;
+        buffered = 0;
+        ++decoded;
+        continue;
+      }
+    }
+
+    size_t length = Utf8SequenceLength(buffer[0]);
+    while (buffered < length && bytes != bytes_end &&
+           (buffered == 1 || IsContinuationByte(buffer[buffered - 1]))) {
+      buffer[buffered++] = static_cast<uint8_t>(*bytes);
+      ++bytes;
+    }
+
+    char32_t ch = 0;
+    char32_t* ch_end = &ch;
+    const uint8_t* buffer_pos = buffer;
+    size_t consumed = Utf8DecodePrefix<const uint8_t*, char32_t*,
+                                       /*kCheckBoundaries = */ true>(
+        buffer_pos, buffer + buffered, ch_end, &ch + 1);
+    if (consumed > 0) {
+      *output = ch;
+      ++output;
+    } else if (policy == ErrorPolicy::kStop) {
+      break;
+    } else {
+      if (policy == ErrorPolicy::kReplace) {
+        *output = kReplacementCharacter;
+        ++output;
+      }
+      consumed = 1;
+    }
+    decoded += consumed;
+    buffered -= consumed;
+    for (size_t i = 0; i < buffered; i++) {
+      buffer[i] = buffer[consumed + i];
+    }
+  }
+
+  return decoded;
+}
+
+}  // namespace detail
+
+template <class BytesIterator, class OutputIterator, bool kCheckBoundaries>
+constexpr size_t Utf8DecodeImpl(BytesIterator bytes_beg,
+                                BytesIterator bytes_end,
+                                OutputIterator& output,
+                                OutputIterator output_end) {
+  if constexpr (detail::HasIteratorCategory<BytesIterator,
+                                            std::forward_iterator_tag>()) {
+    return detail::Utf8DecodePrefix<BytesIterator, OutputIterator,
+                                    kCheckBoundaries>(bytes_beg, bytes_end,
+                                                      output, output_end);
+  } else {
+    return detail::Utf8DecodeSinglePass<BytesIterator, OutputIterator,
+                                        kCheckBoundaries>(
+        bytes_beg, bytes_end, output, output_end, ErrorPolicy::kStop);
+  }
 }
 
 template <class BytesIterator, class OutputIterator>
-size_t Utf8Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
-                  OutputIterator output) {
+constexpr size_t Utf8Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
+                            OutputIterator output) {
   return Utf8DecodeImpl<BytesIterator, OutputIterator,
                         /*kCheckBoundaries = */ false>(bytes_beg, bytes_end,
                                                        output, output);
 }
 
 template <class BytesIterator, class OutputIterator>
-size_t Utf8Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
-                  OutputIterator output_beg, OutputIterator output_end) {
+constexpr size_t Utf8Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
+                            OutputIterator output_beg,
+                            OutputIterator output_end) {
   return Utf8DecodeImpl<BytesIterator, OutputIterator,
                         /*kCheckBoundaries = */ true>(bytes_beg, bytes_end,
                                                       output_beg, output_end);
 }
 
-template <class BytesIterator, class OutputIterator>
-size_t Utf8Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
-                  OutputIterator output, ErrorPolicy policy) {
+// Moves `iter` back to the beginning of the character preceding it. Forward
+// decoding of the input starting at `begin` must have a character boundary
+// at `iter`, the previous one is found looking at most 4 bytes back. Returns
+// the character, or kInvalidCharacter if the preceding byte is invalid, which
+// the decoders replace or skip according to the error policy.
+template <class BytesIterator>
+constexpr char32_t Utf8PrevCodePoint(BytesIterator begin,
+                                     BytesIterator& iter) {
+  // Forward decoding stops at every byte which isn't a continuation one, so
+  // decode forward from the closest one.
+  BytesIterator pos = iter;
+  for (int i = 0;; i++) {
+    if (i == 4) {
+      // too many continuation bytes for them all to belong to a character
+      --iter;
+      return kInvalidCharacter;
+    }
+    --pos;
+    if (pos == begin || !IsContinuationByte(static_cast<uint8_t>(*pos))) {
+      break;
+    }
+  }
+
+  while (true) {
+    BytesIterator next = pos;
+    char32_t ch = detail::Utf8DecodeCharacter(next, iter);
+    if (next == iter) {
+      iter = pos;
+      return ch;
+    }
+    pos = next;
+  }
+}
+
+namespace detail {
+
+// Decodes UTF-8 to `output`, which must have room for `size` characters.
+// Returns the number of decoded bytes.
+size_t Utf8DecodeContiguous(const uint8_t* bytes, size_t size, char32_t* output,
+                            ErrorPolicy policy, size_t* chars_written);
+#if WCHAR_MAX > 0xFFFF
+size_t Utf8DecodeContiguous(const uint8_t* bytes, size_t size, wchar_t* output,
+                            ErrorPolicy policy, size_t* chars_written);
+#endif
+
+// Decodes contiguous bytes piece by piece to a buffer using the vectorized
+// decoder, then copies the characters to `output`. Returns the number of
+// decoded bytes.
+template <class OutputIterator>
+size_t Utf8DecodeBuffered(const uint8_t* bytes, size_t size,
+                          OutputIterator& output, ErrorPolicy policy) {
+  constexpr size_t kBufferSize = 1024;
+
+  char32_t buffer[kBufferSize];
+  size_t pos = 0;
+  while (pos < size) {
+    size_t piece = std::min(kBufferSize, size - pos);
+    if (piece < size - pos) {
+      // Cut before a byte starting a sequence, so no valid sequence is split.
+      // If there's none among the last bytes, no valid sequence crosses the
+      // end of the piece either.
+      size_t cut = piece;
+      while (cut > piece - 3 && IsContinuationByte(bytes[pos + cut])) {
+        --cut;
+      }
+      if (!IsContinuationByte(bytes[pos + cut])) {
+        piece = cut;
+      }
+    }
+
+    size_t written = 0;
+    size_t decoded =
+        Utf8DecodeContiguous(bytes + pos, piece, buffer, policy, &written);
+    output = std::copy(buffer, buffer + written, output);
+    pos += decoded;
+    if (decoded < piece) {
+      break;
+    }
+  }
+
+  return pos;
+}
+
+// Utf8Decode() of forward iterators without the vectorized code. With
+// `kScalarOnly` it runs at compile time on every compiler, see
+// Utf8DecodePrefix().
+template <class BytesIterator, class OutputIterator, bool kScalarOnly>
+constexpr size_t Utf8DecodeForward(BytesIterator bytes_beg,
+                                   BytesIterator bytes_end,
+                                   OutputIterator output, ErrorPolicy policy) {
   BytesIterator iter = bytes_beg;
+  size_t decoded = 0;
   while (iter != bytes_end) {
-    size_t bytes_left = static_cast<size_t>(std::distance(iter, bytes_end));
-    size_t decoded = Utf8Decode(iter, bytes_end, output);
-    if (decoded < bytes_left) {
-      if (policy == ErrorPolicy::kSkip) {
-        ++decoded;
-      } else if (policy == ErrorPolicy::kStop) {
-        std::advance(iter, decoded);
-        break;
-      } else if (policy == ErrorPolicy::kReplace) {
-        *output = kReplacementCharacter;
-        ++output;
-        ++decoded;
+    decoded += Utf8DecodePrefix<BytesIterator, OutputIterator,
+                                /*kCheckBoundaries = */ false, kScalarOnly>(
+        iter, bytes_end, output, output);
+    if (iter == bytes_end || policy == ErrorPolicy::kStop) {
+      break;
+    }
+    if (policy == ErrorPolicy::kReplace) {
+      *output = kReplacementCharacter;
+      ++output;
+    }
+    ++iter;
+    ++decoded;
+  }
+
+  return decoded;
+}
+
+}  // namespace detail
+
+template <class BytesIterator, class OutputIterator>
+constexpr size_t Utf8Decode(BytesIterator bytes_beg, BytesIterator bytes_end,
+                            OutputIterator output, ErrorPolicy policy) {
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+  if constexpr (!detail::HasIteratorCategory<BytesIterator,
+                                             std::forward_iterator_tag>()) {
+    return detail::Utf8DecodeSinglePass<BytesIterator, OutputIterator,
+                                        /*kCheckBoundaries = */ false>(
+        bytes_beg, bytes_end, output, output, policy);
+  } else {
+    if constexpr (detail::IsContiguousIterator<BytesIterator>() &&
+                  sizeof(ByteType) == 1) {
+      // without vectorized kernels copying through the buffer doesn't pay off
+      if (bytes_beg != bytes_end && !detail::IsConstantEvaluated() &&
+          ActiveSimdLevel() != SimdLevel::kScalar) {
+        return detail::Utf8DecodeBuffered(
+            reinterpret_cast<const uint8_t*>(
+                detail::IteratorAddress(bytes_beg)),
+            static_cast<size_t>(bytes_end - bytes_beg), output, policy);
       }
     }
-    std::advance(iter, decoded);
+
+    return detail::Utf8DecodeForward<BytesIterator, OutputIterator,
+                                     /*kScalarOnly = */ false>(
+        bytes_beg, bytes_end, output, policy);
+  }
+}
+
+namespace detail {
+
+// Encodes `size` characters to `output` of `output_size` bytes, which must
+// have room for Utf8LengthFromUtf32() bytes. Returns the number of encoded
+// characters.
+size_t Utf8EncodeContiguous(const char32_t* chars, size_t size,
+                            uint8_t* output, size_t output_size,
+                            ErrorPolicy policy, size_t* bytes_written);
+
+// Encodes contiguous characters piece by piece to a buffer using the
+// vectorized encoder, then copies the bytes to `output`. Returns the number of
+// encoded characters.
+template <class OutputIterator>
+size_t Utf8EncodeBuffered(const char32_t* chars, size_t size,
+                          OutputIterator& output, ErrorPolicy policy) {
+  constexpr size_t kBufferSize = 1024;
+
+  uint8_t buffer[kBufferSize];
+  size_t pos = 0;
+  while (pos < size) {
+    size_t piece = std::min(kBufferSize / 4, size - pos);
+    size_t written = 0;
+    size_t encoded = Utf8EncodeContiguous(chars + pos, piece, buffer,
+                                          kBufferSize, policy, &written);
+    output = std::copy(buffer, buffer + written, output);
+    pos += encoded;
+    if (encoded < piece) {
+      break;
+    }
   }
 
-  return std::distance(bytes_beg, iter);
+  return pos;
 }
 
+}  // namespace detail
+
 template <class OutputIterator>
-OutputIterator Utf8EncodeValidCharacter(char32_t code,
-                                        OutputIterator&& iterator) {
+constexpr OutputIterator Utf8EncodeValidCharacter(char32_t code,
+                                                  OutputIterator&& iterator) {
   if (code <= 0x7F) {
     *iterator = static_cast<uint8_t>(code);
   } else if (code <= 0x7FF) {
@@ -173,13 +550,27 @@ OutputIterator Utf8EncodeValidCharacter(char32_t code,
 }
 
 template <class CharsIterator, class OutputIterator>
-size_t Utf8Encode(CharsIterator input_beg, CharsIterator input_end,
-                  OutputIterator output, ErrorPolicy policy) {
-  CharsIterator iter = input_beg;
-  while (iter != input_end) {
+constexpr size_t Utf8Encode(CharsIterator input_beg, CharsIterator input_end,
+                            OutputIterator output, ErrorPolicy policy) {
+  using Char = typename std::iterator_traits<CharsIterator>::value_type;
+  if constexpr (detail::IsContiguousIterator<CharsIterator>() &&
+                sizeof(Char) == 4) {
+    // without vectorized kernels copying through the buffer doesn't pay off
+    if (input_beg != input_end && !detail::IsConstantEvaluated() &&
+        ActiveSimdLevel() != SimdLevel::kScalar) {
+      return detail::Utf8EncodeBuffered(
+          reinterpret_cast<const char32_t*>(
+              detail::IteratorAddress(input_beg)),
+          static_cast<size_t>(input_end - input_beg), output, policy);
+    }
+  }
+
+  size_t encoded = 0;
+  for (CharsIterator iter = input_beg; iter != input_end; ++iter) {
     char32_t ch = *iter;
     if (!IsValidCharacter(ch)) {
       if (policy == ErrorPolicy::kSkip) {
+        ++encoded;
         continue;
       } else if (policy == ErrorPolicy::kStop) {
         break;
@@ -189,10 +580,10 @@ size_t Utf8Encode(CharsIterator input_beg, CharsIterator input_end,
     }
 
     output = Utf8EncodeValidCharacter(ch, output);
-    ++iter;
+    ++encoded;
   }
 
-  return std::distance(input_beg, iter);
+  return encoded;
 }
 
 template <class BytesIterator>
@@ -419,13 +810,183 @@ size_t Utf8ValidPrefixLength(std::string_view utf8_string);
 size_t Utf8NumValidChars(std::string_view utf8_string);
 size_t Utf8NumCharsWithReplacement(std::string_view utf8_string);
 
+enum class Utf8ErrorKind {
+  // continuation bytes without a lead byte
+  kUnexpectedContinuation,
+  // a longer encoding than needed, including the lead bytes 0xC0 and 0xC1
+  kOverlong,
+  // an encoded surrogate, U+D800..U+DFFF
+  kSurrogate,
+  // above U+10FFFF, including the lead bytes 0xF5..0xFF
+  kOutOfRange,
+  // a sequence cut by another lead byte, an ASCII one or the end
+  kTruncated,
+};
+
+struct Utf8Error {
+  size_t offset;
+  size_t length;
+  Utf8ErrorKind kind;
+};
+
+// Returns every invalid sequence of `utf8_string` in order. An error is a
+// lead byte with the continuation bytes it announces, or a run of
+// continuation bytes without one. Together they are exactly the bytes the
+// decoders replace or skip.
+std::vector<Utf8Error> Utf8FindErrors(std::string_view utf8_string);
+
+// Returns the length of the UTF-8 encoding of `chars` with invalid characters
+// replaced, which is the upper bound for the other error policies.
+size_t Utf8LengthFromUtf32(std::u32string_view chars);
+
+// Decodes a stream of UTF-8 arriving in chunks. A sequence split between two
+// chunks is decoded as a whole: its leading bytes are kept until the next
+// chunk. The result is the same as Utf8Decode() of the whole stream with the
+// same error policy.
+class Utf8StreamDecoder {
+public:
+  // Longest truncated sequence kept between chunks.
+  static constexpr size_t kMaxPendingBytes = 3;
+
+  explicit Utf8StreamDecoder(ErrorPolicy policy = ErrorPolicy::kReplace)
+      : policy_(policy) {}
+
+  // Decodes the next chunk to `output`, whole characters only. With room for
+  // pending_size() + chunk.size() characters the whole chunk is consumed.
+  // Otherwise the result may be TranscodeStatus::kOutputFull, calling again
+  // with the unconsumed rest of the chunk continues where decoding stopped.
+  // A truncated sequence at the end of the chunk is consumed and kept, the
+  // result is never kNeedMoreInput. With ErrorPolicy::kStop nothing is
+  // decoded after the first invalid sequence, see failed().
+  TranscodeResult Feed(std::string_view chunk, char32_t* output,
+                       size_t output_size);
+
+  // Ends the stream, the pending bytes of a truncated sequence are invalid.
+  // `consumed` counts the pending bytes. With room for kMaxPendingBytes
+  // characters the result is never TranscodeStatus::kOutputFull.
+  TranscodeResult Finish(char32_t* output, size_t output_size);
+
+#if defined(__cpp_lib_span)
+  TranscodeResult Feed(std::string_view chunk, std::span<char32_t> output) {
+    return Feed(chunk, output.data(), output.size());
+  }
+
+  TranscodeResult Finish(std::span<char32_t> output) {
+    return Finish(output.data(), output.size());
+  }
+#endif
+
+  // Starts a new stream.
+  void Reset() {
+    pending_size_ = 0;
+    bytes_decoded_ = 0;
+    failed_ = false;
+  }
+
+  // True if decoding stopped at an invalid sequence, which can happen only
+  // with ErrorPolicy::kStop.
+  bool failed() const {
+    return failed_;
+  }
+
+  // Number of bytes decoded so far, not including the pending ones. After a
+  // failure it's the offset of the invalid sequence in the stream.
+  size_t bytes_decoded() const {
+    return bytes_decoded_;
+  }
+
+  // Number of bytes of a truncated sequence kept from the last chunk.
+  size_t pending_size() const {
+    return pending_size_;
+  }
+
+private:
+  ErrorPolicy policy_;
+  uint8_t pending_[kMaxPendingBytes] = {};
+  size_t pending_size_ = 0;
+  size_t bytes_decoded_ = 0;
+  bool failed_ = false;
+};
+
+// Random access to the characters of a UTF-8 string by their index. The byte
+// offset of every kStride-th character is kept, a lookup scans at most
+// kStride - 1 characters from one of them. Characters are counted the way
+// the decoders with ErrorPolicy::kReplace produce them, every invalid byte is
+// a character. The index refers to the string, which must outlive it.
+class Utf8CodePointIndex {
+public:
+  static constexpr size_t kStride = 128;
+
+  Utf8CodePointIndex() = default;
+  explicit Utf8CodePointIndex(std::string_view utf8_string);
+
+  // Number of characters.
+  size_t size() const {
+    return size_;
+  }
+
+  // Byte offset of the character, the size of the string for the indices
+  // starting at size().
+  size_t ByteOffset(size_t char_index) const;
+
+  // Index of the character the byte belongs to, size() for the offsets
+  // starting at the size of the string.
+  size_t CharIndex(size_t byte_offset) const;
+
+  // Up to `char_count` characters starting at `char_index`.
+  std::string_view Substr(size_t char_index,
+                          size_t char_count = std::string_view::npos) const;
+
+private:
+  // Checkpoints are grouped in blocks, so that their offsets relative to the
+  // block fit into 16 bits: kBlockCheckpoints * kStride characters take at
+  // most 4 times as many bytes.
+  static constexpr size_t kBlockCheckpoints = 32;
+
+  size_t Checkpoint(size_t checkpoint) const {
+    return block_offsets_[checkpoint / kBlockCheckpoints] +
+           checkpoint_offsets_[checkpoint];
+  }
+
+  // True if every character up to the next checkpoint is a single byte.
+  bool IsSingleByteBlock(size_t checkpoint) const;
+
+  std::string_view string_;
+  size_t size_ = 0;
+  std::vector<size_t> block_offsets_;
+  std::vector<uint16_t> checkpoint_offsets_;
+};
+
 template <class Result, class Wstring>
 Result Utf8Bytes(const Wstring& wstring,
                  ErrorPolicy policy = ErrorPolicy::kReplace,
                  size_t* chars_encoded = nullptr) {
+  using CharsIterator = decltype(wstring.begin());
+  using Char = typename std::iterator_traits<CharsIterator>::value_type;
+
   Result result;
-  size_t encoded = Utf8Encode(wstring.begin(), wstring.end(),
-                              std::back_inserter(result), policy);
+  size_t encoded = 0;
+  if constexpr (detail::IsContiguousIterator<CharsIterator>() &&
+                sizeof(Char) == 4 && detail::IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 1) {
+    size_t size =
+        static_cast<size_t>(std::distance(wstring.begin(), wstring.end()));
+    if (size > 0) {
+      const char32_t* chars = reinterpret_cast<const char32_t*>(
+          detail::IteratorAddress(wstring.begin()));
+      size_t length = Utf8LengthFromUtf32(std::u32string_view(chars, size));
+      detail::ResizeAndOverwrite(result, length, [&](auto* data) {
+        size_t written = 0;
+        encoded = detail::Utf8EncodeContiguous(
+            chars, size, reinterpret_cast<uint8_t*>(data), length, policy,
+            &written);
+        return written;
+      });
+    }
+  } else {
+    encoded = Utf8Encode(wstring.begin(), wstring.end(),
+                         std::back_inserter(result), policy);
+  }
 
   if (chars_encoded != nullptr) {
     *chars_encoded = encoded;
@@ -438,9 +999,31 @@ template <class Wstring, class BytesContainer>
 Wstring Utf8Wstring(const BytesContainer& bytes,
                     ErrorPolicy policy = ErrorPolicy::kReplace,
                     size_t* bytes_decoded = nullptr) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+  using Char = typename Wstring::value_type;
+
   Wstring result;
-  size_t decoded = Utf8Decode(bytes.begin(), bytes.end(),
-                              CheckedBackInserter(result), policy);
+  size_t decoded = 0;
+  if constexpr (detail::IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1 &&
+                (std::is_same_v<Char, char32_t> ||
+                 (std::is_same_v<Char, wchar_t> && WCHAR_MAX > 0xFFFF))) {
+    size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+    if (size > 0) {
+      detail::ResizeAndOverwrite(result, size, [&](auto* data) {
+        size_t written = 0;
+        decoded = detail::Utf8DecodeContiguous(
+            reinterpret_cast<const uint8_t*>(
+                detail::IteratorAddress(bytes.begin())),
+            size, data, policy, &written);
+        return written;
+      });
+    }
+  } else {
+    decoded = Utf8Decode(bytes.begin(), bytes.end(),
+                         CheckedBackInserter(result), policy);
+  }
   if (bytes_decoded != nullptr) {
     *bytes_decoded = decoded;
   }
@@ -0,0 +1,222 @@
+#include "utf8_utf16.h"
+
+#include "simd.h"
+
+#include <algorithm>
+
+namespace unicpp {
+namespace {
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool kBigEndianHost = true;
+#else
+constexpr bool kBigEndianHost = false;
+#endif
+
+uint8_t* StoreUtf16Character(char32_t ch, uint8_t* output, bool big_endian) {
+  if (ch <= 0xFFFF) {
+    detail::StoreUtf16Unit(static_cast<uint16_t>(ch), output, big_endian);
+    return output + 2;
+  }
+  uint32_t sur = ch - 0x10000;
+  detail::StoreUtf16Unit(static_cast<uint16_t>((sur >> 10) + 0xD800), output,
+                         big_endian);
+  detail::StoreUtf16Unit(static_cast<uint16_t>((sur & 0x3FF) + 0xDC00),
+                         output + 2, big_endian);
+  return output + 4;
+}
+
+// The kernels write past the end of their output, so they only get as much
+// input as they could transcode if there were no multibyte characters in it.
+// The scalar code never writes more than the whole output.
+
+size_t Utf8ToUtf16Impl(const uint8_t* bytes, size_t size, uint8_t* output,
+                       size_t output_size, bool big_endian, ErrorPolicy policy,
+                       size_t* bytes_written) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos < size) {
+    size_t room = (output_size - (out - output)) / 2;
+    detail::BlocksResult blocks = kernels.utf8_to_utf16_blocks(
+        bytes + pos, std::min(size - pos, room), out, big_endian, policy);
+    pos += blocks.read;
+    out += 2 * blocks.written;
+
+    char32_t buffer[detail::kScalarBlockSize];
+    char32_t* buffer_end = buffer;
+    pos += Utf8DecodeImpl<const uint8_t*, char32_t*,
+                          /*kCheckBoundaries = */ true>(
+        bytes + pos, bytes + size, buffer_end,
+        buffer + detail::kScalarBlockSize);
+    for (const char32_t* ch = buffer; ch != buffer_end; ++ch) {
+      out = StoreUtf16Character(*ch, out, big_endian);
+    }
+    if (pos == size || buffer_end == buffer + detail::kScalarBlockSize) {
+      continue;
+    }
+
+    if (policy == ErrorPolicy::kStop) {
+      break;
+    } else if (policy == ErrorPolicy::kReplace) {
+      out = StoreUtf16Character(kReplacementCharacter, out, big_endian);
+    }
+    ++pos;
+  }
+
+  *bytes_written = out - output;
+  return pos;
+}
+
+size_t Utf16ToUtf8Impl(const uint8_t* bytes, size_t size, bool big_endian,
+                       uint8_t* output, size_t output_size, ErrorPolicy policy,
+                       size_t* bytes_written) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos < size) {
+    size_t room = 2 * ((output_size - (out - output)) / 3);
+    detail::BlocksResult blocks = kernels.utf16_to_utf8_blocks(
+        bytes + pos, std::min(size - pos, room), big_endian, out);
+    pos += blocks.read;
+    out += blocks.written;
+
+    size_t end =
+        pos + std::min(2 * detail::kScalarBlockSize, (size - pos) & ~size_t{1});
+    if (detail::Utf16ToUtf8Scalar(bytes, size, pos, end, big_endian, out) &&
+        size - pos != 1) {
+      continue;
+    }
+
+    if (policy == ErrorPolicy::kStop) {
+      break;
+    } else if (policy == ErrorPolicy::kReplace) {
+      out += detail::StoreUtf8Character(kReplacementCharacter, out);
+    }
+    // skip a single code unit, or a trailing odd byte
+    pos += std::min<size_t>(2, size - pos);
+  }
+
+  *bytes_written = out - output;
+  return pos;
+}
+
+size_t Utf8LengthFromUtf16Impl(const uint8_t* bytes, size_t size,
+                               bool big_endian) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  size_t length = 0;
+  size_t pos = 0;
+  while (pos < size) {
+    detail::BlocksResult blocks =
+        kernels.utf8_length_from_utf16_blocks(bytes + pos, size - pos,
+                                              big_endian);
+    pos += blocks.read;
+    length += blocks.written;
+
+    size_t end =
+        pos + std::min(2 * detail::kScalarBlockSize, (size - pos) & ~size_t{1});
+    if (detail::Utf8LengthFromUtf16Scalar(bytes, size, pos, end, big_endian,
+                                          length) &&
+        size - pos != 1) {
+      continue;
+    }
+
+    // same as Utf16ToUtf8Impl() with ErrorPolicy::kReplace
+    length += 3;
+    pos += std::min<size_t>(2, size - pos);
+  }
+
+  return length;
+}
+
+}  // namespace
+
+size_t Utf16LengthFromUtf8(std::string_view utf8_string) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(utf8_string.data());
+  size_t size = utf8_string.size();
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  size_t length = 0;
+  size_t pos = 0;
+  while (pos < size) {
+    detail::BlocksResult blocks =
+        kernels.utf16_length_from_utf8_blocks(bytes + pos, size - pos);
+    pos += blocks.read;
+    length += blocks.written;
+
+    char32_t buffer[detail::kScalarBlockSize];
+    char32_t* buffer_end = buffer;
+    pos += Utf8DecodeImpl<const uint8_t*, char32_t*,
+                          /*kCheckBoundaries = */ true>(
+        bytes + pos, bytes + size, buffer_end,
+        buffer + detail::kScalarBlockSize);
+    for (const char32_t* ch = buffer; ch != buffer_end; ++ch) {
+      length += detail::Utf16CharacterLength(*ch);
+    }
+    if (pos == size || buffer_end == buffer + detail::kScalarBlockSize) {
+      continue;
+    }
+
+    // same as Utf8ToUtf16Impl() with ErrorPolicy::kReplace
+    length += 1;
+    ++pos;
+  }
+
+  return length;
+}
+
+size_t Utf8LengthFromUtf16(std::u16string_view utf16_string) {
+  return Utf8LengthFromUtf16Impl(
+      reinterpret_cast<const uint8_t*>(utf16_string.data()),
+      2 * utf16_string.size(), kBigEndianHost);
+}
+
+size_t Utf8LengthFromUtf16Le(std::string_view utf16_bytes) {
+  return Utf8LengthFromUtf16Impl(
+      reinterpret_cast<const uint8_t*>(utf16_bytes.data()), utf16_bytes.size(),
+      /*big_endian = */ false);
+}
+
+size_t Utf8LengthFromUtf16Be(std::string_view utf16_bytes) {
+  return Utf8LengthFromUtf16Impl(
+      reinterpret_cast<const uint8_t*>(utf16_bytes.data()), utf16_bytes.size(),
+      /*big_endian = */ true);
+}
+
+namespace detail {
+
+size_t Utf8ToUtf16Contiguous(const uint8_t* bytes, size_t size,
+                             uint8_t* output, size_t output_size,
+                             Endian endian, ErrorPolicy policy,
+                             size_t* bytes_written) {
+  return Utf8ToUtf16Impl(bytes, size, output, output_size,
+                         endian == Endian::kBig, policy, bytes_written);
+}
+
+size_t Utf8ToUtf16Contiguous(const uint8_t* bytes, size_t size,
+                             char16_t* output, size_t output_size,
+                             ErrorPolicy policy, size_t* units_written) {
+  size_t transcoded = Utf8ToUtf16Impl(
+      bytes, size, reinterpret_cast<uint8_t*>(output), 2 * output_size,
+      kBigEndianHost, policy, units_written);
+  *units_written /= 2;
+  return transcoded;
+}
+
+size_t Utf16ToUtf8Contiguous(const uint8_t* bytes, size_t size, Endian endian,
+                             uint8_t* output, size_t output_size,
+                             ErrorPolicy policy, size_t* bytes_written) {
+  return Utf16ToUtf8Impl(bytes, size, endian == Endian::kBig, output,
+                         output_size, policy, bytes_written);
+}
+
+size_t Utf16ToUtf8Contiguous(const char16_t* units, size_t size,
+                             uint8_t* output, size_t output_size,
+                             ErrorPolicy policy, size_t* bytes_written) {
+  return Utf16ToUtf8Impl(reinterpret_cast<const uint8_t*>(units), 2 * size,
+                         kBigEndianHost, output, output_size, policy,
+                         bytes_written) /
+         2;
+}
+
+}  // namespace detail
+}  // namespace unicpp
@@ -0,0 +1,361 @@
+#pragma once
+
+#include "utf16.h"
+#include "utf8.h"
+#include "utf_common.h"
+
+#include <iterator>
+#include <string_view>
+
+#include <stdint.h>
+
+namespace unicpp {
+
+// Direct UTF-8 <-> UTF-16 transcoding. Characters outside of the BMP are
+// written as surrogate pairs, nothing is buffered between the two encodings.
+// UTF-16 is either a sequence of bytes in little or big endian byte order, or
+// a sequence of native char16_t code units.
+
+namespace detail {
+
+// Output iterator accepting characters and writing them to the underlying
+// iterator as UTF-16 bytes in the given byte order, or as native char16_t code
+// units if EndianConstant is void.
+template <class OutputIterator, class EndianConstant>
+class Utf16EncodeOutputIterator {
+public:
+  constexpr explicit Utf16EncodeOutputIterator(OutputIterator output)
+      : output_(output) {}
+
+  constexpr Utf16EncodeOutputIterator& operator=(char32_t ch) {
+    if constexpr (std::is_void_v<EndianConstant>) {
+      if (ch <= 0xFFFF) {
+        *output_ = static_cast<char16_t>(ch);
+      } else {
+        uint32_t sur = ch - 0x10000;
+        *output_ = static_cast<char16_t>((sur >> 10) + 0xD800);
+        ++output_;
+        *output_ = static_cast<char16_t>((sur & 0x3FF) + 0xDC00);
+      }
+      ++output_;
+    } else {
+      output_ =
+          Utf16EncodeValidCharacter<OutputIterator, EndianConstant::value>(
+              ch, output_);
+    }
+    return *this;
+  }
+  constexpr Utf16EncodeOutputIterator& operator*() {
+    return *this;
+  }
+  constexpr Utf16EncodeOutputIterator& operator++() {
+    return *this;
+  }
+  constexpr Utf16EncodeOutputIterator operator++(int) {
+    return *this;
+  }
+
+private:
+  OutputIterator output_;
+};
+
+// Output iterator accepting characters and writing them to the underlying
+// iterator as UTF-8 bytes.
+template <class OutputIterator>
+class Utf8EncodeOutputIterator {
+public:
+  constexpr explicit Utf8EncodeOutputIterator(OutputIterator output)
+      : output_(output) {}
+
+  constexpr Utf8EncodeOutputIterator& operator=(char32_t ch) {
+    output_ = Utf8EncodeValidCharacter(ch, output_);
+    return *this;
+  }
+  constexpr Utf8EncodeOutputIterator& operator*() {
+    return *this;
+  }
+  constexpr Utf8EncodeOutputIterator& operator++() {
+    return *this;
+  }
+  constexpr Utf8EncodeOutputIterator operator++(int) {
+    return *this;
+  }
+
+private:
+  OutputIterator output_;
+};
+
+template <Endian kEndian>
+using EndianConstant = std::integral_constant<Endian, kEndian>;
+
+// Transcode contiguous input to `output` of `output_size` bytes (or units),
+// which must have room for the whole output, e.g. the length computed by
+// Utf16LengthFromUtf8() or Utf8LengthFromUtf16*(). Return the number of
+// transcoded input bytes (or units).
+size_t Utf8ToUtf16Contiguous(const uint8_t* bytes, size_t size,
+                             uint8_t* output, size_t output_size,
+                             Endian endian, ErrorPolicy policy,
+                             size_t* bytes_written);
+size_t Utf8ToUtf16Contiguous(const uint8_t* bytes, size_t size,
+                             char16_t* output, size_t output_size,
+                             ErrorPolicy policy, size_t* units_written);
+size_t Utf16ToUtf8Contiguous(const uint8_t* bytes, size_t size, Endian endian,
+                             uint8_t* output, size_t output_size,
+                             ErrorPolicy policy, size_t* bytes_written);
+size_t Utf16ToUtf8Contiguous(const char16_t* units, size_t size,
+                             uint8_t* output, size_t output_size,
+                             ErrorPolicy policy, size_t* bytes_written);
+
+}  // namespace detail
+
+// Transcodes UTF-8 bytes to UTF-16 bytes in the given byte order. Returns the
+// number of transcoded input bytes.
+template <class BytesIterator, class OutputIterator,
+          Endian kEndian = Endian::kLittle>
+constexpr size_t Utf8ToUtf16Bytes(BytesIterator bytes_beg,
+                                  BytesIterator bytes_end,
+                                  OutputIterator output, ErrorPolicy policy) {
+  return Utf8Decode(
+      bytes_beg, bytes_end,
+      detail::Utf16EncodeOutputIterator<OutputIterator,
+                                        detail::EndianConstant<kEndian>>(output),
+      policy);
+}
+
+template <class BytesIterator, class OutputIterator>
+constexpr size_t Utf8ToUtf16Le(BytesIterator bytes_beg, BytesIterator bytes_end,
+                               OutputIterator output, ErrorPolicy policy) {
+  return Utf8ToUtf16Bytes<BytesIterator, OutputIterator, Endian::kLittle>(
+      bytes_beg, bytes_end, output, policy);
+}
+
+template <class BytesIterator, class OutputIterator>
+constexpr size_t Utf8ToUtf16Be(BytesIterator bytes_beg, BytesIterator bytes_end,
+                               OutputIterator output, ErrorPolicy policy) {
+  return Utf8ToUtf16Bytes<BytesIterator, OutputIterator, Endian::kBig>(
+      bytes_beg, bytes_end, output, policy);
+}
+
+// Transcodes UTF-8 bytes to native char16_t code units.
+template <class BytesIterator, class OutputIterator>
+constexpr size_t Utf8ToUtf16(BytesIterator bytes_beg, BytesIterator bytes_end,
+                             OutputIterator output, ErrorPolicy policy) {
+  return Utf8Decode(
+      bytes_beg, bytes_end,
+      detail::Utf16EncodeOutputIterator<OutputIterator, void>(output), policy);
+}
+
+// Transcodes UTF-16 to UTF-8 bytes. Input of 2-byte values is read as native
+// code units, otherwise as bytes in the given byte order. Returns the number
+// of transcoded input values.
+template <class Utf16Iterator, class OutputIterator,
+          Endian kEndian = Endian::kLittle>
+constexpr size_t Utf16ToUtf8(Utf16Iterator input_beg, Utf16Iterator input_end,
+                             OutputIterator output, ErrorPolicy policy) {
+  return Utf16Decode<Utf16Iterator,
+                     detail::Utf8EncodeOutputIterator<OutputIterator>,
+                     kEndian>(
+      input_beg, input_end,
+      detail::Utf8EncodeOutputIterator<OutputIterator>(output), policy);
+}
+
+template <class BytesIterator, class OutputIterator>
+constexpr size_t Utf16LeToUtf8(BytesIterator bytes_beg, BytesIterator bytes_end,
+                               OutputIterator output, ErrorPolicy policy) {
+  return Utf16ToUtf8<BytesIterator, OutputIterator, Endian::kLittle>(
+      bytes_beg, bytes_end, output, policy);
+}
+
+template <class BytesIterator, class OutputIterator>
+constexpr size_t Utf16BeToUtf8(BytesIterator bytes_beg, BytesIterator bytes_end,
+                               OutputIterator output, ErrorPolicy policy) {
+  return Utf16ToUtf8<BytesIterator, OutputIterator, Endian::kBig>(
+      bytes_beg, bytes_end, output, policy);
+}
+
+// Return the length of the output of transcoding with invalid sequences
+// replaced, which is the upper bound for the other error policies: the number
+// of UTF-16 code units, or the number of UTF-8 bytes.
+size_t Utf16LengthFromUtf8(std::string_view utf8_string);
+size_t Utf8LengthFromUtf16(std::u16string_view utf16_string);
+size_t Utf8LengthFromUtf16Le(std::string_view utf16_bytes);
+size_t Utf8LengthFromUtf16Be(std::string_view utf16_bytes);
+
+namespace detail {
+
+// Returns `size` bytes starting from the first element of `container`.
+template <class Container>
+std::string_view BytesView(const Container& container, size_t size) {
+  return std::string_view(
+      reinterpret_cast<const char*>(IteratorAddress(container.begin())), size);
+}
+
+template <Endian kEndian, class Result, class BytesContainer>
+Result Utf16BytesFromUtf8(const BytesContainer& bytes, ErrorPolicy policy,
+                          size_t* bytes_transcoded) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+
+  Result result;
+  size_t transcoded = 0;
+  if constexpr (IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1 && IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 1) {
+    size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+    if (size > 0) {
+      std::string_view input = BytesView(bytes, size);
+      size_t length = 2 * Utf16LengthFromUtf8(input);
+      ResizeAndOverwrite(result, length, [&](auto* data) {
+        size_t written = 0;
+        transcoded = Utf8ToUtf16Contiguous(
+            reinterpret_cast<const uint8_t*>(input.data()), size,
+            reinterpret_cast<uint8_t*>(data), length, kEndian, policy,
+            &written);
+        return written;
+      });
+    }
+  } else {
+    transcoded = Utf8ToUtf16Bytes<BytesIterator,
+                                  std::back_insert_iterator<Result>, kEndian>(
+        bytes.begin(), bytes.end(), std::back_inserter(result), policy);
+  }
+  if (bytes_transcoded != nullptr) {
+    *bytes_transcoded = transcoded;
+  }
+
+  return result;
+}
+
+template <Endian kEndian, class Result, class Utf16Container>
+Result Utf8BytesFromUtf16(const Utf16Container& input, ErrorPolicy policy,
+                          size_t* values_transcoded) {
+  using Utf16Iterator = decltype(input.begin());
+  using Value = typename std::iterator_traits<Utf16Iterator>::value_type;
+
+  Result result;
+  size_t transcoded = 0;
+  if constexpr (IsContiguousIterator<Utf16Iterator>() &&
+                (sizeof(Value) == 1 || sizeof(Value) == 2) &&
+                IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 1) {
+    size_t size = static_cast<size_t>(std::distance(input.begin(), input.end()));
+    if (size > 0) {
+      std::string_view bytes = BytesView(input, sizeof(Value) * size);
+      size_t length = 0;
+      if constexpr (sizeof(Value) == 2) {
+        length = Utf8LengthFromUtf16(std::u16string_view(
+            reinterpret_cast<const char16_t*>(bytes.data()), size));
+      } else if constexpr (kEndian == Endian::kLittle) {
+        length = Utf8LengthFromUtf16Le(bytes);
+      } else {
+        length = Utf8LengthFromUtf16Be(bytes);
+      }
+
+      ResizeAndOverwrite(result, length, [&](auto* data) {
+        size_t written = 0;
+        if constexpr (sizeof(Value) == 2) {
+          transcoded = Utf16ToUtf8Contiguous(
+              reinterpret_cast<const char16_t*>(bytes.data()), size,
+              reinterpret_cast<uint8_t*>(data), length, policy, &written);
+        } else {
+          transcoded = Utf16ToUtf8Contiguous(
+              reinterpret_cast<const uint8_t*>(bytes.data()), size, kEndian,
+              reinterpret_cast<uint8_t*>(data), length, policy, &written);
+        }
+        return written;
+      });
+    }
+  } else {
+    transcoded =
+        Utf16ToUtf8<Utf16Iterator, std::back_insert_iterator<Result>, kEndian>(
+            input.begin(), input.end(), std::back_inserter(result), policy);
+  }
+  if (values_transcoded != nullptr) {
+    *values_transcoded = transcoded;
+  }
+
+  return result;
+}
+
+}  // namespace detail
+
+template <class Result, class BytesContainer>
+Result Utf16LeBytesFromUtf8(const BytesContainer& bytes,
+                            ErrorPolicy policy = ErrorPolicy::kReplace,
+                            size_t* bytes_transcoded = nullptr) {
+  return detail::Utf16BytesFromUtf8<Endian::kLittle, Result>(bytes, policy,
+                                                            bytes_transcoded);
+}
+
+template <class Result, class BytesContainer>
+Result Utf16BeBytesFromUtf8(const BytesContainer& bytes,
+                            ErrorPolicy policy = ErrorPolicy::kReplace,
+                            size_t* bytes_transcoded = nullptr) {
+  return detail::Utf16BytesFromUtf8<Endian::kBig, Result>(bytes, policy,
+                                                         bytes_transcoded);
+}
+
+// Result is a container of char16_t, e.g. std::u16string.
+template <class Result, class BytesContainer>
+Result Utf16StringFromUtf8(const BytesContainer& bytes,
+                           ErrorPolicy policy = ErrorPolicy::kReplace,
+                           size_t* bytes_transcoded = nullptr) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+
+  Result result;
+  size_t transcoded = 0;
+  if constexpr (detail::IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1 &&
+                detail::IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 2) {
+    size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+    if (size > 0) {
+      std::string_view input = detail::BytesView(bytes, size);
+      size_t length = Utf16LengthFromUtf8(input);
+      detail::ResizeAndOverwrite(result, length, [&](auto* data) {
+        size_t written = 0;
+        transcoded = detail::Utf8ToUtf16Contiguous(
+            reinterpret_cast<const uint8_t*>(input.data()), size,
+            reinterpret_cast<char16_t*>(data), length, policy, &written);
+        return written;
+      });
+    }
+  } else {
+    transcoded = Utf8ToUtf16(bytes.begin(), bytes.end(),
+                             std::back_inserter(result), policy);
+  }
+  if (bytes_transcoded != nullptr) {
+    *bytes_transcoded = transcoded;
+  }
+
+  return result;
+}
+
+template <class Result, class BytesContainer>
+Result Utf8BytesFromUtf16Le(const BytesContainer& bytes,
+                            ErrorPolicy policy = ErrorPolicy::kReplace,
+                            size_t* bytes_transcoded = nullptr) {
+  return detail::Utf8BytesFromUtf16<Endian::kLittle, Result>(bytes, policy,
+                                                            bytes_transcoded);
+}
+
+template <class Result, class BytesContainer>
+Result Utf8BytesFromUtf16Be(const BytesContainer& bytes,
+                            ErrorPolicy policy = ErrorPolicy::kReplace,
+                            size_t* bytes_transcoded = nullptr) {
+  return detail::Utf8BytesFromUtf16<Endian::kBig, Result>(bytes, policy,
+                                                         bytes_transcoded);
+}
+
+// Utf16String is a container of char16_t, e.g. std::u16string.
+template <class Result, class Utf16String>
+Result Utf8BytesFromUtf16(const Utf16String& utf16_string,
+                          ErrorPolicy policy = ErrorPolicy::kReplace,
+                          size_t* units_transcoded = nullptr) {
+  static_assert(sizeof(typename Utf16String::value_type) == 2);
+  return detail::Utf8BytesFromUtf16<Endian::kLittle, Result>(
+      utf16_string, policy, units_transcoded);
+}
+
+}  // namespace unicpp
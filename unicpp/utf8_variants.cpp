@@ -0,0 +1,196 @@
+#include "utf8_variants.h"
+
+#include "simd.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace unicpp {
+namespace {
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool kBigEndianHost = true;
+#else
+constexpr bool kBigEndianHost = false;
+#endif
+
+// Calls `function` with `variant` as a std::integral_constant.
+template <class Function>
+size_t WithVariant(Utf8Variant variant, Function function) {
+  switch (variant) {
+    case Utf8Variant::kWtf8:
+      return function(
+          std::integral_constant<Utf8Variant, Utf8Variant::kWtf8>());
+    case Utf8Variant::kCesu8:
+      return function(
+          std::integral_constant<Utf8Variant, Utf8Variant::kCesu8>());
+    case Utf8Variant::kModifiedUtf8:
+      break;
+  }
+  return function(
+      std::integral_constant<Utf8Variant, Utf8Variant::kModifiedUtf8>());
+}
+
+// Char is char32_t for characters or char16_t for native UTF-16.
+template <Utf8Variant kVariant, class Char>
+size_t Utf8VariantDecodeImpl(const uint8_t* bytes, size_t size, Char* output,
+                             ErrorPolicy policy, size_t* values_written) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  const uint8_t* iter = bytes;
+  const uint8_t* end = bytes + size;
+  Char* out = output;
+  while (iter != end) {
+    detail::BlocksResult blocks;
+    if constexpr (sizeof(Char) == 4) {
+      blocks = kernels.utf8_variant_to_utf32_blocks(iter, end - iter, kVariant,
+                                                    out);
+    } else {
+      blocks = kernels.utf8_variant_to_utf16_blocks(
+          iter, end - iter, kVariant, reinterpret_cast<uint8_t*>(out),
+          kBigEndianHost);
+    }
+    iter += blocks.read;
+    out += blocks.written;
+
+    const uint8_t* scalar_end =
+        iter + std::min<size_t>(detail::kScalarBlockSize, end - iter);
+    while (iter < scalar_end) {
+      const uint8_t* start = iter;
+      char32_t ch = detail::Utf8VariantDecodeCharacter<kVariant>(iter, end);
+      if (ch == kInvalidCharacter) {
+        if (policy == ErrorPolicy::kStop) {
+          *values_written = out - output;
+          return start - bytes;
+        } else if (policy == ErrorPolicy::kSkip) {
+          continue;
+        }
+        ch = kReplacementCharacter;
+      }
+      if (sizeof(Char) == 2 && ch > 0xFFFF) {
+        uint32_t sur = ch - 0x10000;
+        *out++ = static_cast<Char>((sur >> 10) + 0xD800);
+        *out++ = static_cast<Char>((sur & 0x3FF) + 0xDC00);
+      } else {
+        *out++ = static_cast<Char>(ch);
+      }
+    }
+  }
+
+  *values_written = out - output;
+  return size;
+}
+
+template <Utf8Variant kVariant>
+size_t Utf8VariantEncodeImpl(const char32_t* chars, size_t size,
+                             uint8_t* output, size_t output_size,
+                             ErrorPolicy policy, size_t* bytes_written) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  const char32_t* iter = chars;
+  const char32_t* end = chars + size;
+  uint8_t* out = output;
+  while (iter != end) {
+    // characters other than surrogates are encoded in WTF-8 as in UTF-8,
+    // CESU-8 and Modified UTF-8 have no kernels
+    if constexpr (kVariant == Utf8Variant::kWtf8) {
+      size_t room = (output_size - (out - output)) / 4;
+      detail::BlocksResult blocks = kernels.utf32_to_utf8_blocks(
+          iter, std::min<size_t>(end - iter, room), out);
+      iter += blocks.read;
+      out += blocks.written;
+    }
+
+    const char32_t* scalar_end =
+        iter + std::min<size_t>(detail::kScalarBlockSize, end - iter);
+    while (iter < scalar_end) {
+      const char32_t* start = iter;
+      if (detail::Utf8VariantEncodeCharacter<kVariant>(iter, end, out)) {
+        continue;
+      }
+      if (policy == ErrorPolicy::kStop) {
+        *bytes_written = out - output;
+        return start - chars;
+      } else if (policy == ErrorPolicy::kReplace) {
+        out += detail::StoreUtf8Character(kReplacementCharacter, out);
+      }
+    }
+  }
+
+  *bytes_written = out - output;
+  return size;
+}
+
+size_t Utf16ToUtf8VariantImpl(Utf8Variant variant, const uint8_t* bytes,
+                              size_t size, uint8_t* output, size_t output_size,
+                              ErrorPolicy policy, size_t* bytes_written) {
+  const detail::Kernels& kernels = detail::ActiveKernels();
+  uint8_t* out = output;
+  size_t pos = 0;
+  while (pos < size) {
+    size_t room = 2 * ((output_size - (out - output)) / 3);
+    detail::BlocksResult blocks = kernels.utf16_to_utf8_variant_blocks(
+        bytes + pos, std::min(size - pos, room), kBigEndianHost, variant, out);
+    pos += blocks.read;
+    out += blocks.written;
+
+    size_t end = pos + std::min(2 * detail::kScalarBlockSize, size - pos);
+    if (detail::Utf16ToUtf8VariantScalar(bytes, size, pos, end, kBigEndianHost,
+                                         variant, out)) {
+      continue;
+    }
+
+    if (policy == ErrorPolicy::kStop) {
+      break;
+    } else if (policy == ErrorPolicy::kReplace) {
+      out += detail::StoreUtf8Character(kReplacementCharacter, out);
+    }
+    pos += 2;
+  }
+
+  *bytes_written = out - output;
+  return pos;
+}
+
+}  // namespace
+
+namespace detail {
+
+size_t Utf8VariantDecodeContiguous(Utf8Variant variant, const uint8_t* bytes,
+                                   size_t size, char32_t* output,
+                                   ErrorPolicy policy, size_t* chars_written) {
+  return WithVariant(variant, [&](auto constant) {
+    return Utf8VariantDecodeImpl<decltype(constant)::value>(
+        bytes, size, output, policy, chars_written);
+  });
+}
+
+size_t Utf8VariantToUtf16Contiguous(Utf8Variant variant, const uint8_t* bytes,
+                                    size_t size, char16_t* output,
+                                    ErrorPolicy policy, size_t* units_written) {
+  return WithVariant(variant, [&](auto constant) {
+    return Utf8VariantDecodeImpl<decltype(constant)::value>(
+        bytes, size, output, policy, units_written);
+  });
+}
+
+size_t Utf8VariantEncodeContiguous(Utf8Variant variant, const char32_t* chars,
+                                   size_t size, uint8_t* output,
+                                   size_t output_size, ErrorPolicy policy,
+                                   size_t* bytes_written) {
+  return WithVariant(variant, [&](auto constant) {
+    return Utf8VariantEncodeImpl<decltype(constant)::value>(
+        chars, size, output, output_size, policy, bytes_written);
+  });
+}
+
+size_t Utf16ToUtf8VariantContiguous(Utf8Variant variant, const char16_t* units,
+                                    size_t size, uint8_t* output,
+                                    size_t output_size, ErrorPolicy policy,
+                                    size_t* bytes_written) {
+  return Utf16ToUtf8VariantImpl(variant, reinterpret_cast<const uint8_t*>(units),
+                                2 * size, output, output_size, policy,
+                                bytes_written) /
+         2;
+}
+
+}  // namespace detail
+}  // namespace unicpp
@@ -0,0 +1,489 @@
+#pragma once
+
+#include "utf8.h"
+#include "utf8_utf16.h"
+#include "utf_common.h"
+
+#include <iterator>
+#include <type_traits>
+
+#include <stdint.h>
+
+namespace unicpp {
+
+// WTF-8, CESU-8 and Modified UTF-8, the encodings derived from UTF-8 which
+// encode UTF-16 surrogates as 3-byte sequences, so that UTF-16 with unpaired
+// surrogates, e.g. JavaScript or Java strings, round-trips through them.
+//
+// * WTF-8 is UTF-8 with unpaired surrogates. A surrogate pair is always
+//   encoded as its character, a lead surrogate followed by a trail one is
+//   invalid.
+// * CESU-8 encodes every UTF-16 code unit as a sequence of its own, a
+//   supplementary character as the two 3-byte sequences of its surrogates.
+//   4-byte sequences and unpaired surrogates are invalid.
+// * Modified UTF-8, used by Java serialization and JNI, is CESU-8 with
+//   unpaired surrogates and U+0000 encoded as C0 80, so zero bytes are
+//   invalid.
+//
+// Unpaired surrogates are decoded as characters of the same value and
+// encoded back as such, they are errors in CESU-8 only. Invalid sequences are
+// handled by the ErrorPolicy byte by byte as in Utf8Decode().
+
+namespace detail {
+
+// Decodes the sequence at `iter` the same way as Utf8DecodeCharacter(), but
+// with the sequences of the variant. Surrogates are decoded one at a time.
+template <Utf8Variant kVariant, class BytesIterator>
+constexpr char32_t Utf8VariantDecodeSequence(BytesIterator& iter,
+                                             const BytesIterator& end) {
+  constexpr bool kModified = kVariant == Utf8Variant::kModifiedUtf8;
+
+  uint8_t lead = static_cast<uint8_t>(*iter);
+  ++iter;
+  if (lead <= 0x7F) {
+    return kModified && lead == 0 ? kInvalidCharacter : lead;
+  }
+  size_t length = kModified && lead == 0xC0 ? 2 : Utf8SequenceLength(lead);
+  if (length == 1 || (length == 4 && kVariant != Utf8Variant::kWtf8)) {
+    return kInvalidCharacter;
+  }
+
+  uint8_t min_second = lead == 0xE0 ? 0xA0 : lead == 0xF0 ? 0x90 : 0x80;
+  uint8_t max_second = lead == 0xC0 ? 0x80 : lead == 0xF4 ? 0x8F : 0xBF;
+  char32_t ch = lead & (0x7F >> length);
+  BytesIterator pos = iter;
+  for (size_t i = 1; i < length; i++, ++pos) {
+    if (pos == end) {
+      return kInvalidCharacter;
+    }
+    uint8_t byte = static_cast<uint8_t>(*pos);
+    if (i == 1 ? byte < min_second || byte > max_second
+               : !IsContinuationByte(byte)) {
+      return kInvalidCharacter;
+    }
+    ch = (ch << 6) | (byte & 0x3F);
+  }
+  iter = pos;
+  return ch;
+}
+
+// Decodes the character at `iter` advancing `iter` past it, see
+// Utf8DecodeCharacter(). A CESU-8 or Modified UTF-8 surrogate pair is decoded
+// as its character.
+template <Utf8Variant kVariant, class BytesIterator>
+constexpr char32_t Utf8VariantDecodeCharacter(BytesIterator& iter,
+                                              const BytesIterator& end) {
+  BytesIterator next = iter;
+  char32_t ch = Utf8VariantDecodeSequence<kVariant>(next, end);
+  if (!IsSurrogate(ch)) {
+    iter = next;
+    return ch;
+  }
+
+  if (ch <= 0xDBFF && next != end) {
+    BytesIterator after = next;
+    char32_t trail = Utf8VariantDecodeSequence<kVariant>(after, end);
+    if (trail >= 0xDC00 && trail <= 0xDFFF) {
+      if constexpr (kVariant == Utf8Variant::kWtf8) {
+        ++iter;
+        return kInvalidCharacter;
+      } else {
+        iter = after;
+        return 0x10000 + (((ch - 0xD800) << 10) | (trail - 0xDC00));
+      }
+    }
+  }
+  if constexpr (kVariant == Utf8Variant::kCesu8) {
+    ++iter;
+    return kInvalidCharacter;
+  }
+  iter = next;
+  return ch;
+}
+
+// Encodes a UTF-16 code unit as a sequence of its own.
+template <Utf8Variant kVariant, class OutputIterator>
+constexpr OutputIterator Utf8VariantEncodeUnit(char32_t unit,
+                                               OutputIterator output) {
+  if (kVariant == Utf8Variant::kModifiedUtf8 && unit == 0) {
+    *output = uint8_t{0xC0};
+    ++output;
+    *output = uint8_t{0x80};
+    return ++output;
+  }
+  return Utf8EncodeValidCharacter(unit, output);
+}
+
+// Encodes the character at `iter` advancing `iter` past it, or past both
+// surrogates of a pair, which WTF-8 encodes as their character. Returns false
+// if the character isn't representable: above U+10FFFF, or a surrogate in
+// CESU-8.
+template <Utf8Variant kVariant, class CharsIterator, class OutputIterator>
+constexpr bool Utf8VariantEncodeCharacter(CharsIterator& iter,
+                                          const CharsIterator& end,
+                                          OutputIterator& output) {
+  char32_t ch = *iter;
+  ++iter;
+  if (ch > kMaxValidCharacter ||
+      (kVariant == Utf8Variant::kCesu8 && IsSurrogate(ch))) {
+    return false;
+  }
+
+  if constexpr (kVariant == Utf8Variant::kWtf8) {
+    if (ch >= 0xD800 && ch <= 0xDBFF && iter != end) {
+      char32_t trail = *iter;
+      if (trail >= 0xDC00 && trail <= 0xDFFF) {
+        ++iter;
+        ch = 0x10000 + (((ch - 0xD800) << 10) | (trail - 0xDC00));
+      }
+    }
+    output = Utf8EncodeValidCharacter(ch, output);
+  } else if (ch > 0xFFFF) {
+    uint32_t sur = ch - 0x10000;
+    output = Utf8VariantEncodeUnit<kVariant>((sur >> 10) + 0xD800, output);
+    output = Utf8VariantEncodeUnit<kVariant>((sur & 0x3FF) + 0xDC00, output);
+  } else {
+    output = Utf8VariantEncodeUnit<kVariant>(ch, output);
+  }
+  return true;
+}
+
+// Same as Utf8VariantEncodeCharacter() for a UTF-16 code unit at `iter`.
+// Returns false on an unpaired surrogate in CESU-8.
+template <Utf8Variant kVariant, class Utf16Iterator, class OutputIterator>
+constexpr bool Utf16ToUtf8VariantCharacter(Utf16Iterator& iter,
+                                           const Utf16Iterator& end,
+                                           OutputIterator& output) {
+  char32_t unit = static_cast<char16_t>(*iter);
+  ++iter;
+  if (unit >= 0xD800 && unit <= 0xDBFF && iter != end) {
+    char32_t trail = static_cast<char16_t>(*iter);
+    if (trail >= 0xDC00 && trail <= 0xDFFF) {
+      ++iter;
+      if constexpr (kVariant == Utf8Variant::kWtf8) {
+        output = Utf8EncodeValidCharacter(
+            0x10000 + (((unit - 0xD800) << 10) | (trail - 0xDC00)), output);
+      } else {
+        output = Utf8VariantEncodeUnit<kVariant>(unit, output);
+        output = Utf8VariantEncodeUnit<kVariant>(trail, output);
+      }
+      return true;
+    }
+  }
+  if (kVariant == Utf8Variant::kCesu8 && IsSurrogate(unit)) {
+    return false;
+  }
+  output = Utf8VariantEncodeUnit<kVariant>(unit, output);
+  return true;
+}
+
+}  // namespace detail
+
+// Decodes the bytes of a UTF-8 variant to characters, unpaired surrogates
+// included. Needs forward iterators. Returns the number of decoded bytes.
+template <Utf8Variant kVariant, class BytesIterator, class OutputIterator>
+constexpr size_t Utf8VariantDecode(BytesIterator bytes_beg,
+                                   BytesIterator bytes_end,
+                                   OutputIterator output, ErrorPolicy policy) {
+  size_t decoded = 0;
+  BytesIterator iter = bytes_beg;
+  while (iter != bytes_end) {
+    BytesIterator next = iter;
+    char32_t ch = detail::Utf8VariantDecodeCharacter<kVariant>(next, bytes_end);
+    if (ch != kInvalidCharacter) {
+      *output = ch;
+      ++output;
+    } else if (policy == ErrorPolicy::kStop) {
+      break;
+    } else if (policy == ErrorPolicy::kReplace) {
+      *output = kReplacementCharacter;
+      ++output;
+    }
+    decoded += static_cast<size_t>(std::distance(iter, next));
+    iter = next;
+  }
+  return decoded;
+}
+
+// Encodes characters, unpaired surrogates included, in a UTF-8 variant.
+// Returns the number of encoded characters.
+template <Utf8Variant kVariant, class CharsIterator, class OutputIterator>
+constexpr size_t Utf8VariantEncode(CharsIterator input_beg,
+                                   CharsIterator input_end,
+                                   OutputIterator output, ErrorPolicy policy) {
+  size_t encoded = 0;
+  CharsIterator iter = input_beg;
+  while (iter != input_end) {
+    CharsIterator next = iter;
+    if (!detail::Utf8VariantEncodeCharacter<kVariant>(next, input_end,
+                                                      output)) {
+      if (policy == ErrorPolicy::kStop) {
+        break;
+      } else if (policy == ErrorPolicy::kReplace) {
+        output = Utf8EncodeValidCharacter(kReplacementCharacter, output);
+      }
+    }
+    encoded += static_cast<size_t>(std::distance(iter, next));
+    iter = next;
+  }
+  return encoded;
+}
+
+// Transcodes the bytes of a UTF-8 variant to native char16_t code units. An
+// unpaired surrogate becomes a single code unit. Needs forward iterators.
+// Returns the number of transcoded bytes.
+template <Utf8Variant kVariant, class BytesIterator, class OutputIterator>
+constexpr size_t Utf8VariantToUtf16(BytesIterator bytes_beg,
+                                    BytesIterator bytes_end,
+                                    OutputIterator output, ErrorPolicy policy) {
+  return Utf8VariantDecode<kVariant>(
+      bytes_beg, bytes_end,
+      detail::Utf16EncodeOutputIterator<OutputIterator, void>(output), policy);
+}
+
+// Transcodes native char16_t code units to a UTF-8 variant. Returns the
+// number of transcoded code units.
+template <Utf8Variant kVariant, class Utf16Iterator, class OutputIterator>
+constexpr size_t Utf16ToUtf8Variant(Utf16Iterator input_beg,
+                                    Utf16Iterator input_end,
+                                    OutputIterator output, ErrorPolicy policy) {
+  static_assert(
+      sizeof(typename std::iterator_traits<Utf16Iterator>::value_type) == 2);
+
+  size_t transcoded = 0;
+  Utf16Iterator iter = input_beg;
+  while (iter != input_end) {
+    Utf16Iterator next = iter;
+    if (!detail::Utf16ToUtf8VariantCharacter<kVariant>(next, input_end,
+                                                       output)) {
+      if (policy == ErrorPolicy::kStop) {
+        break;
+      } else if (policy == ErrorPolicy::kReplace) {
+        output = Utf8EncodeValidCharacter(kReplacementCharacter, output);
+      }
+    }
+    transcoded += static_cast<size_t>(std::distance(iter, next));
+    iter = next;
+  }
+  return transcoded;
+}
+
+namespace detail {
+
+// Transcode contiguous input to `output`, which must have room for the whole
+// output: a character (or code unit) per input byte, 3 bytes per input code
+// unit, 4 bytes per input character in WTF-8 and 6 in the other variants.
+// Return the number of transcoded input bytes (or units, or characters).
+size_t Utf8VariantDecodeContiguous(Utf8Variant variant, const uint8_t* bytes,
+                                   size_t size, char32_t* output,
+                                   ErrorPolicy policy, size_t* chars_written);
+size_t Utf8VariantToUtf16Contiguous(Utf8Variant variant, const uint8_t* bytes,
+                                    size_t size, char16_t* output,
+                                    ErrorPolicy policy, size_t* units_written);
+size_t Utf8VariantEncodeContiguous(Utf8Variant variant, const char32_t* chars,
+                                   size_t size, uint8_t* output,
+                                   size_t output_size, ErrorPolicy policy,
+                                   size_t* bytes_written);
+size_t Utf16ToUtf8VariantContiguous(Utf8Variant variant, const char16_t* units,
+                                    size_t size, uint8_t* output,
+                                    size_t output_size, ErrorPolicy policy,
+                                    size_t* bytes_written);
+
+}  // namespace detail
+
+template <Utf8Variant kVariant, class Result, class Wstring>
+Result Utf8VariantBytes(const Wstring& wstring,
+                        ErrorPolicy policy = ErrorPolicy::kReplace,
+                        size_t* chars_encoded = nullptr) {
+  using CharsIterator = decltype(wstring.begin());
+  using Char = typename std::iterator_traits<CharsIterator>::value_type;
+
+  Result result;
+  size_t encoded = 0;
+  if constexpr (detail::IsContiguousIterator<CharsIterator>() &&
+                sizeof(Char) == 4 && detail::IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 1) {
+    size_t size =
+        static_cast<size_t>(std::distance(wstring.begin(), wstring.end()));
+    if (size > 0) {
+      size_t length = (kVariant == Utf8Variant::kWtf8 ? 4 : 6) * size;
+      detail::ResizeAndOverwrite(result, length, [&](auto* data) {
+        size_t written = 0;
+        encoded = detail::Utf8VariantEncodeContiguous(
+            kVariant,
+            reinterpret_cast<const char32_t*>(
+                detail::IteratorAddress(wstring.begin())),
+            size, reinterpret_cast<uint8_t*>(data), length, policy, &written);
+        return written;
+      });
+    }
+  } else {
+    encoded = Utf8VariantEncode<kVariant>(wstring.begin(), wstring.end(),
+                                          std::back_inserter(result), policy);
+  }
+  if (chars_encoded != nullptr) {
+    *chars_encoded = encoded;
+  }
+
+  return result;
+}
+
+template <Utf8Variant kVariant, class Wstring, class BytesContainer>
+Wstring Utf8VariantWstring(const BytesContainer& bytes,
+                           ErrorPolicy policy = ErrorPolicy::kReplace,
+                           size_t* bytes_decoded = nullptr) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+
+  Wstring result;
+  size_t decoded = 0;
+  if constexpr (detail::IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1 &&
+                std::is_same_v<typename Wstring::value_type, char32_t>) {
+    size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+    if (size > 0) {
+      detail::ResizeAndOverwrite(result, size, [&](auto* data) {
+        size_t written = 0;
+        decoded = detail::Utf8VariantDecodeContiguous(
+            kVariant,
+            reinterpret_cast<const uint8_t*>(
+                detail::IteratorAddress(bytes.begin())),
+            size, data, policy, &written);
+        return written;
+      });
+    }
+  } else {
+    decoded = Utf8VariantDecode<kVariant>(bytes.begin(), bytes.end(),
+                                          CheckedBackInserter(result), policy);
+  }
+  if (bytes_decoded != nullptr) {
+    *bytes_decoded = decoded;
+  }
+
+  return result;
+}
+
+// Result is a container of char16_t, e.g. std::u16string.
+template <Utf8Variant kVariant, class Result, class BytesContainer>
+Result Utf16StringFromUtf8Variant(const BytesContainer& bytes,
+                                  ErrorPolicy policy = ErrorPolicy::kReplace,
+                                  size_t* bytes_transcoded = nullptr) {
+  using BytesIterator = decltype(bytes.begin());
+  using ByteType = typename std::iterator_traits<BytesIterator>::value_type;
+
+  Result result;
+  size_t transcoded = 0;
+  if constexpr (detail::IsContiguousIterator<BytesIterator>() &&
+                sizeof(ByteType) == 1 &&
+                detail::IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 2) {
+    size_t size = static_cast<size_t>(std::distance(bytes.begin(), bytes.end()));
+    if (size > 0) {
+      detail::ResizeAndOverwrite(result, size, [&](auto* data) {
+        size_t written = 0;
+        transcoded = detail::Utf8VariantToUtf16Contiguous(
+            kVariant,
+            reinterpret_cast<const uint8_t*>(
+                detail::IteratorAddress(bytes.begin())),
+            size, reinterpret_cast<char16_t*>(data), policy, &written);
+        return written;
+      });
+    }
+  } else {
+    transcoded = Utf8VariantToUtf16<kVariant>(
+        bytes.begin(), bytes.end(), std::back_inserter(result), policy);
+  }
+  if (bytes_transcoded != nullptr) {
+    *bytes_transcoded = transcoded;
+  }
+
+  return result;
+}
+
+// Utf16String is a container of char16_t, e.g. std::u16string.
+template <Utf8Variant kVariant, class Result, class Utf16String>
+Result Utf8VariantBytesFromUtf16(const Utf16String& utf16_string,
+                                 ErrorPolicy policy = ErrorPolicy::kReplace,
+                                 size_t* units_transcoded = nullptr) {
+  using Utf16Iterator = decltype(utf16_string.begin());
+
+  Result result;
+  size_t transcoded = 0;
+  if constexpr (detail::IsContiguousIterator<Utf16Iterator>() &&
+                detail::IsContiguousContainer<Result>() &&
+                sizeof(typename Result::value_type) == 1) {
+    size_t size = static_cast<size_t>(
+        std::distance(utf16_string.begin(), utf16_string.end()));
+    if (size > 0) {
+      size_t length = 3 * size;
+      detail::ResizeAndOverwrite(result, length, [&](auto* data) {
+        size_t written = 0;
+        transcoded = detail::Utf16ToUtf8VariantContiguous(
+            kVariant,
+            reinterpret_cast<const char16_t*>(
+                detail::IteratorAddress(utf16_string.begin())),
+            size, reinterpret_cast<uint8_t*>(data), length, policy, &written);
+        return written;
+      });
+    }
+  } else {
+    transcoded = Utf16ToUtf8Variant<kVariant>(
+        utf16_string.begin(), utf16_string.end(), std::back_inserter(result),
+        policy);
+  }
+  if (units_transcoded != nullptr) {
+    *units_transcoded = transcoded;
+  }
+
+  return result;
+}
+
+template <class Result, class BytesContainer>
+Result Utf16StringFromWtf8(const BytesContainer& bytes,
+                           ErrorPolicy policy = ErrorPolicy::kReplace,
+                           size_t* bytes_transcoded = nullptr) {
+  return Utf16StringFromUtf8Variant<Utf8Variant::kWtf8, Result>(
+      bytes, policy, bytes_transcoded);
+}
+
+template <class Result, class BytesContainer>
+Result Utf16StringFromCesu8(const BytesContainer& bytes,
+                            ErrorPolicy policy = ErrorPolicy::kReplace,
+                            size_t* bytes_transcoded = nullptr) {
+  return Utf16StringFromUtf8Variant<Utf8Variant::kCesu8, Result>(
+      bytes, policy, bytes_transcoded);
+}
+
+template <class Result, class BytesContainer>
+Result Utf16StringFromModifiedUtf8(const BytesContainer& bytes,
+                                   ErrorPolicy policy = ErrorPolicy::kReplace,
+                                   size_t* bytes_transcoded = nullptr) {
+  return Utf16StringFromUtf8Variant<Utf8Variant::kModifiedUtf8, Result>(
+      bytes, policy, bytes_transcoded);
+}
+
+template <class Result, class Utf16String>
+Result Wtf8BytesFromUtf16(const Utf16String& utf16_string,
+                          ErrorPolicy policy = ErrorPolicy::kReplace,
+                          size_t* units_transcoded = nullptr) {
+  return Utf8VariantBytesFromUtf16<Utf8Variant::kWtf8, Result>(
+      utf16_string, policy, units_transcoded);
+}
+
+template <class Result, class Utf16String>
+Result Cesu8BytesFromUtf16(const Utf16String& utf16_string,
+                           ErrorPolicy policy = ErrorPolicy::kReplace,
+                           size_t* units_transcoded = nullptr) {
+  return Utf8VariantBytesFromUtf16<Utf8Variant::kCesu8, Result>(
+      utf16_string, policy, units_transcoded);
+}
+
+template <class Result, class Utf16String>
+Result ModifiedUtf8BytesFromUtf16(const Utf16String& utf16_string,
+                                  ErrorPolicy policy = ErrorPolicy::kReplace,
+                                  size_t* units_transcoded = nullptr) {
+  return Utf8VariantBytesFromUtf16<Utf8Variant::kModifiedUtf8, Result>(
+      utf16_string, policy, units_transcoded);
+}
+
+}  // namespace unicpp
@@ -3,6 +3,10 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 namespace unicpp {
 
@@ -19,14 +23,193 @@ enum class ErrorPolicy {
   kStop,
 };
 
-inline bool IsSurrogate(char32_t ch) {
+// Encodings of byte sequences, for the functions choosing one at runtime.
+enum class Encoding {
+  kUtf8,
+  kUtf16Le,
+  kUtf16Be,
+  kLatin1,
+};
+
+// Encodings of UTF-16 derived from UTF-8 which encode surrogates as 3-byte
+// sequences, see utf8_variants.h.
+enum class Utf8Variant {
+  kWtf8,
+  kCesu8,
+  kModifiedUtf8,
+};
+
+// The outcome of decoding or transcoding into a fixed-size output buffer, see
+// Transcode() and Utf8StreamDecoder.
+enum class TranscodeStatus {
+  // all the input is transcoded
+  kDone,
+  // the next character doesn't fit in the output
+  kOutputFull,
+  // the input ends inside a character, which is left unconsumed to be passed
+  // again with the following input
+  kNeedMoreInput,
+  // ErrorPolicy::kStop only: the input is invalid at the `consumed` offset,
+  // or has a character the output encoding can't represent
+  kError,
+};
+
+struct TranscodeResult {
+  TranscodeStatus status;
+  // input and output values, bytes or characters
+  size_t consumed;
+  size_t produced;
+};
+
+constexpr bool IsSurrogate(char32_t ch) {
   return ch >= kMinSurrogate && ch <= kMaxSurrogate;
 }
 
-inline bool IsValidCharacter(char32_t ch) {
+constexpr bool IsValidCharacter(char32_t ch) {
   return ch <= kMaxValidCharacter && !IsSurrogate(ch);
 }
 
+// Defined if constant evaluation can be told apart from runtime. Otherwise
+// the functions taking contiguous input (or output) can only run at runtime,
+// except for the literals of literals.h.
+#if defined(__cpp_lib_is_constant_evaluated)
+#define UNICPP_HAS_CONSTANT_EVALUATED 1
+#elif defined(__clang__)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define UNICPP_HAS_CONSTANT_EVALUATED 1
+#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || \
+    (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define UNICPP_HAS_CONSTANT_EVALUATED 1
+#endif
+
+namespace detail {
+
+// True during constant evaluation, where the vectorized and memcpy-based
+// paths can't run. See UNICPP_HAS_CONSTANT_EVALUATED.
+constexpr bool IsConstantEvaluated() {
+#if defined(__cpp_lib_is_constant_evaluated)
+  return std::is_constant_evaluated();
+#elif defined(UNICPP_HAS_CONSTANT_EVALUATED)
+  return __builtin_is_constant_evaluated();
+#else
+  return false;
+#endif
+}
+
+template <class Char>
+constexpr bool IsCharType() {
+  return std::is_same_v<Char, char> || std::is_same_v<Char, wchar_t> ||
+#if defined(__cpp_char8_t)
+         std::is_same_v<Char, char8_t> ||
+#endif
+         std::is_same_v<Char, char16_t> || std::is_same_v<Char, char32_t>;
+}
+
+template <class Iterator, class = void>
+struct IteratorCategory {
+  using type = void;
+};
+
+template <class Iterator>
+struct IteratorCategory<
+    Iterator,
+    std::void_t<typename std::iterator_traits<Iterator>::iterator_category>> {
+  using type = typename std::iterator_traits<Iterator>::iterator_category;
+};
+
+template <class Iterator, class Category>
+constexpr bool HasIteratorCategory() {
+  return std::is_base_of_v<Category, typename IteratorCategory<Iterator>::type>;
+}
+
+// True if elements of the underlying sequence are stored contiguously in
+// memory, so the iterator can be converted to a pointer.
+template <class Iterator>
+constexpr bool IsContiguousIterator() {
+  using Value = typename std::iterator_traits<Iterator>::value_type;
+  if constexpr (std::is_pointer_v<Iterator>) {
+    return true;
+#if defined(__cpp_lib_concepts)
+  } else if constexpr (std::contiguous_iterator<Iterator>) {
+    return true;
+#endif
+  } else if constexpr (std::is_same_v<Value, bool> || std::is_void_v<Value>) {
+    return false;
+  } else if constexpr (std::is_same_v<Iterator,
+                                      typename std::vector<Value>::iterator> ||
+                       std::is_same_v<
+                           Iterator,
+                           typename std::vector<Value>::const_iterator>) {
+    return true;
+  } else if constexpr (IsCharType<Value>()) {
+    return std::is_same_v<Iterator,
+                          typename std::basic_string<Value>::iterator> ||
+           std::is_same_v<Iterator,
+                          typename std::basic_string<Value>::const_iterator> ||
+           std::is_same_v<
+               Iterator, typename std::basic_string_view<Value>::const_iterator>;
+  } else {
+    return false;
+  }
+}
+
+template <class Container>
+constexpr bool IsContiguousContainer() {
+  return IsContiguousIterator<typename Container::iterator>();
+}
+
+template <class Container>
+struct IsBasicString : std::false_type {};
+
+template <class Char, class Traits, class Allocator>
+struct IsBasicString<std::basic_string<Char, Traits, Allocator>>
+    : std::true_type {};
+
+// Resizes `container` to `size` elements, lets `fill` overwrite them given
+// a pointer to the first one and shrinks the container to the number of
+// elements `fill` returns. Strings aren't zero-initialized before that if the
+// standard library supports it.
+template <class Container, class Fill>
+void ResizeAndOverwrite(Container& container, size_t size, Fill fill) {
+#if defined(__cpp_lib_string_resize_and_overwrite)
+  if constexpr (IsBasicString<Container>::value) {
+    container.resize_and_overwrite(
+        size, [&](typename Container::value_type* data, size_t) {
+          return fill(data);
+        });
+    return;
+  }
+#endif
+  container.resize(size);
+  container.resize(fill(container.data()));
+}
+
+// True if [iter, end) has at least `count` elements. Takes O(count) time for
+// iterators which aren't random access.
+template <class Iterator>
+constexpr bool HasAtLeast(Iterator iter, Iterator end, std::ptrdiff_t count) {
+  if constexpr (HasIteratorCategory<Iterator,
+                                    std::random_access_iterator_tag>()) {
+    return end - iter >= count;
+  } else {
+    for (; count > 0; --count, ++iter) {
+      if (iter == end) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+// Same as std::to_address, but `iter` has to be dereferenceable.
+template <class Iterator>
+constexpr auto IteratorAddress(Iterator iter) {
+  return std::addressof(*iter);
+}
+
+}  // namespace detail
+
 template <class Container>
 class CheckedBackInsertIterator {
 public:
@@ -0,0 +1,434 @@
+#pragma once
+
+#include "utf16.h"
+#include "utf8.h"
+#include "utf_common.h"
+
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_ranges)
+
+#include <concepts>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include <stdint.h>
+
+namespace unicpp {
+namespace detail {
+
+// Codecs of the views below. Read() consumes one character of the input
+// advancing `iter` past it, or past a single invalid value returning
+// kInvalidCharacter, ReadBack() does the same backwards. The character is
+// produced as Length() output values, Unit() returns one of them.
+
+struct Utf8DecodeCodec {
+  using value_type = char32_t;
+
+  template <class Iterator, class Sentinel>
+  static char32_t Read(Iterator& iter, const Sentinel& end) {
+    return Utf8DecodeCharacter(iter, end);
+  }
+
+  template <class Iterator>
+  static char32_t ReadBack(const Iterator& begin, Iterator& iter) {
+    return Utf8PrevCodePoint(begin, iter);
+  }
+
+  static size_t Length(char32_t) {
+    return 1;
+  }
+
+  static char32_t Unit(char32_t ch, size_t) {
+    return ch;
+  }
+};
+
+struct Utf16DecodeCodec {
+  using value_type = char32_t;
+
+  template <class Iterator, class Sentinel>
+  static char32_t Read(Iterator& iter, const Sentinel& end) {
+    char32_t unit0 = static_cast<uint16_t>(*iter);
+    ++iter;
+    if (!IsSurrogate(unit0)) {
+      return unit0;
+    }
+    // the unit following an unpaired high surrogate is decoded again
+    if (unit0 >= 0xDC00 || iter == end) {
+      return kInvalidCharacter;
+    }
+    char32_t unit1 = static_cast<uint16_t>(*iter);
+    if (unit1 < 0xDC00 || unit1 > kMaxSurrogate) {
+      return kInvalidCharacter;
+    }
+    ++iter;
+    return 0x10000 + (((unit0 - 0xD800) << 10) | (unit1 - 0xDC00));
+  }
+
+  template <class Iterator>
+  static char32_t ReadBack(const Iterator& begin, Iterator& iter) {
+    return Utf16PrevCodePoint(begin, iter);
+  }
+
+  static size_t Length(char32_t) {
+    return 1;
+  }
+
+  static char32_t Unit(char32_t ch, size_t) {
+    return ch;
+  }
+};
+
+template <class Iterator, class Sentinel>
+char32_t ReadCharacter(Iterator& iter, const Sentinel&) {
+  char32_t ch = static_cast<char32_t>(*iter);
+  ++iter;
+  return IsValidCharacter(ch) ? ch : kInvalidCharacter;
+}
+
+template <class Iterator>
+char32_t ReadCharacterBack(const Iterator&, Iterator& iter) {
+  --iter;
+  char32_t ch = static_cast<char32_t>(*iter);
+  return IsValidCharacter(ch) ? ch : kInvalidCharacter;
+}
+
+struct Utf8EncodeCodec {
+  using value_type = uint8_t;
+
+  template <class Iterator, class Sentinel>
+  static char32_t Read(Iterator& iter, const Sentinel& end) {
+    return ReadCharacter(iter, end);
+  }
+
+  template <class Iterator>
+  static char32_t ReadBack(const Iterator& begin, Iterator& iter) {
+    return ReadCharacterBack(begin, iter);
+  }
+
+  static size_t Length(char32_t ch) {
+    return ch <= 0x7F ? 1 : ch <= 0x7FF ? 2 : ch <= 0xFFFF ? 3 : 4;
+  }
+
+  static uint8_t Unit(char32_t ch, size_t index) {
+    size_t length = Length(ch);
+    if (length == 1) {
+      return static_cast<uint8_t>(ch);
+    }
+    uint8_t payload = static_cast<uint8_t>(ch >> (6 * (length - 1 - index)));
+    if (index == 0) {
+      return static_cast<uint8_t>((0xF00 >> length) | payload);
+    }
+    return static_cast<uint8_t>(0x80 | (payload & 0x3F));
+  }
+};
+
+struct Utf16EncodeCodec {
+  using value_type = char16_t;
+
+  template <class Iterator, class Sentinel>
+  static char32_t Read(Iterator& iter, const Sentinel& end) {
+    return ReadCharacter(iter, end);
+  }
+
+  template <class Iterator>
+  static char32_t ReadBack(const Iterator& begin, Iterator& iter) {
+    return ReadCharacterBack(begin, iter);
+  }
+
+  static size_t Length(char32_t ch) {
+    return ch > 0xFFFF ? 2 : 1;
+  }
+
+  static char16_t Unit(char32_t ch, size_t index) {
+    if (ch <= 0xFFFF) {
+      return static_cast<char16_t>(ch);
+    }
+    char32_t offset = ch - 0x10000;
+    return static_cast<char16_t>(index == 0 ? 0xD800 + (offset >> 10)
+                                            : 0xDC00 + (offset & 0x3FF));
+  }
+};
+
+// View of `V` decoded or encoded by `Codec`. Iterators hold positions in the
+// underlying range and the current character, so they are cheap to copy.
+// They are bidirectional if the underlying range is bidirectional and common.
+template <std::ranges::forward_range V, class Codec>
+  requires std::ranges::view<V>
+class CodecView : public std::ranges::view_interface<CodecView<V, Codec>> {
+public:
+  template <bool kConst>
+  class Iterator {
+    using Base = std::conditional_t<kConst, const V, V>;
+    using BaseIterator = std::ranges::iterator_t<Base>;
+    using BaseSentinel = std::ranges::sentinel_t<Base>;
+
+    static constexpr bool kBidirectional =
+        std::ranges::bidirectional_range<Base> &&
+        std::ranges::common_range<Base>;
+
+  public:
+    using iterator_concept =
+        std::conditional_t<kBidirectional, std::bidirectional_iterator_tag,
+                           std::forward_iterator_tag>;
+    // dereferencing returns a value, so it isn't a legacy forward iterator
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename Codec::value_type;
+    using difference_type = std::ranges::range_difference_t<Base>;
+
+    Iterator() = default;
+
+    Iterator(BaseIterator begin, BaseIterator current, BaseSentinel end,
+             ErrorPolicy policy)
+        : begin_(std::move(begin))
+        , current_(std::move(current))
+        , end_(std::move(end))
+        , policy_(policy) {
+      Read();
+    }
+
+    value_type operator*() const {
+      return Codec::Unit(value_, index_);
+    }
+
+    Iterator& operator++() {
+      if (++index_ == Codec::Length(value_)) {
+        current_ = next_;
+        Read();
+      }
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator tmp(*this);
+      operator++();
+      return tmp;
+    }
+
+    Iterator& operator--()
+      requires kBidirectional
+    {
+      if (index_ > 0) {
+        --index_;
+        return *this;
+      }
+      // with ErrorPolicy::kStop the view ends before the first invalid
+      // sequence, so there are none to stop at
+      BaseIterator prev = current_;
+      char32_t value = Codec::ReadBack(begin_, prev);
+      while (value == kInvalidCharacter && policy_ == ErrorPolicy::kSkip) {
+        value = Codec::ReadBack(begin_, prev);
+      }
+      next_ = std::move(current_);
+      current_ = std::move(prev);
+      value_ = value == kInvalidCharacter ? kReplacementCharacter : value;
+      index_ = Codec::Length(value_) - 1;
+      return *this;
+    }
+
+    Iterator operator--(int)
+      requires kBidirectional
+    {
+      Iterator tmp(*this);
+      operator--();
+      return tmp;
+    }
+
+    // The position of the current character in the underlying range.
+    const BaseIterator& base() const& {
+      return current_;
+    }
+
+    friend bool operator==(const Iterator& a, const Iterator& b) {
+      return a.current_ == b.current_ && a.index_ == b.index_;
+    }
+
+    friend bool operator==(const Iterator& iter, std::default_sentinel_t) {
+      return iter.current_ == iter.end_;
+    }
+
+  private:
+    void Read() {
+      index_ = 0;
+      while (current_ != end_) {
+        next_ = current_;
+        value_ = Codec::Read(next_, end_);
+        if (value_ != kInvalidCharacter) {
+          return;
+        }
+        if (policy_ == ErrorPolicy::kReplace) {
+          value_ = kReplacementCharacter;
+          return;
+        } else if (policy_ == ErrorPolicy::kStop) {
+          // O(1) for sized ranges
+          current_ = std::ranges::next(current_, end_);
+          return;
+        }
+        current_ = next_;
+      }
+    }
+
+    BaseIterator begin_ = BaseIterator();
+    BaseIterator current_ = BaseIterator();
+    BaseIterator next_ = BaseIterator();
+    BaseSentinel end_ = BaseSentinel();
+    char32_t value_ = 0;
+    size_t index_ = 0;
+    ErrorPolicy policy_ = ErrorPolicy::kReplace;
+  };
+
+  CodecView()
+    requires std::default_initializable<V>
+  = default;
+
+  explicit CodecView(V base, ErrorPolicy policy = ErrorPolicy::kReplace)
+      : base_(std::move(base))
+      , policy_(policy) {
+    if constexpr (std::ranges::common_range<V>) {
+      if (policy_ == ErrorPolicy::kStop) {
+        // Iterating backwards from the end must not pass the first invalid
+        // sequence, so the view is cut there.
+        auto iter = std::ranges::begin(base_);
+        auto end = std::ranges::end(base_);
+        while (iter != end) {
+          auto next = iter;
+          if (Codec::Read(next, end) == kInvalidCharacter) {
+            break;
+          }
+          iter = next;
+        }
+        stop_ = std::ranges::distance(std::ranges::begin(base_), iter);
+      }
+    }
+  }
+
+  V base() const&
+    requires std::copy_constructible<V>
+  {
+    return base_;
+  }
+
+  V base() && {
+    return std::move(base_);
+  }
+
+  Iterator<false> begin() {
+    return {std::ranges::begin(base_), std::ranges::begin(base_), End(base_),
+            policy_};
+  }
+
+  Iterator<true> begin() const
+    requires std::ranges::forward_range<const V>
+  {
+    return {std::ranges::begin(base_), std::ranges::begin(base_), End(base_),
+            policy_};
+  }
+
+  auto end() {
+    if constexpr (std::ranges::common_range<V>) {
+      return Iterator<false>(std::ranges::begin(base_), End(base_),
+                             End(base_), policy_);
+    } else {
+      return std::default_sentinel;
+    }
+  }
+
+  auto end() const
+    requires std::ranges::forward_range<const V>
+  {
+    if constexpr (std::ranges::common_range<const V>) {
+      return Iterator<true>(std::ranges::begin(base_), End(base_), End(base_),
+                            policy_);
+    } else {
+      return std::default_sentinel;
+    }
+  }
+
+private:
+  // O(1) for random access ranges
+  template <class Base>
+  auto End(Base& base) const {
+    if constexpr (std::ranges::common_range<Base>) {
+      if (stop_ >= 0) {
+        return std::ranges::next(std::ranges::begin(base), stop_);
+      }
+    }
+    return std::ranges::end(base);
+  }
+
+  V base_ = V();
+  ErrorPolicy policy_ = ErrorPolicy::kReplace;
+  // the length of the valid prefix of `base_` with ErrorPolicy::kStop
+  std::ranges::range_difference_t<V> stop_ = -1;
+};
+
+// Range adaptor object, `range | adaptor` and `adaptor(range)` make the view
+// with ErrorPolicy::kReplace, `adaptor(policy)` is an adaptor with another
+// error policy.
+template <class Codec, template <class> class InputAllowed>
+struct CodecAdaptor {
+  ErrorPolicy policy = ErrorPolicy::kReplace;
+
+  constexpr CodecAdaptor operator()(ErrorPolicy error_policy) const {
+    return {error_policy};
+  }
+
+  template <std::ranges::viewable_range R>
+    requires std::ranges::forward_range<R> &&
+             InputAllowed<std::ranges::range_value_t<R>>::value
+  auto operator()(R&& range) const {
+    return CodecView<std::views::all_t<R>, Codec>(
+        std::views::all(std::forward<R>(range)), policy);
+  }
+
+  template <std::ranges::viewable_range R>
+    requires std::ranges::forward_range<R> &&
+             InputAllowed<std::ranges::range_value_t<R>>::value
+  friend auto operator|(R&& range, const CodecAdaptor& adaptor) {
+    return adaptor(std::forward<R>(range));
+  }
+};
+
+template <class Value>
+using IsByte = std::bool_constant<sizeof(Value) == 1>;
+
+template <class Value>
+using IsUtf16Unit = std::bool_constant<sizeof(Value) == 2>;
+
+template <class Value>
+using IsCharacter = std::is_convertible<Value, char32_t>;
+
+}  // namespace detail
+
+namespace views {
+
+// UTF-8 bytes to characters.
+inline constexpr detail::CodecAdaptor<detail::Utf8DecodeCodec, detail::IsByte>
+    utf8_decode;
+
+// Characters to UTF-8 bytes.
+inline constexpr detail::CodecAdaptor<detail::Utf8EncodeCodec,
+                                      detail::IsCharacter>
+    utf8_encode;
+
+// UTF-16 code units to characters.
+inline constexpr detail::CodecAdaptor<detail::Utf16DecodeCodec,
+                                      detail::IsUtf16Unit>
+    utf16_decode;
+
+// Characters to UTF-16 code units.
+inline constexpr detail::CodecAdaptor<detail::Utf16EncodeCodec,
+                                      detail::IsCharacter>
+    utf16_encode;
+
+}  // namespace views
+}  // namespace unicpp
+
+#endif  // defined(__cpp_lib_ranges)
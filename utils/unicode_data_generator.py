@@ -1,6 +1,7 @@
 # -*- coding: utf-8 -*-
 
 import csv
+import sys
 import urllib.request
 
 UNICODE_DATA_FILE_URL = 'https://www.unicode.org/Public/13.0.0/ucd/UnicodeData.txt'
@@ -50,12 +51,13 @@ def generate_case_maps():
             lower = int('0x' + lower, 16)
             lowers[code] = lower
 
-    print('const std::unordered_map<char32_t, char32_t> kUpperMap = {')
+    print('// Case mappings sorted by the character.')
+    print('inline constexpr std::pair<char32_t, char32_t> kUpperTable[] = {')
     for (code, upper) in sorted(uppers.items()):
         print(f'    {{ {hex(code)}, {hex(upper)} }},')
     print('};')
     print()
-    print('const std::unordered_map<char32_t, char32_t> kLowerMap = {')
+    print('inline constexpr std::pair<char32_t, char32_t> kLowerTable[] = {')
     for (code, lower) in sorted(lowers.items()):
         print(f'    {{ {hex(code)}, {hex(lower)} }},')
     print('};')
@@ -81,8 +83,10 @@ def generate_general_category_map():
             range_category = category
     category_ranges.append((0x110000, range_category))
 
-    print(
-        'const std::map<char32_t, GeneralCategory> kGeneralCategoryRangeMap = {')
+    print('// Ranges of characters with the same property, each entry holds the end of a')
+    print('// range, exclusive, and the property of the characters in it.')
+    print('inline constexpr std::pair<char32_t, GeneralCategory>')
+    print('    kGeneralCategoryRanges[] = {')
     for (range_beg, range_category) in sorted(category_ranges):
         print(f'    {{ {hex(range_beg)}, {range_category} }},')
     print('};')
@@ -99,8 +103,8 @@ def generate_numeric_type_map():
         for code in range(beg, end):
             numeric_types[code] = 'NumericType::' + record['type'].strip()
 
-    print(
-        'const std::unordered_map<char32_t, NumericType> kNumericTypeMap = {')
+    print('// Numeric types of characters sorted by the character.')
+    print('inline constexpr std::pair<char32_t, NumericType> kNumericTypeTable[] = {')
     for (code, numeric_type) in sorted(numeric_types.items()):
         print(f'    {{ {hex(code)}, {numeric_type} }},')
     print('};')
@@ -126,8 +130,7 @@ def generate_bidi_class_map():
             range_class = bidiclass
     class_ranges.append((0x110000, range_class))
 
-    print(
-        'const std::map<char32_t, BidiClass> kBidiClassRangeMap = {')
+    print('inline constexpr std::pair<char32_t, BidiClass> kBidiClassRanges[] = {')
     for (range_beg, range_class) in sorted(class_ranges):
         print(f'    {{ {hex(range_beg)}, {range_class} }},')
     print('};')
@@ -165,17 +168,50 @@ def generate_decomposition_map():
     print()
 
 
-def main():
-    print('#include "unicode_data.h"')
-    print()
-    print('namespace unicpp {')
-    print()
+def generate_maps():
+    for (map_type, map_name, table_name) in (
+            ('std::unordered_map<char32_t, char32_t>', 'kUpperMap', 'kUpperTable'),
+            ('std::unordered_map<char32_t, char32_t>', 'kLowerMap', 'kLowerTable'),
+            ('std::map<char32_t, GeneralCategory>', 'kGeneralCategoryRangeMap',
+             'kGeneralCategoryRanges'),
+            ('std::unordered_map<char32_t, NumericType>', 'kNumericTypeMap',
+             'kNumericTypeTable'),
+            ('std::map<char32_t, BidiClass>', 'kBidiClassRangeMap',
+             'kBidiClassRanges')):
+        print(f'const {map_type} {map_name}(')
+        print(f'    std::begin({table_name}), std::end({table_name}));')
+        print()
+
 
-    generate_case_maps()
-    generate_general_category_map()
-    generate_numeric_type_map()
-    generate_bidi_class_map()
-    generate_decomposition_map()
+# Prints unicode_data.cpp, or unicode_tables.h with the constexpr tables when
+# run with --tables.
+def main():
+    if '--tables' in sys.argv[1:]:
+        print('#pragma once')
+        print()
+        print('#include "unicode_data.h"')
+        print()
+        print('#include <utility>')
+        print()
+        print('namespace unicpp {')
+        print()
+
+        generate_case_maps()
+        generate_general_category_map()
+        generate_bidi_class_map()
+        generate_numeric_type_map()
+    else:
+        print('#include "unicode_data.h"')
+        print()
+        print('#include "unicode_tables.h"')
+        print()
+        print('#include <iterator>')
+        print()
+        print('namespace unicpp {')
+        print()
+
+        generate_maps()
+        generate_decomposition_map()
 
     print('}  // namespace unicpp')
 
@@ -0,0 +1,155 @@
+// Transcodes a file between UTF-8, UTF-16LE, UTF-16BE and Latin-1.
+//
+// usage: unicpp_iconv -f FROM -t TO [--errors=replace|skip|stop]
+//                     [--threads=N] [--stats] INPUT OUTPUT
+
+#include "unicpp/transcode_file.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <errno.h>
+#include <sys/stat.h>
+
+namespace {
+
+constexpr char kUsage[] =
+    "usage: unicpp_iconv -f FROM -t TO [--errors=replace|skip|stop]\n"
+    "                    [--threads=N] [--stats] INPUT OUTPUT\n"
+    "\n"
+    "Encodings: utf-8, utf-16le, utf-16be, latin1 (iso-8859-1).\n"
+    "Invalid input is replaced with U+FFFD ('?' in Latin-1) by default.\n"
+    "--threads=0 uses all hardware threads, the default is 1.\n"
+    "--stats prints the sizes, the error count and the speed to stderr.\n";
+
+bool ParseEncoding(std::string name, unicpp::Encoding* encoding) {
+  std::transform(name.begin(), name.end(), name.begin(),
+                 [](unsigned char ch) { return std::tolower(ch); });
+  if (name == "utf-8" || name == "utf8") {
+    *encoding = unicpp::Encoding::kUtf8;
+  } else if (name == "utf-16le" || name == "utf16le") {
+    *encoding = unicpp::Encoding::kUtf16Le;
+  } else if (name == "utf-16be" || name == "utf16be") {
+    *encoding = unicpp::Encoding::kUtf16Be;
+  } else if (name == "latin1" || name == "latin-1" || name == "iso-8859-1" ||
+             name == "iso8859-1") {
+    *encoding = unicpp::Encoding::kLatin1;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool ParsePolicy(const std::string& name, unicpp::ErrorPolicy* policy) {
+  if (name == "replace") {
+    *policy = unicpp::ErrorPolicy::kReplace;
+  } else if (name == "skip") {
+    *policy = unicpp::ErrorPolicy::kSkip;
+  } else if (name == "stop") {
+    *policy = unicpp::ErrorPolicy::kStop;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool ParseThreads(const std::string& value, size_t* num_threads) {
+  if (value.empty() ||
+      value.find_first_not_of("0123456789") != std::string::npos) {
+    return false;
+  }
+  *num_threads = std::strtoul(value.c_str(), nullptr, 10);
+  return true;
+}
+
+int UsageError(const char* message) {
+  std::fprintf(stderr, "unicpp_iconv: %s\n\n%s", message, kUsage);
+  return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  unicpp::Encoding from = unicpp::Encoding::kUtf8;
+  unicpp::Encoding to = unicpp::Encoding::kUtf8;
+  bool has_from = false;
+  bool has_to = false;
+  unicpp::ErrorPolicy policy = unicpp::ErrorPolicy::kReplace;
+  size_t num_threads = 1;
+  bool print_stats = false;
+  std::string paths[2];
+  int num_paths = 0;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "-h" || arg == "--help") {
+      std::fputs(kUsage, stdout);
+      return 0;
+    } else if (arg == "-f" || arg == "-t") {
+      if (i + 1 == argc) {
+        return UsageError("missing encoding");
+      }
+      bool is_from = arg == "-f";
+      if (!ParseEncoding(argv[++i], is_from ? &from : &to)) {
+        return UsageError("unknown encoding");
+      }
+      (is_from ? has_from : has_to) = true;
+    } else if (arg.rfind("--errors=", 0) == 0) {
+      if (!ParsePolicy(arg.substr(std::strlen("--errors=")), &policy)) {
+        return UsageError("unknown error policy");
+      }
+    } else if (arg.rfind("--threads=", 0) == 0) {
+      if (!ParseThreads(arg.substr(std::strlen("--threads=")),
+                        &num_threads)) {
+        return UsageError("invalid number of threads");
+      }
+    } else if (arg == "--stats") {
+      print_stats = true;
+    } else if (num_paths < 2 && (arg.empty() || arg[0] != '-')) {
+      paths[num_paths++] = arg;
+    } else {
+      return UsageError("unexpected argument");
+    }
+  }
+  if (!has_from || !has_to || num_paths != 2) {
+    return UsageError("missing arguments");
+  }
+
+  struct stat input_stat;
+  if (::stat(paths[0].c_str(), &input_stat) != 0) {
+    std::fprintf(stderr, "unicpp_iconv: %s: %s\n", paths[0].c_str(),
+                 std::strerror(errno));
+    return 1;
+  }
+  size_t input_size = static_cast<size_t>(input_stat.st_size);
+
+  unicpp::TranscodeFileStats stats;
+  auto start = std::chrono::steady_clock::now();
+  if (!unicpp::TranscodeFile(paths[0], paths[1], from, to, policy,
+                             num_threads, &stats, print_stats)) {
+    std::fprintf(stderr, "unicpp_iconv: %s\n", std::strerror(errno));
+    return 1;
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+
+  if (print_stats) {
+    std::fprintf(stderr,
+                 "read %zu bytes, wrote %zu bytes, %zu errors\n"
+                 "%.3f s, %.1f MB/s\n",
+                 stats.bytes_read, stats.bytes_written, stats.errors, seconds,
+                 seconds > 0 ? input_size / seconds / 1e6 : 0.0);
+  }
+  if (stats.bytes_read < input_size) {
+    std::fprintf(stderr, "unicpp_iconv: stopped at an error at byte %zu\n",
+                 stats.bytes_read);
+    return 1;
+  }
+  return 0;
+}